@@ -0,0 +1,924 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef API_BASE_CONTAINERS_UNORDERED_FLAT_MAP_H
+#define API_BASE_CONTAINERS_UNORDERED_FLAT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>  // placement new
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define BASE_FLAT_TABLE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define BASE_FLAT_TABLE_NEON
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <base/containers/allocator.h>
+#include <base/containers/pair.h>
+#include <base/containers/string.h>
+#include <base/containers/string_view.h>
+#include <base/containers/type_traits.h>
+#include <base/containers/unordered_map.h>
+#include <base/namespace.h>
+#include <base/util/hash.h>
+#include <base/util/log.h>
+
+BASE_BEGIN_NAMESPACE()
+/*
+ * Open addressing hash tables in the style of SwissTable.
+ * Values are stored inline in a single slot array, next to it is an array of one control byte per slot. A control
+ * byte is either empty, deleted or the low 7 bits of the hash of a full slot. Lookups probe groups of 16 control
+ * bytes at a time (with SSE2 / NEON when available) and compare keys only for slots whose 7 bit hash matches.
+ * Unlike unordered_map inserting and rehashing move the values, so pointers and iterators are invalidated by any
+ * insertion which grows the table. Erasing doesn't move other values.
+ */
+namespace Detail {
+constexpr uint8_t FLAT_TABLE_EMPTY = 0x80U;
+constexpr uint8_t FLAT_TABLE_DELETED = 0xFEU;
+// Control byte after the last slot, stops iteration.
+constexpr uint8_t FLAT_TABLE_SENTINEL = 0xFFU;
+constexpr size_t FLAT_TABLE_GROUP_WIDTH = 16U;
+
+inline uint32_t FlatTableCountTrailingZeros(uint64_t value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index = 0U;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+}
+
+// Slots of a group matching a query, each slot is represented by 1 << Shift bits.
+template <uint32_t Shift>
+class FlatTableBitMask {
+public:
+    explicit constexpr FlatTableBitMask(uint64_t mask) noexcept : mask_(mask) {}
+
+    explicit constexpr operator bool() const noexcept
+    {
+        return mask_ != 0U;
+    }
+
+    uint32_t Lowest() const noexcept
+    {
+        return FlatTableCountTrailingZeros(mask_) >> Shift;
+    }
+
+    constexpr void ClearLowest() noexcept
+    {
+        mask_ &= (mask_ - 1U);
+    }
+
+private:
+    uint64_t mask_;
+};
+
+class FlatTableGroup {
+public:
+#if defined(BASE_FLAT_TABLE_SSE2)
+    using BitMask = FlatTableBitMask<0U>;
+
+    explicit FlatTableGroup(const uint8_t* ctrl) noexcept
+        : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+    {}
+
+    BitMask Match(uint8_t h2) const noexcept
+    {
+        return BitMask(static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(static_cast<char>(h2))))));
+    }
+
+    BitMask MatchEmpty() const noexcept
+    {
+        return Match(FLAT_TABLE_EMPTY);
+    }
+
+    // Empty and deleted are the only control bytes with the high bit set inside a group.
+    BitMask MatchEmptyOrDeleted() const noexcept
+    {
+        return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(ctrl_)));
+    }
+
+private:
+    __m128i ctrl_;
+#elif defined(BASE_FLAT_TABLE_NEON)
+    // Lanes are narrowed to 4 bits each, only the highest bit of each nibble is kept.
+    using BitMask = FlatTableBitMask<2U>;
+
+    explicit FlatTableGroup(const uint8_t* ctrl) noexcept : ctrl_(vld1q_u8(ctrl)) {}
+
+    BitMask Match(uint8_t h2) const noexcept
+    {
+        return ToMask(vceqq_u8(ctrl_, vdupq_n_u8(h2)));
+    }
+
+    BitMask MatchEmpty() const noexcept
+    {
+        return Match(FLAT_TABLE_EMPTY);
+    }
+
+    BitMask MatchEmptyOrDeleted() const noexcept
+    {
+        return ToMask(vcgeq_u8(ctrl_, vdupq_n_u8(FLAT_TABLE_EMPTY)));
+    }
+
+private:
+    static BitMask ToMask(uint8x16_t lanes) noexcept
+    {
+        const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(lanes), 4);
+        return BitMask(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL);
+    }
+
+    uint8x16_t ctrl_;
+#else
+    using BitMask = FlatTableBitMask<0U>;
+
+    explicit FlatTableGroup(const uint8_t* ctrl) noexcept : ctrl_(ctrl) {}
+
+    BitMask Match(uint8_t h2) const noexcept
+    {
+        uint32_t mask = 0U;
+        for (uint32_t i = 0U; i < FLAT_TABLE_GROUP_WIDTH; ++i) {
+            mask |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+        }
+        return BitMask(mask);
+    }
+
+    BitMask MatchEmpty() const noexcept
+    {
+        return Match(FLAT_TABLE_EMPTY);
+    }
+
+    BitMask MatchEmptyOrDeleted() const noexcept
+    {
+        uint32_t mask = 0U;
+        for (uint32_t i = 0U; i < FLAT_TABLE_GROUP_WIDTH; ++i) {
+            mask |= static_cast<uint32_t>(ctrl_[i] >> 7U) << i;
+        }
+        return BitMask(mask);
+    }
+
+private:
+    const uint8_t* ctrl_;
+#endif
+};
+
+template <class Table, bool IsConst>
+class FlatTableIterator {
+public:
+    using base_container = Table;
+
+    using iterator_category = forward_iterator_tag;
+    using value_type = typename base_container::value_type;
+    using difference_type = ptrdiff_t;
+    using pointer = conditional_t<IsConst, typename base_container::const_pointer, typename base_container::pointer>;
+    using reference =
+        conditional_t<IsConst, typename base_container::const_reference, typename base_container::reference>;
+
+    constexpr FlatTableIterator() noexcept = default;
+
+    // Allow converting iterators to const iterators.
+    template <bool OtherConst, enable_if_t<IsConst && !OtherConst, int> = 0>
+    constexpr FlatTableIterator(const FlatTableIterator<Table, OtherConst>& other) noexcept
+        : ctrl_(other.ctrl_), slot_(other.slot_)
+    {}
+
+    reference operator*() const noexcept
+    {
+        BASE_ASSERT(slot_);
+        return *slot_;
+    }
+
+    pointer operator->() const noexcept
+    {
+        BASE_ASSERT(slot_);
+        return slot_;
+    }
+
+    FlatTableIterator& operator++() noexcept
+    {
+        ++ctrl_;
+        ++slot_;
+        SkipFree();
+        return *this;
+    }
+
+    FlatTableIterator operator++(int) noexcept
+    {
+        auto prev = *this;
+        ++*this;
+        return prev;
+    }
+
+    template <bool OtherConst>
+    constexpr bool operator==(const FlatTableIterator<Table, OtherConst>& other) const noexcept
+    {
+        return ctrl_ == other.ctrl_;
+    }
+
+    template <bool OtherConst>
+    constexpr bool operator!=(const FlatTableIterator<Table, OtherConst>& other) const noexcept
+    {
+        return ctrl_ != other.ctrl_;
+    }
+
+private:
+    friend Table;
+    friend class FlatTableIterator<Table, !IsConst>;
+
+    constexpr FlatTableIterator(const uint8_t* ctrl, pointer slot) noexcept : ctrl_(ctrl), slot_(slot) {}
+
+    void SkipFree() noexcept
+    {
+        while ((*ctrl_ & FLAT_TABLE_EMPTY) && (*ctrl_ != FLAT_TABLE_SENTINEL)) {
+            ++ctrl_;
+            ++slot_;
+        }
+    }
+
+    const uint8_t* ctrl_{nullptr};
+    pointer slot_{nullptr};
+};
+
+// Common implementation of unordered_flat_map and unordered_flat_set. Policy provides GetKey(const Value&) and
+// Transfer(Value* dst, Value* src) which move constructs dst from src and destroys src.
+template <class Key, class Value, class Policy>
+class FlatTable {
+public:
+    using key_type = Key;
+    using value_type = Value;
+    using size_type = size_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using iterator = FlatTableIterator<FlatTable, false>;
+    using const_iterator = FlatTableIterator<FlatTable, true>;
+    // Type used for lookups, strings can be looked up with string_views without creating a temporary string.
+    using key_view_type = conditional_t<is_same_v<Key, BASE_NS::string>, BASE_NS::string_view, const Key&>;
+
+    FlatTable() noexcept : allocator_(default_allocator()) {}
+    explicit FlatTable(allocator& alloc) noexcept : allocator_(alloc) {}
+    explicit FlatTable(size_t count) : allocator_(default_allocator())
+    {
+        reserve(count);
+    }
+
+    FlatTable(const FlatTable& other) : allocator_(other.allocator_)
+    {
+        CopyFrom(other);
+    }
+
+    FlatTable(FlatTable&& other) noexcept
+        : allocator_(other.allocator_), ctrl_(exchange(other.ctrl_, nullptr)), slots_(exchange(other.slots_, nullptr)),
+          capacity_(exchange(other.capacity_, 0U)), size_(exchange(other.size_, 0U)),
+          growthLeft_(exchange(other.growthLeft_, 0U))
+    {}
+
+    ~FlatTable()
+    {
+        Destroy();
+    }
+
+    FlatTable& operator=(const FlatTable& other)
+    {
+        if (&other != this) {
+            // Like vector the allocator isn't copied.
+            clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    FlatTable& operator=(FlatTable&& other) noexcept
+    {
+        if (&other != this) {
+            Destroy();
+            allocator_ = other.allocator_.get();
+            ctrl_ = exchange(other.ctrl_, nullptr);
+            slots_ = exchange(other.slots_, nullptr);
+            capacity_ = exchange(other.capacity_, 0U);
+            size_ = exchange(other.size_, 0U);
+            growthLeft_ = exchange(other.growthLeft_, 0U);
+        }
+        return *this;
+    }
+
+    allocator& getAllocator()
+    {
+        return allocator_.get();
+    }
+
+    const allocator& getAllocator() const
+    {
+        return allocator_.get();
+    }
+
+    // Changing the allocator moves the values to a new allocation.
+    void setAllocator(allocator& alloc)
+    {
+        if (&alloc != &allocator_.get()) {
+            if (capacity_) {
+                Resize(capacity_, &alloc);
+            } else {
+                allocator_ = alloc;
+            }
+        }
+    }
+
+    bool empty() const noexcept
+    {
+        return size_ == 0U;
+    }
+
+    size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    // Makes room for count values without rehashing.
+    void reserve(size_t count)
+    {
+        size_t newCapacity = FLAT_TABLE_GROUP_WIDTH;
+        while (MaxLoad(newCapacity) < count) {
+            newCapacity <<= 1U;
+        }
+        if (newCapacity > capacity_) {
+            Resize(newCapacity, nullptr);
+        }
+    }
+
+    // Destroys all the values, memory is kept.
+    void clear() noexcept
+    {
+        if (!capacity_) {
+            return;
+        }
+        if (size_) {
+            for (size_t i = 0U; i < capacity_; ++i) {
+                if (IsFull(ctrl_[i])) {
+                    DestroySlot(slots_ + i);
+                }
+            }
+        }
+        ClearToValue(ctrl_, capacity_, FLAT_TABLE_EMPTY, capacity_);
+        size_ = 0U;
+        growthLeft_ = MaxLoad(capacity_);
+    }
+
+    iterator begin() noexcept
+    {
+        if (!size_) {
+            return end();
+        }
+        iterator it{ctrl_, slots_};
+        it.SkipFree();
+        return it;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        if (!size_) {
+            return end();
+        }
+        const_iterator it{ctrl_, slots_};
+        it.SkipFree();
+        return it;
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    iterator end() noexcept
+    {
+        return iterator{ctrl_ + capacity_, slots_ + capacity_};
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator{ctrl_ + capacity_, slots_ + capacity_};
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    iterator find(key_view_type key)
+    {
+        const size_t index = FindIndex(key);
+        return (index != NPOS) ? iterator{ctrl_ + index, slots_ + index} : end();
+    }
+
+    const_iterator find(key_view_type key) const
+    {
+        const size_t index = FindIndex(key);
+        return (index != NPOS) ? const_iterator{ctrl_ + index, slots_ + index} : end();
+    }
+
+    bool contains(key_view_type key) const
+    {
+        return FindIndex(key) != NPOS;
+    }
+
+    size_t count(key_view_type key) const
+    {
+        return contains(key) ? 1U : 0U;
+    }
+
+    size_t erase(key_view_type key)
+    {
+        const size_t index = FindIndex(key);
+        if (index == NPOS) {
+            return 0U;
+        }
+        EraseIndex(index);
+        return 1U;
+    }
+
+    // Returns iterator to the value following the erased one.
+    iterator erase(const_iterator pos)
+    {
+        if (!pos.slot_ || (pos == end())) {
+            return end();
+        }
+        const auto index = static_cast<size_t>(pos.slot_ - slots_);
+        EraseIndex(index);
+        iterator it{ctrl_ + index, slots_ + index};
+        it.SkipFree();
+        return it;
+    }
+
+protected:
+    static constexpr size_t NPOS = ~size_t(0U);
+
+    struct HashParts {
+        // Probe start.
+        size_t h1;
+        // Stored in the control byte.
+        uint8_t h2;
+    };
+
+    // Many hash functions in base are identities, mix the bits so both the group index and the control byte are
+    // well distributed.
+    template <class K>
+    static HashParts Hash(const K& key)
+    {
+        constexpr uint64_t GOLDEN_RATIO_64 = 0x9E3779B97F4A7C15ULL;
+        constexpr uint32_t MIX_SHIFT = 32U;
+        constexpr uint32_t H2_BITS = 7U;
+        uint64_t h = hash(key) * GOLDEN_RATIO_64;
+        h ^= h >> MIX_SHIFT;
+        return {static_cast<size_t>(h >> H2_BITS), static_cast<uint8_t>(h & 0x7FU)};
+    }
+
+    static constexpr bool IsFull(uint8_t ctrl) noexcept
+    {
+        return (ctrl & FLAT_TABLE_EMPTY) == 0U;
+    }
+
+    // At most 7/8 of the slots are used, keeps probe sequences short and guarantees an empty slot.
+    static constexpr size_t MaxLoad(size_t capacity) noexcept
+    {
+        return capacity - (capacity / 8U);
+    }
+
+    // Groups are probed with triangular numbers, which visits every group as the group count is a power of two.
+    template <class K>
+    size_t FindIndex(const K& key) const
+    {
+        if (!size_) {
+            return NPOS;
+        }
+        const HashParts parts = Hash(key);
+        const size_t groupMask = (capacity_ / FLAT_TABLE_GROUP_WIDTH) - 1U;
+        size_t group = parts.h1 & groupMask;
+        for (size_t step = 1U;; ++step) {
+            const size_t first = group * FLAT_TABLE_GROUP_WIDTH;
+            const FlatTableGroup g(ctrl_ + first);
+            for (auto match = g.Match(parts.h2); match; match.ClearLowest()) {
+                const size_t index = first + match.Lowest();
+                if (Policy::GetKey(slots_[index]) == key) {
+                    return index;
+                }
+            }
+            if (g.MatchEmpty()) {
+                return NPOS;
+            }
+            group = (group + step) & groupMask;
+        }
+    }
+
+    size_t FindFirstNonFull(size_t h1) const
+    {
+        const size_t groupMask = (capacity_ / FLAT_TABLE_GROUP_WIDTH) - 1U;
+        size_t group = h1 & groupMask;
+        for (size_t step = 1U;; ++step) {
+            const size_t first = group * FLAT_TABLE_GROUP_WIDTH;
+            if (const auto match = FlatTableGroup(ctrl_ + first).MatchEmptyOrDeleted()) {
+                return first + match.Lowest();
+            }
+            group = (group + step) & groupMask;
+        }
+    }
+
+    // Returns index of the key and false, or index of a claimed slot and true. The caller must construct the value
+    // in a claimed slot.
+    template <class K>
+    pair<size_t, bool> FindOrPrepareInsert(const K& key)
+    {
+        const size_t found = FindIndex(key);
+        if (found != NPOS) {
+            return {found, false};
+        }
+        const HashParts parts = Hash(key);
+        size_t index = capacity_ ? FindFirstNonFull(parts.h1) : NPOS;
+        // A deleted slot can be reused without growing.
+        if ((index == NPOS) || (!growthLeft_ && (ctrl_[index] != FLAT_TABLE_DELETED))) {
+            Grow();
+            index = FindFirstNonFull(parts.h1);
+        }
+        if (ctrl_[index] == FLAT_TABLE_EMPTY) {
+            --growthLeft_;
+        }
+        ctrl_[index] = parts.h2;
+        ++size_;
+        return {index, true};
+    }
+
+    template <class... Args>
+    pair<iterator, bool> EmplaceKey(key_view_type key, Args&&... args)
+    {
+        const auto res = FindOrPrepareInsert(key);
+        if (res.second) {
+            ::new (slots_ + res.first) value_type(BASE_NS::forward<Args>(args)...);
+        }
+        return {iterator{ctrl_ + res.first, slots_ + res.first}, res.second};
+    }
+
+    void EraseIndex(size_t index)
+    {
+        DestroySlot(slots_ + index);
+        --size_;
+        // If the group already has an empty slot probes stop at this group anyway and the slot can become empty.
+        // Otherwise probes for keys placed past this group must continue, leave a tombstone.
+        const size_t first = index & ~(FLAT_TABLE_GROUP_WIDTH - 1U);
+        if (FlatTableGroup(ctrl_ + first).MatchEmpty()) {
+            ctrl_[index] = FLAT_TABLE_EMPTY;
+            ++growthLeft_;
+        } else {
+            ctrl_[index] = FLAT_TABLE_DELETED;
+        }
+    }
+
+    void Grow()
+    {
+        if (!capacity_) {
+            Resize(FLAT_TABLE_GROUP_WIDTH, nullptr);
+        } else if (size_ <= (MaxLoad(capacity_) / 2U)) {
+            // Mostly tombstones, rehash to the same size.
+            Resize(capacity_, nullptr);
+        } else {
+            Resize(capacity_ * 2U, nullptr);
+        }
+    }
+
+    // Moves the values to a new allocation of the given capacity, optionally from a different allocator.
+    void Resize(size_t newCapacity, allocator* newAllocator)
+    {
+        uint8_t* const oldCtrl = ctrl_;
+        value_type* const oldSlots = slots_;
+        const size_t oldCapacity = capacity_;
+        allocator& oldAllocator = allocator_.get();
+        if (newAllocator) {
+            allocator_ = *newAllocator;
+        }
+        Allocate(newCapacity);
+        for (size_t i = 0U; i < oldCapacity; ++i) {
+            if (IsFull(oldCtrl[i])) {
+                const HashParts parts = Hash(Policy::GetKey(oldSlots[i]));
+                const size_t index = FindFirstNonFull(parts.h1);
+                ctrl_[index] = parts.h2;
+                Policy::Transfer(slots_ + index, oldSlots + i);
+            }
+        }
+        growthLeft_ = MaxLoad(capacity_) - size_;
+        if (oldSlots && oldAllocator.free) {
+            oldAllocator.free(oldAllocator.instance, oldSlots);
+        }
+    }
+
+    // Slots and control bytes are in one allocation, slots first so they get the allocation's alignment.
+    void Allocate(size_t newCapacity)
+    {
+        const size_t ctrlOffset = newCapacity * sizeof(value_type);
+        const size_t ctrlSize = newCapacity + 1U;
+        slots_ = static_cast<value_type*>(allocator_.alloc(ctrlOffset + ctrlSize));
+        BASE_ASSERT(slots_);
+        ctrl_ = reinterpret_cast<uint8_t*>(slots_) + ctrlOffset;
+        ClearToValue(ctrl_, ctrlSize, FLAT_TABLE_EMPTY, newCapacity);
+        ctrl_[newCapacity] = FLAT_TABLE_SENTINEL;
+        capacity_ = newCapacity;
+        growthLeft_ = MaxLoad(newCapacity);
+    }
+
+    void Destroy()
+    {
+        if (slots_) {
+            clear();
+            allocator_.free(slots_);
+            slots_ = nullptr;
+            ctrl_ = nullptr;
+            capacity_ = 0U;
+            growthLeft_ = 0U;
+        }
+    }
+
+    void CopyFrom(const FlatTable& other)
+    {
+        reserve(other.size_);
+        for (size_t i = 0U; i < other.capacity_; ++i) {
+            if (IsFull(other.ctrl_[i])) {
+                const auto res = FindOrPrepareInsert(Policy::GetKey(other.slots_[i]));
+                ::new (slots_ + res.first) value_type(other.slots_[i]);
+            }
+        }
+    }
+
+    static void DestroySlot(value_type* slot)
+    {
+        if constexpr (!__is_trivially_destructible(value_type)) {
+            slot->~value_type();
+        }
+    }
+
+    iterator MakeIterator(size_t index) noexcept
+    {
+        return iterator{ctrl_ + index, slots_ + index};
+    }
+
+    // Wrapper to create a "re-seatable" reference.
+    class Wrapper {
+    public:
+        inline Wrapper(allocator& a) : allocator_(&a) {}
+
+        inline Wrapper& operator=(allocator& a)
+        {
+            allocator_ = &a;
+            return *this;
+        }
+
+        inline void* alloc(allocator::size_type size)
+        {
+            if ((allocator_) && (allocator_->alloc)) {
+                return allocator_->alloc(allocator_->instance, size);
+            }
+            return nullptr;
+        }
+
+        inline void free(void* ptr)
+        {
+            if ((allocator_) && (allocator_->free)) {
+                allocator_->free(allocator_->instance, ptr);
+            }
+        }
+
+        allocator& get()
+        {
+            BASE_ASSERT(allocator_ != nullptr);
+            return *allocator_;
+        }
+
+        const allocator& get() const
+        {
+            BASE_ASSERT(allocator_ != nullptr);
+            return *allocator_;
+        }
+
+    private:
+        allocator* allocator_{nullptr};
+    } allocator_;
+
+    uint8_t* ctrl_{nullptr};
+    value_type* slots_{nullptr};
+    size_t capacity_{0U};
+    size_t size_{0U};
+    // Empty slots which can still be used before growing.
+    size_t growthLeft_{0U};
+};
+
+template <class Key, class T>
+struct FlatMapPolicy {
+    using value_type = pair<const Key, T>;
+
+    static const Key& GetKey(const value_type& value) noexcept
+    {
+        return value.first;
+    }
+
+    static void Transfer(value_type* dst, value_type* src)
+    {
+        // The source is destroyed right after, so moving its key is safe even though it's const.
+        ::new (dst) value_type(BASE_NS::move(const_cast<Key&>(src->first)), BASE_NS::move(src->second));
+        if constexpr (!__is_trivially_destructible(value_type)) {
+            src->~value_type();
+        }
+    }
+};
+
+template <class Key>
+struct FlatSetPolicy {
+    static const Key& GetKey(const Key& value) noexcept
+    {
+        return value;
+    }
+
+    static void Transfer(Key* dst, Key* src)
+    {
+        ::new (dst) Key(BASE_NS::move(*src));
+        if constexpr (!__is_trivially_destructible(Key)) {
+            src->~Key();
+        }
+    }
+};
+}  // namespace Detail
+
+/** Open addressing hash map, a drop-in replacement for unordered_map when pointer stability isn't needed. */
+template <class Key, class T>
+class unordered_flat_map : public Detail::FlatTable<Key, pair<const Key, T>, Detail::FlatMapPolicy<Key, T>> {
+    using base = Detail::FlatTable<Key, pair<const Key, T>, Detail::FlatMapPolicy<Key, T>>;
+
+public:
+    using mapped_type = T;
+    using typename base::const_iterator;
+    using typename base::iterator;
+    using typename base::key_type;
+    using typename base::key_view_type;
+    using typename base::value_type;
+
+    using base::base;
+
+    unordered_flat_map() = default;
+
+    // The only way to get initializer_lists is to use std::initializer_list.
+    // Also initializer_lists are bad since they cause copies. please avoid them.
+    unordered_flat_map(std::initializer_list<value_type> init)
+    {
+        base::reserve(init.size());
+        for (auto&& value : init) {
+            insert(value);
+        }
+    }
+
+    pair<iterator, bool> insert(const value_type& value)
+    {
+        return base::EmplaceKey(value.first, value);
+    }
+
+    pair<iterator, bool> insert(value_type&& value)
+    {
+        return base::EmplaceKey(value.first, BASE_NS::move(value));
+    }
+
+    template <class... Args>
+    pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+    {
+        return base::EmplaceKey(key, key, mapped_type(BASE_NS::forward<Args>(args)...));
+    }
+
+    template <class... Args>
+    pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+    {
+        const auto res = base::FindOrPrepareInsert(key);
+        if (res.second) {
+            ::new (base::slots_ + res.first)
+                value_type(BASE_NS::move(key), mapped_type(BASE_NS::forward<Args>(args)...));
+        }
+        return {base::MakeIterator(res.first), res.second};
+    }
+
+    template <class M>
+    pair<iterator, bool> insert_or_assign(key_view_type key, M&& value)
+    {
+        const auto res = base::FindOrPrepareInsert(key);
+        if (res.second) {
+            ::new (base::slots_ + res.first) value_type(key_type(key), BASE_NS::forward<M>(value));
+        } else {
+            base::slots_[res.first].second = BASE_NS::forward<M>(value);
+        }
+        return {base::MakeIterator(res.first), res.second};
+    }
+
+    mapped_type& operator[](key_view_type key)
+    {
+        const auto res = base::FindOrPrepareInsert(key);
+        if (res.second) {
+            ::new (base::slots_ + res.first) value_type(key_type(key), mapped_type{});
+        }
+        return base::slots_[res.first].second;
+    }
+
+    template <class K = Key, enable_if_t<is_same_v<K, BASE_NS::string>, int> = 0>
+    mapped_type& operator[](const char* const key)
+    {
+        return operator[](string_view(key));
+    }
+
+    mapped_type& operator[](key_type&& key)
+    {
+        const auto res = base::FindOrPrepareInsert(key);
+        if (res.second) {
+            ::new (base::slots_ + res.first) value_type(BASE_NS::move(key), mapped_type{});
+        }
+        return base::slots_[res.first].second;
+    }
+};
+
+/** Open addressing hash set. */
+template <class Key>
+class unordered_flat_set : public Detail::FlatTable<Key, Key, Detail::FlatSetPolicy<Key>> {
+    using base = Detail::FlatTable<Key, Key, Detail::FlatSetPolicy<Key>>;
+
+public:
+    using typename base::key_type;
+    using typename base::key_view_type;
+    using typename base::value_type;
+    // Values can't be modified through iterators as that would change their hash.
+    using iterator = typename base::const_iterator;
+    using const_iterator = typename base::const_iterator;
+
+    using base::base;
+
+    unordered_flat_set() = default;
+
+    unordered_flat_set(std::initializer_list<value_type> init)
+    {
+        base::reserve(init.size());
+        for (auto&& value : init) {
+            insert(value);
+        }
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return base::begin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return base::end();
+    }
+
+    const_iterator find(key_view_type key) const
+    {
+        return base::find(key);
+    }
+
+    pair<const_iterator, bool> insert(const value_type& value)
+    {
+        const auto res = base::EmplaceKey(value, value);
+        return {res.first, res.second};
+    }
+
+    pair<const_iterator, bool> insert(value_type&& value)
+    {
+        const auto res = base::FindOrPrepareInsert(value);
+        if (res.second) {
+            ::new (base::slots_ + res.first) value_type(BASE_NS::move(value));
+        }
+        return {base::MakeIterator(res.first), res.second};
+    }
+};
+BASE_END_NAMESPACE()
+
+#undef BASE_FLAT_TABLE_SSE2
+#undef BASE_FLAT_TABLE_NEON
+
+#endif  // API_BASE_CONTAINERS_UNORDERED_FLAT_MAP_H
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <base/containers/unordered_flat_map.h>
+#include <base/containers/unordered_map.h>
+#include <base/containers/vector.h>
+
+#include "test_framework.h"
+
+using namespace BASE_NS;
+
+/**
+ * @tc.name: Initialization
+ * @tc.desc: Tests for inserting and looking up values.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_ContainersUnorderedFlatMap, Initialization, testing::ext::TestSize.Level1)
+{
+    unordered_flat_map<int, int> intInt;
+    ASSERT_TRUE(intInt.empty());
+    ASSERT_TRUE(intInt.begin() == intInt.end());
+    ASSERT_TRUE(intInt.find(42) == intInt.end());
+    intInt[42] = 32;
+    ASSERT_EQ(intInt[42], 32);
+    ASSERT_EQ(intInt.size(), 1U);
+
+    unordered_flat_map<int, string> intString({{10, "First"}, {456, "Second"}});
+    ASSERT_EQ(intString[10], "First");
+    ASSERT_EQ(intString[456], "Second");
+    const auto res = intString.insert({10, "Third"});
+    ASSERT_FALSE(res.second);
+    ASSERT_EQ(res.first->second, "First");
+    ASSERT_TRUE(intString.insert_or_assign(10, "Third").first->second == "Third");
+    ASSERT_TRUE(intString.try_emplace(11, "Fourth").second);
+    ASSERT_FALSE(intString.try_emplace(11, "Fifth").second);
+    ASSERT_EQ(intString[11], "Fourth");
+}
+
+/**
+ * @tc.name: StringView
+ * @tc.desc: Tests for looking up string keys with string views.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_ContainersUnorderedFlatMap, StringView, testing::ext::TestSize.Level1)
+{
+    unordered_flat_map<string, int> stringInt;
+    stringInt["First"] = 10;
+    stringInt.insert({"Second", 456});
+    const string key = "Third";
+    stringInt[key] = 3;
+    ASSERT_EQ(stringInt["First"], 10);
+    ASSERT_EQ(stringInt[string_view("Second")], 456);
+    ASSERT_TRUE(stringInt.contains(string_view(key)));
+    ASSERT_EQ(stringInt.count("Fourth"), 0U);
+    ASSERT_EQ(stringInt.find("Second")->second, 456);
+    ASSERT_EQ(stringInt.erase("First"), 1U);
+    ASSERT_EQ(stringInt.erase("First"), 0U);
+    ASSERT_EQ(stringInt.size(), 2U);
+}
+
+/**
+ * @tc.name: Modifiers
+ * @tc.desc: Tests for growing, erasing and reusing erased slots against unordered_map.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_ContainersUnorderedFlatMap, Modifiers, testing::ext::TestSize.Level1)
+{
+    unordered_flat_map<uint32_t, uint32_t> flat;
+    unordered_map<uint32_t, uint32_t> reference;
+    constexpr uint32_t keyRange = 3000U;
+    uint32_t seed = 1U;
+    for (uint32_t i = 0U; i < 100000U; ++i) {
+        seed = (seed * 1664525U) + 1013904223U;
+        const uint32_t key = (seed >> 8U) % keyRange;
+        if (seed & 1U) {
+            flat[key] = i;
+            reference[key] = i;
+        } else {
+            ASSERT_EQ(flat.erase(key), reference.erase(key));
+        }
+    }
+    ASSERT_EQ(flat.size(), reference.size());
+    size_t count = 0U;
+    for (const auto& value : flat) {
+        const auto it = reference.find(value.first);
+        ASSERT_TRUE(it != reference.end());
+        ASSERT_EQ(value.second, it->second);
+        ++count;
+    }
+    ASSERT_EQ(count, reference.size());
+
+    // Erasing while iterating returns the next value.
+    for (auto it = flat.begin(); it != flat.end();) {
+        if (it->first & 1U) {
+            it = flat.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (const auto& value : flat) {
+        ASSERT_EQ(value.first & 1U, 0U);
+    }
+
+    const size_t capacity = flat.capacity();
+    flat.clear();
+    ASSERT_TRUE(flat.empty());
+    ASSERT_EQ(flat.capacity(), capacity);
+    flat.reserve(10000U);
+    const size_t reserved = flat.capacity();
+    for (uint32_t i = 0U; i < 10000U; ++i) {
+        flat[i] = i;
+    }
+    ASSERT_EQ(flat.capacity(), reserved);
+}
+
+/**
+ * @tc.name: CopyMove
+ * @tc.desc: Tests for copying and moving maps.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_ContainersUnorderedFlatMap, CopyMove, testing::ext::TestSize.Level1)
+{
+    unordered_flat_map<int, vector<int>> original;
+    for (int i = 0; i < 100; ++i) {
+        original[i].push_back(i);
+    }
+    unordered_flat_map<int, vector<int>> copy = original;
+    ASSERT_EQ(copy.size(), original.size());
+    ASSERT_EQ(copy[50][0], 50);
+    unordered_flat_map<int, vector<int>> moved = BASE_NS::move(copy);
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(moved.size(), original.size());
+    copy = moved;
+    ASSERT_EQ(copy[99][0], 99);
+    moved = BASE_NS::move(original);
+    ASSERT_TRUE(original.empty());
+    ASSERT_EQ(moved[0][0], 0);
+}
+
+/**
+ * @tc.name: Allocator
+ * @tc.desc: Tests for using a custom allocator.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_ContainersUnorderedFlatMap, Allocator, testing::ext::TestSize.Level1)
+{
+    static int allocations = 0;
+    allocator counting{nullptr,
+        [](void* /* instance */, allocator::size_type size) -> void* {
+            ++allocations;
+            return ::malloc(size);
+        },
+        [](void* /* instance */, void* ptr) { ::free(ptr); }};
+    {
+        unordered_flat_map<uint32_t, string> map(counting);
+        map.reserve(1000U);
+        for (uint32_t i = 0U; i < 1000U; ++i) {
+            map[i] = "value";
+        }
+        ASSERT_EQ(allocations, 1);
+        ASSERT_EQ(&map.getAllocator(), &counting);
+        map.setAllocator(default_allocator());
+        ASSERT_EQ(map.size(), 1000U);
+        ASSERT_EQ(map[999U], "value");
+    }
+    ASSERT_EQ(allocations, 1);
+}
+
+/**
+ * @tc.name: Set
+ * @tc.desc: Tests for unordered_flat_set.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_ContainersUnorderedFlatMap, Set, testing::ext::TestSize.Level1)
+{
+    unordered_flat_set<uint64_t> set({1U, 2U, 3U});
+    ASSERT_EQ(set.size(), 3U);
+    ASSERT_FALSE(set.insert(2U).second);
+    ASSERT_TRUE(set.insert(4U).second);
+    ASSERT_TRUE(set.contains(4U));
+    ASSERT_EQ(set.erase(1U), 1U);
+    ASSERT_FALSE(set.contains(1U));
+    uint64_t sum = 0U;
+    for (const auto value : set) {
+        sum += value;
+    }
+    ASSERT_EQ(sum, 9U);
+
+    unordered_flat_set<string> strings;
+    strings.insert(string("a"));
+    strings.insert("b");
+    ASSERT_TRUE(strings.contains("a"));
+    ASSERT_TRUE(strings.find(string_view("b")) != strings.end());
+    ASSERT_FALSE(strings.contains("c"));
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+
+#include <base/containers/string.h>
+#include <base/containers/unordered_flat_map.h>
+#include <base/containers/unordered_map.h>
+#include <base/containers/vector.h>
+
+namespace benchmarks {
+namespace {
+using BASE_NS::string;
+using BASE_NS::unordered_flat_map;
+using BASE_NS::unordered_map;
+using BASE_NS::vector;
+
+// Random 64 bit keys like entity ids, the first half is inserted and the second half is used for misses.
+vector<uint64_t> CreateKeys(size_t count)
+{
+    std::mt19937_64 generator(count);
+    vector<uint64_t> keys(count * 2U);
+    for (auto& key : keys) {
+        key = generator();
+    }
+    return keys;
+}
+
+vector<string> CreateStringKeys(size_t count)
+{
+    std::mt19937_64 generator(count);
+    vector<string> keys(count * 2U);
+    for (auto& key : keys) {
+        key = string("resource://") + std::to_string(generator()).c_str();
+    }
+    return keys;
+}
+
+template <typename Map, typename Key>
+Map CreateMap(const vector<Key>& keys, size_t count)
+{
+    Map map;
+    for (size_t i = 0U; i < count; ++i) {
+        map[keys[i]] = static_cast<uint32_t>(i);
+    }
+    return map;
+}
+
+void MapSizes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->RangeMultiplier(10)->Range(1000, 1000000)->ArgName("entries")->Unit(benchmark::kMicrosecond);
+}
+}  // namespace
+
+// Inserting all the keys to an empty map, including growing.
+template <typename Map>
+void Insert(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto keys = CreateKeys(count);
+    for (auto _ : state) {
+        Map map;
+        for (size_t i = 0U; i < count; ++i) {
+            map[keys[i]] = static_cast<uint32_t>(i);
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Looking up keys which are all in the map.
+template <typename Map>
+void FindHit(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto keys = CreateKeys(count);
+    const auto map = CreateMap<Map>(keys, count);
+    for (auto _ : state) {
+        uint32_t sum = 0U;
+        for (size_t i = 0U; i < count; ++i) {
+            sum += map.find(keys[i])->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Looking up keys which are not in the map.
+template <typename Map>
+void FindMiss(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto keys = CreateKeys(count);
+    const auto map = CreateMap<Map>(keys, count);
+    for (auto _ : state) {
+        size_t found = 0U;
+        for (size_t i = count; i < keys.size(); ++i) {
+            found += map.count(keys[i]);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Erasing all the keys, the map is filled outside of the timed region.
+template <typename Map>
+void Erase(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto keys = CreateKeys(count);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto map = CreateMap<Map>(keys, count);
+        state.ResumeTiming();
+        for (size_t i = 0U; i < count; ++i) {
+            map.erase(keys[i]);
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Iterating over all the values.
+template <typename Map>
+void Iterate(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto map = CreateMap<Map>(CreateKeys(count), count);
+    for (auto _ : state) {
+        uint32_t sum = 0U;
+        for (const auto& value : map) {
+            sum += value.second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Looking up string keys, which makes the key comparisons more expensive.
+template <typename Map>
+void FindString(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto keys = CreateStringKeys(count);
+    const auto map = CreateMap<Map>(keys, count);
+    for (auto _ : state) {
+        size_t found = 0U;
+        for (const auto& key : keys) {
+            found += map.count(key);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * 2);
+}
+
+using NodeMap = unordered_map<uint64_t, uint32_t>;
+using FlatMap = unordered_flat_map<uint64_t, uint32_t>;
+using NodeStringMap = unordered_map<string, uint32_t>;
+using FlatStringMap = unordered_flat_map<string, uint32_t>;
+
+BENCHMARK_TEMPLATE(Insert, NodeMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(Insert, FlatMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(FindHit, NodeMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(FindHit, FlatMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(FindMiss, NodeMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(FindMiss, FlatMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(Erase, NodeMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(Erase, FlatMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(Iterate, NodeMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(Iterate, FlatMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(FindString, NodeStringMap)->Apply(MapSizes);
+BENCHMARK_TEMPLATE(FindString, FlatStringMap)->Apply(MapSizes);
+
+}  // namespace benchmarks
@@ -40,6 +40,7 @@
 #include "default_limits.h"
 #include "io/dev/FileMonitor.h"
 #include "lume/Log.h"
+#include "shader_bundle_writer.h"
 #include "shader_type.h"
 #include "spirv_cross.hpp"
 #include "spirv_cross_helpers_gles.h"
@@ -681,6 +682,7 @@ struct Inputs {
     bool optimizeSpirv = false;
     bool checkIfChanged = false;
     bool stripDebugInformation = false;
+    bool writeBundle = false;
     ShaderEnv envVersion = ShaderEnv::version_vulkan_1_0;
 };
 
@@ -1957,7 +1959,9 @@ void ShowUsage()
                  "LumeShaderCompiler.exe --source <source path> --destination "
                  "<destination path>\n"
                  "LumeShaderCompiler.exe --monitor (monitors changes in the "
-                 "source files)\n";
+                 "source files)\n"
+                 "LumeShaderCompiler.exe --source <source path> --bundle (packs the "
+                 "outputs to a single shader bundle)\n";
 }
 
 std::vector<std::string> FilterByExtension(
@@ -2050,6 +2054,12 @@ constexpr Args ARGS[] = {
             params.stripDebugInformation = true;
             return true;
         }},
+    {"--bundle",
+        0,
+        [](Inputs& params, char* argv[]) {
+            params.writeBundle = true;
+            return true;
+        }},
     {"--vulkan",
         1,
         [](Inputs& params, char* argv[]) {
@@ -2270,6 +2280,17 @@ int CompilerMain(int argc, char* argv[])
         }
     }
 
+    if (params->writeBundle && (errorCount == 0)) {
+        try {
+            if (!WriteShaderBundle(dest, dest / SHADER_BUNDLE_FILENAME)) {
+                errorCount++;
+            }
+        } catch (std::exception const& e) {
+            LUME_LOG_E("Writing shader bundle failed with an exception: %s", e.what());
+            errorCount++;
+        }
+    }
+
     if (errorCount == 0) {
         LUME_LOG_I("Success.");
     } else {
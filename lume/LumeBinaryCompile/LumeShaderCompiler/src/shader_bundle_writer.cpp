@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shader_bundle_writer.h"
+
+// standard library
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+// internal
+#include "lume/Log.h"
+
+namespace {
+// Layout is shared with RENDER_NS::ShaderBundle, see README.md.
+constexpr uint8_t BUNDLE_TAG[] = {'s', 'h', 'b', 1};  // last one is version
+constexpr uint32_t BUNDLE_DATA_ALIGNMENT = 16U;
+constexpr std::string_view BUNDLE_EXTENSIONS[] = {".shader", ".spv", ".gl", ".gles", ".lsb"};
+
+struct BundleHeader {
+    uint8_t tag[sizeof(BUNDLE_TAG)];
+    uint32_t entryCount;
+};
+
+struct BundleEntry {
+    uint32_t nameOffset;
+    uint32_t nameSize;
+    uint32_t dataOffset;
+    uint32_t dataSize;
+};
+
+struct BundleFile {
+    std::string name;
+    std::vector<char> data;
+};
+
+bool IsBundled(const std::filesystem::path& path)
+{
+    const std::string extension = path.extension().u8string();
+    return std::any_of(std::begin(BUNDLE_EXTENSIONS), std::end(BUNDLE_EXTENSIONS),
+        [&extension](const std::string_view bundled) { return extension == bundled; });
+}
+
+std::optional<std::vector<char>> ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return std::nullopt;
+    }
+    const auto size = static_cast<size_t>(file.tellg());
+    std::vector<char> data(size);
+    file.seekg(0, std::ios::beg);
+    if (!file.read(data.data(), static_cast<std::streamsize>(size))) {
+        return std::nullopt;
+    }
+    return data;
+}
+
+uint64_t Align(const uint64_t offset)
+{
+    return (offset + (BUNDLE_DATA_ALIGNMENT - 1U)) & ~uint64_t(BUNDLE_DATA_ALIGNMENT - 1U);
+}
+
+std::optional<std::vector<BundleFile>> CollectFiles(
+    const std::filesystem::path& root, const std::filesystem::path& bundleFile)
+{
+    std::vector<BundleFile> files;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root, error)) {
+        if (!entry.is_regular_file(error) || !IsBundled(entry.path())) {
+            continue;
+        }
+        if (std::filesystem::equivalent(entry.path(), bundleFile, error)) {
+            continue;
+        }
+        auto data = ReadFile(entry.path());
+        if (!data) {
+            LUME_LOG_E("Failed to read %s", entry.path().u8string().c_str());
+            return std::nullopt;
+        }
+        files.push_back({std::filesystem::relative(entry.path(), root).generic_u8string(), *std::move(data)});
+    }
+    if (error) {
+        LUME_LOG_E("Failed to list %s: %s", root.u8string().c_str(), error.message().c_str());
+        return std::nullopt;
+    }
+    // runtime does a binary search by name
+    std::sort(files.begin(), files.end(),
+        [](const BundleFile& lhs, const BundleFile& rhs) { return lhs.name < rhs.name; });
+    return files;
+}
+}  // namespace
+
+bool WriteShaderBundle(const std::filesystem::path& root, const std::filesystem::path& bundleFile)
+{
+    const auto files = CollectFiles(root, bundleFile);
+    if (!files) {
+        return false;
+    }
+
+    // header, sorted entry table, names and 16 byte aligned file contents.
+    BundleHeader header{};
+    std::copy(std::begin(BUNDLE_TAG), std::end(BUNDLE_TAG), header.tag);
+    header.entryCount = static_cast<uint32_t>(files->size());
+
+    std::vector<BundleEntry> entries(files->size());
+    uint64_t offset = sizeof(BundleHeader) + sizeof(BundleEntry) * entries.size();
+    for (size_t i = 0; i < files->size(); ++i) {
+        entries[i].nameOffset = static_cast<uint32_t>(offset);
+        entries[i].nameSize = static_cast<uint32_t>((*files)[i].name.size());
+        offset += (*files)[i].name.size();
+    }
+    for (size_t i = 0; i < files->size(); ++i) {
+        offset = Align(offset);
+        entries[i].dataOffset = static_cast<uint32_t>(offset);
+        entries[i].dataSize = static_cast<uint32_t>((*files)[i].data.size());
+        offset += (*files)[i].data.size();
+    }
+    if (offset > UINT32_MAX) {
+        LUME_LOG_E("Shader bundle too large: %llu bytes", static_cast<unsigned long long>(offset));
+        return false;
+    }
+
+    std::ofstream out(bundleFile, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        LUME_LOG_E("Failed to open %s", bundleFile.u8string().c_str());
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()),
+        static_cast<std::streamsize>(sizeof(BundleEntry) * entries.size()));
+    for (const auto& file : *files) {
+        out.write(file.name.data(), static_cast<std::streamsize>(file.name.size()));
+    }
+    const char padding[BUNDLE_DATA_ALIGNMENT] = {};
+    for (size_t i = 0; i < files->size(); ++i) {
+        const auto position = static_cast<uint64_t>(out.tellp());
+        out.write(padding, static_cast<std::streamsize>(entries[i].dataOffset - position));
+        out.write((*files)[i].data.data(), static_cast<std::streamsize>((*files)[i].data.size()));
+    }
+    if (!out) {
+        LUME_LOG_E("Failed to write %s", bundleFile.u8string().c_str());
+        return false;
+    }
+    LUME_LOG_I("Bundled %zu files to '%s'", files->size(), bundleFile.u8string().c_str());
+    return true;
+}
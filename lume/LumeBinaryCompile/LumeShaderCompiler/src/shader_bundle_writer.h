@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHADER_BUNDLE_WRITER_H
+#define SHADER_BUNDLE_WRITER_H
+
+#include <filesystem>
+#include <string_view>
+
+// Default file name of the bundle, the runtime looks for it at the root of a shader path.
+constexpr std::string_view SHADER_BUNDLE_FILENAME = "shaders.shaderbundle";
+
+// Packs the compiled outputs under root (.shader, .spv, .gl, .gles and .lsb files) into a single bundle file.
+// Entry names are the file paths relative to root with '/' separators.
+bool WriteShaderBundle(const std::filesystem::path& root, const std::filesystem::path& bundleFile);
+
+#endif
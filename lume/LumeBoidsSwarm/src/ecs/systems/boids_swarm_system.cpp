@@ -15,6 +15,8 @@
 
 #include "boids_swarm_system.h"
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <tuple>
 #include <utility>
@@ -35,6 +37,14 @@ static constexpr uint32_t BOIDSSWARM_PROFILER_DEFAULT_COLOR{0xff00ff};
 static constexpr auto VELOCITY_COUNT{BOIDSSWARM_NS::BoidsSwarmStateComponent::VELOCITY_COUNT};
 static constexpr auto VELOCITY_CURRENT_INDEX{BOIDSSWARM_NS::BoidsSwarmStateComponent::VELOCITY_CURRENT_INDEX};
 
+// Run is split into tasks of at least this many boids.
+static constexpr size_t MIN_RUN_TASK_SIZE{128U};
+static constexpr uint32_t MIN_SPATIAL_HASH_BUCKETS{64U};
+// Grid cells are slightly larger than the neighbor distance so that rounding can't move neighbors two cells apart.
+static constexpr float SPATIAL_HASH_CELL_MARGIN{1.001f};
+// Cell coordinates are clamped to fit 32 bits, clamping only merges cells so no neighbors are lost.
+static constexpr float MAX_CELL_COORDINATE{1073741824.f};
+
 struct GravityField {};
 struct RepulsionField {};
 
@@ -67,6 +77,43 @@ struct QueryRowIndices {
     enum class RepulsionEntity : uint32_t { BOIDS_SWARM_REPULSION_COMP = 0, TRANSFORM_COMP = 1 };
 };
 
+int32_t GetCellCoordinate(float value, float invCellSize)
+{
+    float cell = BASE_NS::Math::floor(value * invCellSize);
+    if (!(cell >= -MAX_CELL_COORDINATE)) {
+        cell = -MAX_CELL_COORDINATE;
+    } else if (cell > MAX_CELL_COORDINATE) {
+        cell = MAX_CELL_COORDINATE;
+    }
+    return static_cast<int32_t>(cell);
+}
+
+uint32_t GetCellBucket(int32_t x, int32_t y, int32_t z, uint32_t bucketMask)
+{
+    return ((static_cast<uint32_t>(x) * 73856093U) ^ (static_cast<uint32_t>(y) * 19349663U) ^
+               (static_cast<uint32_t>(z) * 83492791U)) &
+           bucketMask;
+}
+
+// Largest of the squared neighbor distances which are used, NaN distances never match so they are skipped.
+float GetMaxNeighborDistanceSq(const BOIDSSWARM_NS::BoidsSwarmComponent& swarm,
+    const BOIDSSWARM_NS::BoidsSwarmSystem::BoidsSwarmFrameData& frameData)
+{
+    float maxDistanceSq = -1.f;
+    const std::pair<bool, float> distances[] = {
+        {swarm.separationTargets.empty(), frameData.separationDistance},
+        {swarm.alignmentTargets.empty(), frameData.alignmentDistance},
+        {swarm.cohesionTargets.empty(), frameData.cohesionDistance},
+    };
+    for (const auto& distance : distances) {
+        const float distanceSq = distance.second * distance.second;
+        if (distance.first && (distanceSq > maxDistanceSq)) {
+            maxDistanceSq = distanceSq;
+        }
+    }
+    return maxDistanceSq;
+}
+
 template <typename T>
 uint32_t GetQueryRowIndex(T IndexAsEnum)
 {
@@ -190,6 +237,28 @@ BOIDSSWARM_BEGIN_NAMESPACE()
 using namespace BASE_NS;
 using namespace CORE_NS;
 
+class BoidsSwarmSystem::RunTask final : public IThreadPool::ITask {
+public:
+    RunTask(BoidsSwarmSystem& system, size_t begin, size_t end, vector<uint32_t>& neighbors)
+        : system_(system), begin_(begin), end_(end), neighbors_(neighbors)
+    {}
+
+    void operator()() override
+    {
+        system_.RunRange(begin_, end_, neighbors_);
+    }
+
+protected:
+    void Destroy() override
+    {}
+
+private:
+    BoidsSwarmSystem& system_;
+    size_t begin_;
+    size_t end_;
+    vector<uint32_t>& neighbors_;
+};
+
 void BoidsSwarmSystem::SetActive(bool state)
 {
     active_ = state;
@@ -207,9 +276,12 @@ BoidsSwarmSystem::BoidsSwarmSystem(IEcs& ecs)
       boidsSwarmRepulsionManager_(*(GetManager<IBoidsSwarmRepulsionComponentManager>(ecs))),
       boidsSwarmStateManager_(*(GetManager<IBoidsSwarmStateComponentManager>(ecs))),
       transformManager_(*(GetManager<CORE3D_NS::ITransformComponentManager>(ecs))),
+      threadPool_(ecs.GetThreadPool()),
       randomEngine_(std::random_device{}())
 {}
 
+BoidsSwarmSystem::~BoidsSwarmSystem() = default;
+
 string_view BoidsSwarmSystem::GetName() const
 {
     return BOIDSSWARM_NS::GetName(this);
@@ -407,6 +479,109 @@ void BoidsSwarmSystem::PreRun()
 
         entity2indices_[row.entity] = i;
     }
+
+    BuildSpatialHash();
+}
+
+void BoidsSwarmSystem::BuildSpatialHash()
+{
+#if (BOIDSSWARM_DEV_ENABLED == 1)
+    CORE_CPU_PERF_SCOPE("BOIDSSWARM", "BoidsSwarmSystem", "BuildSpatialHash", BOIDSSWARM_PROFILER_DEFAULT_COLOR);
+#endif
+    auto& hash = spatialHash_;
+    const size_t count = positions_.size();
+    hash.positions.resize(count);
+    float maxDistance = 0.f;
+    bool finite = true;
+    for (size_t i = 0; i < count; ++i) {
+        hash.positions[i] = positions_[i] * axisMaskFloat_;
+        const auto& frameData = frameDatas_[i];
+        for (const float distance :
+            {frameData.separationDistance, frameData.alignmentDistance, frameData.cohesionDistance}) {
+            finite = finite && std::isfinite(distance);
+            maxDistance = Math::max(maxDistance, Math::abs(distance));
+        }
+    }
+    if (!finite) {
+        // unbounded neighbor distance, every boid is a candidate
+        hash.cellSize = 0.f;
+        return;
+    }
+    hash.cellSize = Math::max(maxDistance * SPATIAL_HASH_CELL_MARGIN, Math::EPSILON);
+    hash.invCellSize = 1.f / hash.cellSize;
+
+    uint32_t bucketCount = MIN_SPATIAL_HASH_BUCKETS;
+    while (bucketCount < (count * 2U)) {
+        bucketCount <<= 1U;
+    }
+    hash.bucketMask = bucketCount - 1U;
+
+    // counting sort of the boids by bucket
+    hash.boidBuckets.resize(count);
+    hash.bucketStarts.clear();
+    hash.bucketStarts.resize(bucketCount + 1U, 0U);
+    for (size_t i = 0; i < count; ++i) {
+        const Math::Vec3& position = hash.positions[i];
+        const uint32_t bucket = GetCellBucket(GetCellCoordinate(position.x, hash.invCellSize),
+            GetCellCoordinate(position.y, hash.invCellSize), GetCellCoordinate(position.z, hash.invCellSize),
+            hash.bucketMask);
+        hash.boidBuckets[i] = bucket;
+        ++hash.bucketStarts[bucket + 1U];
+    }
+    for (uint32_t bucket = 1U; bucket <= bucketCount; ++bucket) {
+        hash.bucketStarts[bucket] += hash.bucketStarts[bucket - 1U];
+    }
+    hash.bucketCursors.resize(bucketCount);
+    std::copy(hash.bucketStarts.cbegin(), hash.bucketStarts.cbegin() + bucketCount, hash.bucketCursors.begin());
+    hash.boids.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        hash.boids[hash.bucketCursors[hash.boidBuckets[i]]++] = static_cast<uint32_t>(i);
+    }
+}
+
+void BoidsSwarmSystem::GatherNeighbors(size_t i, float distanceSq, vector<uint32_t>& neighbors) const
+{
+    neighbors.clear();
+    const auto& hash = spatialHash_;
+    const Math::Vec3& position = hash.positions[i];
+    auto addCandidate = [&](const uint32_t j) {
+        if (j != i) {
+            const Math::Vec3 delta = hash.positions[j] - position;
+            if (Math::Dot(delta, delta) <= distanceSq) {
+                neighbors.push_back(j);
+            }
+        }
+    };
+    if (hash.cellSize <= 0.f) {
+        for (uint32_t j = 0U; j < static_cast<uint32_t>(hash.positions.size()); ++j) {
+            addCandidate(j);
+        }
+        return;
+    }
+
+    const int32_t cellX = GetCellCoordinate(position.x, hash.invCellSize);
+    const int32_t cellY = GetCellCoordinate(position.y, hash.invCellSize);
+    const int32_t cellZ = GetCellCoordinate(position.z, hash.invCellSize);
+    constexpr size_t neighborCellCount = 27U;
+    uint32_t buckets[neighborCellCount];
+    size_t bucketCount = 0U;
+    for (int32_t z = cellZ - 1; z <= cellZ + 1; ++z) {
+        for (int32_t y = cellY - 1; y <= cellY + 1; ++y) {
+            for (int32_t x = cellX - 1; x <= cellX + 1; ++x) {
+                buckets[bucketCount++] = GetCellBucket(x, y, z, hash.bucketMask);
+            }
+        }
+    }
+    // different cells can share a bucket, visit each bucket once
+    std::sort(buckets, buckets + bucketCount);
+    const uint32_t* const bucketsEnd = std::unique(buckets, buckets + bucketCount);
+    for (const uint32_t* bucket = buckets; bucket != bucketsEnd; ++bucket) {
+        for (uint32_t k = hash.bucketStarts[*bucket]; k < hash.bucketStarts[*bucket + 1U]; ++k) {
+            addCandidate(hash.boids[k]);
+        }
+    }
+    // neighbors are processed in index order like when scanning all boids, keeping the sums identical
+    std::sort(neighbors.begin(), neighbors.end());
 }
 
 void BoidsSwarmSystem::Run()
@@ -414,14 +589,41 @@ void BoidsSwarmSystem::Run()
 #if (BOIDSSWARM_DEV_ENABLED == 1)
     CORE_CPU_PERF_SCOPE("BOIDSSWARM", "BoidsSwarmSystem", "Run", BOIDSSWARM_PROFILER_DEFAULT_COLOR);
 #endif
+    const size_t count = frameDatas_.size();
+    const auto threadCount = threadPool_ ? threadPool_->GetNumberOfThreads() : 0U;
+    if ((threadCount == 0U) || (count < (MIN_RUN_TASK_SIZE * 2U))) {
+        neighborBuffers_.resize(1U);
+        RunRange(0U, count, neighborBuffers_[0U]);
+        return;
+    }
 
+    // Each boid only writes its own frame data, so the boids can be split into independent tasks. The last range and
+    // the remainder are processed in the calling thread.
+    const size_t taskSize = Math::max(MIN_RUN_TASK_SIZE, count / (threadCount + 1U));
+    const size_t taskCount = (count / taskSize) - 1U;
+    neighborBuffers_.resize(taskCount + 1U);
+    tasks_.clear();
+    tasks_.reserve(taskCount);
+    taskResults_.clear();
+    taskResults_.reserve(taskCount);
+    for (size_t i = 0U; i < taskCount; ++i) {
+        auto& task = tasks_.emplace_back(*this, i * taskSize, (i + 1U) * taskSize, neighborBuffers_[i]);
+        taskResults_.push_back(threadPool_->Push(IThreadPool::ITask::Ptr{&task}));
+    }
+    RunRange(taskCount * taskSize, count, neighborBuffers_[taskCount]);
+    for (const auto& result : taskResults_) {
+        result->Wait();
+    }
+}
+
+void BoidsSwarmSystem::RunRange(size_t begin, size_t end, vector<uint32_t>& neighbors)
+{
     auto computeNeighborForces = [&](size_t i) {
 #if (BOIDSSWARM_DEV_ENABLED == 1)
         CORE_CPU_PERF_SCOPE(
             "BOIDSSWARM", "BoidsSwarmSystem", "ComputeNeighborForces", BOIDSSWARM_PROFILER_DEFAULT_COLOR);
 #endif
         auto& frameData = frameDatas_[i];
-        const size_t count = frameDatas_.size();
 
         auto swarmCompId = swarmEntityQuery_.GetResults()[i]
                                .components[GetQueryRowIndex(QueryRowIndices::SwarmEntity::BOIDS_SWARM_COMP)];
@@ -438,6 +640,13 @@ void BoidsSwarmSystem::Run()
         size_t alignmentCount = 0;
         size_t cohesionCount = 0;
 
+        // candidates within the largest distance, each force below filters them with its own distance
+        if (const float maxDistSq = GetMaxNeighborDistanceSq(*swarmComp, frameData); maxDistSq >= 0.f) {
+            GatherNeighbors(i, maxDistSq, neighbors);
+        } else {
+            neighbors.clear();
+        }
+
         auto processNeighbors = [&](const auto& targets, float distSqThreshold, auto&& processFunc) {
             if (!targets.empty()) {
                 for (const auto& target : targets) {
@@ -453,10 +662,7 @@ void BoidsSwarmSystem::Run()
                     processFunc(delta, distSq, j);
                 }
             } else {
-                for (size_t j = 0; j < count; ++j) {
-                    if (i == j) {
-                        continue;
-                    }
+                for (const size_t j : neighbors) {
                     const Math::Vec3 otherPosProjected = positions_[j] * axisMaskFloat_;
                     const Math::Vec3 delta = otherPosProjected - myPosProjected;
                     const float distSq = Math::Dot(delta, delta);
@@ -607,9 +813,7 @@ void BoidsSwarmSystem::Run()
         return boundaryForce;
     };
 
-    size_t count = frameDatas_.size();
-
-    for (size_t i = 0; i < count; ++i) {
+    for (size_t i = begin; i < end; ++i) {
         auto& frameData = frameDatas_[i];
 
         computeNeighborForces(i);
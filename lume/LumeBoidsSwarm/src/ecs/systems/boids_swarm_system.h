@@ -32,6 +32,7 @@
 #include <base/containers/vector.h>
 #include <core/ecs/intf_system.h>
 #include <core/namespace.h>
+#include <core/threading/intf_thread_pool.h>
 
 CORE_BEGIN_NAMESPACE()
 class IEcs;
@@ -75,7 +76,7 @@ public:
     };
 
     explicit BoidsSwarmSystem(CORE_NS::IEcs& ecs);
-    ~BoidsSwarmSystem() override = default;
+    ~BoidsSwarmSystem() override;
 
     BASE_NS::string_view GetName() const override;
     BASE_NS::Uid GetUid() const override;
@@ -123,6 +124,23 @@ public:
     }
 
 private:
+    class RunTask;
+
+    // Boids hashed to a uniform grid of their projected positions. The cell size is at least the largest neighbor
+    // distance, so the neighbors of a boid are in the 3x3x3 cells around it.
+    struct SpatialHash {
+        // Zero when the grid can't be used and all boids are neighbor candidates.
+        float cellSize{0.f};
+        float invCellSize{0.f};
+        uint32_t bucketMask{0U};
+        // Boids of bucket b are boids[bucketStarts[b]] ... boids[bucketStarts[b + 1] - 1] in ascending order.
+        BASE_NS::vector<uint32_t> bucketStarts;
+        BASE_NS::vector<uint32_t> bucketCursors;
+        BASE_NS::vector<uint32_t> boidBuckets;
+        BASE_NS::vector<uint32_t> boids;
+        BASE_NS::vector<BASE_NS::Math::Vec3> positions;
+    };
+
     void ResetBoid(
         const BoidsSwarmComponent& swarm, CORE3D_NS::TransformComponent& transform, BoidsSwarmStateComponent& state);
     void Reset();
@@ -130,7 +148,10 @@ private:
 
     void PreRun();
     void Run();
+    void RunRange(size_t begin, size_t end, BASE_NS::vector<uint32_t>& neighbors);
     void PostRun();
+    void BuildSpatialHash();
+    void GatherNeighbors(size_t i, float distanceSq, BASE_NS::vector<uint32_t>& neighbors) const;
     void LimitTurnRate(BoidsSwarmFrameData& frameData, const BASE_NS::Math::Vec3& up);
 
     void OnComponentEvent(CORE_NS::IEcs::ComponentListener::EventType type,
@@ -156,6 +177,13 @@ private:
     BASE_NS::unordered_map<CORE_NS::Entity, bool> notPlayedEntities_;
     BASE_NS::unordered_map<CORE_NS::Entity, size_t> entity2indices_;
 
+    SpatialHash spatialHash_;
+    CORE_NS::IThreadPool::Ptr threadPool_;
+    BASE_NS::vector<RunTask> tasks_;
+    BASE_NS::vector<CORE_NS::IThreadPool::IResult::Ptr> taskResults_;
+    // Neighbor scratch buffer of each task and the calling thread.
+    BASE_NS::vector<BASE_NS::vector<uint32_t>> neighborBuffers_;
+
     float timeStepSec_{DEFAULT_TIME_STEP_SEC};
     float playSpeed_{DEFAULT_PLAY_SPEED};
     uint64_t accumulatedTime_{0};
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <boids_swarm/ecs/components/boids_swarm_component.h>
+#include <boids_swarm/ecs/components/boids_swarm_gravity_component.h>
+#include <boids_swarm/ecs/components/boids_swarm_repulsion_component.h>
+#include <boids_swarm/ecs/components/boids_swarm_state_component.h>
+#include <boids_swarm/ecs/systems/intf_boids_swarm_system.h>
+#include <cmath>
+#include <random>
+
+#include <3d/ecs/components/transform_component.h>
+#include <base/containers/array_view.h>
+#include <core/ecs/intf_ecs.h>
+#include <core/ecs/intf_entity_manager.h>
+#include <core/intf_engine.h>
+#include <core/plugin/intf_plugin_register.h>
+
+#include "utils.h"
+
+namespace benchmarks {
+namespace {
+using BASE_NS::Uid;
+using CORE_NS::IEcs;
+
+// Volume per boid, keeps the number of neighbors roughly the same at every swarm size.
+constexpr float VOLUME_PER_BOID = 8.0f;
+
+IEcs::Ptr CreateBoidsEcs()
+{
+    IEcs::Ptr ecs = GetEngine()->CreateEcs();
+    const Uid managers[] = {
+        CORE3D_NS::ITransformComponentManager::UID,
+        BOIDSSWARM_NS::IBoidsSwarmComponentManager::UID,
+        BOIDSSWARM_NS::IBoidsSwarmGravityComponentManager::UID,
+        BOIDSSWARM_NS::IBoidsSwarmRepulsionComponentManager::UID,
+        BOIDSSWARM_NS::IBoidsSwarmStateComponentManager::UID,
+    };
+    auto& pluginRegister = CORE_NS::GetPluginRegister();
+    for (const auto* typeInfo : pluginRegister.GetTypeInfos(CORE_NS::ComponentManagerTypeInfo::UID)) {
+        const auto& info = *static_cast<const CORE_NS::ComponentManagerTypeInfo*>(typeInfo);
+        for (const auto& uid : managers) {
+            if (info.uid == uid) {
+                ecs->CreateComponentManager(info);
+            }
+        }
+    }
+    for (const auto* typeInfo : pluginRegister.GetTypeInfos(CORE_NS::SystemTypeInfo::UID)) {
+        const auto& info = *static_cast<const CORE_NS::SystemTypeInfo*>(typeInfo);
+        if (info.uid == BOIDSSWARM_NS::IBoidsSwarmSystem::UID) {
+            ecs->CreateSystem(info);
+        }
+    }
+    ecs->Initialize();
+    return ecs;
+}
+
+void CreateSwarm(IEcs& ecs, uint32_t count)
+{
+    auto* transformManager = CORE_NS::GetManager<CORE3D_NS::ITransformComponentManager>(ecs);
+    auto* swarmManager = CORE_NS::GetManager<BOIDSSWARM_NS::IBoidsSwarmComponentManager>(ecs);
+    const float halfExtent = 0.5f * std::cbrt(VOLUME_PER_BOID * static_cast<float>(count));
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<float> position(-halfExtent, halfExtent);
+    std::uniform_real_distribution<float> velocity(-1.0f, 1.0f);
+    auto& entityManager = ecs.GetEntityManager();
+    for (uint32_t i = 0U; i < count; ++i) {
+        const CORE_NS::Entity entity = entityManager.Create();
+        transformManager->Create(entity);
+        if (auto transform = transformManager->Write(entity)) {
+            transform->position = {position(generator), position(generator), position(generator)};
+        }
+        swarmManager->Create(entity);
+        if (auto swarm = swarmManager->Write(entity)) {
+            swarm->initialVelocity = {velocity(generator), velocity(generator), velocity(generator)};
+            swarm->boundaryMinPos = {-halfExtent, -halfExtent, -halfExtent};
+            swarm->boundaryMaxPos = {halfExtent, halfExtent, halfExtent};
+            swarm->boundaryDistance = 1.0f;
+            swarm->boundaryWeight = 1.0f;
+            swarm->maxVelocityMag = 2.0f;
+            swarm->maxAccelerationMag = 1.0f;
+            swarm->separationWeight = 1.5f;
+            swarm->separationDistance = 1.0f;
+            swarm->alignmentWeight = 1.0f;
+            swarm->alignmentDistance = 3.0f;
+            swarm->cohesionWeight = 0.8f;
+            swarm->cohesionDistance = 4.0f;
+        }
+    }
+    // deliver the component events and let the system reset the new boids
+    ecs.ProcessEvents();
+    ecs.Update(0U, 0U);
+}
+}  // namespace
+
+// One simulation step of a swarm, the argument is the number of boids.
+void BoidsSwarmStep(benchmark::State& state)
+{
+    const auto count = static_cast<uint32_t>(state.range(0));
+    IEcs::Ptr ecs = CreateBoidsEcs();
+    CreateSwarm(*ecs, count);
+    auto* system = CORE_NS::GetSystem<BOIDSSWARM_NS::IBoidsSwarmSystem>(*ecs);
+    const auto stepUs = static_cast<uint64_t>(system->GetTimeStepSec() * 1000000.0f);
+    uint64_t time = 0U;
+    for (auto _ : state) {
+        time += stepUs;
+        ecs->Update(time, stepUs);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+    ecs->Uninitialize();
+}
+
+BENCHMARK(BoidsSwarmStep)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Arg(10000)
+    ->Arg(25000)
+    ->Arg(50000)
+    ->ArgName("boids")
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
@@ -64,6 +64,20 @@ public:
         RENDER_ALWAYS,
     };
 
+    /** Mode that controls how Update executes the systems. */
+    enum class SystemUpdateMode : uint8_t {
+        /** Systems are updated one after another on the calling thread in system order. */
+        SEQUENTIAL,
+        /** Systems are updated concurrently in the ECS thread pool when their component manager dependencies don't
+         * conflict. A system is ordered after an earlier system if either writes a component manager the other reads
+         * or writes, if they are linked with afterSystem / beforeSystem, or if either uses the wildcard dependency or
+         * has no registered SystemTypeInfo. Systems must declare all the component managers they access in
+         * SystemTypeInfo::componentDependencies and SystemTypeInfo::readOnlyComponentDependencies for this to be safe.
+         * The isFrameRenderingQueued flag passed to a system reflects the systems completed before it started.
+         */
+        PARALLEL,
+    };
+
     /** Listener for ECS Entity events. */
     class EntityListener {
     public:
@@ -230,6 +244,16 @@ public:
      */
     virtual uint64_t GetId() const = 0;
 
+    /** Set how systems are executed during Update. Default is SystemUpdateMode::SEQUENTIAL.
+     * @param mode Update mode to use starting from the next Update.
+     */
+    virtual void SetSystemUpdateMode(SystemUpdateMode mode) = 0;
+
+    /** Get how systems are executed during Update.
+     * @return Current system update mode.
+     */
+    virtual SystemUpdateMode GetSystemUpdateMode() const = 0;
+
     using Ptr = BASE_NS::refcnt_ptr<IEcs>;
 
 protected:
@@ -25,6 +25,7 @@
 #include <base/namespace.h>
 #include <core/image/intf_animated_image.h>
 #include <core/image/intf_image_container.h>
+#include <core/io/intf_file.h>
 #include <core/namespace.h>
 #include <core/plugin/intf_plugin.h>
 
@@ -34,7 +35,6 @@ class array_view;
 BASE_END_NAMESPACE()
 
 CORE_BEGIN_NAMESPACE()
-class IFile;
 const int MAX_ERR_MSG_LEN = 128;
 
 // NOTE: Nicer way to return error strings.
@@ -118,6 +118,17 @@ public:
             return LoadResult{};
         }
 
+        /** Load Image file from provided file with passed flags, taking the ownership of the file. Loaders can keep
+         * a memory mapped file alive and use its contents as the image data instead of copying them.
+         * @param file File where to load from
+         * @param loadFlags Load flags. Combination of #ImageLoaderFlags
+         * @return Result of the loading operation.
+         */
+        virtual LoadResult Load(IFile::Ptr&& file, uint32_t loadFlags) const
+        {
+            return file ? Load(*file, loadFlags) : LoadResult{};
+        }
+
         /** Load image file from given data bytes
          * @param imageFileBytes Image data.
          * @param loadFlags Load flags. Combination of #ImageLoaderFlags
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 
+#include <base/containers/array_view.h>
 #include <base/containers/unique_ptr.h>
 #include <base/namespace.h>
 #include <core/namespace.h>
@@ -84,6 +85,16 @@ public:
      */
     virtual uint64_t GetPosition() const = 0;
 
+    /** Returns a read only view to the whole contents of the file when they are directly accessible in memory, e.g.
+     *  the file is memory mapped. This allows parsing the data in place instead of reading it to a separate buffer.
+     *  The view stays valid until the file is modified, closed or destroyed.
+     *  @return Contents of the file, or an empty view if the file doesn't support direct access.
+     */
+    virtual BASE_NS::array_view<const uint8_t> GetMappedData() const
+    {
+        return {};
+    }
+
     struct Deleter {
         constexpr Deleter() noexcept = default;
         void operator()(IFile* ptr) const
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef API_CORE_PERF_INTF_PERFORMANCE_CAPTURE_H
+#define API_CORE_PERF_INTF_PERFORMANCE_CAPTURE_H
+
+#include <base/containers/string_view.h>
+#include <base/namespace.h>
+#include <base/util/uid.h>
+#include <core/namespace.h>
+#include <core/plugin/intf_interface.h>
+
+CORE_BEGIN_NAMESPACE()
+class IFileManager;
+
+/** IPerformanceCapture for recording a timeline of the performance data updates.
+ * Implemented by the performance data manager factory, query with GetInterface. Internally synchronized.
+ */
+class IPerformanceCapture : public IInterface {
+public:
+    static constexpr auto UID = BASE_NS::Uid{"36915237-b4e2-4917-a504-507e9e46f9a7"};
+
+    IPerformanceCapture(const IPerformanceCapture&) = delete;
+    IPerformanceCapture& operator=(const IPerformanceCapture&) = delete;
+
+    /** Starts recording the timings and values given to the performance data managers, e.g. CORE_CPU_PERF_SCOPE.
+     * Events of a previous capture are discarded.
+     */
+    virtual void StartCapture() = 0;
+
+    /** Stops recording events. The events recorded so far are kept until the next capture is started. */
+    virtual void StopCapture() = 0;
+
+    /** Returns true while events are being recorded. */
+    virtual bool IsCapturing() const = 0;
+
+    /** Writes the recorded events as Chrome trace event JSON, which can be opened e.g. in Perfetto UI or
+     * chrome://tracing. Timings are written as complete events on the thread which measured them and other values
+     * as counters.
+     * @param fileManager File manager used for creating the file.
+     * @param uri Uri of the file to write.
+     * @return True if the file was written.
+     */
+    virtual bool ExportChromeTrace(IFileManager& fileManager, BASE_NS::string_view uri) = 0;
+
+protected:
+    IPerformanceCapture() = default;
+    virtual ~IPerformanceCapture() = default;
+};
+
+inline constexpr BASE_NS::string_view GetName(const IPerformanceCapture*)
+{
+    return "IPerformanceCapture";
+}
+CORE_END_NAMESPACE()
+
+#endif  // API_CORE_PERF_INTF_PERFORMANCE_CAPTURE_H
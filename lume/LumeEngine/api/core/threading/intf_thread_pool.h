@@ -252,6 +252,23 @@ public:
      */
     virtual ISequentialTaskQueue::Ptr CreateSequentialTaskQueue(const IThreadPool::Ptr& threadPool) const = 0;
 
+    /** Scheduling strategy of a thread pool. */
+    enum class ThreadPoolType : uint32_t {
+        /** All workers share one queue guarded by a single lock. */
+        SHARED_QUEUE = 0,
+        /** Each worker owns a lock-free deque and idle workers steal tasks from the others. Scales better when many
+         * small tasks are pushed from several threads.
+         */
+        WORK_STEALING = 1,
+    };
+
+    /** Create a thread safe thread pool using the given scheduling strategy.
+     * @param threadCount number of threads created in the pool.
+     * @param type Scheduling strategy of the pool.
+     * @return Thread pool instance.
+     */
+    virtual IThreadPool::Ptr CreateThreadPool(uint32_t threadCount, ThreadPoolType type) const = 0;
+
 protected:
     virtual ~ITaskQueueFactory() = default;
 };
@@ -16,6 +16,9 @@
 #ifndef API_CORE_UTIL_FRUSTUM_UTIL_H
 #define API_CORE_UTIL_FRUSTUM_UTIL_H
 
+#include <cstdint>
+
+#include <base/containers/array_view.h>
 #include <base/containers/refcnt_ptr.h>
 #include <base/math/vector.h>
 #include <base/namespace.h>
@@ -57,6 +60,18 @@ struct Frustum {
     BASE_NS::Math::Vec4 planes[PLANE_COUNT];
 };
 
+/** Bounding spheres in structure of arrays layout, all arrays have the same size. */
+struct FrustumSpheres {
+    /** Sphere center x coordinates */
+    BASE_NS::array_view<const float> centerX;
+    /** Sphere center y coordinates */
+    BASE_NS::array_view<const float> centerY;
+    /** Sphere center z coordinates */
+    BASE_NS::array_view<const float> centerZ;
+    /** Sphere radii */
+    BASE_NS::array_view<const float> radius;
+};
+
 class IFrustumUtil : public IInterface {
 public:
     static constexpr auto UID = BASE_NS::Uid{"3defee25-af81-4c20-b8d0-e1c3419556b2"};
@@ -78,6 +93,17 @@ public:
     virtual bool SphereFrustumCollision(
         const Frustum& frustum, const BASE_NS::Math::Vec3 pos, const float radius) const = 0;
 
+    /** Test a batch of spheres against one or several frustums.
+     * Sphere is visible when it is inside partially or fully any of the frustums, the test per frustum is the same as
+     * with SphereFrustumCollision.
+     * @param frustums Frustums to test against.
+     * @param spheres Bounding spheres to test.
+     * @param visibility Visibility bit mask, bit (i % 64) of element (i / 64) is set when sphere i is visible. Must
+     * have at least (sphere count + 63) / 64 elements. All bits of these elements are written.
+     */
+    virtual void SpheresFrustumCollision(BASE_NS::array_view<const Frustum> frustums, const FrustumSpheres& spheres,
+        BASE_NS::array_view<uint64_t> visibility) const = 0;
+
 protected:
     IFrustumUtil() = default;
     virtual ~IFrustumUtil() = default;
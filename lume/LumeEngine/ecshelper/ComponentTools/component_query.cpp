@@ -15,6 +15,8 @@
 
 #include "component_query.h"
 
+#include <algorithm>
+
 #include <base/containers/array_view.h>
 #include <base/containers/iterator.h>
 #include <base/containers/type_traits.h>
@@ -31,6 +33,23 @@ CORE_BEGIN_NAMESPACE()
 using BASE_NS::array_view;
 using BASE_NS::move;
 
+namespace {
+constexpr uint32_t INVALID_ROW = ~0U;
+
+// Minimum number of pending entities before falling back to walking the whole base component set.
+constexpr size_t MIN_PENDING_LIMIT = 64U;
+
+inline uint32_t GetEntityIndex(Entity entity)
+{
+    return static_cast<uint32_t>(entity.id & 0xFFFFFFFFU);
+}
+
+inline bool BaseIdLess(const ComponentQuery::ResultRow& lhs, const ComponentQuery::ResultRow& rhs)
+{
+    return lhs.components[0U] < rhs.components[0U];
+}
+}  // namespace
+
 ComponentQuery::~ComponentQuery()
 {
     UnregisterEcsListeners();
@@ -51,7 +70,12 @@ void ComponentQuery::SetupQuery(
     enableLookup_ = enableEntityLookup;
 
     result_.clear();
+    rowIndex_.clear();
+    mapping_.clear();
+    pending_.clear();
+    destroyedRows_.clear();
     valid_ = false;
+    fullRebuild_ = true;
 
     // Unregistering any old listeners because the operations might not use the same managers.
     UnregisterEcsListeners();
@@ -76,6 +100,7 @@ void ComponentQuery::SetupQuery(
 
 bool ComponentQuery::Execute()
 {
+    statistics_ = {};
     if ((enableListeners_ && valid_) || managers_.empty() || !managers_[0]) {
         // No changes detected since previous execute.
         // Query setup not done.
@@ -83,59 +108,14 @@ bool ComponentQuery::Execute()
         return false;
     }
 
-    const IComponentManager& baseComponentSet = *managers_[0];
-
-    const auto baseComponents = baseComponentSet.GetComponentCount();
-    result_.resize(baseComponents);
-
-    auto& em = baseComponentSet.GetEcs().GetEntityManager();
-    const size_t managerCount = managers_.size();
-    size_t index = 0U;
-    for (IComponentManager::ComponentId id = 0; id < baseComponents; ++id) {
-        const Entity entity = baseComponentSet.GetEntity(id);
-        if (!em.IsAlive(entity)) {
-            continue;
-        }
-        auto& row = result_[index];
-        row.entity = entity;
-        row.components.resize(managerCount, IComponentManager::INVALID_COMPONENT_ID);
-        row.components[0U] = id;
-
-        bool valid = true;
-
-        // NOTE: starting from index 1 that is the first manager after the base component set.
-        for (size_t i = 1; valid && (i < managerCount); ++i) {
-            const auto& manager = managers_[i];
-            const auto componentId =
-                manager ? manager->GetComponentId(entity) : IComponentManager::INVALID_COMPONENT_ID;
-            row.components[i] = componentId;
-
-            switch (operationMethods_[i]) {
-                case Operation::REQUIRE: {
-                    // for required components ID must be valid
-                    valid = (componentId != IComponentManager::INVALID_COMPONENT_ID);
-                    break;
-                }
-
-                case Operation::OPTIONAL: {
-                    // for optional ID doesn't matter
-                    break;
-                }
-
-                default: {
-                    valid = false;
-                }
-            }
-        }
-
-        if (valid) {
-            if (enableLookup_) {
-                mapping_[entity] = index;
-            }
-            ++index;
-        }
+    if (enableListeners_ && registered_ && !fullRebuild_) {
+        PatchResults();
+    } else {
+        RebuildResults();
     }
-    result_.resize(index);
+    pending_.clear();
+    // Without listeners changes are not tracked and the next execute needs to walk everything again.
+    fullRebuild_ = !(enableListeners_ && registered_);
 
     valid_ = true;
     return true;
@@ -171,15 +151,200 @@ array_view<const ComponentQuery::ResultRow> ComponentQuery::GetResults() const
 const ComponentQuery::ResultRow* ComponentQuery::FindResultRow(Entity entity) const
 {
     if (EntityUtil::IsValid(entity)) {
-        const auto it = mapping_.find(entity);
-        if (it != mapping_.end() && it->second < result_.size()) {
-            return &(result_[it->second]);
+        if (const auto index = GetEntityIndex(entity); index < rowIndex_.size()) {
+            if (const auto row = rowIndex_[index]; row < result_.size() && result_[row].entity == entity) {
+                return &(result_[row]);
+            }
+        }
+        if (!mapping_.empty()) {
+            const auto it = mapping_.find(entity);
+            if (it != mapping_.end() && it->second < result_.size()) {
+                return &(result_[it->second]);
+            }
         }
     }
 
     return nullptr;
 }
 
+const ComponentQuery::ExecuteStatistics& ComponentQuery::GetExecuteStatistics() const
+{
+    return statistics_;
+}
+
+bool ComponentQuery::EvaluateRow(const Entity entity, const IComponentManager::ComponentId baseId, ResultRow& row) const
+{
+    const size_t managerCount = managers_.size();
+    row.entity = entity;
+    row.components.resize(managerCount, IComponentManager::INVALID_COMPONENT_ID);
+    row.components[0U] = baseId;
+
+    bool valid = true;
+
+    // NOTE: starting from index 1 that is the first manager after the base component set.
+    for (size_t i = 1; valid && (i < managerCount); ++i) {
+        const auto& manager = managers_[i];
+        const auto componentId = manager ? manager->GetComponentId(entity) : IComponentManager::INVALID_COMPONENT_ID;
+        row.components[i] = componentId;
+
+        switch (operationMethods_[i]) {
+            case Operation::REQUIRE: {
+                // for required components ID must be valid
+                valid = (componentId != IComponentManager::INVALID_COMPONENT_ID);
+                break;
+            }
+
+            case Operation::OPTIONAL: {
+                // for optional ID doesn't matter
+                break;
+            }
+
+            default: {
+                valid = false;
+            }
+        }
+    }
+    return valid;
+}
+
+void ComponentQuery::RebuildResults()
+{
+    const IComponentManager& baseComponentSet = *managers_[0];
+
+    const auto baseComponents = baseComponentSet.GetComponentCount();
+    result_.resize(baseComponents);
+
+    auto& em = baseComponentSet.GetEcs().GetEntityManager();
+    size_t index = 0U;
+    for (IComponentManager::ComponentId id = 0; id < baseComponents; ++id) {
+        const Entity entity = baseComponentSet.GetEntity(id);
+        if (!em.IsAlive(entity)) {
+            continue;
+        }
+        if (EvaluateRow(entity, id, result_[index])) {
+            ++index;
+        }
+    }
+    result_.resize(index);
+
+    statistics_.evaluatedRows = baseComponents;
+    statistics_.fullRebuild = true;
+    destroyedRows_.clear();
+
+    if (enableLookup_ || enableListeners_) {
+        mapping_.clear();
+        UpdateIndex(0U);
+    }
+}
+
+void ComponentQuery::PatchResults()
+{
+    std::sort(pending_.begin(), pending_.end());
+    pending_.erase(std::unique(pending_.begin(), pending_.end()), pending_.cend());
+
+    const IComponentManager& baseComponentSet = *managers_[0];
+    if (pending_.size() > ((baseComponentSet.GetComponentCount() / 2U) + MIN_PENDING_LIMIT)) {
+        RebuildResults();
+        return;
+    }
+
+    // Remove the current rows of the changed entities while keeping the rest in base component order. Rows of
+    // destroyed entities were already dropped from the lookup and are removed by row number.
+    size_t firstChanged = result_.size();
+    for (const auto index : destroyedRows_) {
+        if (index < result_.size() && EntityUtil::IsValid(result_[index].entity)) {
+            result_[index].entity = {};
+            firstChanged = std::min(firstChanged, static_cast<size_t>(index));
+            ++statistics_.removedRows;
+        }
+    }
+    destroyedRows_.clear();
+    for (const auto& entity : pending_) {
+        if (const auto* row = FindResultRow(entity); row) {
+            const auto index = static_cast<size_t>(row - result_.data());
+            result_[index].entity = {};
+            firstChanged = std::min(firstChanged, index);
+            ++statistics_.removedRows;
+        }
+    }
+    if (statistics_.removedRows) {
+        result_.erase(std::remove_if(result_.begin(), result_.end(),
+                          [](const ResultRow& row) { return !EntityUtil::IsValid(row.entity); }),
+            result_.cend());
+    }
+
+    // Re-evaluate the changed entities and merge the ones which still match.
+    auto& em = baseComponentSet.GetEcs().GetEntityManager();
+    BASE_NS::vector<ResultRow> added;
+    for (const auto& entity : pending_) {
+        const auto id = baseComponentSet.GetComponentId(entity);
+        if (id == IComponentManager::INVALID_COMPONENT_ID || !em.IsAlive(entity)) {
+            continue;
+        }
+        ++statistics_.evaluatedRows;
+        ResultRow row;
+        if (EvaluateRow(entity, id, row)) {
+            added.push_back(move(row));
+        }
+    }
+    if (!added.empty()) {
+        std::sort(added.begin(), added.end(), BaseIdLess);
+        const auto first = std::lower_bound(result_.cbegin(), result_.cend(), added.front(), BaseIdLess);
+        firstChanged = std::min(firstChanged, static_cast<size_t>(first - result_.cbegin()));
+        const auto oldSize = static_cast<ptrdiff_t>(result_.size());
+        result_.reserve(result_.size() + added.size());
+        for (auto& row : added) {
+            result_.push_back(move(row));
+        }
+        std::inplace_merge(result_.begin(), result_.begin() + oldSize, result_.end(), BaseIdLess);
+    }
+
+    UpdateIndex(firstChanged);
+}
+
+void ComponentQuery::UpdateIndex(const size_t firstRow)
+{
+    // Rows before firstRow didn't move, entries pointing after it are rewritten.
+    if (!mapping_.empty()) {
+        for (auto it = mapping_.begin(); it != mapping_.end();) {
+            if (it->second >= firstRow) {
+                it = mapping_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    for (size_t row = firstRow; row < result_.size(); ++row) {
+        const Entity entity = result_[row].entity;
+        const auto index = GetEntityIndex(entity);
+        if (index >= rowIndex_.size()) {
+            rowIndex_.resize(static_cast<size_t>(index) + 1U, INVALID_ROW);
+        }
+        if (const auto previous = rowIndex_[index];
+            (previous < row) && (GetEntityIndex(result_[previous].entity) == index)) {
+            // Another generation of the same entity index is already indexed.
+            mapping_[entity] = row;
+        } else {
+            rowIndex_[index] = static_cast<uint32_t>(row);
+        }
+    }
+}
+
+void ComponentQuery::AddPendingEntities(const array_view<const Entity> entities)
+{
+    if (fullRebuild_) {
+        return;
+    }
+    if ((pending_.size() + entities.size()) >
+        ((managers_[0] ? managers_[0]->GetComponentCount() : 0U) + MIN_PENDING_LIMIT)) {
+        // Walking everything is cheaper than patching.
+        fullRebuild_ = true;
+        pending_.clear();
+        return;
+    }
+    pending_.append(entities.cbegin(), entities.cend());
+}
+
 void ComponentQuery::RegisterEcsListeners()
 {
     if (!registered_ && !managers_.empty()) {
@@ -192,6 +357,8 @@ void ComponentQuery::RegisterEcsListeners()
         }
         ecs_->AddListener(static_cast<IEcs::EntityListener&>(*this));
         registered_ = true;
+        // Changes done while not listening are unknown.
+        fullRebuild_ = true;
     }
 }
 
@@ -211,9 +378,9 @@ void ComponentQuery::UnregisterEcsListeners()
 void ComponentQuery::OnEntityEvent(const IEcs::EntityListener::EventType type, const array_view<const Entity> entities)
 {
     if (type == IEcs::EntityListener::EventType::ACTIVATED || type == IEcs::EntityListener::EventType::DEACTIVATED) {
-        if (!valid_) {
-            // Listener is only used to invalidate the quety. If the query is already invalid -> no need to check
-            // anything.
+        if (!valid_ && fullRebuild_) {
+            // Listener is only used to invalidate the query and to collect the entities to re-evaluate. If the query
+            // is already invalid and will be rebuilt -> no need to check anything.
             return;
         }
         const auto managerCount = managers_.size();
@@ -232,26 +399,40 @@ void ComponentQuery::OnEntityEvent(const IEcs::EntityListener::EventType type, c
             }
 
             if (isRelevantEntity) {
-                // Marking this query as invalid. No need to iterate entities further.
+                // Marking this query as invalid and patching the entity's row on next execute.
                 valid_ = false;
-                return;
+                AddPendingEntities({&entity, 1U});
             }
         }
     } else if (type == IEcs::EntityListener::EventType::DESTROYED) {
-        if (enableLookup_) {
-            for (const auto& entity : entities) {
-                mapping_.erase(entity);
+        // Destroyed entities must not be found anymore even before the next execute removes their rows.
+        for (const auto& entity : entities) {
+            const ResultRow* row = FindResultRow(entity);
+            if (!row) {
+                continue;
+            }
+            const auto rowNumber = static_cast<uint32_t>(row - result_.data());
+            const auto index = GetEntityIndex(entity);
+            if ((index < rowIndex_.size()) && (rowIndex_[index] == rowNumber)) {
+                rowIndex_[index] = INVALID_ROW;
             }
+            mapping_.erase(entity);
+            destroyedRows_.push_back(rowNumber);
+            valid_ = false;
+            AddPendingEntities({&entity, 1U});
         }
     }
 }
 
 void ComponentQuery::OnComponentEvent(const IEcs::ComponentListener::EventType type,
-    const IComponentManager& /* componentManager */, const array_view<const Entity> /* entities */)
+    const IComponentManager& /* componentManager */, const array_view<const Entity> entities)
 {
-    // We only get events from relevant managers. If they have new or deleted components, the query is no longer valid.
-    if (type == IEcs::ComponentListener::EventType::CREATED || type == IEcs::ComponentListener::EventType::DESTROYED) {
+    // We only get events from relevant managers. If they have new, moved or deleted components, the query is no longer
+    // valid and the rows of these entities need to be re-evaluated. Moved components have new component ids.
+    if (type == IEcs::ComponentListener::EventType::CREATED || type == IEcs::ComponentListener::EventType::DESTROYED ||
+        type == IEcs::ComponentListener::EventType::MOVED) {
         valid_ = false;
+        AddPendingEntities(entities);
     }
 }
 CORE_END_NAMESPACE()
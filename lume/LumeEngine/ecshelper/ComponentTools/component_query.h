@@ -65,6 +65,9 @@ public:
         bool enableEntityLookup = false);
 
     /** Executes the query. Assumes that the query has been set up earlier.
+     * When ECS listeners are enabled, only the rows of the entities reported by the component and entity events since
+     * the previous execute are re-evaluated and the result is patched in place. Otherwise the whole base component set
+     * is walked.
      * @return True if there are possible changes in the query result since previous execute.
      */
     bool Execute();
@@ -122,7 +125,27 @@ public:
      */
     const ResultRow* FindResultRow(Entity entity) const;
 
+    /** Statistics of the latest Execute() call. */
+    struct ExecuteStatistics {
+        /** Number of result rows which were evaluated from the component managers. */
+        size_t evaluatedRows{0U};
+        /** Number of result rows which were removed when patching the result. */
+        size_t removedRows{0U};
+        /** True if the whole base component set was walked instead of patching the result. */
+        bool fullRebuild{false};
+    };
+
+    /** Returns statistics of the latest Execute() call, e.g. to see how many rows were rebuilt in a frame.
+     * @return Statistics, all zero if the latest Execute() didn't update the result.
+     */
+    const ExecuteStatistics& GetExecuteStatistics() const;
+
 private:
+    bool EvaluateRow(Entity entity, IComponentManager::ComponentId baseId, ResultRow& row) const;
+    void RebuildResults();
+    void PatchResults();
+    void UpdateIndex(size_t firstRow);
+    void AddPendingEntities(BASE_NS::array_view<const Entity> entities);
     void RegisterEcsListeners();
     void UnregisterEcsListeners();
 
@@ -137,11 +160,21 @@ private:
     BASE_NS::vector<ResultRow> result_;
     BASE_NS::vector<IComponentManager*> managers_;
     BASE_NS::vector<Operation::Method> operationMethods_;
+    // Result row of each entity indexed by the entity's index. Entities whose slot is taken by another generation of
+    // the same index are in mapping_.
+    BASE_NS::vector<uint32_t> rowIndex_;
     BASE_NS::unordered_map<Entity, size_t> mapping_;
+    // Entities reported by the listeners since the previous execute.
+    BASE_NS::vector<Entity> pending_;
+    // Rows of destroyed entities which were already removed from the lookup.
+    BASE_NS::vector<uint32_t> destroyedRows_;
+    ExecuteStatistics statistics_;
     bool enableLookup_{false};
     bool enableListeners_{false};
     bool registered_{false};
     bool valid_{false};
+    // Set when the pending entities don't cover all the changes, e.g. events were missed while not listening.
+    bool fullRebuild_{true};
 };
 CORE_END_NAMESPACE()
 
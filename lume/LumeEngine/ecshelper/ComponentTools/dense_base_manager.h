@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE__ECS_HELPER__COMPONENT_TOOLS__DENSE_BASE_MANAGER_H
+#define CORE__ECS_HELPER__COMPONENT_TOOLS__DENSE_BASE_MANAGER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <base/containers/array_view.h>
+#include <base/containers/string_view.h>
+#include <base/containers/unordered_map.h>
+#include <base/containers/vector.h>
+#include <base/namespace.h>
+#include <base/util/uid.h>
+#include <core/ecs/entity.h>
+#include <core/ecs/intf_component_manager.h>
+#include <core/namespace.h>
+#include <core/property/intf_property_api.h>
+#include <core/property/intf_property_handle.h>
+#include <core/property/scoped_handle.h>
+
+CORE_BEGIN_NAMESPACE()
+class IEcs;
+struct Property;
+
+// Alternative to BaseManager with structure of arrays storage, for components which are iterated in bulk.
+// Component payloads are kept contiguous in a single vector indexed by ComponentId and the per component metadata
+// (entity, generation, dirty flag and the property handle) lives in parallel vectors. Entities are mapped to
+// component ids through a sparse array indexed by the entity id, entities whose id is still used by a component of
+// an older generation of the same id fall back to a hash map.
+// Behaves like BaseManager otherwise: component ids are stable until Gc, and all components are reported as moved
+// when the storage is reallocated.
+template<typename ComponentType, typename BaseClass>
+class DenseBaseManager : public BaseClass, public IPropertyApi {
+    using ComponentId = IComponentManager::ComponentId;
+
+public:
+    // IPropertyApi
+    size_t PropertyCount() const override = 0;
+    const Property* MetaData(size_t index) const override = 0;
+    BASE_NS::array_view<const Property> MetaData() const override = 0;
+    IPropertyHandle* Create() const override;
+    IPropertyHandle* Clone(const IPropertyHandle*) const override;
+    void Release(IPropertyHandle*) const override;
+    uint64_t Type() const override;
+
+    // IComponentManager
+    BASE_NS::string_view GetName() const override;
+    BASE_NS::Uid GetUid() const override;
+    size_t GetComponentCount() const override;
+    const IPropertyApi& GetPropertyApi() const override;
+    Entity GetEntity(ComponentId index) const override;
+    uint32_t GetComponentGeneration(ComponentId index) const override;
+    bool HasComponent(Entity entity) const override;
+    IComponentManager::ComponentId GetComponentId(Entity entity) const override;
+    void Create(Entity entity) override;
+    bool Destroy(Entity entity) override;
+    void Gc() override;
+    void Destroy(BASE_NS::array_view<const Entity> gcList) override;
+    BASE_NS::vector<Entity> GetAddedComponents() override;
+    BASE_NS::vector<Entity> GetRemovedComponents() override;
+    BASE_NS::vector<Entity> GetUpdatedComponents() override;
+    BASE_NS::vector<Entity> GetMovedComponents() override;
+    CORE_NS::ComponentManagerModifiedFlags GetModifiedFlags() const override;
+    void ClearModifiedFlags() override;
+    uint32_t GetGenerationCounter() const override;
+    void SetData(Entity entity, const IPropertyHandle& dataHandle) override;
+    const IPropertyHandle* GetData(Entity entity) const override;
+    IPropertyHandle* GetData(Entity entity) override;
+    void SetData(ComponentId index, const IPropertyHandle& dataHandle) override;
+    const IPropertyHandle* GetData(ComponentId index) const override;
+    IPropertyHandle* GetData(ComponentId index) override;
+    IEcs& GetEcs() const override;
+
+    // "base class"
+    ComponentType Get(ComponentId index) const override;
+    ComponentType Get(Entity entity) const override;
+    void Set(ComponentId index, const ComponentType& aData) override;
+    void Set(Entity entity, const ComponentType& aData) override;
+    ScopedHandle<const ComponentType> Read(ComponentId index) const override;
+    ScopedHandle<const ComponentType> Read(Entity entity) const override;
+    ScopedHandle<ComponentType> Write(ComponentId index) override;
+    ScopedHandle<ComponentType> Write(Entity entity) override;
+
+    // internal, non-public
+    void Updated(ComponentId index);
+
+    DenseBaseManager(const DenseBaseManager&) = delete;
+    DenseBaseManager(DenseBaseManager&&) = delete;
+    DenseBaseManager& operator=(const DenseBaseManager&) = delete;
+    DenseBaseManager& operator=(DenseBaseManager&&) = delete;
+
+protected:
+    DenseBaseManager(IEcs& ecs, BASE_NS::string_view) noexcept;
+    DenseBaseManager(IEcs& ecs, BASE_NS::string_view, size_t preallocate) noexcept;
+    virtual ~DenseBaseManager();
+
+    // Contiguous payloads of all the components indexed by ComponentId. Invalidated when components are added or
+    // garbage collected. Writes must go through Set or Write so that generations and modification events are kept.
+    BASE_NS::array_view<const ComponentType> GetComponentData() const;
+
+    IEcs& ecs_;
+    BASE_NS::string_view name_;
+
+    bool IsMatchingHandle(const IPropertyHandle& handle);
+
+    // Handle of a component bound to an entity. The handle doesn't hold any data, its index in handles_ is the
+    // index of the payload.
+    class ComponentHandle : public IPropertyHandle {
+    public:
+        ComponentHandle() = delete;
+        explicit ComponentHandle(DenseBaseManager* owner) noexcept;
+        ~ComponentHandle() override = default;
+        ComponentHandle(const ComponentHandle& other) = delete;
+        ComponentHandle(ComponentHandle&& other) noexcept;
+        ComponentHandle& operator=(const ComponentHandle& other) = delete;
+        ComponentHandle& operator=(ComponentHandle&& other) noexcept;
+        const IPropertyApi* Owner() const override;
+        size_t Size() const override;
+        const void* RLock() const override;
+        void RUnlock() const override;
+        void* WLock() override;
+        void WUnlock() override;
+#ifndef NDEBUG
+        mutable int32_t rLocked_ { 0 };
+        mutable bool wLocked_ { false };
+#endif
+        DenseBaseManager* manager_ { nullptr };
+
+    private:
+        ComponentId Index() const;
+    };
+
+    // Handle created with IPropertyApi::Create or Clone, owns its data.
+    class DetachedHandle final : public IPropertyHandle {
+    public:
+        DetachedHandle(const DenseBaseManager* owner, const ComponentType& data) noexcept;
+        ~DetachedHandle() override = default;
+        const IPropertyApi* Owner() const override;
+        size_t Size() const override;
+        const void* RLock() const override;
+        void RUnlock() const override;
+        void* WLock() override;
+        void WUnlock() override;
+
+        const DenseBaseManager* manager_ { nullptr };
+        ComponentType data_;
+    };
+
+    ComponentId FindId(Entity entity) const;
+    void InsertId(Entity entity, ComponentId id);
+    void EraseId(Entity entity, ComponentId id);
+    void ChangeId(Entity entity, ComponentId oldId, ComponentId newId);
+    ComponentId Append(Entity entity, const ComponentType& data);
+
+    uint32_t generationCounter_ { 0 };
+    uint32_t modifiedFlags_ { 0 };
+    // Component payloads.
+    BASE_NS::vector<ComponentType> data_;
+    // Metadata, parallel to data_.
+    BASE_NS::vector<Entity> entities_;
+    BASE_NS::vector<uint32_t> generations_;
+    BASE_NS::vector<uint8_t> dirty_;
+    BASE_NS::vector<ComponentHandle> handles_;
+    // Component id of each entity id.
+    BASE_NS::vector<ComponentId> sparse_;
+    // Entities whose slot in sparse_ was taken by another generation.
+    BASE_NS::unordered_map<Entity, ComponentId> overflow_;
+    BASE_NS::vector<Entity> added_;
+    BASE_NS::vector<Entity> removed_;
+    BASE_NS::vector<Entity> moved_;
+    uint64_t typeHash_;
+};
+CORE_END_NAMESPACE()
+#endif
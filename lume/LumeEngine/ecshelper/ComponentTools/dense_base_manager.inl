@@ -0,0 +1,654 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <base/util/log.h>
+#ifndef NDEBUG
+#include <base/containers/atomics.h>
+#endif
+
+CORE_BEGIN_NAMESPACE()
+namespace DenseBaseManagerUtil {
+constexpr uint32_t MODIFIED = 0x80000000;
+
+// Default initial reservation for 8 components/entities.
+// Will resize as needed.
+constexpr size_t INITIAL_COMPONENT_RESERVE_SIZE = 8;
+
+// Entity ids are indices to the entity manager's entity array, the generation is in the high bits.
+inline uint32_t EntityIndex(Entity entity)
+{
+    return static_cast<uint32_t>(entity.id & 0xFFFFFFFFu);
+}
+} // namespace DenseBaseManagerUtil
+
+// IPropertyApi
+template<typename ComponentType, typename BaseClass>
+IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::Create() const
+{
+    return new DetachedHandle(this, {});
+}
+
+template<typename ComponentType, typename BaseClass>
+IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::Clone(const IPropertyHandle* src) const
+{
+    if (src->Owner() == this) {
+        if (const auto data = ScopedHandle<const ComponentType>(src); data) {
+            return new DetachedHandle(this, *data);
+        }
+    }
+    return nullptr;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Release(IPropertyHandle* dst) const
+{
+    if (dst && (dst->Owner() == this)) {
+        // we can only destroy things we "own" (know). handles bound to components are in handles_.
+        const auto address = reinterpret_cast<uintptr_t>(dst);
+        const auto first = reinterpret_cast<uintptr_t>(static_cast<const IPropertyHandle*>(handles_.data()));
+        if ((address >= first) && (address < (first + handles_.size() * sizeof(ComponentHandle)))) {
+            return;
+        }
+        delete static_cast<DetachedHandle*>(dst);
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+uint64_t DenseBaseManager<ComponentType, BaseClass>::Type() const
+{
+    return typeHash_;
+}
+
+// IComponentManager
+template<typename ComponentType, typename BaseClass>
+BASE_NS::string_view DenseBaseManager<ComponentType, BaseClass>::GetName() const
+{
+    return name_;
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::Uid DenseBaseManager<ComponentType, BaseClass>::GetUid() const
+{
+    return BaseClass::UID;
+}
+
+template<typename ComponentType, typename BaseClass>
+size_t DenseBaseManager<ComponentType, BaseClass>::GetComponentCount() const
+{
+    return data_.size();
+}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyApi& DenseBaseManager<ComponentType, BaseClass>::GetPropertyApi() const
+{
+    return *this;
+}
+
+template<typename ComponentType, typename BaseClass>
+CORE_NS::Entity DenseBaseManager<ComponentType, BaseClass>::GetEntity(ComponentId index) const
+{
+    if (index < entities_.size()) {
+        return entities_[index];
+    }
+    return CORE_NS::Entity();
+}
+
+template<typename ComponentType, typename BaseClass>
+uint32_t DenseBaseManager<ComponentType, BaseClass>::GetComponentGeneration(ComponentId index) const
+{
+    if (index < generations_.size()) {
+        return generations_[index];
+    }
+    return 0;
+}
+
+template<typename ComponentType, typename BaseClass>
+bool DenseBaseManager<ComponentType, BaseClass>::HasComponent(CORE_NS::Entity entity) const
+{
+    return FindId(entity) != IComponentManager::INVALID_COMPONENT_ID;
+}
+
+template<typename ComponentType, typename BaseClass>
+IComponentManager::ComponentId DenseBaseManager<ComponentType, BaseClass>::GetComponentId(
+    CORE_NS::Entity entity) const
+{
+    return FindId(entity);
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Create(CORE_NS::Entity entity)
+{
+    if (EntityUtil::IsValid(entity)) {
+        if (const auto id = FindId(entity); id == IComponentManager::INVALID_COMPONENT_ID) {
+            Append(entity, {});
+        } else {
+            if (auto dst = ScopedHandle<ComponentType>(&handles_[id]); dst) {
+                *dst = {};
+            }
+        }
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+bool DenseBaseManager<ComponentType, BaseClass>::Destroy(CORE_NS::Entity entity)
+{
+    if (const auto id = FindId(entity); id != IComponentManager::INVALID_COMPONENT_ID) {
+        EraseId(entity, id);
+        entities_[id] = {}; // invalid entity. (marks it as ready for re-use)
+        removed_.push_back(entity);
+        modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_REMOVED_BIT;
+        ++generationCounter_;
+        return true;
+    }
+    return false;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Gc()
+{
+    const bool hasRemovedComponents = modifiedFlags_ & CORE_COMPONENT_MANAGER_COMPONENT_REMOVED_BIT;
+    if (!hasRemovedComponents) {
+        return;
+    }
+    ComponentId componentCount = static_cast<ComponentId>(entities_.size());
+    for (ComponentId id = 0; id < componentCount;) {
+        if (EntityUtil::IsValid(entities_[id])) {
+            ++id;
+            continue;
+        }
+        // invalid entity.. if so clean garbage
+        // find last valid and swap with it
+        ComponentId rid = componentCount - 1;
+        while ((rid > id) && !EntityUtil::IsValid(entities_[rid])) {
+            --rid;
+        }
+        if ((rid > id) && EntityUtil::IsValid(entities_[rid])) {
+            const Entity entity = entities_[rid];
+            moved_.push_back(entity);
+            ChangeId(entity, rid, id);
+            data_[id] = BASE_NS::move(data_[rid]);
+            entities_[id] = BASE_NS::exchange(entities_[rid], {});
+            generations_[id] = generations_[rid];
+            dirty_[id] = dirty_[rid];
+        }
+        --componentCount;
+    }
+    if (!moved_.empty()) {
+        modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_MOVED_BIT;
+    }
+    if (data_.size() > componentCount) {
+        data_.erase(data_.cbegin() + componentCount, data_.cend());
+        entities_.erase(entities_.cbegin() + componentCount, entities_.cend());
+        generations_.erase(generations_.cbegin() + componentCount, generations_.cend());
+        dirty_.erase(dirty_.cbegin() + componentCount, dirty_.cend());
+        handles_.erase(handles_.cbegin() + componentCount, handles_.cend());
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Destroy(BASE_NS::array_view<const CORE_NS::Entity> gcList)
+{
+    for (const CORE_NS::Entity e : gcList) {
+        Destroy(e);
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::vector<CORE_NS::Entity> DenseBaseManager<ComponentType, BaseClass>::GetAddedComponents()
+{
+    return BASE_NS::move(added_);
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::vector<CORE_NS::Entity> DenseBaseManager<ComponentType, BaseClass>::GetRemovedComponents()
+{
+    return BASE_NS::move(removed_);
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::vector<CORE_NS::Entity> DenseBaseManager<ComponentType, BaseClass>::GetUpdatedComponents()
+{
+    BASE_NS::vector<CORE_NS::Entity> updated;
+    if (modifiedFlags_ & DenseBaseManagerUtil::MODIFIED) {
+        modifiedFlags_ &= ~DenseBaseManagerUtil::MODIFIED;
+        updated.reserve(dirty_.size() / 2U); // 2: approximation for vector reserve size
+        for (size_t i = 0U; i < dirty_.size(); ++i) {
+            if (dirty_[i]) {
+                dirty_[i] = 0U;
+                updated.push_back(entities_[i]);
+            }
+        }
+    }
+    return updated;
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::vector<CORE_NS::Entity> DenseBaseManager<ComponentType, BaseClass>::GetMovedComponents()
+{
+    return BASE_NS::move(moved_);
+}
+
+template<typename ComponentType, typename BaseClass>
+CORE_NS::ComponentManagerModifiedFlags DenseBaseManager<ComponentType, BaseClass>::GetModifiedFlags() const
+{
+    return modifiedFlags_ & ~DenseBaseManagerUtil::MODIFIED;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::ClearModifiedFlags()
+{
+    modifiedFlags_ &= DenseBaseManagerUtil::MODIFIED;
+}
+
+template<typename ComponentType, typename BaseClass>
+uint32_t DenseBaseManager<ComponentType, BaseClass>::GetGenerationCounter() const
+{
+    return generationCounter_;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::SetData(CORE_NS::Entity entity, const IPropertyHandle& dataHandle)
+{
+    if (const auto id = FindId(entity); id != IComponentManager::INVALID_COMPONENT_ID) {
+        SetData(id, dataHandle);
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::GetData(CORE_NS::Entity entity) const
+{
+    return GetData(FindId(entity));
+}
+
+template<typename ComponentType, typename BaseClass>
+IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::GetData(CORE_NS::Entity entity)
+{
+    return GetData(FindId(entity));
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::SetData(ComponentId index, const IPropertyHandle& dataHandle)
+{
+    if (!IsMatchingHandle(dataHandle)) {
+        return;
+    }
+    if (index < handles_.size()) {
+        if (const auto src = ScopedHandle<const ComponentType>(&dataHandle); src) {
+            if (auto dst = ScopedHandle<ComponentType>(&handles_[index]); dst) {
+                *dst = *src;
+            }
+        }
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::GetData(ComponentId index) const
+{
+    if (index < handles_.size()) {
+        return &handles_[index];
+    }
+    return nullptr;
+}
+
+template<typename ComponentType, typename BaseClass>
+IPropertyHandle* DenseBaseManager<ComponentType, BaseClass>::GetData(ComponentId index)
+{
+    if (index < handles_.size()) {
+        return &handles_[index];
+    }
+    return nullptr;
+}
+
+template<typename ComponentType, typename BaseClass>
+IEcs& DenseBaseManager<ComponentType, BaseClass>::GetEcs() const
+{
+    return ecs_;
+}
+
+// "base class"
+template<typename ComponentType, typename BaseClass>
+ComponentType DenseBaseManager<ComponentType, BaseClass>::Get(ComponentId index) const
+{
+    if (auto handle = ScopedHandle<const ComponentType>(GetData(index))) {
+        return *handle;
+    }
+    return ComponentType {};
+}
+
+template<typename ComponentType, typename BaseClass>
+ComponentType DenseBaseManager<ComponentType, BaseClass>::Get(CORE_NS::Entity entity) const
+{
+    return Get(FindId(entity));
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Set(ComponentId index, const ComponentType& data)
+{
+    if (auto handle = ScopedHandle<ComponentType>(GetData(index))) {
+        *handle = data;
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Set(CORE_NS::Entity entity, const ComponentType& data)
+{
+    if (EntityUtil::IsValid(entity)) {
+        if (const auto id = FindId(entity); id == IComponentManager::INVALID_COMPONENT_ID) {
+            generations_[Append(entity, data)] = 1;
+        } else {
+            if (auto handle = ScopedHandle<ComponentType>(&handles_[id]); handle) {
+                *handle = data;
+            }
+        }
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+ScopedHandle<const ComponentType> DenseBaseManager<ComponentType, BaseClass>::Read(ComponentId index) const
+{
+    return ScopedHandle<const ComponentType> { GetData(index) };
+}
+
+template<typename ComponentType, typename BaseClass>
+ScopedHandle<const ComponentType> DenseBaseManager<ComponentType, BaseClass>::Read(CORE_NS::Entity entity) const
+{
+    return ScopedHandle<const ComponentType> { GetData(FindId(entity)) };
+}
+
+template<typename ComponentType, typename BaseClass>
+ScopedHandle<ComponentType> DenseBaseManager<ComponentType, BaseClass>::Write(ComponentId index)
+{
+    return ScopedHandle<ComponentType> { GetData(index) };
+}
+
+template<typename ComponentType, typename BaseClass>
+ScopedHandle<ComponentType> DenseBaseManager<ComponentType, BaseClass>::Write(CORE_NS::Entity entity)
+{
+    return ScopedHandle<ComponentType> { GetData(FindId(entity)) };
+}
+
+// internal
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::Updated(ComponentId index)
+{
+    ++generations_[index];
+    if (EntityUtil::IsValid(entities_[index])) {
+        dirty_[index] = 1U;
+        modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_UPDATED_BIT | DenseBaseManagerUtil::MODIFIED;
+        ++generationCounter_;
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::DenseBaseManager(IEcs& ecs, const BASE_NS::string_view name) noexcept
+    : DenseBaseManager(ecs, name, DenseBaseManagerUtil::INITIAL_COMPONENT_RESERVE_SIZE)
+{}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::DenseBaseManager(
+    IEcs& ecs, const BASE_NS::string_view name, const size_t preallocate) noexcept
+    : ecs_(ecs), name_(name), typeHash_(BASE_NS::FNV1aHash(name.data(), name.size()))
+{
+    if (preallocate) {
+        data_.reserve(preallocate);
+        entities_.reserve(preallocate);
+        generations_.reserve(preallocate);
+        dirty_.reserve(preallocate);
+        handles_.reserve(preallocate);
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::~DenseBaseManager()
+{
+    BASE_ASSERT(GetComponentCount() == 0);
+}
+
+template<typename ComponentType, typename BaseClass>
+BASE_NS::array_view<const ComponentType> DenseBaseManager<ComponentType, BaseClass>::GetComponentData() const
+{
+    return data_;
+}
+
+template<typename ComponentType, typename BaseClass>
+bool DenseBaseManager<ComponentType, BaseClass>::IsMatchingHandle(const IPropertyHandle& dataHandle)
+{
+    if (dataHandle.Owner() == this) {
+        return true;
+    }
+    if (dataHandle.Owner() && (dataHandle.Owner()->Type() == typeHash_)) {
+        return true;
+    }
+    return false;
+}
+
+template<typename ComponentType, typename BaseClass>
+IComponentManager::ComponentId DenseBaseManager<ComponentType, BaseClass>::FindId(Entity entity) const
+{
+    if (!EntityUtil::IsValid(entity)) {
+        return IComponentManager::INVALID_COMPONENT_ID;
+    }
+    if (const auto index = DenseBaseManagerUtil::EntityIndex(entity); index < sparse_.size()) {
+        if (const auto id = sparse_[index];
+            (id != IComponentManager::INVALID_COMPONENT_ID) && (entities_[id] == entity)) {
+            return id;
+        }
+    }
+    if (!overflow_.empty()) {
+        if (const auto it = overflow_.find(entity); it != overflow_.end()) {
+            return it->second;
+        }
+    }
+    return IComponentManager::INVALID_COMPONENT_ID;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::InsertId(Entity entity, ComponentId id)
+{
+    const auto index = DenseBaseManagerUtil::EntityIndex(entity);
+    if (index == INVALID_ENTITY) {
+        overflow_.insert({ entity, id });
+        return;
+    }
+    if (index >= sparse_.size()) {
+        sparse_.resize(static_cast<size_t>(index) + 1U, IComponentManager::INVALID_COMPONENT_ID);
+    }
+    if (sparse_[index] == IComponentManager::INVALID_COMPONENT_ID) {
+        sparse_[index] = id;
+    } else {
+        // an entity with the same index but an older generation hasn't been destroyed yet.
+        overflow_.insert({ entity, id });
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::EraseId(Entity entity, ComponentId id)
+{
+    if (const auto index = DenseBaseManagerUtil::EntityIndex(entity);
+        (index < sparse_.size()) && (sparse_[index] == id)) {
+        sparse_[index] = IComponentManager::INVALID_COMPONENT_ID;
+    } else {
+        overflow_.erase(entity);
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::ChangeId(Entity entity, ComponentId oldId, ComponentId newId)
+{
+    if (const auto index = DenseBaseManagerUtil::EntityIndex(entity);
+        (index < sparse_.size()) && (sparse_[index] == oldId)) {
+        sparse_[index] = newId;
+    } else {
+        overflow_[entity] = newId;
+    }
+}
+
+template<typename ComponentType, typename BaseClass>
+IComponentManager::ComponentId DenseBaseManager<ComponentType, BaseClass>::Append(
+    Entity entity, const ComponentType& data)
+{
+    const auto id = static_cast<ComponentId>(data_.size());
+    const auto oldCapacity = data_.capacity();
+    const auto oldHandleCapacity = handles_.capacity();
+    data_.push_back(data);
+    entities_.push_back(entity);
+    generations_.push_back(0U);
+    dirty_.push_back(0U);
+    handles_.emplace_back(this);
+    InsertId(entity, id);
+    if ((data_.capacity() != oldCapacity) || (handles_.capacity() != oldHandleCapacity)) {
+        moved_.reserve(moved_.size() + entities_.size());
+        moved_.append(entities_.cbegin(), entities_.cend());
+        modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_MOVED_BIT;
+    }
+    added_.push_back(entity);
+    modifiedFlags_ |= CORE_COMPONENT_MANAGER_COMPONENT_ADDED_BIT;
+    ++generationCounter_;
+    return id;
+}
+
+// handle implementation
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::ComponentHandle(DenseBaseManager* owner) noexcept
+    : manager_(owner)
+{}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::ComponentHandle(ComponentHandle&& other) noexcept
+    :
+#ifndef NDEBUG
+      rLocked_(BASE_NS::exchange(other.rLocked_, 0U)), wLocked_(BASE_NS::exchange(other.wLocked_, false)),
+#endif
+      manager_(other.manager_)
+{
+#ifndef NDEBUG
+    BASE_ASSERT((rLocked_ == 0U) && !wLocked_);
+#endif
+}
+
+template<typename ComponentType, typename BaseClass>
+typename DenseBaseManager<ComponentType, BaseClass>::ComponentHandle&
+DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::operator=(ComponentHandle&& other) noexcept
+{
+    if (this != &other) {
+        BASE_ASSERT(manager_ == other.manager_);
+#ifndef NDEBUG
+        BASE_ASSERT((other.rLocked_ == 0U) && !other.wLocked_);
+        rLocked_ = BASE_NS::exchange(other.rLocked_, 0U);
+        wLocked_ = BASE_NS::exchange(other.wLocked_, false);
+#endif
+    }
+    return *this;
+}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyApi* DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::Owner() const
+{
+    return manager_;
+}
+
+template<typename ComponentType, typename BaseClass>
+size_t DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::Size() const
+{
+    return sizeof(ComponentType);
+}
+
+template<typename ComponentType, typename BaseClass>
+const void* DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::RLock() const
+{
+    BASE_ASSERT(manager_);
+#ifndef NDEBUG
+    BASE_ASSERT(!wLocked_);
+    BASE_NS::AtomicIncrementRelaxed(&rLocked_);
+#endif
+    return &manager_->data_[Index()];
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::RUnlock() const
+{
+    BASE_ASSERT(manager_);
+#ifndef NDEBUG
+    BASE_ASSERT(rLocked_ > 0U);
+    BASE_NS::AtomicDecrementRelaxed(&rLocked_);
+#endif
+}
+
+template<typename ComponentType, typename BaseClass>
+void* DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::WLock()
+{
+    BASE_ASSERT(manager_);
+#ifndef NDEBUG
+    BASE_ASSERT(rLocked_ <= 1U && !wLocked_);
+    wLocked_ = true;
+#endif
+    return &manager_->data_[Index()];
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::WUnlock()
+{
+    BASE_ASSERT(manager_);
+#ifndef NDEBUG
+    BASE_ASSERT(wLocked_);
+    wLocked_ = false;
+#endif
+    // update generation etc..
+    manager_->Updated(Index());
+}
+
+template<typename ComponentType, typename BaseClass>
+IComponentManager::ComponentId DenseBaseManager<ComponentType, BaseClass>::ComponentHandle::Index() const
+{
+    return static_cast<ComponentId>(this - manager_->handles_.data());
+}
+
+template<typename ComponentType, typename BaseClass>
+DenseBaseManager<ComponentType, BaseClass>::DetachedHandle::DetachedHandle(
+    const DenseBaseManager* owner, const ComponentType& data) noexcept
+    : manager_(owner), data_(data)
+{}
+
+template<typename ComponentType, typename BaseClass>
+const IPropertyApi* DenseBaseManager<ComponentType, BaseClass>::DetachedHandle::Owner() const
+{
+    return manager_;
+}
+
+template<typename ComponentType, typename BaseClass>
+size_t DenseBaseManager<ComponentType, BaseClass>::DetachedHandle::Size() const
+{
+    return sizeof(ComponentType);
+}
+
+template<typename ComponentType, typename BaseClass>
+const void* DenseBaseManager<ComponentType, BaseClass>::DetachedHandle::RLock() const
+{
+    return &data_;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::DetachedHandle::RUnlock() const
+{}
+
+template<typename ComponentType, typename BaseClass>
+void* DenseBaseManager<ComponentType, BaseClass>::DetachedHandle::WLock()
+{
+    return &data_;
+}
+
+template<typename ComponentType, typename BaseClass>
+void DenseBaseManager<ComponentType, BaseClass>::DetachedHandle::WUnlock()
+{}
+CORE_END_NAMESPACE()
@@ -14,7 +14,9 @@
  */
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 
 #include <base/containers/array_view.h>
 #include <base/containers/atomics.h>
@@ -37,6 +39,7 @@
 #include <core/threading/intf_thread_pool.h>
 
 #include "ecs/entity_manager.h"
+#include "threading/task_queue.h"
 
 CORE_BEGIN_NAMESPACE()
 constexpr bool operator==(const CORE_NS::SystemTypeInfo* info, const BASE_NS::Uid& uid) noexcept
@@ -110,6 +113,9 @@ public:
 
     uint64_t GetId() const override;
 
+    void SetSystemUpdateMode(SystemUpdateMode mode) override;
+    SystemUpdateMode GetSystemUpdateMode() const override;
+
     using SystemPtr = unique_ptr<ISystem, SystemTypeInfo::DestroySystemFn>;
     using ManagerPtr = unique_ptr<IComponentManager, ComponentManagerTypeInfo::DestroyComponentManagerFn>;
 
@@ -122,6 +128,11 @@ protected:
 
     void CleanupComponentManager(IComponentManager& manager);
 
+    // Builds the dependency graph used by SystemUpdateMode::PARALLEL from systemOrder_.
+    void BuildSystemGraph();
+    bool UpdateSystemsSequential(bool frameRenderingQueued, uint64_t time, uint64_t delta);
+    bool UpdateSystemsParallel(bool frameRenderingQueued, uint64_t time, uint64_t delta);
+
     IThreadPool::Ptr threadPool_;
 
     // for storing systems and component managers in creation order
@@ -135,6 +146,17 @@ protected:
     vector<ComponentListener*> componentListeners_;
     unordered_map<IComponentManager*, vector<ComponentListener*>> componentManagerListeners_;
 
+    struct SystemNode {
+        // Number of systems which must complete before this one starts.
+        uint32_t dependencyCount{0U};
+        // Indices of the systems waiting for this one.
+        vector<uint32_t> dependents;
+    };
+    // Nodes in the same order as systemOrder_.
+    vector<SystemNode> systemGraph_;
+    bool systemGraphDirty_{true};
+    SystemUpdateMode systemUpdateMode_{SystemUpdateMode::SEQUENTIAL};
+
     bool initialized_{false};
     bool needRender_{false};
     bool renderRequested_{false};
@@ -390,6 +412,7 @@ ISystem* Ecs::CreateSystem(const SystemTypeInfo& systemInfo)
 
     systems_.insert({systemInfo.uid, system});
     systemOrder_.emplace_back(system, systemInfo.destroySystem);
+    systemGraphDirty_ = true;
 
     if (initialized_) {
         system->Initialize();
@@ -647,6 +670,7 @@ void Ecs::Initialize()
             systems_.insert({systemInfo->uid, system});
             systemOrder_.emplace_back(system, systemInfo->destroySystem);
         }
+        systemGraphDirty_ = true;
     }
 
     for (auto& s : systemOrder_) {
@@ -668,11 +692,10 @@ bool Ecs::Update(uint64_t time, uint64_t delta)
 
     // Update all systems.
     delta = static_cast<uint64_t>(static_cast<double>(delta) * timeScale_);
-    for (auto& s : systemOrder_) {
-        CORE_CPU_PERF_SCOPE("CORE", "SystemUpdate", s->GetName(), CORE_PROFILER_DEFAULT_COLOR);
-        if (s->Update(frameRenderingQueued, time, delta)) {
-            frameRenderingQueued = true;
-        }
+    if ((systemUpdateMode_ == SystemUpdateMode::PARALLEL) && threadPool_ && (systemOrder_.size() > 1U)) {
+        frameRenderingQueued = UpdateSystemsParallel(frameRenderingQueued, time, delta);
+    } else {
+        frameRenderingQueued = UpdateSystemsSequential(frameRenderingQueued, time, delta);
     }
 
     // Clear modification flags from component managers.
@@ -687,6 +710,165 @@ bool Ecs::Update(uint64_t time, uint64_t delta)
     return frameRenderingQueued;
 }
 
+bool Ecs::UpdateSystemsSequential(bool frameRenderingQueued, uint64_t time, uint64_t delta)
+{
+    for (auto& s : systemOrder_) {
+        CORE_CPU_PERF_SCOPE("CORE", "SystemUpdate", s->GetName(), CORE_PROFILER_DEFAULT_COLOR);
+        if (s->Update(frameRenderingQueued, time, delta)) {
+            frameRenderingQueued = true;
+        }
+    }
+    return frameRenderingQueued;
+}
+
+bool Ecs::UpdateSystemsParallel(bool frameRenderingQueued, uint64_t time, uint64_t delta)
+{
+    if (systemGraphDirty_) {
+        BuildSystemGraph();
+    }
+
+    // State shared with the pool tasks. Lives until all the systems have completed.
+    struct UpdateState {
+        std::mutex mutex;
+        std::condition_variable cv;
+        vector<uint32_t> completed;
+        bool frameRenderingQueued;
+    };
+    UpdateState state;
+    state.frameRenderingQueued = frameRenderingQueued;
+
+    auto updateSystem = [&state, time, delta](ISystem& system) {
+        CORE_CPU_PERF_SCOPE("CORE", "SystemUpdate", system.GetName(), CORE_PROFILER_DEFAULT_COLOR);
+        bool queued;
+        {
+            std::lock_guard lock(state.mutex);
+            queued = state.frameRenderingQueued;
+        }
+        if (system.Update(queued, time, delta)) {
+            std::lock_guard lock(state.mutex);
+            state.frameRenderingQueued = true;
+        }
+    };
+
+    const auto systemCount = static_cast<uint32_t>(systemGraph_.size());
+    vector<uint32_t> pending;
+    pending.reserve(systemCount);
+    // Systems are started in the order they become ready. Each system is pushed once, so the list is consumed from
+    // readyHead instead of erasing from the front.
+    vector<uint32_t> ready;
+    ready.reserve(systemCount);
+    size_t readyHead = 0U;
+    for (uint32_t i = 0U; i < systemCount; ++i) {
+        pending.push_back(systemGraph_[i].dependencyCount);
+        if (pending.back() == 0U) {
+            ready.push_back(i);
+        }
+    }
+    auto complete = [this, &pending, &ready](uint32_t index) {
+        for (const auto dependent : systemGraph_[index].dependents) {
+            if (--pending[dependent] == 0U) {
+                ready.push_back(dependent);
+            }
+        }
+    };
+
+    // Systems may push their own tasks to the pool and wait for them. Leaving one worker free guarantees those tasks
+    // can always make progress.
+    const uint32_t maxPooled = threadPool_->GetNumberOfThreads() - 1U;
+    uint32_t pooled = 0U;
+    uint32_t completedCount = 0U;
+    vector<uint32_t> completed;
+    while (completedCount < systemCount) {
+        // Start ready systems in the pool, but keep one for this thread.
+        while (((ready.size() - readyHead) > 1U) && (pooled < maxPooled)) {
+            const auto index = ready[readyHead++];
+            ++pooled;
+            threadPool_->PushNoWait(FunctionTask::Create([&state, &updateSystem, system = systemOrder_[index].get(),
+                                                             index]() {
+                updateSystem(*system);
+                {
+                    std::lock_guard lock(state.mutex);
+                    state.completed.push_back(index);
+                }
+                state.cv.notify_one();
+            }));
+        }
+
+        if (readyHead < ready.size()) {
+            const auto index = ready[readyHead++];
+            updateSystem(*systemOrder_[index]);
+            complete(index);
+            ++completedCount;
+        }
+
+        // Collect systems completed in the pool, and wait for them if there's nothing else to do.
+        {
+            std::unique_lock lock(state.mutex);
+            if ((readyHead == ready.size()) && (completedCount < systemCount)) {
+                state.cv.wait(lock, [&state]() { return !state.completed.empty(); });
+            }
+            completed.swap(state.completed);
+        }
+        for (const auto index : completed) {
+            complete(index);
+            ++completedCount;
+            --pooled;
+        }
+        completed.clear();
+    }
+    return state.frameRenderingQueued;
+}
+
+void Ecs::BuildSystemGraph()
+{
+    struct SystemAccess {
+        Uid uid;
+        Uid afterSystem;
+        Uid beforeSystem;
+        array_view<const Uid> writes;
+        array_view<const Uid> reads;
+        // Set when the accessed component managers are not known.
+        bool wildcard{true};
+    };
+    const auto systemMetadata = GetPluginRegister().GetTypeInfos(SystemTypeInfo::UID);
+    vector<SystemAccess> access;
+    access.reserve(systemOrder_.size());
+    for (const auto& system : systemOrder_) {
+        auto& info = access.emplace_back();
+        info.uid = system->GetUid();
+        if (const auto* typeInfo = FindTypeInfo<SystemTypeInfo>(info.uid, systemMetadata); typeInfo) {
+            info.afterSystem = typeInfo->afterSystem;
+            info.beforeSystem = typeInfo->beforeSystem;
+            info.writes = typeInfo->componentDependencies;
+            info.reads = typeInfo->readOnlyComponentDependencies;
+            info.wildcard =
+                (Find(info.writes, Uid{}) != info.writes.end()) || (Find(info.reads, Uid{}) != info.reads.end());
+        }
+    }
+
+    constexpr auto intersects = [](array_view<const Uid> lhs, array_view<const Uid> rhs) {
+        return std::any_of(lhs.begin(), lhs.end(), [rhs](const Uid& uid) { return Find(rhs, uid) != rhs.end(); });
+    };
+    constexpr auto conflicts = [intersects](const SystemAccess& lhs, const SystemAccess& rhs) {
+        return lhs.wildcard || rhs.wildcard || (lhs.afterSystem == rhs.uid) || (lhs.beforeSystem == rhs.uid) ||
+               (rhs.afterSystem == lhs.uid) || (rhs.beforeSystem == lhs.uid) || intersects(lhs.writes, rhs.writes) ||
+               intersects(lhs.writes, rhs.reads) || intersects(lhs.reads, rhs.writes);
+    };
+
+    // Each system depends on all the earlier conflicting systems, which keeps the sequential order for them.
+    systemGraph_.clear();
+    systemGraph_.resize(access.size());
+    for (uint32_t i = 0U; i < static_cast<uint32_t>(access.size()); ++i) {
+        for (uint32_t j = 0U; j < i; ++j) {
+            if (conflicts(access[i], access[j])) {
+                systemGraph_[j].dependents.push_back(i);
+                ++systemGraph_[i].dependencyCount;
+            }
+        }
+    }
+    systemGraphDirty_ = false;
+}
+
 void Ecs::Uninitialize()
 {
     // Destroy all entities from scene.
@@ -743,6 +925,16 @@ uint64_t Ecs::GetId() const
     return ecsId_;
 }
 
+void Ecs::SetSystemUpdateMode(SystemUpdateMode mode)
+{
+    systemUpdateMode_ = mode;
+}
+
+IEcs::SystemUpdateMode Ecs::GetSystemUpdateMode() const
+{
+    return systemUpdateMode_;
+}
+
 void Ecs::Ref() noexcept
 {
     BASE_NS::AtomicIncrementRelaxed(&refcnt_);
@@ -792,6 +984,7 @@ void Ecs::OnTypeInfoEvent(EventType type, array_view<const ITypeInfo* const> typ
                     systems_.erase(pos);
                 }
                 RemoveUid(systemOrder_, systemInfo->uid);
+                systemGraphDirty_ = true;
             } else if (info->typeUid == ComponentManagerTypeInfo::UID) {
                 const auto managerInfo = static_cast<const ComponentManagerTypeInfo*>(info);
                 // BaseManager expects that the component list is empty when it's destroyed. might be also
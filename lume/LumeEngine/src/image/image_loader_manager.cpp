@@ -41,6 +41,25 @@ using BASE_NS::string_view;
 using BASE_NS::unique_ptr;
 using BASE_NS::vector;
 
+namespace {
+// Maximum header size of currently implemented file types.
+constexpr size_t IMAGE_HEADER_LENGTH = 12u;
+
+// Returns the header used for finding a loader for the file. Mapped files are checked in place, otherwise the header
+// is read to the given buffer and the file is rewound.
+array_view<const uint8_t> ReadImageHeader(IFile& file, uint8_t (&buffer)[IMAGE_HEADER_LENGTH])
+{
+    if (const auto mapped = file.GetMappedData(); mapped.size() >= IMAGE_HEADER_LENGTH) {
+        return {mapped.data(), IMAGE_HEADER_LENGTH};
+    }
+    if (file.Read(buffer, IMAGE_HEADER_LENGTH) != IMAGE_HEADER_LENGTH) {
+        return {};
+    }
+    file.Seek(0);
+    return {buffer, IMAGE_HEADER_LENGTH};
+}
+}  // namespace
+
 ImageLoaderManager::ImageLoaderManager(IFileManager& fileManager) : fileManager_(fileManager)
 {
     for (const auto* typeInfo : GetPluginRegister().GetTypeInfos(IImageLoaderManager::ImageLoaderTypeInfo::UID)) {
@@ -78,13 +97,26 @@ ImageLoaderManager::LoadResult ImageLoaderManager::LoadImage(const string_view u
 {
     CORE_CPU_PERF_SCOPE("CORE", "LoadImage()", uri, CORE_PROFILER_DEFAULT_COLOR);
 
-    // Load 12 bytes (maximum header size of currently implemented file types)
     IFile::Ptr file = fileManager_.OpenFile(uri);
     if (!file) {
         return ResultFailure("Can not open image.");
     }
 
-    return LoadImage(*file, loadFlags);
+    CORE_CPU_PERF_SCOPE("CORE", "LoadImage(file)", "", CORE_PROFILER_DEFAULT_COLOR);
+
+    uint8_t buffer[IMAGE_HEADER_LENGTH];
+    const auto header = ReadImageHeader(*file, buffer);
+    if (header.empty()) {
+        return ResultFailure("Can not read file header.");
+    }
+
+    for (auto& loader : imageLoaders_) {
+        if (loader.instance && loader.instance->CanLoad(header)) {
+            // The loader owns the file from here on, a mapped file can be used as the image data as is.
+            return loader.instance->Load(move(file), loadFlags);
+        }
+    }
+    return ResultFailure("Image loader not found for this format.");
 }
 
 ImageLoaderManager::LoadResult ImageLoaderManager::LoadImage(
@@ -125,19 +157,14 @@ ImageLoaderManager::LoadResult ImageLoaderManager::LoadImage(IFile& file, uint32
 {
     CORE_CPU_PERF_SCOPE("CORE", "LoadImage(file)", "", CORE_PROFILER_DEFAULT_COLOR);
 
-    const uint64_t byteLength = 12u;
-
-    // Read header of the file to a buffer.
-    unique_ptr<uint8_t[]> buffer = make_unique<uint8_t[]>(static_cast<size_t>(byteLength));
-    const uint64_t read = file.Read(buffer.get(), byteLength);
-    if (read != byteLength) {
+    uint8_t buffer[IMAGE_HEADER_LENGTH];
+    const auto header = ReadImageHeader(file, buffer);
+    if (header.empty()) {
         return ResultFailure("Can not read file header.");
     }
-    file.Seek(0);
 
     for (auto& loader : imageLoaders_) {
-        if (loader.instance &&
-            loader.instance->CanLoad(array_view<const uint8_t>(buffer.get(), static_cast<size_t>(byteLength)))) {
+        if (loader.instance && loader.instance->CanLoad(header)) {
             return loader.instance->Load(file, loadFlags);
         }
     }
@@ -175,19 +202,14 @@ ImageLoaderManager::LoadAnimatedResult ImageLoaderManager::LoadAnimatedImage(IFi
 {
     CORE_CPU_PERF_SCOPE("CORE", "LoadAnimatedImage(file)", "", CORE_PROFILER_DEFAULT_COLOR);
 
-    const uint64_t byteLength = 12u;
-
-    // Read header of the file to a buffer.
-    unique_ptr<uint8_t[]> buffer = make_unique<uint8_t[]>(static_cast<size_t>(byteLength));
-    const uint64_t read = file.Read(buffer.get(), byteLength);
-    if (read != byteLength) {
+    uint8_t buffer[IMAGE_HEADER_LENGTH];
+    const auto header = ReadImageHeader(file, buffer);
+    if (header.empty()) {
         return ResultFailureAnimated("Can not read file header.");
     }
-    file.Seek(0);
 
     for (auto& loader : imageLoaders_) {
-        if (loader.instance &&
-            loader.instance->CanLoad(array_view<const uint8_t>(buffer.get(), static_cast<size_t>(byteLength)))) {
+        if (loader.instance && loader.instance->CanLoad(header)) {
             return loader.instance->LoadAnimatedImage(file, loadFlags);
         }
     }
@@ -96,7 +96,10 @@ inline Format GetAstcBlockSizeFormat(uint32_t x, uint32_t y, bool srgb)
 class AstcImage final : public IImageContainer {
 public:
     AstcImage(unique_ptr<uint8_t[]>&& fileBytes, size_t fileBytesLength)
-        : fileBytes_(move(fileBytes)), fileBytesLength_(fileBytesLength)
+        : fileBytes_(move(fileBytes)), fileData_(fileBytes_.get()), fileBytesLength_(fileBytesLength)
+    {}
+    AstcImage(IFile::Ptr&& mappedFile, array_view<const uint8_t> fileBytes)
+        : mappedFile_(move(mappedFile)), fileData_(fileBytes.data()), fileBytesLength_(fileBytes.size())
     {}
     using Ptr = unique_ptr<AstcImage, Deleter>;
 
@@ -107,7 +110,7 @@ public:
 
     array_view<const uint8_t> GetData() const override
     {
-        return {fileBytes_.get() + ASTC_HEADER_SIZE, fileBytesLength_ - ASTC_HEADER_SIZE};
+        return {fileData_ + ASTC_HEADER_SIZE, fileBytesLength_ - ASTC_HEADER_SIZE};
     };
 
     array_view<const SubImageDesc> GetBufferImageCopies() const override
@@ -201,9 +204,24 @@ public:
             return ImageLoaderManager::ResultFailure("Not enough data for parsing astc.");
         }
 
-        auto image = AstcImage::Ptr(new AstcImage(move(fileBytes), static_cast<size_t>(fileBytesLength)));
+        return Parse(AstcImage::Ptr(new AstcImage(move(fileBytes), static_cast<size_t>(fileBytesLength))), loadFlags);
+    }
 
-        const uint8_t* data = image->fileBytes_.get();
+    // Loading from a mapped file, the image data points to the mapping which the image keeps alive.
+    static ImageLoaderManager::LoadResult Load(IFile::Ptr mappedFile, uint32_t loadFlags)
+    {
+        const auto fileBytes = mappedFile->GetMappedData();
+        if (fileBytes.size() < ASTC_HEADER_SIZE) {
+            return ImageLoaderManager::ResultFailure("Not enough data for parsing astc.");
+        }
+        return Parse(AstcImage::Ptr(new AstcImage(move(mappedFile), fileBytes)), loadFlags);
+    }
+
+private:
+    static ImageLoaderManager::LoadResult Parse(AstcImage::Ptr image, uint32_t loadFlags)
+    {
+        const uint8_t* data = image->fileData_;
+        const uint64_t fileBytesLength = image->fileBytesLength_;
 
         const AstcHeader header = ReadHeader(data);
         const Format format = GetAstcBlockSizeFormat(header.blockWidth, header.blockHeight, false);
@@ -256,6 +274,9 @@ protected:
 
 private:
     unique_ptr<uint8_t[]> fileBytes_;
+    // Alternatively the file is kept mapped and the data is used in place.
+    IFile::Ptr mappedFile_;
+    const uint8_t* fileData_{nullptr};
     size_t fileBytesLength_{0};
 
     ImageDesc imageDesc_;
@@ -297,6 +318,22 @@ public:
         return AstcImage::Load(std::move(buffer), byteLength, loadFlags);
     }
 
+    /** Load Image file from provided file with passed flags, mapped files are used in place without copying.
+     * @param file File where to load from
+     * @param loadFlags Load flags. Combination of #ImageLoaderFlags
+     * @return Result of the loading operation.
+     */
+    ImageLoaderManager::LoadResult Load(IFile::Ptr&& file, uint32_t loadFlags) const override
+    {
+        if (!file) {
+            return ImageLoaderManager::ResultFailure("Input file must not be null.");
+        }
+        if (const auto mapped = file->GetMappedData(); !mapped.empty() && (mapped.size() == file->GetLength())) {
+            return AstcImage::Load(move(file), loadFlags);
+        }
+        return Load(*file, loadFlags);
+    }
+
     /** Load image file from given data bytes
      * @param imageFileBytes Image data.
      * @param loadFlags Load flags. Combination of #ImageLoaderFlags
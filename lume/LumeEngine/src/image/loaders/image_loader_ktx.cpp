@@ -192,7 +192,11 @@ public:
     KtxImage() = default;
 
     KtxImage(unique_ptr<uint8_t[]>&& fileBytes, size_t fileBytesLength)
-        : fileBytes_(CORE_NS::move(fileBytes)), fileBytesLength_(fileBytesLength)
+        : fileBytes_(CORE_NS::move(fileBytes)), fileData_(fileBytes_.get()), fileBytesLength_(fileBytesLength)
+    {}
+
+    KtxImage(IFile::Ptr&& mappedFile, array_view<const uint8_t> fileBytes)
+        : mappedFile_(CORE_NS::move(mappedFile)), fileData_(fileBytes.data()), fileBytesLength_(fileBytes.size())
     {}
 
     using Ptr = BASE_NS::unique_ptr<KtxImage, Deleter>;
@@ -251,6 +255,7 @@ public:
             // We can assume that moving the data to the previous valid position
             // is ok as it will only overwrite the now unnecessary "lodsize" value.
             const auto validOffset = static_cast<uint32_t>(currentImageElementOffset / bytesPerBlock * bytesPerBlock);
+            CORE_ASSERT_MSG(!image->mappedFile_, "Mapped file data can't be realigned.");
             auto* imageBytes = const_cast<uint8_t*>(image->imageBytes_);
             if (memmove_s(imageBytes + validOffset,
                     image->imageBytesLength_ - validOffset,
@@ -385,7 +390,7 @@ public:
             return false;
         }
 
-        const auto fileBytesLeft = image->fileBytesLength_ - static_cast<uintptr_t>(data - image->fileBytes_.get());
+        const auto fileBytesLeft = image->fileBytesLength_ - static_cast<uintptr_t>(data - image->fileData_);
         if (totalSizePadded > fileBytesLeft) {
             CORE_LOG_D("Not enough data for the element");
             return false;
@@ -462,7 +467,7 @@ public:
                     return ImageLoaderManager::ResultFailure("Invalid ktx data.");
                 }
                 if (sizeof(uint32_t) >=
-                    image->fileBytesLength_ - static_cast<uintptr_t>(data - image->fileBytes_.get())) {
+                    image->fileBytesLength_ - static_cast<uintptr_t>(data - image->fileData_)) {
                     CORE_LOG_D("Not enough data in the bytearray.");
                     return ImageLoaderManager::ResultFailure("Invalid ktx data.");
                 }
@@ -512,7 +517,7 @@ public:
                 data += totalSizePadded;
             }
 
-            if (data != (image->fileBytes_.get() + image->fileBytesLength_)) {
+            if (data != (image->fileData_ + image->fileBytesLength_)) {
                 CORE_LOG_D("File data left over.");
                 return ImageLoaderManager::ResultFailure("Invalid ktx data.");
             }
@@ -575,19 +580,54 @@ public:
         }
 
         // Populate the image object.
-        auto image = KtxImage::Ptr(new KtxImage(move(fileBytes), static_cast<size_t>(fileBytesLength)));
+        return Parse(KtxImage::Ptr(new KtxImage(move(fileBytes), static_cast<size_t>(fileBytesLength))), loadFlags);
+    }
+
+    // Loading from a mapped file, the image data points to the mapping which the image keeps alive.
+    static ImageLoaderManager::LoadResult Load(IFile::Ptr mappedFile, uint32_t loadFlags)
+    {
+        const auto fileBytes = mappedFile->GetMappedData();
+        if (fileBytes.size() < KTX_HEADER_LENGTH) {
+            return ImageLoaderManager::ResultFailure("Not enough data for parsing ktx.");
+        }
+
+        // Mip levels of formats with blocks larger than 4 bytes are realigned in place, which requires a copy.
+        const uint8_t* data = fileBytes.data();
+        const auto ktxHeader = ReadHeader(&data);
+        const uint32_t bytesPerBlock = GetFormatInfo(ktxHeader.glInternalFormat).bitsPerBlock / 8u;
+        if (((loadFlags & IImageLoaderManager::IMAGE_LOADER_METADATA_ONLY) == 0) &&
+            (ktxHeader.numberOfMipmapLevels > 1u) && (bytesPerBlock > 4u)) {
+            unique_ptr<uint8_t[]> buffer = make_unique<uint8_t[]>(fileBytes.size());
+            if (!CloneData(buffer.get(), fileBytes.size(), fileBytes.data(), fileBytes.size())) {
+                return ImageLoaderManager::ResultFailure("Loading image failed.");
+            }
+            return Load(move(buffer), fileBytes.size(), loadFlags);
+        }
+
+        return Parse(KtxImage::Ptr(new KtxImage(move(mappedFile), fileBytes)), loadFlags);
+    }
+
+protected:
+    void Destroy() override
+    {
+        delete this;
+    }
+
+private:
+    static ImageLoaderManager::LoadResult Parse(KtxImage::Ptr image, uint32_t loadFlags)
+    {
         if (!image) {
             return ImageLoaderManager::ResultFailure("Loading image failed.");
         }
 
-        const uint8_t* data = image->fileBytes_.get();
+        const uint8_t* data = image->fileData_;
         const auto ktxHeader = ReadHeader(&data);
         if (!ValidateKtxHeader(ktxHeader)) {
             return ImageLoaderManager::ResultFailure("Invalid ktx data.");
         }
         if ((loadFlags & IImageLoaderManager::IMAGE_LOADER_METADATA_ONLY) == 0) {
             if (ktxHeader.bytesOfKeyValueData >
-                image->fileBytesLength_ - static_cast<uintptr_t>(data - image->fileBytes_.get())) {
+                image->fileBytesLength_ - static_cast<uintptr_t>(data - image->fileData_)) {
                 CORE_LOG_D("Ktx bytesOfKeyValueData too large.");
                 return ImageLoaderManager::ResultFailure("Invalid ktx data.");
             }
@@ -595,7 +635,7 @@ public:
             ReadKeyValueData(ktxHeader, &data);
             // NOTE: Point to the start of the actual data of the first texture
             // (Jump over the first lod offset uint32_t (4 bytes)
-            const size_t headerLength = static_cast<size_t>(data - image->fileBytes_.get()) + sizeof(uint32_t);
+            const size_t headerLength = static_cast<size_t>(data - image->fileData_) + sizeof(uint32_t);
             image->imageBytes_ = data + sizeof(uint32_t);
             image->imageBytesLength_ = image->fileBytesLength_ - headerLength;
         }
@@ -608,13 +648,6 @@ public:
         return CreateImage(move(image), ktxHeader, loadFlags, data, isEndianFlipped);
     }
 
-protected:
-    void Destroy() override
-    {
-        delete this;
-    }
-
-private:
     static KtxHeader ReadHeader(const uint8_t** data)
     {
         // Read the identifier.
@@ -691,6 +724,9 @@ private:
     // will be pointing to the file data anyway. Only downside is the wasted
     // memory for the file header.
     unique_ptr<uint8_t[]> fileBytes_;
+    // Alternatively the file is kept mapped and the data is used in place.
+    IFile::Ptr mappedFile_;
+    const uint8_t* fileData_{nullptr};
     size_t fileBytesLength_{0};
 
     // The actual image data part of the file;
@@ -729,6 +765,17 @@ public:
         return KtxImage::Load(move(buffer), byteLength, loadFlags);
     }
 
+    ImageLoaderManager::LoadResult Load(IFile::Ptr&& file, uint32_t loadFlags) const override
+    {
+        if (!file) {
+            return ImageLoaderManager::ResultFailure("Input file must not be null.");
+        }
+        if (const auto mapped = file->GetMappedData(); !mapped.empty() && (mapped.size() == file->GetLength())) {
+            return KtxImage::Load(move(file), loadFlags);
+        }
+        return Load(*file, loadFlags);
+    }
+
     ImageLoaderManager::LoadResult Load(array_view<const uint8_t> imageFileBytes, uint32_t loadFlags) const override
     {
         // NOTE: could reuse this and remove the extra copy here if the data would be given as a unique_ptr.
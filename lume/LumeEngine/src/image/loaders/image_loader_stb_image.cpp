@@ -463,6 +463,11 @@ public:
             return ImageLoaderManager::ResultFailure("File too big to read.");
         }
 
+        // Decode mapped files in place.
+        if (const auto mapped = file.GetMappedData(); mapped.size() == byteLength) {
+            return StbImage::Load(mapped, loadFlags);
+        }
+
         // Read the file to a buffer.
         unique_ptr<uint8_t[]> buffer = make_unique<uint8_t[]>(static_cast<size_t>(byteLength));
         const uint64_t read = file.Read(buffer.get(), byteLength);
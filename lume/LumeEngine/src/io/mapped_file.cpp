@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/mapped_file.h"
+
+#include <cstdint>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <base/containers/allocator.h>
+#include <base/containers/string.h>
+#include <base/containers/string_view.h>
+#include <base/containers/unique_ptr.h>
+#include <core/io/intf_file.h>
+#include <core/log.h>
+#include <core/namespace.h>
+
+CORE_BEGIN_NAMESPACE()
+using BASE_NS::string;
+using BASE_NS::string_view;
+
+MappedFile::MappedFile(void* data, size_t size) : data_(data), size_(size)
+{}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+IFile::Ptr MappedFile::Open(const string_view path)
+{
+#if !defined(_WIN32)
+    const int fd = open(string(path).c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return {};
+    }
+    struct stat statBuf {};
+    if ((fstat(fd, &statBuf) != 0) || !S_ISREG(statBuf.st_mode) || (statBuf.st_size < 0) ||
+        (static_cast<uint64_t>(statBuf.st_size) < MIN_MAPPED_FILE_SIZE) ||
+        (static_cast<uint64_t>(statBuf.st_size) > SIZE_MAX)) {
+        close(fd);
+        return {};
+    }
+    const auto size = static_cast<size_t>(statBuf.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file referenced.
+    close(fd);
+    if (data == MAP_FAILED) {
+        CORE_LOG_D("Mapping file failed: %s", string(path).c_str());
+        return {};
+    }
+    // Assets are typically parsed front to back right after opening, start reading ahead.
+    posix_madvise(data, size, POSIX_MADV_WILLNEED);
+    return IFile::Ptr{BASE_NS::make_unique<MappedFile>(data, size).release()};
+#else
+    return {};
+#endif
+}
+
+IFile::Mode MappedFile::GetMode() const
+{
+    return data_ ? Mode::READ_ONLY : Mode::INVALID;
+}
+
+void MappedFile::Close()
+{
+#if !defined(_WIN32)
+    if (data_) {
+        munmap(data_, size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0U;
+    position_ = 0U;
+}
+
+uint64_t MappedFile::Read(void* buffer, uint64_t count)
+{
+    if (!data_ || (count == 0U) || (position_ >= size_)) {
+        return 0U;
+    }
+    const size_t toRead = (count < (size_ - position_)) ? static_cast<size_t>(count) : (size_ - position_);
+    if (!BASE_NS::CloneData(buffer, toRead, static_cast<const uint8_t*>(data_) + position_, toRead)) {
+        return 0U;
+    }
+    position_ += toRead;
+    return toRead;
+}
+
+uint64_t MappedFile::Write(const void* /* buffer */, uint64_t /* count */)
+{
+    return 0U;
+}
+
+uint64_t MappedFile::Append(const void* /* buffer */, uint64_t /* count */, uint64_t /* flushSize */)
+{
+    return 0U;
+}
+
+uint64_t MappedFile::GetLength() const
+{
+    return size_;
+}
+
+bool MappedFile::Seek(uint64_t offset)
+{
+    if (!data_ || (offset > size_)) {
+        return false;
+    }
+    position_ = static_cast<size_t>(offset);
+    return true;
+}
+
+uint64_t MappedFile::GetPosition() const
+{
+    return position_;
+}
+
+BASE_NS::array_view<const uint8_t> MappedFile::GetMappedData() const
+{
+    return {static_cast<const uint8_t*>(data_), size_};
+}
+CORE_END_NAMESPACE()
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_IO_MAPPED_FILE_H
+#define CORE_IO_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <base/containers/array_view.h>
+#include <base/containers/string_view.h>
+#include <core/io/intf_file.h>
+#include <core/namespace.h>
+
+CORE_BEGIN_NAMESPACE()
+/** Memory mapped file.
+ * Read only IFile implementation which maps the whole file to memory, so the contents can be parsed in place through
+ * GetMappedData without copying them to a separate buffer.
+ */
+class MappedFile final : public IFile {
+public:
+    MappedFile(void* data, size_t size);
+    ~MappedFile() override;
+
+    // Map an existing file for reading. Fails if the file does not exist, is smaller than MIN_MAPPED_FILE_SIZE, or
+    // mapping files is not supported on the platform. The caller should fall back to StdFile in that case.
+    static IFile::Ptr Open(BASE_NS::string_view path);
+
+    // Files smaller than this are cheaper to read than to map.
+    static constexpr size_t MIN_MAPPED_FILE_SIZE = 64U * 1024U;
+
+    Mode GetMode() const override;
+
+    // Unmap file.
+    void Close() override;
+
+    uint64_t Read(void* buffer, uint64_t count) override;
+
+    uint64_t Write(const void* buffer, uint64_t count) override;
+
+    uint64_t Append(const void* buffer, uint64_t count, uint64_t flushSize) override;
+
+    uint64_t GetLength() const override;
+
+    bool Seek(uint64_t offset) override;
+
+    uint64_t GetPosition() const override;
+
+    BASE_NS::array_view<const uint8_t> GetMappedData() const override;
+
+protected:
+    void Destroy() override
+    {
+        delete this;
+    }
+
+private:
+    void* data_{nullptr};
+    size_t size_{0U};
+    size_t position_{0U};
+};
+CORE_END_NAMESPACE()
+
+#endif  // CORE_IO_MAPPED_FILE_H
@@ -127,4 +127,12 @@ uint64_t MemoryFile::GetPosition() const
 {
     return index_;
 }
+
+BASE_NS::array_view<const uint8_t> MemoryFile::GetMappedData() const
+{
+    if (mode_ == Mode::INVALID) {
+        return {};
+    }
+    return buffer_->GetStorage();
+}
 CORE_END_NAMESPACE()
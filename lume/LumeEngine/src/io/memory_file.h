@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 
+#include <base/containers/array_view.h>
 #include <base/containers/shared_ptr.h>
 #include <base/containers/type_traits.h>
 #include <base/containers/vector.h>
@@ -81,6 +82,8 @@ public:
 
     uint64_t GetPosition() const override;
 
+    BASE_NS::array_view<const uint8_t> GetMappedData() const override;
+
 protected:
     void Destroy() override
     {
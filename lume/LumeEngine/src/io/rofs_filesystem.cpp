@@ -117,6 +117,11 @@ public:
         return index_;
     }
 
+    BASE_NS::array_view<const uint8_t> GetMappedData() const override
+    {
+        return {data_, size_};
+    }
+
 protected:
     void Destroy() override
     {
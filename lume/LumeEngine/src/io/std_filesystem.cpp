@@ -44,6 +44,7 @@
 #include <core/log.h>
 #include <core/namespace.h>
 
+#include "io/mapped_file.h"
 #include "io/path_tools.h"
 #include "std_directory.h"
 #include "std_file.h"
@@ -94,6 +95,12 @@ IFile::Ptr StdFilesystem::OpenFile(const string_view pathIn, const IFile::Mode m
 {
     auto path = ValidatePath(pathIn);
     if (!path.empty()) {
+        // Large read only files are mapped so that they can be parsed in place.
+        if (mode == IFile::Mode::READ_ONLY) {
+            if (auto file = MappedFile::Open(path); file) {
+                return file;
+            }
+        }
         return StdFile::Open(path, mode);
     }
     return {};
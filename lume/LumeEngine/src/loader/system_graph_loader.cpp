@@ -379,6 +379,15 @@ ISystemGraphLoader::LoadResult LoadFromNullTerminated(const string_view jsonStri
         return ISystemGraphLoader::LoadResult("Invalid json file.");
     }
     ISystemGraphLoader::LoadResult finalResult = ParseSystemGraphVersion(json);
+    if (const json::value* modeIt = json.find("systemUpdateMode"); modeIt && modeIt->is_string()) {
+        if (modeIt->string_ == "parallel") {
+            ecs.SetSystemUpdateMode(IEcs::SystemUpdateMode::PARALLEL);
+        } else if (modeIt->string_ == "sequential") {
+            ecs.SetSystemUpdateMode(IEcs::SystemUpdateMode::SEQUENTIAL);
+        } else {
+            CORE_LOG_W("Unknown systemUpdateMode: %s", string(modeIt->string_).c_str());
+        }
+    }
     const auto& systemsArrayIt = json.find("systems");
     if (systemsArrayIt && systemsArrayIt->is_array()) {
         auto& pluginRegister = GetPluginRegister();
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "perf/chrome_trace_writer.h"
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+
+#include <base/containers/array_view.h>
+#include <base/containers/string.h>
+#include <base/containers/string_view.h>
+#include <base/namespace.h>
+#include <core/io/intf_file.h>
+#include <core/json/json.h>
+#include <core/namespace.h>
+#include <core/perf/intf_performance_data_manager.h>
+
+CORE_BEGIN_NAMESPACE()
+using BASE_NS::array_view;
+using BASE_NS::string;
+using BASE_NS::string_view;
+
+namespace {
+// The events are formatted to a string which is written to the file whenever it grows past this.
+constexpr size_t WRITE_CHUNK_SIZE = 64U * 1024U;
+constexpr size_t NUMBER_BUFFER_SIZE = 32U;
+
+void AppendNumber(string& out, int64_t value)
+{
+    char buffer[NUMBER_BUFFER_SIZE];
+    const int length = snprintf(buffer, sizeof(buffer), "%" PRId64, value);
+    if (length > 0) {
+        out.append(buffer, static_cast<size_t>(length));
+    }
+}
+
+void AppendString(string& out, string_view value)
+{
+    out += '"';
+    json::escape(out, value);
+    out += '"';
+}
+
+string_view GetUnitName(IPerformanceDataManager::PerformanceTimingData::DataType type)
+{
+    switch (type) {
+        case IPerformanceDataManager::PerformanceTimingData::DataType::BYTES:
+            return "bytes";
+        case IPerformanceDataManager::PerformanceTimingData::DataType::COUNT:
+            return "count";
+        case IPerformanceDataManager::PerformanceTimingData::DataType::MICROSECONDS:
+        default:
+            return "us";
+    }
+}
+
+bool Write(IFile& file, const string& data)
+{
+    return data.empty() || (file.Write(data.data(), data.size()) == data.size());
+}
+}  // namespace
+
+void AppendChromeTraceEvent(string& out, const PerformanceTraceEvent& event)
+{
+    // Name the events like the entries in the performance data, e.g. "SystemUpdate::RenderSystem".
+    out += "{\"name\":\"";
+    json::escape(out, event.subCategory);
+    if (!event.name.empty()) {
+        out += "::";
+        json::escape(out, event.name);
+    }
+    out += '"';
+    out += ",\"cat\":";
+    AppendString(out, event.category);
+    if (event.type == IPerformanceDataManager::PerformanceTimingData::DataType::MICROSECONDS) {
+        // Timings are measured when the scope ends, complete events give the start time and duration.
+        out += ",\"ph\":\"X\",\"ts\":";
+        AppendNumber(out, event.timestamp - event.value);
+        out += ",\"dur\":";
+        AppendNumber(out, event.value);
+    } else {
+        out += ",\"ph\":\"C\",\"ts\":";
+        AppendNumber(out, event.timestamp);
+        out += ",\"args\":{";
+        AppendString(out, GetUnitName(event.type));
+        out += ':';
+        AppendNumber(out, event.value);
+        out += '}';
+    }
+    out += ",\"pid\":1,\"tid\":";
+    AppendNumber(out, static_cast<int64_t>(event.threadId));
+    out += '}';
+}
+
+bool WriteChromeTrace(IFile& file, array_view<const PerformanceTraceEvent> events)
+{
+    string out;
+    out.reserve(WRITE_CHUNK_SIZE + WRITE_CHUNK_SIZE / 2U);
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& event : events) {
+        if (!first) {
+            out += ",\n";
+        } else {
+            out += '\n';
+            first = false;
+        }
+        AppendChromeTraceEvent(out, event);
+        if (out.size() >= WRITE_CHUNK_SIZE) {
+            if (!Write(file, out)) {
+                return false;
+            }
+            out.clear();
+        }
+    }
+    out += "\n]}\n";
+    return Write(file, out);
+}
+CORE_END_NAMESPACE()
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_PERF_CHROME_TRACE_WRITER_H
+#define CORE_PERF_CHROME_TRACE_WRITER_H
+
+#include <cstdint>
+
+#include <base/containers/array_view.h>
+#include <base/containers/fixed_string.h>
+#include <base/containers/string.h>
+#include <base/namespace.h>
+#include <core/namespace.h>
+#include <core/perf/intf_performance_data_manager.h>
+
+CORE_BEGIN_NAMESPACE()
+class IFile;
+
+/** Recorded performance data update. */
+struct PerformanceTraceEvent {
+    using Name = BASE_NS::fixed_string<IPerformanceDataManager::TIMING_DATA_NAME_LENGTH>;
+
+    Name category;
+    Name subCategory;
+    Name name;
+    /** Sequential id of the thread which updated the data. */
+    uint32_t threadId{0U};
+    /** Time of the update in microseconds since the capture was started. For timings this is the end of the event. */
+    int64_t timestamp{0};
+    /** Duration in microseconds, or the value for other data types. */
+    int64_t value{0};
+    IPerformanceDataManager::PerformanceTimingData::DataType type{
+        IPerformanceDataManager::PerformanceTimingData::DataType::MICROSECONDS};
+};
+
+/** Appends a single event in Chrome trace event JSON format, without a separator. */
+void AppendChromeTraceEvent(BASE_NS::string& out, const PerformanceTraceEvent& event);
+
+/** Writes the events as a Chrome trace event JSON object to the file.
+ * @return True if everything was written.
+ */
+bool WriteChromeTrace(IFile& file, BASE_NS::array_view<const PerformanceTraceEvent> events);
+CORE_END_NAMESPACE()
+
+#endif  // CORE_PERF_CHROME_TRACE_WRITER_H
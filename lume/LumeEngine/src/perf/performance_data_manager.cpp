@@ -16,10 +16,12 @@
 #include "performance_data_manager.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cinttypes>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
 
 #include <base/containers/array_view.h>
@@ -33,11 +35,15 @@
 #include <base/math/mathf.h>
 #include <base/namespace.h>
 #include <base/util/uid.h>
+#include <core/io/intf_file_manager.h>
 #include <core/log.h>
 #include <core/namespace.h>
+#include <core/perf/intf_performance_capture.h>
 #include <core/perf/intf_performance_data_manager.h>
 #include <core/perf/intf_performance_trace.h>
 
+#include "perf/chrome_trace_writer.h"
+
 CORE_BEGIN_NAMESPACE()
 using BASE_NS::array_view;
 using BASE_NS::make_unique;
@@ -53,6 +59,23 @@ struct PerformanceDataManager::InternalData {
 
 namespace {
 #if (CORE_PERF_ENABLED == 1)
+// Number of updates each thread can queue before the buffers are flushed.
+constexpr uint32_t THREAD_BUFFER_SIZE = 1024U;
+// Upper limit for the events kept for a capture, each takes a bit over 200 bytes.
+constexpr size_t MAX_CAPTURED_EVENTS = 1024U * 1024U;
+// Separates the producer and consumer indices of the thread buffers.
+constexpr size_t CACHE_LINE_SIZE = 64U;
+
+std::atomic<uint64_t> g_factorySerial{0U};
+
+int64_t GetMicroseconds()
+{
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<int64_t>(duration_cast<microseconds>(now).count());
+}
+
 void UpdateTimingData(const string_view subCategory, const string_view name, const int64_t microSeconds,
     const PerformanceDataManager::PerformanceTimingData::DataType type, PerformanceDataManager::TypeDataSet& dataSet)
 {
@@ -130,10 +153,35 @@ vector<IPerformanceDataManager::PerformanceData> GetTimingData(const Performance
 #endif  // CORE_PERF_ENABLED
 }  // namespace
 
+#if (CORE_PERF_ENABLED == 1)
+// Single producer single consumer queue of the updates made by one thread. The owning thread appends to the head and
+// the consumer, serialized by the factory's flushMutex_, advances the tail.
+struct PerformanceDataManagerFactory::ThreadBuffer {
+    struct Sample {
+        PerformanceDataManager* manager{nullptr};
+        PerformanceTraceEvent::Name subCategory;
+        PerformanceTraceEvent::Name name;
+        int64_t value{0};
+        // Time of the update if it was captured, otherwise negative.
+        int64_t timestamp{-1};
+        PerformanceDataManager::PerformanceTimingData::DataType type{};
+    };
+
+    uint32_t threadId{0U};
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> head{0U};
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> tail{0U};
+    Sample samples[THREAD_BUFFER_SIZE];
+};
+#endif
+
 PerformanceDataManager::~PerformanceDataManager() = default;
 
-PerformanceDataManager::PerformanceDataManager(const string_view category, PerformanceDataManagerFactory& /*factory*/)
+PerformanceDataManager::PerformanceDataManager(
+    const string_view category, [[maybe_unused]] PerformanceDataManagerFactory& factory)
     : category_(category)
+#if (CORE_PERF_ENABLED == 1)
+    , factory_(factory)
+#endif
 {}
 
 string_view PerformanceDataManager::GetCategory() const
@@ -160,8 +208,7 @@ void PerformanceDataManager::UpdateData([[maybe_unused]] const string_view subCa
     [[maybe_unused]] const string_view name, [[maybe_unused]] const int64_t microSeconds)
 {
 #if (CORE_PERF_ENABLED == 1)
-    std::lock_guard<std::mutex> lock(dataMutex_);
-    UpdateTimingData(subCategory, name, microSeconds, PerformanceTimingData::DataType::MICROSECONDS, data_);
+    factory_.Record(*this, subCategory, name, microSeconds, PerformanceTimingData::DataType::MICROSECONDS);
 #endif
 }
 
@@ -169,6 +216,15 @@ void PerformanceDataManager::UpdateData([[maybe_unused]] const string_view subCa
     [[maybe_unused]] const string_view name, [[maybe_unused]] const int64_t value,
     [[maybe_unused]] PerformanceTimingData::DataType type)
 {
+#if (CORE_PERF_ENABLED == 1)
+    factory_.Record(*this, subCategory, name, value, type);
+#endif
+}
+
+void PerformanceDataManager::Aggregate([[maybe_unused]] const string_view subCategory,
+    [[maybe_unused]] const string_view name, [[maybe_unused]] const int64_t value,
+    [[maybe_unused]] PerformanceTimingData::DataType type)
+{
 #if (CORE_PERF_ENABLED == 1)
     std::lock_guard<std::mutex> lock(dataMutex_);
     UpdateTimingData(subCategory, name, value, type, data_);
@@ -178,6 +234,7 @@ void PerformanceDataManager::UpdateData([[maybe_unused]] const string_view subCa
 void PerformanceDataManager::ResetData()
 {
 #if (CORE_PERF_ENABLED == 1)
+    factory_.Flush();
     std::lock_guard<std::mutex> lock(dataMutex_);
     data_.clear();
 #endif
@@ -186,6 +243,7 @@ void PerformanceDataManager::ResetData()
 vector<IPerformanceDataManager::PerformanceData> PerformanceDataManager::GetData() const
 {
 #if (CORE_PERF_ENABLED == 1)
+    factory_.Flush();
     std::lock_guard<std::mutex> lock(dataMutex_);
     return GetTimingData(data_);
 #else
@@ -196,6 +254,7 @@ vector<IPerformanceDataManager::PerformanceData> PerformanceDataManager::GetData
 void PerformanceDataManager::RemoveData([[maybe_unused]] const string_view subCategory)
 {
 #if (CORE_PERF_ENABLED == 1)
+    factory_.Flush();
     std::lock_guard<std::mutex> lock(dataMutex_);
     data_.erase(subCategory);
 #endif
@@ -204,6 +263,7 @@ void PerformanceDataManager::RemoveData([[maybe_unused]] const string_view subCa
 void PerformanceDataManager::GetSelectedCounters(CounterPairView data) const
 {
 #if (CORE_PERF_ENABLED == 1)
+    factory_.Flush();
     std::lock_guard<std::mutex> lock(dataMutex_);
     const auto dataRef = GetTimingData(data_);
     for (const auto& dRef : dataRef) {
@@ -246,6 +306,7 @@ IPerformanceDataManager::ComparisonData PerformanceDataManager::CompareCounters(
 void PerformanceDataManager::DumpToLog() const
 {
 #if (CORE_PERF_ENABLED == 1)
+    factory_.Flush();
     std::lock_guard<std::mutex> lock(dataMutex_);
 
     constexpr const string_view formatLegend = "%8s %8s %8s %9s %8s (microseconds)";
@@ -293,6 +354,9 @@ void PerformanceDataManager::Unref()
 {}
 
 PerformanceDataManagerFactory::PerformanceDataManagerFactory(IPluginRegister& registry)
+#if (CORE_PERF_ENABLED == 1)
+    : serial_(++g_factorySerial)
+#endif
 {}
 
 void PerformanceDataManagerFactory::SetPerformanceTrace(
@@ -323,12 +387,31 @@ PerformanceDataManagerFactory::~PerformanceDataManagerFactory() = default;
 IPerformanceDataManager* PerformanceDataManagerFactory::Get([[maybe_unused]] const string_view category)
 {
 #if (CORE_PERF_ENABLED == 1)
-    std::lock_guard lock(mutex_);
-    if (auto pos = managers_.find(category); pos != managers_.end()) {
-        return pos->second.get();
+    // Perf scopes look up their manager each time, remember the latest one of each thread to avoid locking.
+    struct CachedManager {
+        uint64_t owner{0U};
+        PerformanceTraceEvent::Name category;
+        PerformanceDataManager* manager{nullptr};
+    };
+    thread_local CachedManager cached;
+    if ((cached.owner == serial_) && (string_view(cached.category) == category)) {
+        return cached.manager;
     }
-    auto inserted = managers_.insert({category, make_unique<PerformanceDataManager>(category, *this)});
-    return inserted.first->second.get();
+    PerformanceDataManager* manager = nullptr;
+    {
+        std::lock_guard lock(mutex_);
+        if (auto pos = managers_.find(category); pos != managers_.end()) {
+            manager = pos->second.get();
+        } else {
+            auto inserted = managers_.insert({category, make_unique<PerformanceDataManager>(category, *this)});
+            manager = inserted.first->second.get();
+        }
+    }
+    // Managers live as long as the factory.
+    if (category.size() < IPerformanceDataManager::TIMING_DATA_NAME_LENGTH) {
+        cached = {serial_, category, manager};
+    }
+    return manager;
 #else
     return {};
 #endif
@@ -349,11 +432,141 @@ vector<IPerformanceDataManager*> PerformanceDataManagerFactory::GetAllCategories
     return categories;
 }
 
+void PerformanceDataManagerFactory::Record([[maybe_unused]] PerformanceDataManager& manager,
+    [[maybe_unused]] const string_view subCategory, [[maybe_unused]] const string_view name,
+    [[maybe_unused]] const int64_t value, [[maybe_unused]] PerformanceDataManager::PerformanceTimingData::DataType type)
+{
+#if (CORE_PERF_ENABLED == 1)
+    auto& buffer = GetThreadBuffer();
+    const uint32_t head = buffer.head.load(std::memory_order_relaxed);
+    if ((head - buffer.tail.load(std::memory_order_acquire)) >= THREAD_BUFFER_SIZE) {
+        // The only case where updating blocks, other threads' buffers get aggregated at the same time.
+        Flush();
+    }
+    auto& sample = buffer.samples[head % THREAD_BUFFER_SIZE];
+    sample.manager = &manager;
+    sample.subCategory = subCategory;
+    sample.name = name;
+    sample.value = value;
+    sample.timestamp = capturing_.load(std::memory_order_relaxed) ? GetMicroseconds() : -1;
+    sample.type = type;
+    buffer.head.store(head + 1U, std::memory_order_release);
+#endif
+}
+
+void PerformanceDataManagerFactory::Flush() const
+{
+#if (CORE_PERF_ENABLED == 1)
+    std::lock_guard lock(flushMutex_);
+    Drain();
+#endif
+}
+
+#if (CORE_PERF_ENABLED == 1)
+PerformanceDataManagerFactory::ThreadBuffer& PerformanceDataManagerFactory::GetThreadBuffer()
+{
+    // Threads keep a reference to their buffer so that exiting doesn't need to synchronize with the factory. A buffer
+    // of a previous factory instance is replaced.
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    thread_local uint64_t owner{0U};
+    if (!buffer || (owner != serial_)) {
+        auto newBuffer = std::make_shared<ThreadBuffer>();
+        {
+            std::lock_guard lock(flushMutex_);
+            newBuffer->threadId = ++threadCount_;
+            threadBuffers_.push_back(newBuffer);
+        }
+        buffer = BASE_NS::move(newBuffer);
+        owner = serial_;
+    }
+    return *buffer;
+}
+
+void PerformanceDataManagerFactory::Drain() const
+{
+    for (auto it = threadBuffers_.begin(); it != threadBuffers_.end();) {
+        auto& buffer = **it;
+        const uint32_t head = buffer.head.load(std::memory_order_acquire);
+        uint32_t tail = buffer.tail.load(std::memory_order_relaxed);
+        for (; tail != head; ++tail) {
+            const auto& sample = buffer.samples[tail % THREAD_BUFFER_SIZE];
+            sample.manager->Aggregate(sample.subCategory, sample.name, sample.value, sample.type);
+            if ((sample.timestamp >= captureStart_) && (capturedEvents_.size() < MAX_CAPTURED_EVENTS)) {
+                capturedEvents_.push_back({PerformanceTraceEvent::Name(sample.manager->GetCategory()),
+                    sample.subCategory, sample.name, buffer.threadId, sample.timestamp - captureStart_, sample.value,
+                    sample.type});
+            }
+        }
+        buffer.tail.store(tail, std::memory_order_release);
+        // Buffers of exited threads are only referenced from here.
+        if (it->use_count() == 1) {
+            it = threadBuffers_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+#endif
+
+void PerformanceDataManagerFactory::StartCapture()
+{
+#if (CORE_PERF_ENABLED == 1)
+    std::lock_guard lock(flushMutex_);
+    // Updates made before starting are aggregated, but not captured.
+    Drain();
+    capturedEvents_.clear();
+    captureStart_ = GetMicroseconds();
+    capturing_ = true;
+#endif
+}
+
+void PerformanceDataManagerFactory::StopCapture()
+{
+#if (CORE_PERF_ENABLED == 1)
+    std::lock_guard lock(flushMutex_);
+    capturing_ = false;
+    Drain();
+#endif
+}
+
+bool PerformanceDataManagerFactory::IsCapturing() const
+{
+#if (CORE_PERF_ENABLED == 1)
+    return capturing_.load();
+#else
+    return false;
+#endif
+}
+
+bool PerformanceDataManagerFactory::ExportChromeTrace(
+    [[maybe_unused]] IFileManager& fileManager, [[maybe_unused]] const string_view uri)
+{
+#if (CORE_PERF_ENABLED == 1)
+    vector<PerformanceTraceEvent> events;
+    {
+        std::lock_guard lock(flushMutex_);
+        Drain();
+        events = capturedEvents_;
+    }
+    auto file = fileManager.CreateFile(uri);
+    if (!file) {
+        CORE_LOG_W("Failed to create trace file: %s", string(uri).c_str());
+        return false;
+    }
+    return WriteChromeTrace(*file, events);
+#else
+    return false;
+#endif
+}
+
 // IInterface
 const IInterface* PerformanceDataManagerFactory::GetInterface(const Uid& uid) const
 {
     if ((uid == IPerformanceDataManagerFactory::UID) || (uid == IInterface::UID)) {
-        return this;
+        return static_cast<const IPerformanceDataManagerFactory*>(this);
+    }
+    if (uid == IPerformanceCapture::UID) {
+        return static_cast<const IPerformanceCapture*>(this);
     }
     return nullptr;
 }
@@ -361,7 +574,10 @@ const IInterface* PerformanceDataManagerFactory::GetInterface(const Uid& uid) co
 IInterface* PerformanceDataManagerFactory::GetInterface(const Uid& uid)
 {
     if ((uid == IPerformanceDataManagerFactory::UID) || (uid == IInterface::UID)) {
-        return this;
+        return static_cast<IPerformanceDataManagerFactory*>(this);
+    }
+    if (uid == IPerformanceCapture::UID) {
+        return static_cast<IPerformanceCapture*>(this);
     }
     return nullptr;
 }
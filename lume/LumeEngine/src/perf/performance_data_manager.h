@@ -16,7 +16,9 @@
 #ifndef CORE_PERF_PERFORMANCE_DATA_MANAGER_H
 #define CORE_PERF_PERFORMANCE_DATA_MANAGER_H
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 
 #include <base/containers/fixed_string.h>
@@ -28,15 +30,19 @@
 #include <base/namespace.h>
 #include <core/intf_logger.h>
 #include <core/namespace.h>
+#include <core/perf/intf_performance_capture.h>
 #include <core/perf/intf_performance_data_manager.h>
 #include <core/perf/intf_performance_trace.h>
 #include <core/plugin/intf_plugin_register.h>
 
+#include "perf/chrome_trace_writer.h"
+
 CORE_BEGIN_NAMESPACE()
 // if CORE_DEV_ENABLED defined the manager methods are empty
 class PerformanceDataManagerFactory;
 /** PerformanceDataManager.
- * Internally synchronized global singleton for timings.
+ * Internally synchronized global singleton for timings. Updates are queued to per thread buffers of the factory and
+ * aggregated when the data is read or a buffer fills up.
  */
 class PerformanceDataManager final : public IPerformanceDataManager {
 public:
@@ -64,6 +70,10 @@ public:
 
     void DumpToLog() const;
 
+    // Adds a queued update to the data, called by the factory when flushing the thread buffers.
+    void Aggregate(const BASE_NS::string_view subCategory, const BASE_NS::string_view name, const int64_t value,
+        PerformanceTimingData::DataType type);
+
     void RemoveData(const BASE_NS::string_view subCategory) override;
 
     void GetSelectedCounters(CounterPairView data) const override;
@@ -78,6 +88,7 @@ public:
 private:
     const BASE_NS::string category_;
 #if (CORE_PERF_ENABLED == 1)
+    PerformanceDataManagerFactory& factory_;
     mutable std::mutex dataMutex_;
 
     TypeDataSet data_;
@@ -100,7 +111,7 @@ private:
     }
 };
 
-class PerformanceDataManagerFactory final : public IPerformanceDataManagerFactory {
+class PerformanceDataManagerFactory final : public IPerformanceDataManagerFactory, public IPerformanceCapture {
 public:
     explicit PerformanceDataManagerFactory(IPluginRegister& registry);
     ~PerformanceDataManagerFactory() override;
@@ -124,10 +135,39 @@ public:
     void RemovePerformanceTrace(const BASE_NS::Uid& uid);
     ILogger::IOutput::Ptr GetLogger();
 
+    // IPerformanceCapture
+    void StartCapture() override;
+    void StopCapture() override;
+    bool IsCapturing() const override;
+    bool ExportChromeTrace(IFileManager& fileManager, BASE_NS::string_view uri) override;
+
+    // Queues an update to the calling thread's buffer without locking.
+    void Record(PerformanceDataManager& manager, const BASE_NS::string_view subCategory,
+        const BASE_NS::string_view name, const int64_t value,
+        PerformanceDataManager::PerformanceTimingData::DataType type);
+    // Aggregates the queued updates of all the threads to the managers.
+    void Flush() const;
+
 private:
 #if (CORE_PERF_ENABLED == 1)
+    struct ThreadBuffer;
+    ThreadBuffer& GetThreadBuffer();
+    // Aggregates the queued updates and removes the buffers of exited threads. Requires flushMutex_.
+    void Drain() const;
+
     mutable std::mutex mutex_;
     BASE_NS::unordered_map<BASE_NS::string, BASE_NS::unique_ptr<PerformanceDataManager>> managers_;
+
+    // Identifies the factory instance in the thread local buffer references.
+    const uint64_t serial_;
+    // Flushing is the only consumer of the thread buffers.
+    mutable std::mutex flushMutex_;
+    mutable BASE_NS::vector<std::shared_ptr<ThreadBuffer>> threadBuffers_;
+    uint32_t threadCount_{0U};
+
+    std::atomic_bool capturing_{false};
+    int64_t captureStart_{0};
+    mutable BASE_NS::vector<PerformanceTraceEvent> capturedEvents_;
 #endif
     BASE_NS::vector<RegisteredPerformanceTrace> perfTraces_;
 };
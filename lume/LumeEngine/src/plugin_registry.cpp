@@ -448,7 +448,8 @@ vector<InterfaceTypeInfo> PluginRegistry::RegisterGlobalInterfaces(PluginRegistr
             GetName<IPerformanceDataManagerFactory>().data(),
             nullptr,
             [](IClassRegister& /* registry */, PluginToken token) -> IInterface* {
-                return &static_cast<PluginRegistry*>(token)->perfManFactory_;
+                return static_cast<IPerformanceDataManagerFactory*>(
+                    &static_cast<PluginRegistry*>(token)->perfManFactory_);
             }}
 #endif
     };
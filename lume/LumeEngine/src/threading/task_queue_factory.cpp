@@ -16,6 +16,7 @@
 #include "threading/task_queue_factory.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <deque>
@@ -35,6 +36,7 @@
 #include <base/containers/shared_ptr.h>
 #include <base/containers/type_traits.h>
 #include <base/containers/unique_ptr.h>
+#include <base/containers/unordered_map.h>
 #include <base/math/mathf.h>
 #include <base/util/uid.h>
 #include <core/log.h>
@@ -44,6 +46,7 @@
 #include "threading/dispatcher_impl.h"
 #include "threading/parallel_impl.h"
 #include "threading/sequential_impl.h"
+#include "threading/work_stealing_deque.h"
 
 #ifdef PLATFORM_HAS_JAVA
 #include <os/java/java_internal.h>
@@ -59,7 +62,44 @@ using BASE_NS::Math::max;
 namespace {
 #if defined(__OHOS_PLATFORM__) && !defined(BUILD_PUBLIC_VERSION)
 constexpr uint32_t RES_TYPE_EXT_ENGINE_SET_QOS = 10028;
+
+void ReportEngineResType(long tid, int64_t value)
+{
+    std::unordered_map<std::string, std::string> mapPayload{
+        {"pid", std::to_string(getpid())}, {"tid", std::to_string(tid)}};
+    CORE_LOG_I("ReportEngineResType %s %s", mapPayload["pid"].c_str(), mapPayload["tid"].c_str());
+    OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(RES_TYPE_EXT_ENGINE_SET_QOS, value, mapPayload);
+}
+
+// Raises the QoS of a pool worker thread and reports it to the resource scheduler. Returns the thread id.
+long SetWorkerThreadQos()
+{
+    int ret = OHOS::QOS::SetThreadQos(OHOS::QOS::QosLevel::QOS_USER_INTERACTIVE);
+    CORE_LOG_I("set engine child thread qos %s", ret == 0 ? "success" : "failed");
+    auto tid = syscall(SYS_gettid);
+    if (tid > 0) {
+        ReportEngineResType(tid, 1);
+    }
+    return tid;
+}
+
+void ResetWorkerThreadQos(long tid)
+{
+    ReportEngineResType(tid, 0);
+}
+#endif
+
+// Hint to the CPU that the caller is busy waiting.
+inline void CpuRelax()
+{
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_ia32_pause)
+    __builtin_ia32_pause();
+#elif defined(__arm__) || defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
 #endif
+}
 
 #ifdef PLATFORM_HAS_JAVA
 /** RAII class for handling thread setup/release. */
@@ -421,16 +461,7 @@ private:
 #endif
 
 #if defined(__OHOS_PLATFORM__) && !defined(BUILD_PUBLIC_VERSION)
-        int ret = OHOS::QOS::SetThreadQos(OHOS::QOS::QosLevel::QOS_USER_INTERACTIVE);
-        CORE_LOG_I("set engine child thread qos %s", ret == 0 ? "success" : "failed");
-        auto tid = syscall(SYS_gettid);
-        if (tid > 0) {
-            std::unordered_map<std::string, std::string> mapPayload{
-                {"pid", std::to_string(getpid())}, {"tid", std::to_string(tid)}};
-            CORE_LOG_I("ReportEngineResType %s %s", mapPayload["pid"].c_str(), mapPayload["tid"].c_str());
-            OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
-                RES_TYPE_EXT_ENGINE_SET_QOS, 1, mapPayload);
-        }
+        const auto tid = SetWorkerThreadQos();
 #endif
 
         while (true) {
@@ -448,11 +479,7 @@ private:
             // If there was no task it means we are stopping and thread can exit.
             if (!task) {
 #if defined(__OHOS_PLATFORM__) && !defined(BUILD_PUBLIC_VERSION)
-                std::unordered_map<std::string, std::string> mapPayload{
-                    {"pid", std::to_string(getpid())}, {"tid", std::to_string(tid)}};
-                CORE_LOG_I("ReportEngineResType %s %s", mapPayload["pid"].c_str(), mapPayload["tid"].c_str());
-                OHOS::ResourceSchedule::ResSchedClient::GetInstance().ReportData(
-                    RES_TYPE_EXT_ENGINE_SET_QOS, 0, mapPayload);
+                ResetWorkerThreadQos(tid);
 #endif
                 return;
             }
@@ -506,6 +533,393 @@ private:
     std::condition_variable cv_;
     int32_t refcnt_{0};
 };
+
+// -- WorkStealingThreadPool
+// Each worker owns a lock-free deque. Tasks pushed from a worker thread go to its own deque, other pushes go to a
+// shared injection queue. Idle workers steal from the other deques before spinning down and sleeping. Dependencies are
+// tracked with counters: a task is scheduled when its last unfinished dependency completes, so nothing scans the
+// queued tasks.
+class WorkStealingThreadPool final : public IThreadPool {
+public:
+    explicit WorkStealingThreadPool(size_t threadCount)
+        : threadCount_(max(size_t(1), threadCount)), workers_(make_unique<Worker[]>(threadCount_))
+    {
+        CORE_ASSERT(workers_);
+
+        if (threadCount == 0U) {
+            CORE_LOG_W("Threadpool minimum thread count is 1");
+        }
+        // All the deques exist before any worker starts stealing.
+        for (size_t i = 0U; i < threadCount_; ++i) {
+            workers_[i].thread = std::thread(&WorkStealingThreadPool::ThreadProc, this, static_cast<uint32_t>(i));
+        }
+    }
+
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool(WorkStealingThreadPool&&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(WorkStealingThreadPool&&) = delete;
+
+    IResult::Ptr Push(ITask::Ptr task) override
+    {
+        return Push(BASE_NS::move(task), {});
+    }
+
+    IResult::Ptr Push(ITask::Ptr task, BASE_NS::array_view<const ITask* const> dependencies) override
+    {
+        auto taskState = BASE_NS::make_shared<TaskResult::State>();
+        if (taskState) {
+            if (task) {
+                Submit(BASE_NS::move(task), taskState, dependencies);
+            } else {
+                // mark as done if the there was no function.
+                taskState->Done();
+            }
+        }
+        return IResult::Ptr{new TaskResult(BASE_NS::move(taskState))};
+    }
+
+    void PushNoWait(ITask::Ptr task) override
+    {
+        PushNoWait(BASE_NS::move(task), {});
+    }
+
+    void PushNoWait(ITask::Ptr task, BASE_NS::array_view<const ITask* const> dependencies) override
+    {
+        if (task) {
+            Submit(BASE_NS::move(task), {}, dependencies);
+        }
+    }
+
+    uint32_t GetNumberOfThreads() const override
+    {
+        return static_cast<uint32_t>(threadCount_);
+    }
+
+    // IInterface
+    const IInterface* GetInterface(const BASE_NS::Uid& uid) const override
+    {
+        if ((uid == IThreadPool::UID) || (uid == IInterface::UID)) {
+            return this;
+        }
+        return nullptr;
+    }
+
+    IInterface* GetInterface(const BASE_NS::Uid& uid) override
+    {
+        if ((uid == IThreadPool::UID) || (uid == IInterface::UID)) {
+            return this;
+        }
+        return nullptr;
+    }
+
+    void Ref() override
+    {
+        BASE_NS::AtomicIncrementRelaxed(&refcnt_);
+    }
+
+    void Unref() override
+    {
+        if (BASE_NS::AtomicDecrementRelease(&refcnt_) == 0) {
+            BASE_NS::AtomicFenceAcquire();
+            delete this;
+        }
+    }
+
+protected:
+    ~WorkStealingThreadPool() final
+    {
+        Stop();
+    }
+
+private:
+    // Busy wait rounds with a pause instruction before yielding, and yield rounds before sleeping.
+    static constexpr uint32_t SPIN_COUNT = 64U;
+    static constexpr uint32_t YIELD_COUNT = 16U;
+    // Number of independently locked buckets used for mapping ITask pointers to queued tasks.
+    static constexpr size_t REGISTRY_SHARD_COUNT = 16U;
+
+    struct Task {
+        ITask::Ptr function_;
+        BASE_NS::shared_ptr<TaskResult::State> state_;
+        // Tasks waiting for this one. Guarded by lock_.
+        BASE_NS::vector<Task*> dependents_;
+        // Unfinished dependencies plus one which is held while the task is being submitted.
+        std::atomic<uint32_t> pending_{1U};
+        BASE_NS::SpinLock lock_;
+        bool finished_{false};
+    };
+
+    struct Worker {
+        std::thread thread;
+        WorkStealingDeque<Task*> deque;
+    };
+
+    // Owns the submitted tasks until they have finished and maps ITask pointers to them for dependency lookups.
+    struct RegistryShard {
+        std::mutex mutex;
+        BASE_NS::unordered_map<const ITask*, BASE_NS::shared_ptr<Task>> tasks;
+    };
+
+    // Identifies the worker, if any, running on the current thread.
+    struct WorkerBinding {
+        const WorkStealingThreadPool* pool{nullptr};
+        uint32_t index{0U};
+    };
+    static thread_local WorkerBinding currentWorker_;
+
+    RegistryShard& GetShard(const ITask* task)
+    {
+        // Drop the low bits which are the same for every allocation.
+        constexpr uintptr_t alignmentBits = 4U;
+        return registry_[(reinterpret_cast<uintptr_t>(task) >> alignmentBits) % REGISTRY_SHARD_COUNT];
+    }
+
+    void Submit(ITask::Ptr&& function, BASE_NS::shared_ptr<TaskResult::State> state,
+        BASE_NS::array_view<const ITask* const> dependencies)
+    {
+        auto task = BASE_NS::make_shared<Task>();
+        const ITask* key = function.get();
+        task->function_ = BASE_NS::move(function);
+        task->state_ = BASE_NS::move(state);
+        Task* rawTask = task.get();
+        {
+            auto& shard = GetShard(key);
+            std::lock_guard lock(shard.mutex);
+            shard.tasks.insert_or_assign(key, BASE_NS::move(task));
+        }
+
+        // Dependencies which are unknown or already finished are ignored.
+        for (const ITask* dep : dependencies) {
+            if (!dep || (dep == key)) {
+                continue;
+            }
+            BASE_NS::shared_ptr<Task> dependency;
+            {
+                auto& shard = GetShard(dep);
+                std::lock_guard lock(shard.mutex);
+                if (auto pos = shard.tasks.find(dep); pos != shard.tasks.end()) {
+                    dependency = pos->second;
+                }
+            }
+            if (dependency) {
+                BASE_NS::ScopedSpinLock lock(dependency->lock_);
+                if (!dependency->finished_) {
+                    rawTask->pending_.fetch_add(1U, std::memory_order_relaxed);
+                    dependency->dependents_.push_back(rawTask);
+                }
+            }
+        }
+
+        // Release the submission reference, if all the dependencies are done the task can be scheduled.
+        if (rawTask->pending_.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+            Schedule(rawTask);
+        }
+    }
+
+    void Schedule(Task* task)
+    {
+        if (currentWorker_.pool == this) {
+            workers_[currentWorker_.index].deque.Push(task);
+        } else {
+            std::lock_guard lock(injectMutex_);
+            injected_.push_back(task);
+            injectedCount_.fetch_add(1U, std::memory_order_release);
+        }
+        WakeOne();
+    }
+
+    void WakeOne()
+    {
+        // Paired with the sleeping_ increment and the work check in ThreadProc. Either the worker sees the new task or
+        // we see the sleeping worker.
+        epoch_.fetch_add(1U, std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_seq_cst) > 0U) {
+            {
+                std::lock_guard lock(sleepMutex_);
+            }
+            sleepCv_.notify_one();
+        }
+    }
+
+    Task* PopInjected()
+    {
+        if (injectedCount_.load(std::memory_order_acquire) == 0U) {
+            return nullptr;
+        }
+        std::lock_guard lock(injectMutex_);
+        if (injected_.empty()) {
+            return nullptr;
+        }
+        Task* task = injected_.front();
+        injected_.pop_front();
+        injectedCount_.fetch_sub(1U, std::memory_order_relaxed);
+        return task;
+    }
+
+    Task* FindWork(uint32_t index)
+    {
+        if (Task* task = workers_[index].deque.Pop()) {
+            return task;
+        }
+        if (Task* task = PopInjected()) {
+            return task;
+        }
+        for (size_t i = 1U; i < threadCount_; ++i) {
+            if (Task* task = workers_[(index + i) % threadCount_].deque.Steal()) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    bool HasWork() const
+    {
+        if (injectedCount_.load(std::memory_order_seq_cst) != 0U) {
+            return true;
+        }
+        for (size_t i = 0U; i < threadCount_; ++i) {
+            if (!workers_[i].deque.Empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Run(Task* task)
+    {
+        {
+            CORE_CPU_PERF_SCOPE("CORE", "ThreadPoolTask", "", CORE_PROFILER_DEFAULT_COLOR);
+            (*task->function_)();
+        }
+        if (task->state_) {
+            task->state_->Done();
+        }
+
+        BASE_NS::vector<Task*> dependents;
+        {
+            BASE_NS::ScopedSpinLock lock(task->lock_);
+            task->finished_ = true;
+            dependents.swap(task->dependents_);
+        }
+        for (Task* dependent : dependents) {
+            if (dependent->pending_.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+                Schedule(dependent);
+            }
+        }
+
+        // Unregister before the function is destroyed so that a new task allocated at the same address can't be
+        // mistaken for this one.
+        const ITask* key = task->function_.get();
+        BASE_NS::shared_ptr<Task> finished;
+        {
+            auto& shard = GetShard(key);
+            std::lock_guard lock(shard.mutex);
+            if (auto pos = shard.tasks.find(key); pos != shard.tasks.end()) {
+                finished = BASE_NS::move(pos->second);
+                shard.tasks.erase(pos);
+            }
+        }
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard lock(sleepMutex_);
+            if (isDone_) {
+                return;
+            }
+            isDone_ = true;
+        }
+        sleepCv_.notify_all();
+
+        // Workers exit once they run out of tasks.
+        for (size_t i = 0U; i < threadCount_; ++i) {
+            if (workers_[i].thread.joinable()) {
+                workers_[i].thread.join();
+            }
+        }
+
+        // Only tasks whose dependencies never completed can be left.
+        for (auto& shard : registry_) {
+            std::lock_guard lock(shard.mutex);
+            shard.tasks.clear();
+        }
+    }
+
+    void ThreadProc(uint32_t index)
+    {
+#ifdef PLATFORM_HAS_JAVA
+        // RAII class for handling thread setup/release.
+        JavaThreadContext javaContext;
+#endif
+
+#if defined(__OHOS_PLATFORM__) && !defined(BUILD_PUBLIC_VERSION)
+        const auto tid = SetWorkerThreadQos();
+#endif
+        currentWorker_ = {this, index};
+
+        uint32_t idleRounds = 0U;
+        while (true) {
+            if (Task* task = FindWork(index)) {
+                Run(task);
+                idleRounds = 0U;
+                continue;
+            }
+
+            // Back off gradually: spin, then yield, then sleep until new work is scheduled.
+            ++idleRounds;
+            if (idleRounds < SPIN_COUNT) {
+                CpuRelax();
+                continue;
+            }
+            if (idleRounds < (SPIN_COUNT + YIELD_COUNT)) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock lock(sleepMutex_);
+            sleeping_.fetch_add(1U, std::memory_order_seq_cst);
+            const auto epoch = epoch_.load(std::memory_order_seq_cst);
+            const bool hasWork = HasWork();
+            if (!hasWork && isDone_) {
+                sleeping_.fetch_sub(1U, std::memory_order_relaxed);
+                break;
+            }
+            if (!hasWork) {
+                sleepCv_.wait(lock, [this, epoch]() {
+                    return isDone_ || (epoch_.load(std::memory_order_seq_cst) != epoch);
+                });
+            }
+            sleeping_.fetch_sub(1U, std::memory_order_relaxed);
+            idleRounds = 0U;
+        }
+
+        currentWorker_ = {};
+#if defined(__OHOS_PLATFORM__) && !defined(BUILD_PUBLIC_VERSION)
+        ResetWorkerThreadQos(tid);
+#endif
+    }
+
+    size_t threadCount_{0};
+    unique_ptr<Worker[]> workers_;
+
+    RegistryShard registry_[REGISTRY_SHARD_COUNT];
+
+    std::mutex injectMutex_;
+    std::deque<Task*> injected_;
+    std::atomic<uint32_t> injectedCount_{0U};
+
+    std::mutex sleepMutex_;
+    std::condition_variable sleepCv_;
+    std::atomic<uint32_t> sleeping_{0U};
+    std::atomic<uint32_t> epoch_{0U};
+    bool isDone_{false};
+
+    int32_t refcnt_{0};
+};
+
+thread_local WorkStealingThreadPool::WorkerBinding WorkStealingThreadPool::currentWorker_;
 }  // namespace
 
 uint32_t TaskQueueFactory::GetNumberOfCores() const
@@ -524,6 +938,14 @@ IThreadPool::Ptr TaskQueueFactory::CreateThreadPool(const uint32_t threadCount)
     return IThreadPool::Ptr{new ThreadPool(threadCount)};
 }
 
+IThreadPool::Ptr TaskQueueFactory::CreateThreadPool(const uint32_t threadCount, const ThreadPoolType type) const
+{
+    if (type == ThreadPoolType::WORK_STEALING) {
+        return IThreadPool::Ptr{new WorkStealingThreadPool(threadCount)};
+    }
+    return IThreadPool::Ptr{new ThreadPool(threadCount)};
+}
+
 IDispatcherTaskQueue::Ptr TaskQueueFactory::CreateDispatcherTaskQueue(const IThreadPool::Ptr& threadPool) const
 {
     return IDispatcherTaskQueue::Ptr{make_unique<DispatcherImpl>(threadPool).release()};
@@ -30,6 +30,7 @@ public:
     IDispatcherTaskQueue::Ptr CreateDispatcherTaskQueue(const IThreadPool::Ptr& threadPool) const override;
     IParallelTaskQueue::Ptr CreateParallelTaskQueue(const IThreadPool::Ptr& threadPool) const override;
     ISequentialTaskQueue::Ptr CreateSequentialTaskQueue(const IThreadPool::Ptr& threadPool) const override;
+    IThreadPool::Ptr CreateThreadPool(uint32_t threadCount, ThreadPoolType type) const override;
 
     // IInterface
     const IInterface* GetInterface(const BASE_NS::Uid& uid) const override;
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_THREADING_WORK_STEALING_DEQUE_H
+#define CORE_THREADING_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <base/containers/unique_ptr.h>
+#include <base/containers/vector.h>
+#include <core/namespace.h>
+
+CORE_BEGIN_NAMESPACE()
+/** Lock-free single owner / multiple thief deque (Chase-Lev).
+ * The owning thread pushes and pops at the bottom, other threads steal from the top. Memory orderings follow
+ * "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al. 2013). Buffers replaced when growing are
+ * retired until the deque is destroyed as thieves may still be reading them.
+ * T must be a pointer type, nullptr is used to signal an empty deque or a lost race.
+ */
+template <typename T>
+class WorkStealingDeque final {
+public:
+    static constexpr size_t INITIAL_CAPACITY = 256U;
+
+    explicit WorkStealingDeque(size_t capacity = INITIAL_CAPACITY)
+    {
+        size_t size = 1U;
+        while (size < capacity) {
+            size <<= 1U;
+        }
+        retired_.push_back(BASE_NS::make_unique<Buffer>(size));
+        buffer_.store(retired_.back().get(), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    /** Push an item to the bottom of the deque. Only the owning thread may call this. */
+    void Push(T item)
+    {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        if ((b - t) > static_cast<int64_t>(buffer->mask)) {
+            buffer = Grow(buffer, b, t);
+        }
+        buffer->Put(b, item);
+        // Publishes the item to thieves which load bottom_ with acquire.
+        bottom_.store(b + 1, std::memory_order_release);
+    }
+
+    /** Pop an item from the bottom of the deque. Only the owning thread may call this.
+     * @return Popped item or nullptr if the deque was empty.
+     */
+    T Pop()
+    {
+        const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        if (t > b) {
+            // Empty.
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T item = buffer->Get(b);
+        if (t == b) {
+            // Last item, race against thieves.
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /** Steal an item from the top of the deque. Any thread may call this.
+     * @return Stolen item or nullptr if the deque was empty or another thread won the race.
+     */
+    T Steal()
+    {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+        Buffer* buffer = buffer_.load(std::memory_order_acquire);
+        T item = buffer->Get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    /** Approximate check for emptiness, exact only when called by the owner with no concurrent thieves. */
+    bool Empty() const
+    {
+        const int64_t b = bottom_.load(std::memory_order_seq_cst);
+        const int64_t t = top_.load(std::memory_order_seq_cst);
+        return b <= t;
+    }
+
+private:
+    struct Buffer {
+        explicit Buffer(size_t size) : mask(size - 1U), items(BASE_NS::make_unique<std::atomic<T>[]>(size)) {}
+
+        T Get(int64_t index) const
+        {
+            return items[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+
+        void Put(int64_t index, T item)
+        {
+            items[static_cast<size_t>(index) & mask].store(item, std::memory_order_relaxed);
+        }
+
+        size_t mask;
+        BASE_NS::unique_ptr<std::atomic<T>[]> items;
+    };
+
+    Buffer* Grow(const Buffer* buffer, int64_t bottom, int64_t top)
+    {
+        retired_.push_back(BASE_NS::make_unique<Buffer>((buffer->mask + 1U) * 2U));
+        Buffer* grown = retired_.back().get();
+        for (int64_t i = top; i < bottom; ++i) {
+            grown->Put(i, buffer->Get(i));
+        }
+        buffer_.store(grown, std::memory_order_release);
+        return grown;
+    }
+
+    // Keep top and bottom on separate cache lines as they are written by different threads.
+    alignas(64) std::atomic<int64_t> top_{0};
+    alignas(64) std::atomic<int64_t> bottom_{0};
+    alignas(64) std::atomic<Buffer*> buffer_{nullptr};
+    // Owned by the owner thread, all buffers ever used.
+    BASE_NS::vector<BASE_NS::unique_ptr<Buffer>> retired_;
+};
+CORE_END_NAMESPACE()
+
+#endif  // CORE_THREADING_WORK_STEALING_DEQUE_H
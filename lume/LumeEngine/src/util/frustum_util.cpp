@@ -15,20 +15,130 @@
 
 #include "frustum_util.h"
 
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+#include <base/containers/array_view.h>
 #include <base/containers/string_view.h>
 #include <base/math/matrix.h>
 #include <base/math/vector.h>
 #include <base/math/vector_util.h>
 #include <base/namespace.h>
 #include <base/util/uid.h>
+#include <core/log.h>
 #include <core/namespace.h>
 
 CORE_BEGIN_NAMESPACE()
+using BASE_NS::array_view;
 using BASE_NS::string_view;
 using BASE_NS::Uid;
 using BASE_NS::Math::Mat4X4;
 using BASE_NS::Math::Vec3;
 
+namespace {
+constexpr size_t BITS_PER_WORD = 64U;
+
+// Visibility bits of spheres [begin, end) in the frustum, bit 0 is sphere begin.
+uint64_t CullScalar(const Frustum& frustum, const FrustumSpheres& spheres, const size_t begin, const size_t end)
+{
+    uint64_t mask = 0U;
+    for (size_t i = begin; i < end; ++i) {
+        bool visible = true;
+        for (const auto& plane : frustum.planes) {
+            const float d = (plane.x * spheres.centerX[i]) + (plane.y * spheres.centerY[i]) +
+                            (plane.z * spheres.centerZ[i]) + plane.w;
+            if (d <= -spheres.radius[i]) {
+                visible = false;
+                break;
+            }
+        }
+        mask |= static_cast<uint64_t>(visible) << (i - begin);
+    }
+    return mask;
+}
+
+// The SIMD kernels test LANE_COUNT spheres starting at index i and return their visibility bits. Products and sums
+// are evaluated in the same order as in the scalar test and the comparison is "not less or equal" so that NaNs are
+// visible as with SphereFrustumCollision.
+#if defined(__AVX__)
+constexpr size_t LANE_COUNT = 8U;
+
+inline uint32_t CullLanes(const Frustum& frustum, const FrustumSpheres& spheres, const size_t i)
+{
+    const __m256 x = _mm256_loadu_ps(spheres.centerX.data() + i);
+    const __m256 y = _mm256_loadu_ps(spheres.centerY.data() + i);
+    const __m256 z = _mm256_loadu_ps(spheres.centerZ.data() + i);
+    const __m256 negRadius = _mm256_xor_ps(_mm256_loadu_ps(spheres.radius.data() + i), _mm256_set1_ps(-0.0f));
+    __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    for (const auto& plane : frustum.planes) {
+        __m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.x), x), _mm256_mul_ps(_mm256_set1_ps(plane.y), y));
+        d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_set1_ps(plane.z), z));
+        d = _mm256_add_ps(d, _mm256_set1_ps(plane.w));
+        visible = _mm256_and_ps(visible, _mm256_cmp_ps(d, negRadius, _CMP_NLE_UQ));
+    }
+    return static_cast<uint32_t>(_mm256_movemask_ps(visible));
+}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+constexpr size_t LANE_COUNT = 4U;
+
+inline uint32_t CullLanes(const Frustum& frustum, const FrustumSpheres& spheres, const size_t i)
+{
+    const __m128 x = _mm_loadu_ps(spheres.centerX.data() + i);
+    const __m128 y = _mm_loadu_ps(spheres.centerY.data() + i);
+    const __m128 z = _mm_loadu_ps(spheres.centerZ.data() + i);
+    const __m128 negRadius = _mm_xor_ps(_mm_loadu_ps(spheres.radius.data() + i), _mm_set1_ps(-0.0f));
+    __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (const auto& plane : frustum.planes) {
+        __m128 d = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x), _mm_mul_ps(_mm_set1_ps(plane.y), y));
+        d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(plane.z), z));
+        d = _mm_add_ps(d, _mm_set1_ps(plane.w));
+        visible = _mm_and_ps(visible, _mm_cmpnle_ps(d, negRadius));
+    }
+    return static_cast<uint32_t>(_mm_movemask_ps(visible));
+}
+#elif defined(__aarch64__) || defined(_M_ARM64)
+constexpr size_t LANE_COUNT = 4U;
+
+inline uint32_t CullLanes(const Frustum& frustum, const FrustumSpheres& spheres, const size_t i)
+{
+    const float32x4_t x = vld1q_f32(spheres.centerX.data() + i);
+    const float32x4_t y = vld1q_f32(spheres.centerY.data() + i);
+    const float32x4_t z = vld1q_f32(spheres.centerZ.data() + i);
+    const float32x4_t negRadius = vnegq_f32(vld1q_f32(spheres.radius.data() + i));
+    uint32x4_t culled = vdupq_n_u32(0U);
+    for (const auto& plane : frustum.planes) {
+        // separate multiply and add, fused multiply-add would round differently than the scalar test
+        float32x4_t d = vaddq_f32(vmulq_n_f32(x, plane.x), vmulq_n_f32(y, plane.y));
+        d = vaddq_f32(d, vmulq_n_f32(z, plane.z));
+        d = vaddq_f32(d, vdupq_n_f32(plane.w));
+        culled = vorrq_u32(culled, vcleq_f32(d, negRadius));
+    }
+    constexpr uint32_t laneBits[]{1U, 2U, 4U, 8U};
+    return vaddvq_u32(vbicq_u32(vld1q_u32(laneBits), culled));
+}
+#else
+constexpr size_t LANE_COUNT = 1U;
+
+inline uint32_t CullLanes(const Frustum& frustum, const FrustumSpheres& spheres, const size_t i)
+{
+    return static_cast<uint32_t>(CullScalar(frustum, spheres, i, i + 1U));
+}
+#endif
+
+// Visibility bits of a full word of spheres starting at begin.
+uint64_t CullWord(const Frustum& frustum, const FrustumSpheres& spheres, const size_t begin)
+{
+    uint64_t mask = 0U;
+    for (size_t i = 0U; i < BITS_PER_WORD; i += LANE_COUNT) {
+        mask |= static_cast<uint64_t>(CullLanes(frustum, spheres, begin + i)) << i;
+    }
+    return mask;
+}
+}  // namespace
+
 Frustum FrustumUtil::CreateFrustum(const Mat4X4& matrix) const
 {
     Frustum frustum;
@@ -87,6 +197,35 @@ bool FrustumUtil::SphereFrustumCollision(const Frustum& frustum, const Vec3 pos,
     return true;
 }
 
+void FrustumUtil::SpheresFrustumCollision(
+    array_view<const Frustum> frustums, const FrustumSpheres& spheres, array_view<uint64_t> visibility) const
+{
+    const size_t count = spheres.centerX.size();
+    if ((spheres.centerY.size() < count) || (spheres.centerZ.size() < count) || (spheres.radius.size() < count) ||
+        (visibility.size() < ((count + BITS_PER_WORD - 1U) / BITS_PER_WORD))) {
+        CORE_LOG_E("SpheresFrustumCollision: invalid array sizes");
+        return;
+    }
+    const size_t fullWords = count / BITS_PER_WORD;
+    for (size_t word = 0U; word < fullWords; ++word) {
+        uint64_t mask = 0U;
+        for (const auto& frustum : frustums) {
+            mask |= CullWord(frustum, spheres, word * BITS_PER_WORD);
+            if (mask == ~0ULL) {
+                break;
+            }
+        }
+        visibility[word] = mask;
+    }
+    if (const size_t begin = fullWords * BITS_PER_WORD; begin < count) {
+        uint64_t mask = 0U;
+        for (const auto& frustum : frustums) {
+            mask |= CullScalar(frustum, spheres, begin, count);
+        }
+        visibility[fullWords] = mask;
+    }
+}
+
 const IInterface* FrustumUtil::GetInterface(const Uid& uid) const
 {
     if ((uid == IFrustumUtil::UID) || (uid == IInterface::UID)) {
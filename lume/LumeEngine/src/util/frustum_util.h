@@ -15,6 +15,7 @@
 #ifndef CORE_UTIL_FRUSTUM_UTIL_H
 #define CORE_UTIL_FRUSTUM_UTIL_H
 
+#include <base/containers/array_view.h>
 #include <base/containers/string_view.h>
 #include <base/namespace.h>
 #include <core/namespace.h>
@@ -33,6 +34,8 @@ class FrustumUtil final : public IFrustumUtil {
 public:
     Frustum CreateFrustum(const BASE_NS::Math::Mat4X4& matrix) const override;
     bool SphereFrustumCollision(const Frustum& frustum, BASE_NS::Math::Vec3 pos, float radius) const override;
+    void SpheresFrustumCollision(BASE_NS::array_view<const Frustum> frustums, const FrustumSpheres& spheres,
+        BASE_NS::array_view<uint64_t> visibility) const override;
 
     const IInterface* GetInterface(const BASE_NS::Uid& uid) const override;
     IInterface* GetInterface(const BASE_NS::Uid& uid) override;
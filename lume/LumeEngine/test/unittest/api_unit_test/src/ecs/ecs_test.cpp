@@ -17,6 +17,7 @@
 #include <ComponentTools/base_manager.inl>
 #include <ComponentTools/component_query.h>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <thread>
 
@@ -497,6 +498,102 @@ constexpr SystemTypeInfo duplicateTestSystemInfo{
     testSystemDependencies,
 };
 
+// Shared by all OrderTestSystems to order the update start and end events.
+std::atomic_uint32_t orderTestCounter{0U};
+
+// System used for testing parallel updates. Records the order in which the updates start and end.
+template <int Index>
+class OrderTestSystem final : public ISystem {
+public:
+    static constexpr Uid UIDS[] = {Uid{"7b8c1d35-1f2a-4f0e-9a6c-000000000001"},
+        Uid{"7b8c1d35-1f2a-4f0e-9a6c-000000000002"}, Uid{"7b8c1d35-1f2a-4f0e-9a6c-000000000003"}};
+    static constexpr Uid UID = UIDS[Index];
+
+    explicit OrderTestSystem(IEcs& ecs) : ecs_(ecs) {}
+
+    string_view GetName() const override
+    {
+        return "OrderTestSystem";
+    }
+
+    Uid GetUid() const override
+    {
+        return UID;
+    }
+
+    IPropertyHandle* GetProperties() override
+    {
+        return nullptr;
+    }
+
+    const IPropertyHandle* GetProperties() const override
+    {
+        return nullptr;
+    }
+
+    void SetProperties(const IPropertyHandle&) override {}
+
+    bool IsActive() const override
+    {
+        return true;
+    }
+
+    void SetActive(bool) override {}
+
+    void Initialize() override {}
+
+    bool Update(bool, uint64_t, uint64_t) override
+    {
+        start_ = orderTestCounter.fetch_add(1U);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        end_ = orderTestCounter.fetch_add(1U);
+        return Index == 0;
+    }
+
+    void Uninitialize() override {}
+
+    const IEcs& GetECS() const override
+    {
+        return ecs_;
+    }
+
+    static inline uint32_t start_{0U};
+    static inline uint32_t end_{0U};
+
+private:
+    IEcs& ecs_;
+};
+
+template <int Index>
+inline constexpr const string_view GetName(const OrderTestSystem<Index>*)
+{
+    return "OrderTestSystem";
+}
+
+constexpr Uid orderTestSystemWritesX[] = {ITestComponentManager::UID};
+constexpr Uid orderTestSystemWritesY[] = {ITestComponent2Manager::UID};
+constexpr Uid orderTestSystemReadsXY[] = {ITestComponentManager::UID, ITestComponent2Manager::UID};
+
+template <int Index>
+constexpr SystemTypeInfo CreateOrderTestSystemInfo(
+    array_view<const Uid> componentDependencies, array_view<const Uid> readOnlyComponentDependencies)
+{
+    return {
+        {SystemTypeInfo::UID},
+        OrderTestSystem<Index>::UID,
+        "OrderTestSystem",
+        [](IEcs& ecs) -> ISystem* { return new OrderTestSystem<Index>(ecs); },
+        [](ISystem* instance) { delete static_cast<OrderTestSystem<Index>*>(instance); },
+        componentDependencies,
+        readOnlyComponentDependencies,
+    };
+}
+
+// A writes X, B writes Y and C reads both.
+constexpr SystemTypeInfo orderTestSystemAInfo = CreateOrderTestSystemInfo<0>(orderTestSystemWritesX, {});
+constexpr SystemTypeInfo orderTestSystemBInfo = CreateOrderTestSystemInfo<1>(orderTestSystemWritesY, {});
+constexpr SystemTypeInfo orderTestSystemCInfo = CreateOrderTestSystemInfo<2>({}, orderTestSystemReadsXY);
+
 class EntityListener final : IEcs::EntityListener {
 public:
     EntityListener(IEcs& ecs) : ecs_{ecs}
@@ -1525,6 +1622,97 @@ UNIT_TEST(API_EcsTest, componentQuery, testing::ext::TestSize.Level1)
     GetPluginRegister().UnregisterTypeInfo(testComponent2Info);
 }
 
+/**
+ * @tc.name: componentQueryIncremental
+ * @tc.desc: Tests for patching Component Query results with ECS listeners enabled.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsTest, componentQueryIncremental, testing::ext::TestSize.Level1)
+{
+    IEngine::Ptr engine = UTest::CreateEngine();
+    IEcs::Ptr ecs = engine->CreateEcs();
+
+    auto factory = GetInstance<ISystemGraphLoaderFactory>(UID_SYSTEM_GRAPH_LOADER);
+    ASSERT_TRUE(factory);
+    auto systemGraphLoader = factory->Create(engine->GetFileManager());
+
+    GetPluginRegister().RegisterTypeInfo(testSystemInfo);
+    GetPluginRegister().RegisterTypeInfo(testComponentInfo);
+    GetPluginRegister().RegisterTypeInfo(testComponent2Info);
+    EXPECT_TRUE(systemGraphLoader->Load(systemGraph, *ecs).success);
+    ecs->CreateComponentManager(testComponent2Info);
+
+    ecs->Initialize();
+
+    auto* testManager = GetManager<ITestComponentManager>(*ecs);
+    ASSERT_TRUE(testManager);
+    auto* test2Manager = GetManager<ITestComponent2Manager>(*ecs);
+    ASSERT_TRUE(test2Manager);
+
+    ComponentQuery query;
+    const ComponentQuery::Operation operations[] = {
+        {*test2Manager, ComponentQuery::Operation ::Method::OPTIONAL}};
+    query.SetupQuery(*testManager, operations, true);
+    query.SetEcsListenersEnabled(true);
+
+    constexpr size_t entityCount = 100U;
+    vector<Entity> entities;
+    for (size_t i = 0; i < entityCount; ++i) {
+        entities.push_back(ecs->GetEntityManager().Create());
+        testManager->Create(entities.back());
+    }
+    IEcs* ecsArr[] = {ecs.get()};
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+
+    // first execute walks the whole base set.
+    EXPECT_TRUE(query.Execute());
+    EXPECT_TRUE(query.GetExecuteStatistics().fullRebuild);
+    EXPECT_EQ(query.GetExecuteStatistics().evaluatedRows, entityCount);
+    ASSERT_EQ(query.GetResults().size(), entityCount);
+
+    // nothing changed, nothing evaluated.
+    EXPECT_FALSE(query.Execute());
+    EXPECT_EQ(query.GetExecuteStatistics().evaluatedRows, 0U);
+
+    // adding an optional component only re-evaluates that entity.
+    test2Manager->Create(entities[10U]);
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+    EXPECT_FALSE(query.IsValid());
+    EXPECT_TRUE(query.Execute());
+    EXPECT_FALSE(query.GetExecuteStatistics().fullRebuild);
+    EXPECT_EQ(query.GetExecuteStatistics().evaluatedRows, 1U);
+    EXPECT_EQ(query.GetExecuteStatistics().removedRows, 1U);
+    ASSERT_EQ(query.GetResults().size(), entityCount);
+    const auto* row = query.FindResultRow(entities[10U]);
+    ASSERT_TRUE(row);
+    EXPECT_EQ(row->entity, entities[10U]);
+    EXPECT_EQ(row->components[1U], test2Manager->GetComponentId(entities[10U]));
+
+    // destroyed entities are dropped from the lookup right away and their rows are removed on execute.
+    ecs->GetEntityManager().Destroy(entities[20U]);
+    EXPECT_EQ(engine->TickFrame(ecsArr), true);
+    EXPECT_FALSE(query.IsValid());
+    EXPECT_FALSE(query.FindResultRow(entities[20U]));
+    EXPECT_TRUE(query.FindResultRow(entities[21U]));
+    EXPECT_TRUE(query.Execute());
+    EXPECT_EQ(query.GetExecuteStatistics().removedRows, 1U);
+    EXPECT_FALSE(query.GetExecuteStatistics().fullRebuild);
+    ASSERT_EQ(query.GetResults().size(), entityCount - 1U);
+    EXPECT_FALSE(query.FindResultRow(entities[20U]));
+    const auto results = query.GetResults();
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i].components[0U], testManager->GetComponentId(results[i].entity));
+        EXPECT_EQ(query.FindResultRow(results[i].entity), &results[i]);
+        if (i > 0U) {
+            EXPECT_LT(results[i - 1U].components[0U], results[i].components[0U]);
+        }
+    }
+
+    GetPluginRegister().UnregisterTypeInfo(testSystemInfo);
+    GetPluginRegister().UnregisterTypeInfo(testComponentInfo);
+    GetPluginRegister().UnregisterTypeInfo(testComponent2Info);
+}
+
 /**
  * @tc.name: entityComparison
  * @tc.desc: Tests for Entity Comparison. [AUTO-GENERATED]
@@ -1568,6 +1756,61 @@ UNIT_TEST(API_EcsTest, entityComparison, testing::ext::TestSize.Level1)
     static_assert(e2 >= e2);
 }
 
+/**
+ * @tc.name: parallelSystemUpdate
+ * @tc.desc: Tests that systems without conflicting component dependencies are updated in parallel.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsTest, parallelSystemUpdate, testing::ext::TestSize.Level1)
+{
+    IEngine::Ptr engine = UTest::CreateEngine();
+    const auto factory = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY);
+    ASSERT_TRUE(factory);
+    auto threadPool = factory->CreateThreadPool(4U);
+    IEcs::Ptr ecs = engine->CreateEcs(*threadPool);
+    ASSERT_TRUE(ecs);
+    EXPECT_EQ(ecs->GetSystemUpdateMode(), IEcs::SystemUpdateMode::SEQUENTIAL);
+
+    GetPluginRegister().RegisterTypeInfo(orderTestSystemAInfo);
+    GetPluginRegister().RegisterTypeInfo(orderTestSystemBInfo);
+    GetPluginRegister().RegisterTypeInfo(orderTestSystemCInfo);
+
+    ecs->CreateComponentManager(testComponentInfo);
+    ecs->CreateComponentManager(testComponent2Info);
+    ecs->CreateSystem(orderTestSystemAInfo);
+    ecs->CreateSystem(orderTestSystemBInfo);
+    ecs->CreateSystem(orderTestSystemCInfo);
+    ecs->Initialize();
+
+    using A = OrderTestSystem<0>;
+    using B = OrderTestSystem<1>;
+    using C = OrderTestSystem<2>;
+
+    IEcs* ecsArr[] = {ecs.get()};
+    // Sequential mode runs the systems one after another in system order.
+    EXPECT_TRUE(engine->TickFrame(ecsArr));
+    EXPECT_LT(A::end_, B::start_);
+    EXPECT_LT(B::end_, C::start_);
+
+    ecs->SetSystemUpdateMode(IEcs::SystemUpdateMode::PARALLEL);
+    EXPECT_EQ(ecs->GetSystemUpdateMode(), IEcs::SystemUpdateMode::PARALLEL);
+    for (int i = 0; i < 3; ++i) {
+        // Only A requests rendering, the result should still be combined from all the systems.
+        EXPECT_TRUE(engine->TickFrame(ecsArr));
+        // A and B don't conflict and can overlap, C must wait for both.
+        EXPECT_LT(A::start_, B::end_);
+        EXPECT_LT(B::start_, A::end_);
+        EXPECT_GT(C::start_, A::end_);
+        EXPECT_GT(C::start_, B::end_);
+    }
+
+    ecs->Uninitialize();
+    ecs.reset();
+    GetPluginRegister().UnregisterTypeInfo(orderTestSystemCInfo);
+    GetPluginRegister().UnregisterTypeInfo(orderTestSystemBInfo);
+    GetPluginRegister().UnregisterTypeInfo(orderTestSystemAInfo);
+}
+
 /**
  * @tc.name: sharedPtr
  * @tc.desc: Tests for Shared Ptr. [AUTO-GENERATED]
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <benchmark/benchmark.h>
+
+#include <base/containers/array_view.h>
+#include <base/containers/vector.h>
+#include <core/implementation_uids.h>
+#include <core/plugin/intf_class_register.h>
+#include <core/threading/intf_thread_pool.h>
+
+#include "threading/task_queue.h"
+
+namespace benchmarks {
+namespace {
+using CORE_NS::FunctionTask;
+using CORE_NS::IThreadPool;
+using CORE_NS::ITaskQueueFactory;
+
+// Amount of busy work per task, small enough that scheduling overhead dominates.
+constexpr uint32_t TASK_WORK = 64U;
+constexpr uint32_t TASK_COUNT = 10000U;
+
+IThreadPool::Ptr CreatePool(const benchmark::State& state)
+{
+    auto factory = CORE_NS::GetInstance<ITaskQueueFactory>(CORE_NS::UID_TASK_QUEUE_FACTORY);
+    return factory->CreateThreadPool(
+        static_cast<uint32_t>(state.range(1)), static_cast<ITaskQueueFactory::ThreadPoolType>(state.range(0)));
+}
+
+void Work(std::atomic<uint32_t>& counter)
+{
+    uint32_t value = 0U;
+    for (uint32_t i = 0U; i < TASK_WORK; ++i) {
+        benchmark::DoNotOptimize(value += i);
+    }
+    counter.fetch_add(1U, std::memory_order_relaxed);
+}
+
+void WaitFor(const std::atomic<uint32_t>& counter, uint32_t count)
+{
+    while (counter.load(std::memory_order_acquire) < count) {
+    }
+}
+
+// Arguments: pool type and thread count.
+void PoolArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (const int64_t type : {static_cast<int64_t>(ITaskQueueFactory::ThreadPoolType::SHARED_QUEUE),
+             static_cast<int64_t>(ITaskQueueFactory::ThreadPoolType::WORK_STEALING)}) {
+        for (const int64_t threads : {2, 4, 8, 16}) {
+            benchmark->Args({type, threads});
+        }
+    }
+    benchmark->ArgNames({"type", "threads"})->UseRealTime();
+}
+}  // namespace
+
+// Many small independent tasks pushed from one external thread.
+void ThreadPoolThroughput(benchmark::State& state)
+{
+    auto pool = CreatePool(state);
+    std::atomic<uint32_t> counter{0U};
+    for (auto _ : state) {
+        counter = 0U;
+        for (uint32_t i = 0U; i < TASK_COUNT; ++i) {
+            pool->PushNoWait(FunctionTask::Create([&counter]() { Work(counter); }));
+        }
+        WaitFor(counter, TASK_COUNT);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * TASK_COUNT);
+}
+
+// One task per thread which each push their share of small tasks, like ECS systems splitting their work.
+void ThreadPoolNestedPush(benchmark::State& state)
+{
+    auto pool = CreatePool(state);
+    const uint32_t threads = pool->GetNumberOfThreads();
+    const uint32_t perThread = TASK_COUNT / threads;
+    std::atomic<uint32_t> counter{0U};
+    for (auto _ : state) {
+        counter = 0U;
+        for (uint32_t t = 0U; t < threads; ++t) {
+            pool->PushNoWait(FunctionTask::Create([&pool, &counter, perThread]() {
+                for (uint32_t i = 0U; i < perThread; ++i) {
+                    pool->PushNoWait(FunctionTask::Create([&counter]() { Work(counter); }));
+                }
+            }));
+        }
+        WaitFor(counter, perThread * threads);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * perThread * threads);
+}
+
+// Fan-out/fan-in graphs where each join depends on a group of tasks. Exercises dependency resolution.
+void ThreadPoolDependencies(benchmark::State& state)
+{
+    constexpr uint32_t groupSize = 16U;
+    constexpr uint32_t groupCount = TASK_COUNT / groupSize;
+    auto pool = CreatePool(state);
+    std::atomic<uint32_t> counter{0U};
+    BASE_NS::vector<const IThreadPool::ITask*> dependencies;
+    BASE_NS::vector<IThreadPool::IResult::Ptr> results;
+    for (auto _ : state) {
+        counter = 0U;
+        results.clear();
+        for (uint32_t group = 0U; group < groupCount; ++group) {
+            dependencies.clear();
+            for (uint32_t i = 0U; i < groupSize; ++i) {
+                auto task = FunctionTask::Create([&counter]() { Work(counter); });
+                dependencies.push_back(task.get());
+                pool->PushNoWait(BASE_NS::move(task));
+            }
+            results.push_back(pool->Push(FunctionTask::Create([&counter]() { Work(counter); }), dependencies));
+        }
+        for (auto& result : results) {
+            result->Wait();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * groupCount * (groupSize + 1U));
+}
+
+// Round trip of a single task from push until the result is signalled.
+void ThreadPoolLatency(benchmark::State& state)
+{
+    auto pool = CreatePool(state);
+    std::atomic<uint32_t> counter{0U};
+    for (auto _ : state) {
+        pool->Push(FunctionTask::Create([&counter]() { Work(counter); }))->Wait();
+    }
+}
+
+BENCHMARK(ThreadPoolThroughput)->Apply(PoolArguments);
+BENCHMARK(ThreadPoolNestedPush)->Apply(PoolArguments);
+BENCHMARK(ThreadPoolDependencies)->Apply(PoolArguments);
+BENCHMARK(ThreadPoolLatency)->Apply(PoolArguments);
+
+}  // namespace benchmarks
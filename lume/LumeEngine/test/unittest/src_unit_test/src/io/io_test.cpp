@@ -33,6 +33,7 @@
 #endif
 #include "io/dev/file_monitor.h"
 #include "io/file_manager.h"
+#include "io/mapped_file.h"
 #include "io/memory_file.h"
 #include "io/path_tools.h"
 #include "io/std_directory.h"
@@ -613,6 +614,72 @@ UNIT_TEST(SRC_IoTest, fileReadAndWrite, testing::ext::TestSize.Level1)
     ASSERT_TRUE(files->DeleteFile(filename));
 }
 
+/**
+ * @tc.name: mappedFileRead
+ * @tc.desc: Tests for reading large read only files through a memory mapping.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_IoTest, mappedFileRead, testing::ext::TestSize.Level1)
+{
+    auto& files = CORE_NS::UTest::GetTestEnv()->fileManager;
+    ASSERT_TRUE(files != nullptr);
+    auto filename = "cache://test_file_mapped.dat";
+    auto smallFilename = "cache://test_file_mapped_small.dat";
+
+    std::vector<uint8_t> data(MappedFile::MIN_MAPPED_FILE_SIZE * 2U + 3U);
+    for (size_t i = 0U; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 7U);
+    }
+    {
+        auto file = files->CreateFile(filename);
+        ASSERT_TRUE(file != nullptr);
+        ASSERT_EQ(file->Write(data.data(), data.size()), data.size());
+        auto smallFile = files->CreateFile(smallFilename);
+        ASSERT_TRUE(smallFile != nullptr);
+        ASSERT_EQ(smallFile->Write(data.data(), 16U), 16U);
+    }
+
+    {
+        auto file = files->OpenFile(filename);
+        ASSERT_TRUE(file != nullptr);
+        ASSERT_EQ(file->GetLength(), data.size());
+#if !defined(_WIN32)
+        // Contents can be accessed directly.
+        const auto mapped = file->GetMappedData();
+        ASSERT_EQ(mapped.size(), data.size());
+        EXPECT_EQ(memcmp(mapped.data(), data.data(), data.size()), 0);
+#endif
+        // Reading and seeking work the same way as with other files.
+        std::vector<uint8_t> buffer(data.size());
+        ASSERT_TRUE(file->Seek(data.size() - 10U));
+        EXPECT_EQ(file->Read(buffer.data(), buffer.size()), 10U);
+        EXPECT_EQ(file->GetPosition(), data.size());
+        EXPECT_EQ(file->Read(buffer.data(), buffer.size()), 0U);
+        ASSERT_TRUE(file->Seek(0U));
+        EXPECT_EQ(file->Read(buffer.data(), buffer.size()), data.size());
+        EXPECT_EQ(buffer, data);
+        EXPECT_FALSE(file->Seek(data.size() + 1U));
+        // Read only files can't be written.
+        EXPECT_EQ(file->Write(data.data(), 1U), 0U);
+        file->Close();
+        EXPECT_TRUE(file->GetMappedData().empty());
+    }
+
+    {
+        // Small files are read without mapping.
+        auto file = files->OpenFile(smallFilename);
+        ASSERT_TRUE(file != nullptr);
+        EXPECT_TRUE(file->GetMappedData().empty());
+        // Files opened for writing are not mapped either.
+        auto writable = files->OpenFile(filename, IFile::Mode::READ_WRITE);
+        ASSERT_TRUE(writable != nullptr);
+        EXPECT_TRUE(writable->GetMappedData().empty());
+    }
+
+    ASSERT_TRUE(files->DeleteFile(filename));
+    ASSERT_TRUE(files->DeleteFile(smallFilename));
+}
+
 /**
  * @tc.name: directoryCreationAndDeletion
  * @tc.desc: Tests for Directory Creation And Deletion. [AUTO-GENERATED]
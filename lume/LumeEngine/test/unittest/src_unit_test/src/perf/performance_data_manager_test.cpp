@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <base/containers/shared_ptr.h>
+#include <base/containers/string.h>
+#include <core/json/json.h>
+#include <core/perf/intf_performance_capture.h>
+
+#include "test_framework.h"
+
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+#include "io/memory_file.h"
+#include "perf/chrome_trace_writer.h"
+#include "perf/performance_data_manager.h"
+
+using namespace CORE_NS;
+using namespace BASE_NS;
+
+namespace {
+using DataType = IPerformanceDataManager::PerformanceTimingData::DataType;
+
+string WriteToString(array_view<const PerformanceTraceEvent> events)
+{
+    MemoryFile file(make_shared<MemoryFileStorage>(), IFile::Mode::READ_WRITE);
+    EXPECT_TRUE(WriteChromeTrace(file, events));
+    const auto data = file.GetMappedData();
+    return string(string_view(reinterpret_cast<const char*>(data.data()), data.size()));
+}
+}  // namespace
+
+/**
+ * @tc.name: chromeTraceWriter
+ * @tc.desc: Tests for writing performance events as Chrome trace event JSON.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_PerformanceDataManagerTest, chromeTraceWriter, testing::ext::TestSize.Level1)
+{
+    const PerformanceTraceEvent events[] = {
+        {"CORE", "SystemUpdate", "RenderSystem", 1U, 1500, 500, DataType::MICROSECONDS},
+        {"RENDER", "Quoted \"name\"", "", 2U, 1700, 42, DataType::COUNT},
+    };
+    const auto text = WriteToString(events);
+    auto root = json::parse<json::standalone_value>(text.c_str());
+    ASSERT_TRUE(root.is_object());
+    const auto* traceEvents = root.find("traceEvents");
+    ASSERT_TRUE(traceEvents && traceEvents->is_array());
+    ASSERT_EQ(traceEvents->array_.size(), 2U);
+
+    const auto& timing = traceEvents->array_[0];
+    EXPECT_EQ(timing.find("name")->string_, "SystemUpdate::RenderSystem");
+    EXPECT_EQ(timing.find("cat")->string_, "CORE");
+    EXPECT_EQ(timing.find("ph")->string_, "X");
+    EXPECT_EQ(timing.find("ts")->as_number<int64_t>(), 1000);
+    EXPECT_EQ(timing.find("dur")->as_number<int64_t>(), 500);
+    EXPECT_EQ(timing.find("tid")->as_number<int64_t>(), 1);
+
+    const auto& counter = traceEvents->array_[1];
+    EXPECT_EQ(counter.find("name")->string_, "Quoted \"name\"");
+    EXPECT_EQ(counter.find("ph")->string_, "C");
+    EXPECT_EQ(counter.find("ts")->as_number<int64_t>(), 1700);
+    EXPECT_EQ(counter.find("args")->find("count")->as_number<int64_t>(), 42);
+
+    // No events still gives a valid trace.
+    root = json::parse<json::standalone_value>(WriteToString({}).c_str());
+    ASSERT_TRUE(root.find("traceEvents") && root.find("traceEvents")->array_.empty());
+}
+
+#if (CORE_PERF_ENABLED == 1)
+/**
+ * @tc.name: threadedUpdates
+ * @tc.desc: Tests for aggregating updates queued from several threads and capturing them.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_PerformanceDataManagerTest, threadedUpdates, testing::ext::TestSize.Level1)
+{
+    PerformanceDataManagerFactory factory(GetPluginRegister());
+    auto* manager = factory.Get("TEST");
+    ASSERT_TRUE(manager);
+    ASSERT_EQ(factory.Get("TEST"), manager);
+    auto* capture = interface_cast<IPerformanceCapture>(static_cast<IPerformanceDataManagerFactory*>(&factory));
+    ASSERT_TRUE(capture);
+    capture->StartCapture();
+    EXPECT_TRUE(capture->IsCapturing());
+
+    // More updates than fit in a thread buffer so that the buffers are also flushed while updating.
+    constexpr int threadCount = 4;
+    constexpr int updateCount = 5000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back([manager]() {
+            for (int j = 0; j < updateCount; ++j) {
+                manager->UpdateData("Sub", "Timing", 2);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    manager->UpdateData("Sub", "Count", 7, DataType::COUNT);
+    capture->StopCapture();
+    EXPECT_FALSE(capture->IsCapturing());
+    manager->UpdateData("Sub", "Timing", 2);
+
+    const auto data = manager->GetData();
+    ASSERT_EQ(data.size(), 1U);
+    const auto& timing = data[0].timings.find("Timing")->second;
+    EXPECT_EQ(timing.totalTime, (threadCount * updateCount + 1) * 2);
+    EXPECT_EQ(data[0].timings.find("Count")->second.currentTime, 7);
+
+    manager->ResetData();
+    EXPECT_TRUE(manager->GetData().empty());
+
+    auto& fileManager = CORE_NS::UTest::GetTestEnv()->fileManager;
+    ASSERT_TRUE(capture->ExportChromeTrace(*fileManager, "cache://test_trace.json"));
+    auto file = fileManager->OpenFile("cache://test_trace.json");
+    ASSERT_TRUE(file);
+    string text(static_cast<size_t>(file->GetLength()), '\0');
+    file->Read(text.data(), text.size());
+    const auto root = json::parse<json::standalone_value>(text.c_str());
+    ASSERT_TRUE(root.find("traceEvents"));
+    // Only the updates made while capturing.
+    EXPECT_EQ(root.find("traceEvents")->array_.size(), static_cast<size_t>(threadCount * updateCount + 1));
+    fileManager->DeleteFile("cache://test_trace.json");
+}
+#endif
@@ -13,8 +13,11 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <chrono>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <base/containers/unique_ptr.h>
 #include <core/implementation_uids.h>
@@ -610,3 +613,84 @@ UNIT_TEST(SRC_TaskQueueTest, testThreadPool, testing::ext::TestSize.Level1)
         EXPECT_EQ(gStorage.data[2], 3);
     }
 }
+
+/**
+ * @tc.name: testWorkStealingThreadPool
+ * @tc.desc: Tests for Test Work Stealing Thread Pool.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_TaskQueueTest, testWorkStealingThreadPool, testing::ext::TestSize.Level1)
+{
+    const auto factory = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY);
+    auto threadPool = factory->CreateThreadPool(4U, ITaskQueueFactory::ThreadPoolType::WORK_STEALING);
+    ASSERT_TRUE(threadPool);
+    EXPECT_EQ(threadPool->GetNumberOfThreads(), 4U);
+    {
+        // task which resets the storage after a delay. the delay tries to give time to add more tasks.
+        auto resetTask = FunctionTask::Create([]() {
+            wait(100);
+            gStorage.reset();
+        });
+        const auto* resetTaskPtr = resetTask.get();
+        threadPool->PushNoWait(BASE_NS::move(resetTask));
+
+        // two tasks which should wait for the reset task.
+        auto task1 = FunctionTask::Create([]() {
+            gStorage.store(1);
+            wait(50);
+        });
+        auto task1Ptr = task1.get();
+        const CORE_NS::IThreadPool::ITask* deps0[] = {resetTaskPtr};
+        threadPool->PushNoWait(BASE_NS::move(task1), deps0);
+
+        auto task2 = FunctionTask::Create([]() {
+            wait(50);
+            gStorage.store(2);
+        });
+        auto task2Ptr = task2.get();
+        threadPool->PushNoWait(BASE_NS::move(task2), deps0);
+
+        // one more task which should start after the above tasks.
+        auto task3 = FunctionTask::Create([]() { gStorage.store(3); });
+        const CORE_NS::IThreadPool::ITask* deps12[] = {task1Ptr, task2Ptr};
+        auto result = threadPool->Push(BASE_NS::move(task3), deps12);
+
+        EXPECT_FALSE(result->IsDone());
+        result->Wait();
+        EXPECT_TRUE(result->IsDone());
+
+        ASSERT_EQ(gStorage.data.size(), 3);
+        EXPECT_EQ(gStorage.data[2], 3);
+    }
+    // tasks pushed from worker threads go to the worker's own deque and can be stolen by the others.
+    {
+        std::atomic<uint32_t> counter{0U};
+        constexpr uint32_t spawnerCount = 8U;
+        constexpr uint32_t childCount = 100U;
+        std::mutex resultMutex;
+        std::vector<IThreadPool::IResult::Ptr> results;
+        std::vector<IThreadPool::IResult::Ptr> spawners;
+        for (uint32_t i = 0U; i < spawnerCount; ++i) {
+            spawners.push_back(threadPool->Push(FunctionTask::Create([&]() {
+                for (uint32_t j = 0U; j < childCount; ++j) {
+                    auto result = threadPool->Push(FunctionTask::Create([&counter]() { ++counter; }));
+                    std::lock_guard lock(resultMutex);
+                    results.push_back(BASE_NS::move(result));
+                }
+            })));
+        }
+        for (auto& result : spawners) {
+            result->Wait();
+        }
+        for (auto& result : results) {
+            result->Wait();
+        }
+        EXPECT_EQ(counter.load(), spawnerCount * childCount);
+    }
+    // a null task is reported as done immediately.
+    {
+        auto result = threadPool->Push(nullptr);
+        ASSERT_TRUE(result);
+        EXPECT_TRUE(result->IsDone());
+    }
+}
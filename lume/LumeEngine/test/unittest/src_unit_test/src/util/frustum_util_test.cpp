@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <base/containers/vector.h>
 #include <base/math/matrix.h>
 #include <base/math/matrix_util.h>
 #include <base/math/vector.h>
@@ -547,3 +548,54 @@ UNIT_TEST(SRC_FrustumUtilTest, FrustumUtil_SphereFrustumAllPlaneTests, testing::
         EXPECT_TRUE(result) << "Sphere should be inside " << test.planeName << " plane";
     }
 }
+
+/**
+ * @tc.name: FrustumUtil_SpheresFrustumCollision_MatchesSingleTest
+ * @tc.desc: Tests batch culling against several frustums gives the same result as testing each sphere separately
+ * @tc.type: FUNC
+ */
+UNIT_TEST(
+    SRC_FrustumUtilTest, FrustumUtil_SpheresFrustumCollision_MatchesSingleTest, testing::ext::TestSize.Level1)
+{
+    FrustumUtil frustumUtil;
+
+    const Frustum frustums[] = {
+        frustumUtil.CreateFrustum(Math::PerspectiveRhNo(1.57f, 16.0f / 9.0f, 0.1f, 100.0f)),
+        frustumUtil.CreateFrustum(Math::OrthoRhNo(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f) *
+                                  Math::LookAtRh(Vec3(50.0f, 0.0f, -50.0f), Vec3(0.0f, 0.0f, -50.0f),
+                                      Vec3(0.0f, 1.0f, 0.0f))),
+    };
+
+    // not a multiple of any SIMD width or of the mask word size
+    constexpr size_t count = 1003U;
+    BASE_NS::vector<float> x(count);
+    BASE_NS::vector<float> y(count);
+    BASE_NS::vector<float> z(count);
+    BASE_NS::vector<float> radius(count);
+    uint32_t seed = 1U;
+    auto random = [&seed](float min, float max) {
+        seed = (seed * 1664525U) + 1013904223U;
+        return min + ((max - min) * (static_cast<float>(seed >> 8U) / static_cast<float>(1U << 24U)));
+    };
+    for (size_t i = 0; i < count; ++i) {
+        x[i] = random(-120.0f, 120.0f);
+        y[i] = random(-120.0f, 120.0f);
+        z[i] = random(-120.0f, 20.0f);
+        radius[i] = random(0.0f, 5.0f);
+    }
+    const FrustumSpheres spheres{x, y, z, radius};
+
+    for (size_t frustumCount = 0U; frustumCount <= countof(frustums); ++frustumCount) {
+        BASE_NS::vector<uint64_t> visibility((count + 63U) / 64U, ~0ULL);
+        frustumUtil.SpheresFrustumCollision({frustums, frustumCount}, spheres, visibility);
+        for (size_t i = 0; i < count; ++i) {
+            bool expected = false;
+            for (size_t f = 0U; (f < frustumCount) && !expected; ++f) {
+                expected = frustumUtil.SphereFrustumCollision(frustums[f], Vec3(x[i], y[i], z[i]), radius[i]);
+            }
+            EXPECT_EQ(expected, ((visibility[i / 64U] >> (i % 64U)) & 1U) != 0U) << "sphere " << i;
+        }
+        // bits after the last sphere are cleared
+        EXPECT_EQ(0U, visibility.back() >> (count % 64U));
+    }
+}
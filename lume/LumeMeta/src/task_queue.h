@@ -16,8 +16,8 @@
 #ifndef META_SRC_TASK_QUEUE_H
 #define META_SRC_TASK_QUEUE_H
 
+#include <algorithm>
 #include <chrono>
-#include <deque>
 #include <mutex>
 #include <thread>
 
@@ -69,13 +69,12 @@ public:
             // (i.e. you "can" schedule the same task with different "delays")
             // So we remove all scheduled tasks with same token.
             // Also redo/rearm might have add the task back while we were waiting/yielding.
-            for (auto it = tasks_.begin(); it != tasks_.end();) {
-                if (it->operation.get() == token) {
-                    removed = BASE_NS::move(it->operation);
-                    it = tasks_.erase(it);
-                } else {
-                    ++it;
-                }
+            auto first = std::partition(
+                tasks_.begin(), tasks_.end(), [token](const Task& task) { return task.operation.get() != token; });
+            if (first != tasks_.end()) {
+                removed = BASE_NS::move(first->operation);
+                tasks_.erase(first, tasks_.end());
+                std::make_heap(tasks_.begin(), tasks_.end(), ExecutesLater);
             }
             // see if it's in the rearm_ queue
             for (auto it = rearm_.begin(); it != rearm_.end();) {
@@ -97,30 +96,9 @@ public:
             i->SetQueueAndToken(self_.lock(), ret);
         }
 
-        // insertion sort the tasks
-        if (tasks_.empty()) {
-            tasks_.emplace_back(delay, excTime, BASE_NS::move(p));
-        } else if (tasks_.size() == 1) {
-            if (tasks_.front().executeTime >= excTime) {
-                tasks_.emplace_back(delay, excTime, BASE_NS::move(p));
-            } else {
-                tasks_.insert(tasks_.begin(), {delay, excTime, BASE_NS::move(p)});
-            }
-        } else {
-            bool found = false;
-            for (auto it = tasks_.begin(); it != tasks_.end(); ++it) {
-                if (it->executeTime <= excTime) {
-                    // task in list should execute after us, so insert there.
-                    tasks_.insert(it, {delay, excTime, BASE_NS::move(p)});
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                // add last then ..
-                tasks_.emplace_back(delay, excTime, BASE_NS::move(p));
-            }
-        }
+        // tasks_ is a heap with the next task to execute at the front
+        tasks_.emplace_back(delay, excTime, sequence_++, BASE_NS::move(p));
+        std::push_heap(tasks_.begin(), tasks_.end(), ExecutesLater);
         return ret;
     }
 
@@ -143,7 +121,8 @@ public:
     void ProcessTasks(std::unique_lock<std::mutex>& lock, TimeSpan curTime)
     {
         // Must only be called while having the lock
-        while (!terminate_ && !tasks_.empty() && curTime >= tasks_.back().executeTime) {
+        while (!terminate_ && !tasks_.empty() && curTime >= tasks_.front().executeTime) {
+            std::pop_heap(tasks_.begin(), tasks_.end(), ExecutesLater);
             auto task = BASE_NS::move(tasks_.back());
             tasks_.pop_back();
             execToken_ = task.operation.get();
@@ -175,8 +154,14 @@ public:
 
     void Rearm(TimeSpan curTime)
     {
-        for (auto it = rearm_.rbegin(); it != rearm_.rend(); ++it) {
-            auto& task = *it;
+        if (rearm_.empty()) {
+            return;
+        }
+        // Re-heapify once when most of the queue is rearmed, otherwise push the tasks one by one.
+        const bool rebuild = rearm_.size() > tasks_.size();
+        const auto self = self_.lock();
+        // Tasks are rearmed in execution order so that tasks due at the same time keep their order.
+        for (auto& task : rearm_) {
             if (task.delay > TimeSpan()) {
                 // calculate the next executeTime in phase.. (ie. how many events missed)
                 uint64_t dt = static_cast<uint64_t>(task.delay.ToMicroseconds());
@@ -195,7 +180,17 @@ public:
             } else {
                 task.executeTime = curTime;
             }
-            AddTaskImpl(task.operation, task.delay, task.executeTime);
+            if (auto i = interface_cast<ITaskScheduleInfo>(task.operation)) {
+                i->SetQueueAndToken(self, task.operation.get());
+            }
+            task.sequence = sequence_++;
+            tasks_.push_back(BASE_NS::move(task));
+            if (!rebuild) {
+                std::push_heap(tasks_.begin(), tasks_.end(), ExecutesLater);
+            }
+        }
+        if (rebuild) {
+            std::make_heap(tasks_.begin(), tasks_.end(), ExecutesLater);
         }
         rearm_.clear();
     }
@@ -209,14 +204,26 @@ public:
 
     struct Task {
         Task() = default;
-        Task(TimeSpan d, TimeSpan e, const ITaskQueueTask::Ptr& p) : delay(d), executeTime(e), operation(p)
+        Task(TimeSpan d, TimeSpan e, uint64_t s, const ITaskQueueTask::Ptr& p)
+            : delay(d), executeTime(e), sequence(s), operation(p)
         {}
 
         TimeSpan delay;
         TimeSpan executeTime;
+        // Tasks due at the same time are executed in the order they were added.
+        uint64_t sequence{};
         ITaskQueueTask::Ptr operation{nullptr};
     };
 
+    // Heap ordering of tasks_, the task executing first is at the front.
+    static bool ExecutesLater(const Task& lhs, const Task& rhs)
+    {
+        if (lhs.executeTime != rhs.executeTime) {
+            return lhs.executeTime > rhs.executeTime;
+        }
+        return lhs.sequence > rhs.sequence;
+    }
+
 protected:
     std::mutex mutex_;
 
@@ -225,8 +232,9 @@ protected:
     std::thread::id execThread_;
     // currently running task..
     Token execToken_{nullptr};
-    std::deque<Task> tasks_;
+    BASE_NS::vector<Task> tasks_;
     BASE_NS::vector<Task> rearm_;
+    uint64_t sequence_{};
     ITaskQueue::WeakPtr self_;
     bool currentlyExecutingRemoved{};
 };
@@ -154,7 +154,7 @@ public:
 
         while (!terminate_) {
             if (!tasks_.empty()) {
-                TimeSpan delta = tasks_.back().executeTime - Time();
+                TimeSpan delta = tasks_.front().executeTime - Time();
                 // wait for next execute time (or trigger which ever is first). and see if we can now process things..
                 // technically we will always be a bit late here. "it's a best effort"
                 if (delta > TimeSpan::Microseconds(0)) {
@@ -17,6 +17,7 @@
 #include <chrono>
 #include <test_framework.h>
 #include <thread>
+#include <vector>
 
 #include <meta/api/future.h>
 #include <meta/api/make_callback.h>
@@ -590,6 +591,33 @@ UNIT_TEST(API_TaskQueueTest, RecurringMultipleOrder, testing::ext::TestSize.Leve
     EXPECT_EQ(task2, 6);
 }
 
+/**
+ * @tc.name: RecurringManyOrder
+ * @tc.desc: Tests that recurring tasks due at the same time keep the order they were added in.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_TaskQueueTest, RecurringManyOrder, testing::ext::TestSize.Level1)
+{
+    auto queue = GetObjectRegistry().Create<IPollingTaskQueue>(ClassId::PollingTaskQueue);
+    constexpr int taskCount = 5;
+    std::vector<int> order;
+    for (int i = 0; i != taskCount; ++i) {
+        queue->AddTask(META_NS::MakeCallback<ITaskQueueTask>([&order, i] {
+            order.push_back(i);
+            return true;
+        }));
+    }
+    for (int round = 0; round != 3; ++round) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        queue->ProcessTasks();
+        ASSERT_EQ(order.size(), static_cast<size_t>(taskCount));
+        for (int i = 0; i != taskCount; ++i) {
+            EXPECT_EQ(order[i], i);
+        }
+        order.clear();
+    }
+}
+
 /**
  * @tc.name: ApiFuture
  * @tc.desc: Tests for Api Future. [AUTO-GENERATED]
@@ -51,6 +51,60 @@ void PushToTaskQueueWithLongLastingTasks(benchmark::State& state)
     }
 }
 
+constexpr int RECURRING_TASK_COUNT = 10000;
+
+void PushToTaskQueueWithRecurringTasks(benchmark::State& state)
+{
+    auto q = GetObjectRegistry().Create<IPollingTaskQueue>(ClassId::PollingTaskQueue);
+    auto recurring = MakeCallback<ITaskQueueTask>([] { return true; });
+    for (int i = 0; i != RECURRING_TASK_COUNT; ++i) {
+        q->AddTask(recurring, TimeSpan::Seconds(10));
+    }
+    auto task = MakeCallback<ITaskQueueTask>([] { return false; });
+    for (auto _ : state) {
+        for (int i = 0; i != 200; ++i) {
+            q->AddTask(task);
+        }
+        q->ProcessTasks();
+    }
+}
+
+void ProcessRecurringTasks(benchmark::State& state)
+{
+    auto q = GetObjectRegistry().Create<IPollingTaskQueue>(ClassId::PollingTaskQueue);
+    int64_t value{};
+    auto task = MakeCallback<ITaskQueueTask>([&] {
+        ++value;
+        return true;
+    });
+    // every task is due on each round and rearmed in one batch
+    for (int i = 0; i != RECURRING_TASK_COUNT; ++i) {
+        q->AddTask(task);
+    }
+    for (auto _ : state) {
+        q->ProcessTasks();
+    }
+    state.SetItemsProcessed(value);
+}
+
+void ProcessRecurringTasksWithIntervals(benchmark::State& state)
+{
+    auto q = GetObjectRegistry().Create<IPollingTaskQueue>(ClassId::PollingTaskQueue);
+    int64_t value{};
+    auto task = MakeCallback<ITaskQueueTask>([&] {
+        ++value;
+        return true;
+    });
+    // a part of the tasks is due on each round and rearmed among the rest
+    for (int i = 0; i != RECURRING_TASK_COUNT; ++i) {
+        q->AddTask(task, TimeSpan::Milliseconds(1 + i % 16));
+    }
+    for (auto _ : state) {
+        q->ProcessTasks();
+    }
+    state.SetItemsProcessed(value);
+}
+
 void PushToThreadedTaskQueue(benchmark::State& state)
 {
     auto q = GetObjectRegistry().Create<ITaskQueue>(ClassId::ThreadedTaskQueue);
@@ -97,6 +151,9 @@ void PushToThreadedTaskQueueLongLastingTasks(benchmark::State& state)
 
 BENCHMARK(PushToTaskQueue);
 BENCHMARK(PushToTaskQueueWithLongLastingTasks);
+BENCHMARK(PushToTaskQueueWithRecurringTasks);
+BENCHMARK(ProcessRecurringTasks);
+BENCHMARK(ProcessRecurringTasksWithIntervals);
 BENCHMARK(PushToThreadedTaskQueue);
 BENCHMARK(PushToThreadedTaskQueueLongLastingTasks);
 
@@ -108,7 +108,9 @@ enum class DeviceBackendType {
     /** OpenGL backend */
     OPENGL,
     /** Maleoon backend */
-    MALEOON
+    MALEOON,
+    /** Headless backend without a GPU. Rendering is recorded on the CPU but not executed, e.g. for profiling */
+    HEADLESS
 };
 
 /** @ingroup group_idevice */
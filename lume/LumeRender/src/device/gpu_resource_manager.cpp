@@ -389,6 +389,12 @@ void LogGpuResource(const RenderHandle& gpuHandle, const EngineResourceHandle en
         RenderHandleUtil::GetGenerationIndexPart(engineHandle));
 }
 #endif
+
+// Mapping outside the renderer needs an active context on the gl backends. Headless buffers are plain host memory.
+inline bool RequiresActivation(const DeviceBackendType backendType)
+{
+    return (backendType != DeviceBackendType::VULKAN) && (backendType != DeviceBackendType::HEADLESS);
+}
 }  // namespace
 
 GpuResourceManager::GpuResourceManager(Device& device, const CreateInfo& createInfo)
@@ -2366,7 +2372,7 @@ void* GpuResourceManager::MapBufferMemory(const RenderHandle& handle) const
 #endif
         const uint32_t arrayIndex = RenderHandleUtil::GetIndexPart(handle);
         // with gl MapMemory may require context to be active. Activate grabs a mutex which must be before clientMutex.
-        const bool isOpenGl = (device_.GetBackendType() != DeviceBackendType::VULKAN);
+        const bool isOpenGl = RequiresActivation(device_.GetBackendType());
         if (isOpenGl) {
             device_.Activate();
         }
@@ -2402,7 +2408,7 @@ void GpuResourceManager::UnmapBuffer(const RenderHandle& handle) const
         const bool isCreatedImmediate = RenderHandleUtil::IsImmediatelyCreated(handle);
         const uint32_t arrayIndex = RenderHandleUtil::GetIndexPart(handle);
         // with gl Unmap may require context to be active. Activate grabs a mutex which must be before clientMutex.
-        const bool isOpenGl = (device_.GetBackendType() != DeviceBackendType::VULKAN);
+        const bool isOpenGl = RequiresActivation(device_.GetBackendType());
         if (isOpenGl) {
             device_.Activate();
         }
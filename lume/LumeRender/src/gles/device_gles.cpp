@@ -52,7 +52,6 @@ namespace {
 // 32)
 constexpr const uint32_t TEMP_BIND_UNIT = 15;
 constexpr const string_view EXT_BUFFER_STORAGE = "GL_EXT_buffer_storage";
-constexpr const uint32_t CACHE_VERSION = 1U;
 #if RENDER_GL_DEBUG
 #define DUMP(a)                       \
     {                                 \
@@ -1545,6 +1544,15 @@ void FillExtensions(BASE_NS::vector<BASE_NS::string_view>& extensions)
     }
 #endif  // !NDEBUG
 }
+
+uint64_t GetProgramCacheRevision()
+{
+    const char* vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
+    const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    return ProgramBinaryCacheGLES::HashRevision(
+        string_view(vendor ? vendor : ""), string_view(renderer ? renderer : ""), string_view(version ? version : ""));
+}
 }  // namespace
 
 // Some OpenGL/ES features are supported and using them will lead to an assertion unless
@@ -2038,130 +2046,28 @@ uint32_t DeviceGLES::GetGpuQueueCount() const
     return 1;
 }
 
-struct CacheHeader {
-    uint32_t version;
-    uint32_t programs;
-    uint64_t revisionHash;
-    struct Program {
-        uint64_t vertHash;
-        uint64_t fragHash;
-        uint64_t compHash;
-        GLuint offset;
-        GLenum binaryFormat;
-    };
-};
 void DeviceGLES::InitializePipelineCache(array_view<const uint8_t> initialData)
 {
-    if (initialData.size_bytes() < sizeof(CacheHeader)) {
+    if (!supportsBinaryPrograms_ || initialData.empty()) {
         return;
     }
-    auto* header = reinterpret_cast<const CacheHeader*>(initialData.data());
-    const char* vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
-    const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
-    const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
-    if (!vendor || !renderer || !version) {
-        return;
-    }
-    if ((header->version != CACHE_VERSION) ||
-        (header->revisionHash != Hash(string_view(vendor), string_view(renderer), string_view(version)))) {
-        return;
-    }
-    // Use 64-bit arithmetic to prevent overflow when programs count is large.
-    if ((static_cast<uint64_t>(sizeof(CacheHeader)) +
-            static_cast<uint64_t>(header->programs) * sizeof(CacheHeader::Program)) > initialData.size()) {
-        return;
-    }
-    auto programs = array_view(
-        reinterpret_cast<const CacheHeader::Program*>(initialData.data() + sizeof(CacheHeader)), header->programs);
-    auto binaryData = array_view(initialData.data() + (sizeof(CacheHeader) + programs.size_bytes()),
-        initialData.size() - (sizeof(CacheHeader) + programs.size_bytes()));
-    // Validate that offsets are monotonically increasing before processing.
-    bool offsetsValid = programs.empty() || (programs[0].offset < binaryData.size());
-    for (size_t i = 1; i < programs.size(); ++i) {
-        if ((programs[i].offset < programs[i - 1].offset) || (programs[i].offset >= binaryData.size())) {
-            offsetsValid = false;
-            break;
-        }
-    }
-    if (!offsetsValid) {
-        return;
-    }
-    for (auto i = 0U; i < programs.size(); ++i) {
-        auto& program = programs[i];
-        GLsizei length;
-        if ((i + 1) < programs.size()) {
-            length = static_cast<GLsizei>(programs[i + 1].offset - program.offset);
-        } else {
-            length = static_cast<GLsizei>(binaryData.size() - program.offset);
-        }
-        if ((length < 0) || (program.offset + length) > binaryData.size()) {
-            continue;
-        }
-
-        const GLuint programObj = glCreateProgram();
-        glProgramBinary(programObj, program.binaryFormat, binaryData.data() + program.offset, length);
-        GLint result = GL_FALSE;
-        glGetProgramiv(programObj, GL_LINK_STATUS, &result);
-        if (result != GL_FALSE) {
-            auto& entry = programs_.emplace_back();
-            entry.program = programObj;
-            entry.hashVert = program.vertHash;
-            entry.hashFrag = program.fragHash;
-            entry.hashComp = program.compHash;
-        } else {
-#if (RENDER_VALIDATION_ENABLED == 1)
-            GLint logLength = 0;
-            glGetProgramiv(programObj, GL_INFO_LOG_LENGTH, &logLength);
-            string messages;
-            messages.resize(static_cast<size_t>(logLength));
-            glGetProgramInfoLog(programObj, logLength, 0, messages.data());
-            PLUGIN_LOG_ONCE_E("gl_shader_linking_error_" + to_string(programObj),
-                "RENDER_VALIDATION: Shader linking error: %s",
-                messages.c_str());
-#endif
-            glDeleteProgram(programObj);
-        }
+    // Only parse the cache here, programs are created from the binaries when first requested in CacheProgram.
+    if (!programBinaries_.Deserialize(initialData, GetProgramCacheRevision())) {
+        PLUGIN_LOG_D("GLES program cache discarded");
     }
 }
 
 vector<uint8_t> DeviceGLES::GetPipelineCache() const
 {
-    vector<uint8_t> cacheData;
     if (!supportsBinaryPrograms_) {
-        return cacheData;
+        return {};
     }
-
-    CacheHeader header;
-    header.version = CACHE_VERSION;
-    {
-        const char* v = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
-        const char* r = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
-        const char* ver = reinterpret_cast<const char*>(glGetString(GL_VERSION));
-        header.revisionHash = Hash(string_view(v ? v : ""), string_view(r ? r : ""), string_view(ver ? ver : ""));
-    }
-
-    vector<CacheHeader::Program> programs;
+    // Binaries which weren't used this session are kept as is, live programs are (re)read from the driver.
+    ProgramBinaryCacheGLES cache = programBinaries_;
     for (const auto& info : programs_) {
-        GLint programLength = 0;
-        glGetProgramiv(info.program, GL_PROGRAM_BINARY_LENGTH, &programLength);
-        if (!programLength) {
-            continue;
-        }
-        const auto offset = cacheData.size();
-        cacheData.resize(offset + programLength);
-        GLsizei length;
-        GLenum binaryFormat;
-        glGetProgramBinary(info.program, programLength, &length, &binaryFormat, cacheData.data() + offset);
-        programs.push_back({info.hashVert, info.hashFrag, info.hashComp, static_cast<GLuint>(offset), binaryFormat});
-    }
-    header.programs = static_cast<uint32_t>(programs.size());
-    cacheData.insert(cacheData.cbegin(), sizeof(CacheHeader) + programs.size_in_bytes(), uint8_t(0U));
-    CloneData(cacheData.data(), cacheData.size(), &header, sizeof(CacheHeader));
-    CloneData(cacheData.data() + sizeof(CacheHeader),
-        cacheData.size() - sizeof(CacheHeader),
-        programs.data(),
-        programs.size_in_bytes());
-    return cacheData;
+        StoreProgramBinary(cache, info.program, {info.hashVert, info.hashFrag, info.hashComp});
+    }
+    return cache.Serialize(GetProgramCacheRevision());
 }
 
 void DeviceGLES::WaitForIdle()
@@ -2244,6 +2150,10 @@ void DeviceGLES::ReleaseProgram(uint32_t program)
         }
         t.refCount--;
         if (t.refCount == 0) {
+            // Keep the binary so that the program can be recreated and persisted without compiling.
+            if (supportsBinaryPrograms_) {
+                StoreProgramBinary(programBinaries_, t.program, {t.hashVert, t.hashFrag, t.hashComp});
+            }
             if (t.fragShader) {
                 ReleaseShader(GL_FRAGMENT_SHADER, t.fragShader);
             }
@@ -2308,9 +2218,9 @@ uint32_t DeviceGLES::CacheProgram(
     const string_view vertSource, const string_view fragSource, const string_view compSource)
 {
     PLUGIN_ASSERT_MSG(isActive_, "Device not active when building shaders");
-    const uint64_t vertHash = vertSource.empty() ? 0U : FNV1aHash(vertSource.data(), vertSource.size());
-    const uint64_t fragHash = fragSource.empty() ? 0U : FNV1aHash(fragSource.data(), fragSource.size());
-    const uint64_t compHash = compSource.empty() ? 0U : FNV1aHash(compSource.data(), compSource.size());
+    const uint64_t vertHash = ProgramBinaryCacheGLES::HashSource(vertSource);
+    const uint64_t fragHash = ProgramBinaryCacheGLES::HashSource(fragSource);
+    const uint64_t compHash = ProgramBinaryCacheGLES::HashSource(compSource);
     // Then check if we have the program already cached (ie. matching shaders linked)
     for (ProgramCache& t : programs_) {
         if ((t.hashVert != vertHash) || (t.hashFrag != fragHash) || (t.hashComp != compHash)) {
@@ -2320,6 +2230,12 @@ uint32_t DeviceGLES::CacheProgram(
         t.refCount++;
         return t.program;
     }
+    // Then check if there's a binary from the pipeline cache or from an earlier instance of the program.
+    if (const uint32_t program = LoadProgramBinary({vertHash, fragHash, compHash}); program) {
+        pBinaryHit_++;
+        programs_.push_back({program, 0U, 0U, 0U, vertHash, fragHash, compHash, 1U});
+        return program;
+    }
 
     // Hash and cache shader sources.
     const auto& vEntry = CacheShader(DeviceGLES::VERTEX_CACHE, vertSource);
@@ -2386,6 +2302,48 @@ uint32_t DeviceGLES::CacheProgram(
     return program;
 }
 
+uint32_t DeviceGLES::LoadProgramBinary(const ProgramBinaryCacheGLES::Key& key)
+{
+    if (!supportsBinaryPrograms_) {
+        return 0U;
+    }
+    const auto binary = programBinaries_.Find(key);
+    if (binary.data.empty()) {
+        return 0U;
+    }
+    const GLuint program = glCreateProgram();
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glProgramBinary(program, binary.binaryFormat, binary.data.data(), static_cast<GLsizei>(binary.data.size()));
+    GLint result = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &result);
+    if (result == GL_FALSE) {
+        // The driver may reject binaries e.g. after an update which didn't change the version string. Fall back to
+        // compiling and forget the binary.
+        PLUGIN_LOG_D("GLES program binary rejected");
+        glDeleteProgram(program);
+        programBinaries_.Erase(key);
+        return 0U;
+    }
+    return program;
+}
+
+void DeviceGLES::StoreProgramBinary(
+    ProgramBinaryCacheGLES& cache, const uint32_t program, const ProgramBinaryCacheGLES::Key& key) const
+{
+    GLint programLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &programLength);
+    if (programLength <= 0) {
+        return;
+    }
+    vector<uint8_t> data(static_cast<size_t>(programLength));
+    GLsizei length = 0;
+    GLenum binaryFormat = 0;
+    glGetProgramBinary(program, programLength, &length, &binaryFormat, data.data());
+    if (length > 0) {
+        cache.Store(key, binaryFormat, array_view(data.data(), static_cast<size_t>(length)));
+    }
+}
+
 void DeviceGLES::UseProgram(uint32_t program)
 {
     if (boundProgram_ != program) {
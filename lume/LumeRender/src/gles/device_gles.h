@@ -31,6 +31,7 @@
 #include <render/resource_handle.h>
 
 #include "device/device.h"
+#include "gles/program_binary_cache_gles.h"
 #include "gles/swapchain_gles.h"
 
 #if RENDER_HAS_GLES_BACKEND
@@ -324,6 +325,9 @@ private:
 
     const ShaderCache::Entry& CacheShader(int type, BASE_NS::string_view source);
     void ReleaseShader(uint32_t type, uint32_t shader);
+    uint32_t LoadProgramBinary(const ProgramBinaryCacheGLES::Key& key);
+    void StoreProgramBinary(ProgramBinaryCacheGLES& cache, uint32_t program,
+        const ProgramBinaryCacheGLES::Key& key) const;
 
     struct ProgramCache {
         uint32_t program{0};
@@ -338,6 +342,9 @@ private:
     BASE_NS::vector<ProgramCache> programs_;
     size_t pCacheHit_{0};
     size_t pCacheMiss_{0};
+    // Binaries of the pipeline cache and of programs released during the session. Uploaded when first requested.
+    ProgramBinaryCacheGLES programBinaries_;
+    size_t pBinaryHit_{0};
 
 #if RENDER_HAS_GL_BACKEND
 #if _WIN32
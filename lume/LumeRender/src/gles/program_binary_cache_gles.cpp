@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "program_binary_cache_gles.h"
+
+#include <algorithm>
+
+#include <base/containers/allocator.h>
+#include <base/util/hash.h>
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+namespace {
+// Version 2: per program sizes, binaries are uploaded lazily.
+constexpr uint32_t CACHE_VERSION = 2U;
+
+struct CacheHeader {
+    uint32_t version;
+    uint32_t programs;
+    uint64_t revisionHash;
+};
+
+struct CacheProgram {
+    uint64_t vertHash;
+    uint64_t fragHash;
+    uint64_t compHash;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t binaryFormat;
+    uint32_t reserved;
+};
+
+bool operator<(const ProgramBinaryCacheGLES::Key& lhs, const ProgramBinaryCacheGLES::Key& rhs)
+{
+    if (lhs.vertHash != rhs.vertHash) {
+        return lhs.vertHash < rhs.vertHash;
+    }
+    if (lhs.fragHash != rhs.fragHash) {
+        return lhs.fragHash < rhs.fragHash;
+    }
+    return lhs.compHash < rhs.compHash;
+}
+
+bool operator==(const ProgramBinaryCacheGLES::Key& lhs, const ProgramBinaryCacheGLES::Key& rhs)
+{
+    return (lhs.vertHash == rhs.vertHash) && (lhs.fragHash == rhs.fragHash) && (lhs.compHash == rhs.compHash);
+}
+
+template <typename Entries>
+auto LowerBound(Entries& entries, const ProgramBinaryCacheGLES::Key& key)
+{
+    return std::lower_bound(
+        entries.begin(), entries.end(), key, [](const auto& entry, const auto& k) { return entry.key < k; });
+}
+}  // namespace
+
+uint64_t ProgramBinaryCacheGLES::HashSource(const string_view source)
+{
+    return source.empty() ? 0U : FNV1aHash(source.data(), source.size());
+}
+
+uint64_t ProgramBinaryCacheGLES::HashRevision(
+    const string_view vendor, const string_view renderer, const string_view version)
+{
+    return Hash(vendor, renderer, version);
+}
+
+bool ProgramBinaryCacheGLES::Deserialize(const array_view<const uint8_t> data, const uint64_t revisionHash)
+{
+    entries_.clear();
+    if (data.size() < sizeof(CacheHeader)) {
+        return false;
+    }
+    CacheHeader header;
+    CloneData(&header, sizeof(header), data.data(), sizeof(CacheHeader));
+    if ((header.version != CACHE_VERSION) || (header.revisionHash != revisionHash)) {
+        return false;
+    }
+    // Use 64-bit arithmetic to prevent overflow when programs count is large.
+    const uint64_t tableEnd =
+        static_cast<uint64_t>(sizeof(CacheHeader)) + static_cast<uint64_t>(header.programs) * sizeof(CacheProgram);
+    if (tableEnd > data.size()) {
+        return false;
+    }
+    const auto binaryData = array_view(data.data() + tableEnd, data.size() - static_cast<size_t>(tableEnd));
+    entries_.reserve(header.programs);
+    for (uint32_t i = 0U; i < header.programs; ++i) {
+        CacheProgram program;
+        CloneData(&program, sizeof(program), data.data() + sizeof(CacheHeader) + i * sizeof(CacheProgram),
+            sizeof(CacheProgram));
+        if ((program.size == 0U) || (static_cast<uint64_t>(program.offset) + program.size > binaryData.size())) {
+            entries_.clear();
+            return false;
+        }
+        const auto* begin = binaryData.data() + program.offset;
+        entries_.push_back({{program.vertHash, program.fragHash, program.compHash}, program.binaryFormat,
+            vector<uint8_t>(begin, begin + program.size)});
+    }
+    std::sort(entries_.begin(), entries_.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.key < rhs.key; });
+    // Drop duplicate keys, the serializer never writes them.
+    entries_.erase(std::unique(entries_.begin(), entries_.end(),
+                       [](const Entry& lhs, const Entry& rhs) { return lhs.key == rhs.key; }),
+        entries_.end());
+    return true;
+}
+
+vector<uint8_t> ProgramBinaryCacheGLES::Serialize(const uint64_t revisionHash) const
+{
+    const size_t tableSize = sizeof(CacheHeader) + entries_.size() * sizeof(CacheProgram);
+    size_t binarySize = 0U;
+    for (const auto& entry : entries_) {
+        binarySize += entry.data.size();
+    }
+    vector<uint8_t> cacheData(tableSize + binarySize);
+
+    const CacheHeader header{CACHE_VERSION, static_cast<uint32_t>(entries_.size()), revisionHash};
+    CloneData(cacheData.data(), cacheData.size(), &header, sizeof(header));
+    uint8_t* table = cacheData.data() + sizeof(CacheHeader);
+    uint8_t* binaries = cacheData.data() + tableSize;
+    uint32_t offset = 0U;
+    for (const auto& entry : entries_) {
+        const CacheProgram program{entry.key.vertHash, entry.key.fragHash, entry.key.compHash, offset,
+            static_cast<uint32_t>(entry.data.size()), entry.binaryFormat, 0U};
+        CloneData(table, sizeof(CacheProgram), &program, sizeof(program));
+        table += sizeof(CacheProgram);
+        CloneData(binaries + offset, binarySize - offset, entry.data.data(), entry.data.size());
+        offset += static_cast<uint32_t>(entry.data.size());
+    }
+    return cacheData;
+}
+
+ProgramBinaryCacheGLES::Binary ProgramBinaryCacheGLES::Find(const Key& key) const
+{
+    if (const auto pos = LowerBound(entries_, key); (pos != entries_.end()) && (pos->key == key)) {
+        return {pos->binaryFormat, pos->data};
+    }
+    return {};
+}
+
+void ProgramBinaryCacheGLES::Store(const Key& key, const uint32_t binaryFormat, const array_view<const uint8_t> data)
+{
+    if (data.empty()) {
+        return;
+    }
+    auto pos = LowerBound(entries_, key);
+    if ((pos == entries_.end()) || !(pos->key == key)) {
+        pos = entries_.insert(pos, Entry{key, 0U, {}});
+    }
+    pos->binaryFormat = binaryFormat;
+    pos->data = vector<uint8_t>(data.data(), data.data() + data.size());
+}
+
+void ProgramBinaryCacheGLES::Erase(const Key& key)
+{
+    if (const auto pos = LowerBound(entries_, key); (pos != entries_.end()) && (pos->key == key)) {
+        entries_.erase(pos);
+    }
+}
+
+size_t ProgramBinaryCacheGLES::GetProgramCount() const
+{
+    return entries_.size();
+}
+
+void ProgramBinaryCacheGLES::Clear()
+{
+    entries_.clear();
+}
+RENDER_END_NAMESPACE()
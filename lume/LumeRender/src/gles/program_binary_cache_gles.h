@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GLES_PROGRAM_BINARY_CACHE_GLES_H
+#define GLES_PROGRAM_BINARY_CACHE_GLES_H
+
+#include <cstdint>
+
+#include <base/containers/array_view.h>
+#include <base/containers/string_view.h>
+#include <base/containers/vector.h>
+#include <render/namespace.h>
+
+RENDER_BEGIN_NAMESPACE()
+/**
+ * Persistent storage of linked GL program binaries. Programs are keyed by the hashes of their final (specialized and
+ * patched) GLSL sources, and the whole cache is tagged with a revision hash of the driver so that binaries produced by
+ * another driver are discarded. Contains no GL calls, binaries are only uploaded by the device when a program is first
+ * requested.
+ */
+class ProgramBinaryCacheGLES final {
+public:
+    /** Hashes of the program stage sources, zero for unused stages. */
+    struct Key {
+        uint64_t vertHash{0};
+        uint64_t fragHash{0};
+        uint64_t compHash{0};
+    };
+    struct Binary {
+        uint32_t binaryFormat{0};
+        BASE_NS::array_view<const uint8_t> data;
+    };
+
+    /** Hash of a stage source as used in Key. Returns zero for an empty source. */
+    static uint64_t HashSource(BASE_NS::string_view source);
+    /** Revision hash from the GL_VENDOR, GL_RENDERER and GL_VERSION strings. */
+    static uint64_t HashRevision(BASE_NS::string_view vendor, BASE_NS::string_view renderer,
+        BASE_NS::string_view version);
+
+    /**
+     * Replaces the content with the serialized cache. Returns false and leaves the cache empty if the data is
+     * malformed, of another version or from a different revision.
+     */
+    bool Deserialize(BASE_NS::array_view<const uint8_t> data, uint64_t revisionHash);
+    /** Serializes the cached binaries for the given revision. */
+    BASE_NS::vector<uint8_t> Serialize(uint64_t revisionHash) const;
+
+    /** Returns the binary of the program or a binary with empty data if there's none. */
+    Binary Find(const Key& key) const;
+    /** Adds or replaces the binary of the program. */
+    void Store(const Key& key, uint32_t binaryFormat, BASE_NS::array_view<const uint8_t> data);
+    /** Removes the binary of the program e.g. when the driver rejected it. */
+    void Erase(const Key& key);
+
+    size_t GetProgramCount() const;
+    void Clear();
+
+private:
+    struct Entry {
+        Key key;
+        uint32_t binaryFormat{0};
+        BASE_NS::vector<uint8_t> data;
+    };
+    // Sorted by key.
+    BASE_NS::vector<Entry> entries_;
+};
+RENDER_END_NAMESPACE()
+
+#endif  // GLES_PROGRAM_BINARY_CACHE_GLES_H
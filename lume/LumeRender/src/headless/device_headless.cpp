@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "device_headless.h"
+
+#include <render/namespace.h>
+
+#include "device/gpu_program_util.h"
+#include "device/gpu_resource_manager.h"
+#include "device/pipeline_state_object.h"
+#include "device/shader_manager.h"
+#include "device/swapchain.h"
+#include "headless/gpu_program_headless.h"
+#include "headless/gpu_resources_headless.h"
+#include "headless/node_context_descriptor_set_manager_headless.h"
+#include "headless/render_backend_headless.h"
+#include "util/log.h"
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+DeviceHeadless::DeviceHeadless(RenderContext& renderContext) : Device(renderContext)
+{
+    // all the memory is host memory, staging can be bypassed like on integrated gpus
+    deviceSharedMemoryPropertyFlags_ = CORE_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | CORE_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    SetDeviceStatus(true);
+
+    const GpuResourceManager::CreateInfo grmCreateInfo{
+        GpuResourceManager::GPU_RESOURCE_MANAGER_OPTIMIZE_STAGING_MEMORY,
+    };
+    gpuResourceMgr_ = make_unique<GpuResourceManager>(*this, grmCreateInfo);
+    shaderMgr_ = make_unique<ShaderManager>(*this);
+    globalDescriptorSetMgr_ = make_unique<DescriptorSetManagerHeadless>(*this);
+
+    lowLevelDevice_ = make_unique<LowLevelDeviceHeadless>();
+}
+
+DeviceHeadless::~DeviceHeadless()
+{
+    globalDescriptorSetMgr_.reset();
+    // must release handles before taking down gpu resource manager.
+    swapchains_.clear();
+
+    gpuResourceMgr_.reset();
+    shaderMgr_.reset();
+}
+
+DeviceBackendType DeviceHeadless::GetBackendType() const
+{
+    return DeviceBackendType::HEADLESS;
+}
+
+const DevicePlatformData& DeviceHeadless::GetPlatformData() const
+{
+    return plat_;
+}
+
+AsBuildSizes DeviceHeadless::GetAccelerationStructureBuildSizes(const AsBuildGeometryInfo& geometry,
+    array_view<const AsGeometryTrianglesInfo> triangles, array_view<const AsGeometryAabbsInfo> aabbs,
+    array_view<const AsGeometryInstancesInfo> instances) const
+{
+    return {};
+}
+
+FormatProperties DeviceHeadless::GetFormatProperties(const Format format) const
+{
+    // everything is supported, nothing is executed
+    FormatProperties properties;
+    properties.linearTilingFeatures = DeviceFormatSupportConstants::ALL_FLAGS_SUPPORTED;
+    properties.optimalTilingFeatures = DeviceFormatSupportConstants::ALL_FLAGS_SUPPORTED;
+    properties.bufferFeatures = DeviceFormatSupportConstants::ALL_FLAGS_SUPPORTED;
+    properties.bytesPerPixel = GpuProgramUtil::FormatByteSize(format);
+    return properties;
+}
+
+ILowLevelDevice& DeviceHeadless::GetLowLevelDevice() const
+{
+    return *lowLevelDevice_;
+}
+
+void DeviceHeadless::WaitForIdle() {}
+
+PlatformGpuMemoryAllocator* DeviceHeadless::GetPlatformGpuMemoryAllocator()
+{
+    return nullptr;
+}
+
+unique_ptr<Swapchain> DeviceHeadless::CreateDeviceSwapchain(const SwapchainCreateInfo& swapchainCreateInfo)
+{
+    PLUGIN_LOG_E("headless device does not support swapchains");
+    return nullptr;
+}
+
+void DeviceHeadless::DestroyDeviceSwapchain() {}
+
+void DeviceHeadless::Activate() {}
+
+void DeviceHeadless::Deactivate() {}
+
+bool DeviceHeadless::AllowThreadedProcessing() const
+{
+    return true;
+}
+
+GpuQueue DeviceHeadless::GetValidGpuQueue(const GpuQueue& gpuQueue) const
+{
+    return {GpuQueue::QueueType::GRAPHICS, 0};
+}
+
+uint32_t DeviceHeadless::GetGpuQueueCount() const
+{
+    return 1;
+}
+
+void DeviceHeadless::InitializePipelineCache(array_view<const uint8_t> initialData) {}
+
+vector<uint8_t> DeviceHeadless::GetPipelineCache() const
+{
+    return {};
+}
+
+unique_ptr<GpuBuffer> DeviceHeadless::CreateGpuBuffer(const GpuBufferDesc& desc)
+{
+    return make_unique<GpuBufferHeadless>(desc);
+}
+
+unique_ptr<GpuBuffer> DeviceHeadless::CreateGpuBuffer(const GpuAccelerationStructureDesc& desc)
+{
+    return make_unique<GpuBufferHeadless>(desc);
+}
+
+unique_ptr<GpuBuffer> DeviceHeadless::CreateGpuBuffer(const BackendSpecificBufferDesc& desc)
+{
+    PLUGIN_LOG_E("headless device does not support backend specific buffers");
+    return nullptr;
+}
+
+unique_ptr<GpuImage> DeviceHeadless::CreateGpuImage(const GpuImageDesc& desc)
+{
+    return make_unique<GpuImageHeadless>(desc);
+}
+
+unique_ptr<GpuImage> DeviceHeadless::CreateGpuImageView(
+    const GpuImageDesc& desc, const GpuImagePlatformData& platformData)
+{
+    return make_unique<GpuImageHeadless>(desc);
+}
+
+unique_ptr<GpuImage> DeviceHeadless::CreateGpuImageView(
+    const GpuImageDesc& desc, const BackendSpecificImageDesc& platformData)
+{
+    PLUGIN_LOG_E("headless device does not support backend specific images");
+    return nullptr;
+}
+
+vector<unique_ptr<GpuImage>> DeviceHeadless::CreateGpuImageViews(const Swapchain& platformSwapchain)
+{
+    return {};
+}
+
+unique_ptr<GpuSampler> DeviceHeadless::CreateGpuSampler(const GpuSamplerDesc& desc)
+{
+    return make_unique<GpuSamplerHeadless>(desc);
+}
+
+unique_ptr<RenderFrameSync> DeviceHeadless::CreateRenderFrameSync()
+{
+    return make_unique<RenderFrameSyncHeadless>();
+}
+
+unique_ptr<RenderBackend> DeviceHeadless::CreateRenderBackend(
+    GpuResourceManager& gpuResourceMgr, CORE_NS::ITaskQueue* queue)
+{
+    return make_unique<RenderBackendHeadless>(*this, gpuResourceMgr);
+}
+
+unique_ptr<ShaderModule> DeviceHeadless::CreateShaderModule(const ShaderModuleCreateInfo& data)
+{
+    return make_unique<ShaderModuleHeadless>(data);
+}
+
+unique_ptr<ShaderModule> DeviceHeadless::CreateComputeShaderModule(const ShaderModuleCreateInfo& data)
+{
+    return make_unique<ShaderModuleHeadless>(data);
+}
+
+unique_ptr<GpuShaderProgram> DeviceHeadless::CreateGpuShaderProgram(const GpuShaderProgramCreateData& data)
+{
+    return make_unique<GpuShaderProgramHeadless>(data);
+}
+
+unique_ptr<GpuComputeProgram> DeviceHeadless::CreateGpuComputeProgram(const GpuComputeProgramCreateData& data)
+{
+    return make_unique<GpuComputeProgramHeadless>(data);
+}
+
+unique_ptr<NodeContextDescriptorSetManager> DeviceHeadless::CreateNodeContextDescriptorSetManager()
+{
+    return make_unique<NodeContextDescriptorSetManagerHeadless>(*this);
+}
+
+unique_ptr<NodeContextPoolManager> DeviceHeadless::CreateNodeContextPoolManager(
+    GpuResourceManager& gpuResourceMgr, const GpuQueue& gpuQueue)
+{
+    return make_unique<NodeContextPoolManagerHeadless>();
+}
+
+unique_ptr<GraphicsPipelineStateObject> DeviceHeadless::CreateGraphicsPipelineStateObject(
+    const GpuShaderProgram& gpuProgram, const GraphicsState& graphicsState, const PipelineLayout& pipelineLayout,
+    const VertexInputDeclarationView& vertexInputDeclaration,
+    const ShaderSpecializationConstantDataView& specializationConstants,
+    const array_view<const DynamicStateEnum> dynamicStates, const RenderPassDesc& renderPassDesc,
+    const array_view<const RenderPassSubpassDesc>& renderPassSubpassDescs, const uint32_t subpassIndex,
+    const LowLevelRenderPassData* renderPassData, const LowLevelPipelineLayoutData* pipelineLayoutData)
+{
+    return make_unique<GraphicsPipelineStateObject>();
+}
+
+unique_ptr<ComputePipelineStateObject> DeviceHeadless::CreateComputePipelineStateObject(
+    const GpuComputeProgram& gpuProgram, const PipelineLayout& pipelineLayout,
+    const ShaderSpecializationConstantDataView& specializationConstants,
+    const LowLevelPipelineLayoutData* pipelineLayoutData)
+{
+    return make_unique<ComputePipelineStateObject>();
+}
+
+unique_ptr<GpuSemaphore> DeviceHeadless::CreateGpuSemaphore()
+{
+    return make_unique<GpuSemaphoreHeadless>();
+}
+
+unique_ptr<GpuSemaphore> DeviceHeadless::CreateGpuSemaphoreView(const uint64_t handle)
+{
+    return make_unique<GpuSemaphoreHeadless>(handle);
+}
+
+DeviceBackendType LowLevelDeviceHeadless::GetBackendType() const
+{
+    return DeviceBackendType::HEADLESS;
+}
+
+unique_ptr<Device> CreateDeviceHeadless(RenderContext& renderContext)
+{
+    return make_unique<DeviceHeadless>(renderContext);
+}
+RENDER_END_NAMESPACE()
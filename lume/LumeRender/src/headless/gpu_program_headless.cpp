@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_program_headless.h"
+
+#include <base/math/vector.h>
+#include <render/namespace.h>
+
+#include "device/gpu_program_util.h"
+#include "device/shader_manager.h"
+#include "util/log.h"
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+ShaderModuleHeadless::ShaderModuleHeadless(const ShaderModuleCreateInfo& createInfo)
+    : shaderStageFlags_(createInfo.shaderStageFlags)
+{
+    if (!createInfo.reflectionData.IsValid()) {
+        PLUGIN_LOG_E("invalid headless shader module");
+        return;
+    }
+    pipelineLayout_ = createInfo.reflectionData.GetPipelineLayout();
+
+    constants_ = createInfo.reflectionData.GetSpecializationConstants();
+    sscv_.constants = constants_;
+
+    if (shaderStageFlags_ == ShaderStageFlagBits::CORE_SHADER_STAGE_VERTEX_BIT) {
+        vertexInputAttributeDescriptions_ = createInfo.reflectionData.GetInputDescriptions();
+        for (const auto& attrib : vertexInputAttributeDescriptions_) {
+            VertexInputDeclaration::VertexInputBindingDescription bindingDesc;
+            bindingDesc.binding = attrib.binding;
+            bindingDesc.stride = GpuProgramUtil::FormatByteSize(attrib.format);
+            bindingDesc.vertexInputRate = VertexInputRate::CORE_VERTEX_INPUT_RATE_VERTEX;
+            vertexInputBindingDescriptions_.push_back(bindingDesc);
+        }
+        vidv_.bindingDescriptions = vertexInputBindingDescriptions_;
+        vidv_.attributeDescriptions = vertexInputAttributeDescriptions_;
+    } else if (shaderStageFlags_ == ShaderStageFlagBits::CORE_SHADER_STAGE_COMPUTE_BIT) {
+        const Math::UVec3 tgs = createInfo.reflectionData.GetLocalSize();
+        stg_.x = tgs[0U];
+        stg_.y = tgs[1U];
+        stg_.z = tgs[2U];
+    }
+}
+
+ShaderStageFlags ShaderModuleHeadless::GetShaderStageFlags() const
+{
+    return shaderStageFlags_;
+}
+
+const ShaderModulePlatformData& ShaderModuleHeadless::GetPlatformData() const
+{
+    return plat_;
+}
+
+const PipelineLayout& ShaderModuleHeadless::GetPipelineLayout() const
+{
+    return pipelineLayout_;
+}
+
+ShaderSpecializationConstantView ShaderModuleHeadless::GetSpecilization() const
+{
+    return sscv_;
+}
+
+VertexInputDeclarationView ShaderModuleHeadless::GetVertexInputDeclaration() const
+{
+    return vidv_;
+}
+
+ShaderThreadGroup ShaderModuleHeadless::GetThreadGroupSize() const
+{
+    return stg_;
+}
+
+GpuShaderProgramHeadless::GpuShaderProgramHeadless(const GpuShaderProgramCreateData& createData)
+{
+    // combine vertex and fragment shader data like the other backends
+    if (createData.vertShaderModule && createData.fragShaderModule) {
+        auto& pipelineLayout = reflection_.pipelineLayout;
+        {  // vert
+            const ShaderModule& mod = *createData.vertShaderModule;
+            pipelineLayout = mod.GetPipelineLayout();
+            // has sort inside
+            GpuProgramUtil::CombineSpecializationConstants(mod.GetSpecilization().constants, constants_);
+            // not owned, directly reflected from vertex shader module
+            reflection_.vertexInputDeclarationView = mod.GetVertexInputDeclaration();
+        }
+        {  // frag
+            const ShaderModule& mod = *createData.fragShaderModule;
+            GpuProgramUtil::CombineSpecializationConstants(mod.GetSpecilization().constants, constants_);
+            const auto& reflPl = mod.GetPipelineLayout();
+            // has sort inside
+            GpuProgramUtil::CombinePipelineLayouts({&reflPl, 1U}, pipelineLayout);
+        }
+        reflection_.shaderSpecializationConstantView.constants = constants_;
+    }
+}
+
+const ShaderReflection& GpuShaderProgramHeadless::GetReflection() const
+{
+    return reflection_;
+}
+
+GpuComputeProgramHeadless::GpuComputeProgramHeadless(const GpuComputeProgramCreateData& createData)
+{
+    if (createData.compShaderModule) {
+        const ShaderModule& mod = *createData.compShaderModule;
+        reflection_.pipelineLayout = mod.GetPipelineLayout();
+        const auto& tgs = mod.GetThreadGroupSize();
+        reflection_.threadGroupSizeX = Math::max(1U, tgs.x);
+        reflection_.threadGroupSizeY = Math::max(1U, tgs.y);
+        reflection_.threadGroupSizeZ = Math::max(1U, tgs.z);
+        const auto& sscv = mod.GetSpecilization();
+        constants_ = vector<ShaderSpecialization::Constant>(sscv.constants.cbegin().ptr(), sscv.constants.cend().ptr());
+        reflection_.shaderSpecializationConstantView.constants = constants_;
+    }
+}
+
+const ComputeShaderReflection& GpuComputeProgramHeadless::GetReflection() const
+{
+    return reflection_;
+}
+RENDER_END_NAMESPACE()
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HEADLESS_GPU_PROGRAM_HEADLESS_H
+#define HEADLESS_GPU_PROGRAM_HEADLESS_H
+
+#include <base/containers/vector.h>
+#include <render/device/pipeline_layout_desc.h>
+#include <render/device/pipeline_state_desc.h>
+#include <render/namespace.h>
+
+#include "device/gpu_program.h"
+#include "device/shader_module.h"
+
+RENDER_BEGIN_NAMESPACE()
+struct ShaderModuleCreateInfo;
+
+/** Shader module which keeps only the reflection, the SPIR-V isn't retained. */
+class ShaderModuleHeadless final : public ShaderModule {
+public:
+    explicit ShaderModuleHeadless(const ShaderModuleCreateInfo& createInfo);
+    ~ShaderModuleHeadless() override = default;
+
+    ShaderStageFlags GetShaderStageFlags() const override;
+    const ShaderModulePlatformData& GetPlatformData() const override;
+    const PipelineLayout& GetPipelineLayout() const override;
+    ShaderSpecializationConstantView GetSpecilization() const override;
+    VertexInputDeclarationView GetVertexInputDeclaration() const override;
+    ShaderThreadGroup GetThreadGroupSize() const override;
+
+private:
+    ShaderStageFlags shaderStageFlags_{0U};
+    ShaderModulePlatformData plat_;
+    PipelineLayout pipelineLayout_;
+    BASE_NS::vector<ShaderSpecialization::Constant> constants_;
+    ShaderSpecializationConstantView sscv_;
+    BASE_NS::vector<VertexInputDeclaration::VertexInputBindingDescription> vertexInputBindingDescriptions_;
+    BASE_NS::vector<VertexInputDeclaration::VertexInputAttributeDescription> vertexInputAttributeDescriptions_;
+    VertexInputDeclarationView vidv_;
+    ShaderThreadGroup stg_{0U, 0U, 0U};
+};
+
+class GpuShaderProgramHeadless final : public GpuShaderProgram {
+public:
+    explicit GpuShaderProgramHeadless(const GpuShaderProgramCreateData& createData);
+    ~GpuShaderProgramHeadless() override = default;
+
+    const ShaderReflection& GetReflection() const override;
+
+private:
+    BASE_NS::vector<ShaderSpecialization::Constant> constants_;
+    ShaderReflection reflection_;
+};
+
+class GpuComputeProgramHeadless final : public GpuComputeProgram {
+public:
+    explicit GpuComputeProgramHeadless(const GpuComputeProgramCreateData& createData);
+    ~GpuComputeProgramHeadless() override = default;
+
+    const ComputeShaderReflection& GetReflection() const override;
+
+private:
+    BASE_NS::vector<ShaderSpecialization::Constant> constants_;
+    ComputeShaderReflection reflection_;
+};
+RENDER_END_NAMESPACE()
+
+#endif  // HEADLESS_GPU_PROGRAM_HEADLESS_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_resources_headless.h"
+
+#include <render/namespace.h>
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+GpuBufferHeadless::GpuBufferHeadless(const GpuBufferDesc& desc) : desc_(desc), data_(desc.byteSize) {}
+
+GpuBufferHeadless::GpuBufferHeadless(const GpuAccelerationStructureDesc& desc)
+    : desc_(desc.bufferDesc), data_(desc.bufferDesc.byteSize)
+{}
+
+const GpuBufferDesc& GpuBufferHeadless::GetDesc() const
+{
+    return desc_;
+}
+
+uint64_t GpuBufferHeadless::GetDeviceAddress() const
+{
+    return 0U;
+}
+
+void* GpuBufferHeadless::Map()
+{
+    // single block, the ring buffering of dynamic buffers only matters for memory which the GPU reads.
+    return data_.data();
+}
+
+void* GpuBufferHeadless::MapMemory()
+{
+    return data_.data();
+}
+
+void GpuBufferHeadless::Unmap() const {}
+
+GpuImageHeadless::GpuImageHeadless(const GpuImageDesc& desc) : desc_(desc) {}
+
+const GpuImageDesc& GpuImageHeadless::GetDesc() const
+{
+    return desc_;
+}
+
+const GpuImagePlatformData& GpuImageHeadless::GetBasePlatformData() const
+{
+    return plat_;
+}
+
+GpuImage::AdditionalFlags GpuImageHeadless::GetAdditionalFlags() const
+{
+    return 0U;
+}
+
+GpuSamplerHeadless::GpuSamplerHeadless(const GpuSamplerDesc& desc) : desc_(desc) {}
+
+const GpuSamplerDesc& GpuSamplerHeadless::GetDesc() const
+{
+    return desc_;
+}
+
+GpuSemaphoreHeadless::GpuSemaphoreHeadless(const uint64_t handle) : handle_(handle) {}
+
+uint64_t GpuSemaphoreHeadless::GetHandle() const
+{
+    return handle_;
+}
+RENDER_END_NAMESPACE()
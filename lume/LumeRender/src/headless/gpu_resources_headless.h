@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HEADLESS_GPU_RESOURCES_HEADLESS_H
+#define HEADLESS_GPU_RESOURCES_HEADLESS_H
+
+#include <cstdint>
+
+#include <base/containers/vector.h>
+#include <render/device/gpu_resource_desc.h>
+#include <render/device/intf_device.h>
+#include <render/namespace.h>
+
+#include "device/gpu_buffer.h"
+#include "device/gpu_image.h"
+#include "device/gpu_sampler.h"
+#include "device/gpu_semaphore.h"
+
+RENDER_BEGIN_NAMESPACE()
+/** Buffer backed by host memory so that mapping and writing behave like with a real device. */
+class GpuBufferHeadless final : public GpuBuffer {
+public:
+    explicit GpuBufferHeadless(const GpuBufferDesc& desc);
+    explicit GpuBufferHeadless(const GpuAccelerationStructureDesc& desc);
+    ~GpuBufferHeadless() override = default;
+
+    const GpuBufferDesc& GetDesc() const override;
+    uint64_t GetDeviceAddress() const override;
+    void* Map() override;
+    void* MapMemory() override;
+    void Unmap() const override;
+
+private:
+    GpuBufferDesc desc_;
+    BASE_NS::vector<uint8_t> data_;
+};
+
+/** Image without storage, only the description is kept. */
+class GpuImageHeadless final : public GpuImage {
+public:
+    explicit GpuImageHeadless(const GpuImageDesc& desc);
+    ~GpuImageHeadless() override = default;
+
+    const GpuImageDesc& GetDesc() const override;
+    const GpuImagePlatformData& GetBasePlatformData() const override;
+    AdditionalFlags GetAdditionalFlags() const override;
+
+private:
+    GpuImageDesc desc_;
+    GpuImagePlatformData plat_;
+};
+
+class GpuSamplerHeadless final : public GpuSampler {
+public:
+    explicit GpuSamplerHeadless(const GpuSamplerDesc& desc);
+    ~GpuSamplerHeadless() override = default;
+
+    const GpuSamplerDesc& GetDesc() const override;
+
+private:
+    GpuSamplerDesc desc_;
+};
+
+class GpuSemaphoreHeadless final : public GpuSemaphore {
+public:
+    GpuSemaphoreHeadless() = default;
+    explicit GpuSemaphoreHeadless(uint64_t handle);
+    ~GpuSemaphoreHeadless() override = default;
+
+    uint64_t GetHandle() const override;
+
+private:
+    uint64_t handle_{0U};
+};
+RENDER_END_NAMESPACE()
+
+#endif  // HEADLESS_GPU_RESOURCES_HEADLESS_H
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HEADLESS_NODE_CONTEXT_DESCRIPTOR_SET_MANAGER_HEADLESS_H
+#define HEADLESS_NODE_CONTEXT_DESCRIPTOR_SET_MANAGER_HEADLESS_H
+
+#include <base/containers/array_view.h>
+#include <render/device/pipeline_layout_desc.h>
+#include <render/namespace.h>
+#include <render/render_data_structures.h>
+
+#include "nodecontext/node_context_descriptor_set_manager.h"
+
+RENDER_BEGIN_NAMESPACE()
+/** Global descriptor set manager which keeps only the CPU side descriptor sets. */
+class DescriptorSetManagerHeadless final : public DescriptorSetManager {
+public:
+    explicit DescriptorSetManagerHeadless(Device& device);
+    ~DescriptorSetManagerHeadless() override = default;
+
+    void BeginFrame() override;
+    void BeginBackendFrame();
+
+    bool UpdateDescriptorSetGpuHandle(const RenderHandle& handle) override;
+    void UpdateCpuDescriptorSetPlatform(const DescriptorSetLayoutBindingResources& bindingResources) override;
+
+    void CreateDescriptorSets(const uint32_t arrayIndex, const uint32_t descriptorSetCount,
+        const BASE_NS::array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings) override;
+};
+
+/** Node context descriptor set manager which keeps only the CPU side descriptor sets. */
+class NodeContextDescriptorSetManagerHeadless final : public NodeContextDescriptorSetManager {
+public:
+    explicit NodeContextDescriptorSetManagerHeadless(Device& device);
+    ~NodeContextDescriptorSetManagerHeadless() override = default;
+
+    void ResetAndReserve(const DescriptorCounts& descriptorCounts) override;
+    void BeginFrame() override;
+
+    RenderHandle CreateDescriptorSet(
+        const BASE_NS::array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings) override;
+    RenderHandle CreateOneFrameDescriptorSet(
+        const BASE_NS::array_view<const DescriptorSetLayoutBinding> descriptorSetLayoutBindings) override;
+
+    bool UpdateDescriptorSetGpuHandle(const RenderHandle handle) override;
+    void UpdateCpuDescriptorSetPlatform(const DescriptorSetLayoutBindingResources& bindingResources) override;
+
+private:
+    uint32_t oneFrameDescSetGeneration_{0u};
+#if (RENDER_VALIDATION_ENABLED == 1)
+    static constexpr uint32_t MAX_ONE_FRAME_GENERATION_IDX{16u};
+#endif
+};
+RENDER_END_NAMESPACE()
+
+#endif  // HEADLESS_NODE_CONTEXT_DESCRIPTOR_SET_MANAGER_HEADLESS_H
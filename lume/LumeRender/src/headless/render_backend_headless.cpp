@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "render_backend_headless.h"
+
+#include <render/namespace.h>
+
+#include "device/device.h"
+#include "device/gpu_resource_manager.h"
+#include "headless/node_context_descriptor_set_manager_headless.h"
+#include "nodecontext/node_context_pso_manager.h"
+#include "nodecontext/render_command_list.h"
+#include "nodecontext/render_node_graph_node_store.h"  // RenderCommandFrameData
+#include "util/log.h"
+
+using namespace BASE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+void RenderFrameSyncHeadless::BeginFrame() {}
+
+void RenderFrameSyncHeadless::WaitForFrameFence() {}
+
+void NodeContextPoolManagerHeadless::BeginFrame() {}
+
+void NodeContextPoolManagerHeadless::BeginBackendFrame() {}
+
+#if ((RENDER_VALIDATION_ENABLED == 1) || (RENDER_VULKAN_VALIDATION_ENABLED == 1))
+void NodeContextPoolManagerHeadless::SetValidationDebugName(const string_view debugName)
+{
+    PLUGIN_UNUSED(debugName);
+}
+#endif
+
+RenderBackendHeadless::RenderBackendHeadless(Device& device, GpuResourceManager& gpuResourceManager)
+    : RenderBackend(), device_(device), gpuResourceMgr_(gpuResourceManager)
+{
+    PLUGIN_UNUSED(gpuResourceMgr_);
+}
+
+void RenderBackendHeadless::Render(
+    RenderCommandFrameData& renderCommandFrameData, const RenderBackendBackBufferConfiguration& backBufferConfig)
+{
+    PLUGIN_UNUSED(backBufferConfig);
+    // NOTE: all command lists are validated before entering here
+    stats_ = {};
+
+    // global begin backend frame
+    auto& descriptorSetMgr = static_cast<DescriptorSetManagerHeadless&>(device_.GetDescriptorSetManager());
+    descriptorSetMgr.BeginBackendFrame();
+    UpdateGlobalDescriptorSets();
+
+    for (const auto& ref : renderCommandFrameData.renderCommandContexts) {
+        RenderSingleCommandList(ref);
+    }
+
+    // external gpu signals are never signaled, there's no gpu work to wait for
+}
+
+void RenderBackendHeadless::Present(const RenderBackendBackBufferConfiguration& backBufferConfig)
+{
+    PLUGIN_UNUSED(backBufferConfig);
+}
+
+const RenderBackendHeadless::Statistics& RenderBackendHeadless::GetStatistics() const
+{
+    return stats_;
+}
+
+void RenderBackendHeadless::UpdateGlobalDescriptorSets()
+{
+    auto& descriptorSetMgr = static_cast<DescriptorSetManagerHeadless&>(device_.GetDescriptorSetManager());
+    for (const auto& descHandle : descriptorSetMgr.GetUpdateDescriptorSetHandles()) {
+        if (RenderHandleUtil::GetHandleType(descHandle) == RenderHandleType::DESCRIPTOR_SET) {
+            descriptorSetMgr.UpdateDescriptorSetGpuHandle(descHandle);
+        }
+    }
+}
+
+void RenderBackendHeadless::UpdateCommandListDescriptorSets(
+    const RenderCommandList& renderCommandList, NodeContextDescriptorSetManager& ncdsm)
+{
+    for (const auto& descHandle : renderCommandList.GetUpdateDescriptorSetHandles()) {
+        if (RenderHandleUtil::GetHandleType(descHandle) == RenderHandleType::DESCRIPTOR_SET) {
+            ncdsm.UpdateDescriptorSetGpuHandle(descHandle);
+        }
+    }
+}
+
+void RenderBackendHeadless::RenderSingleCommandList(const RenderCommandContext& renderCommandCtx)
+{
+    // these are validated in render graph
+    renderCommandCtx.nodeContextPoolMgr->BeginBackendFrame();
+    renderCommandCtx.nodeContextPsoMgr->BeginBackendFrame();
+
+    UpdateCommandListDescriptorSets(*renderCommandCtx.renderCommandList, *renderCommandCtx.nodeContextDescriptorSetMgr);
+
+    activeRenderPass_ = {};
+    ++stats_.commandLists;
+    for (const auto& ref : renderCommandCtx.renderCommandList->GetRenderCommands()) {
+        PLUGIN_ASSERT(ref.rc);
+        ++stats_.commands;
+        switch (ref.type) {
+            case RenderCommandType::BEGIN_RENDER_PASS: {
+                const auto& renderCmd = *static_cast<const RenderCommandBeginRenderPass*>(ref.rc);
+                activeRenderPass_.renderPassDesc = &renderCmd.renderPassDesc;
+                activeRenderPass_.subpasses = renderCmd.subpasses;
+                activeRenderPass_.subpassIndex = renderCmd.subpassStartIndex;
+                ++stats_.renderPasses;
+                break;
+            }
+            case RenderCommandType::NEXT_SUBPASS:
+                ++activeRenderPass_.subpassIndex;
+                break;
+            case RenderCommandType::END_RENDER_PASS:
+                activeRenderPass_ = {};
+                break;
+            case RenderCommandType::BIND_PIPELINE:
+                BindPipeline(renderCommandCtx, ref);
+                break;
+            case RenderCommandType::DRAW:
+            case RenderCommandType::DRAW_INDIRECT:
+                ++stats_.draws;
+                break;
+            case RenderCommandType::DISPATCH:
+            case RenderCommandType::DISPATCH_INDIRECT:
+                ++stats_.dispatches;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void RenderBackendHeadless::BindPipeline(const RenderCommandContext& renderCommandCtx, const RenderCommandWithType& ref)
+{
+    // creates the pipeline state objects like the gpu backends, the cost of pso management is part of the frame
+    const auto& renderCmd = *static_cast<const RenderCommandBindPipeline*>(ref.rc);
+    NodeContextPsoManager& psoMgr = *renderCommandCtx.nodeContextPsoMgr;
+    if (renderCmd.pipelineBindPoint == PipelineBindPoint::CORE_PIPELINE_BIND_POINT_COMPUTE) {
+        psoMgr.GetComputePso(renderCmd.psoHandle, nullptr);
+    } else if ((renderCmd.pipelineBindPoint == PipelineBindPoint::CORE_PIPELINE_BIND_POINT_GRAPHICS) &&
+               activeRenderPass_.renderPassDesc) {
+        psoMgr.GetGraphicsPso(renderCmd.psoHandle, *activeRenderPass_.renderPassDesc, activeRenderPass_.subpasses,
+            activeRenderPass_.subpassIndex, 0, nullptr, nullptr);
+    }
+    ++stats_.pipelineBinds;
+}
+RENDER_END_NAMESPACE()
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HEADLESS_RENDER_BACKEND_HEADLESS_H
+#define HEADLESS_RENDER_BACKEND_HEADLESS_H
+
+#include <cstdint>
+
+#include <base/containers/array_view.h>
+#include <base/containers/string_view.h>
+#include <render/namespace.h>
+#include <render/render_data_structures.h>
+
+#include "device/render_frame_sync.h"
+#include "nodecontext/node_context_pool_manager.h"
+#include "render_backend.h"
+
+RENDER_BEGIN_NAMESPACE()
+class Device;
+class GpuResourceManager;
+class NodeContextDescriptorSetManager;
+class RenderCommandList;
+struct RenderCommandContext;
+struct RenderCommandWithType;
+
+/** Frame sync without fences, frames are complete when they have been recorded. */
+class RenderFrameSyncHeadless final : public RenderFrameSync {
+public:
+    RenderFrameSyncHeadless() = default;
+    ~RenderFrameSyncHeadless() override = default;
+
+    void BeginFrame() override;
+    void WaitForFrameFence() override;
+};
+
+class NodeContextPoolManagerHeadless final : public NodeContextPoolManager {
+public:
+    NodeContextPoolManagerHeadless() = default;
+    ~NodeContextPoolManagerHeadless() override = default;
+
+    void BeginFrame() override;
+    void BeginBackendFrame() override;
+
+#if ((RENDER_VALIDATION_ENABLED == 1) || (RENDER_VULKAN_VALIDATION_ENABLED == 1))
+    void SetValidationDebugName(BASE_NS::string_view debugName) override;
+#endif
+};
+
+/**
+ * Render backend which walks the recorded command lists like the GPU backends do (descriptor set updates,
+ * pipeline creation, render pass tracking) but doesn't execute anything. Used for measuring the CPU side cost of
+ * the render pipeline.
+ */
+class RenderBackendHeadless final : public RenderBackend {
+public:
+    /** Counters of the last rendered frame. */
+    struct Statistics {
+        uint32_t commandLists{0U};
+        uint32_t commands{0U};
+        uint32_t renderPasses{0U};
+        uint32_t pipelineBinds{0U};
+        uint32_t draws{0U};
+        uint32_t dispatches{0U};
+    };
+
+    RenderBackendHeadless(Device& device, GpuResourceManager& gpuResourceManager);
+    ~RenderBackendHeadless() override = default;
+
+    void Render(RenderCommandFrameData& renderCommandFrameData,
+        const RenderBackendBackBufferConfiguration& backBufferConfig) override;
+    void Present(const RenderBackendBackBufferConfiguration& backBufferConfig) override;
+
+    const Statistics& GetStatistics() const;
+
+private:
+    struct ActiveRenderPass {
+        const RenderPassDesc* renderPassDesc{nullptr};
+        BASE_NS::array_view<const RenderPassSubpassDesc> subpasses;
+        uint32_t subpassIndex{0U};
+    };
+
+    void UpdateGlobalDescriptorSets();
+    void UpdateCommandListDescriptorSets(
+        const RenderCommandList& renderCommandList, NodeContextDescriptorSetManager& ncdsm);
+    void RenderSingleCommandList(const RenderCommandContext& renderCommandCtx);
+    void BindPipeline(const RenderCommandContext& renderCommandCtx, const RenderCommandWithType& ref);
+
+    Device& device_;
+    GpuResourceManager& gpuResourceMgr_;
+    ActiveRenderPass activeRenderPass_;
+    Statistics stats_;
+};
+RENDER_END_NAMESPACE()
+
+#endif  // HEADLESS_RENDER_BACKEND_HEADLESS_H
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loader/shader_bundle.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
+#include <core/io/intf_file_manager.h>
+
+#include "util/log.h"
+
+using namespace BASE_NS;
+using namespace CORE_NS;
+
+RENDER_BEGIN_NAMESPACE()
+namespace {
+// matches the writer in LumeShaderCompiler
+constexpr uint8_t BUNDLE_TAG[] = {'s', 'h', 'b', 1};  // last one is version
+constexpr uint64_t MAX_BUNDLE_FILE_BYTE_SIZE{256ULL * 1024ULL * 1024ULL};
+
+struct BundleHeader {
+    uint8_t tag[sizeof(BUNDLE_TAG)];
+    uint32_t entryCount;
+};
+
+inline string_view NameOf(const array_view<const uint8_t> data, const uint32_t offset, const uint32_t size)
+{
+    return {reinterpret_cast<const char*>(data.data() + offset), size};
+}
+
+// bytewise order used by the writer (std::string comparison)
+inline bool NameLess(const string_view lhs, const string_view rhs)
+{
+    const int res = (lhs.empty() || rhs.empty()) ? 0 : memcmp(lhs.data(), rhs.data(), std::min(lhs.size(), rhs.size()));
+    return (res < 0) || ((res == 0) && (lhs.size() < rhs.size()));
+}
+}  // namespace
+
+bool ShaderBundle::Load(IFileManager& fileManager, const string_view uri)
+{
+    IFile::Ptr file = fileManager.OpenFile(uri);
+    if (!file) {
+        return false;
+    }
+    if (const auto mapped = file->GetMappedData(); !mapped.empty()) {
+        // the entry table is read in place
+        if ((reinterpret_cast<uintptr_t>(mapped.data()) % alignof(Entry)) == 0U) {
+            file_ = move(file);
+            return Load(mapped);
+        }
+    }
+    const uint64_t fileLength = file->GetLength();
+    if (fileLength > MAX_BUNDLE_FILE_BYTE_SIZE) {
+        PLUGIN_LOG_E("shader bundle too large (%s): %" PRIu64, uri.data(), fileLength);
+        return false;
+    }
+    fileData_.resize(static_cast<size_t>(fileLength));
+    if (file->Read(fileData_.data(), fileData_.size()) != fileLength) {
+        PLUGIN_LOG_E("failed to read shader bundle (%s)", uri.data());
+        fileData_ = {};
+        return false;
+    }
+    return Load(fileData_);
+}
+
+bool ShaderBundle::Load(const array_view<const uint8_t> data)
+{
+    data_ = {};
+    entries_ = {};
+    if (data.size() < sizeof(BundleHeader)) {
+        return false;
+    }
+    const auto& header = *reinterpret_cast<const BundleHeader*>(data.data());
+    if (!std::equal(std::begin(BUNDLE_TAG), std::end(BUNDLE_TAG), header.tag)) {
+        PLUGIN_LOG_E("invalid shader bundle tag or version");
+        return false;
+    }
+    if (header.entryCount > ((data.size() - sizeof(BundleHeader)) / sizeof(Entry))) {
+        PLUGIN_LOG_E("invalid shader bundle entry count %u", header.entryCount);
+        return false;
+    }
+    const array_view<const Entry> entries(
+        reinterpret_cast<const Entry*>(data.data() + sizeof(BundleHeader)), header.entryCount);
+    string_view previous;
+    for (const auto& entry : entries) {
+        if ((entry.nameOffset > data.size()) || (entry.nameSize > (data.size() - entry.nameOffset)) ||
+            (entry.dataOffset > data.size()) || (entry.dataSize > (data.size() - entry.dataOffset))) {
+            PLUGIN_LOG_E("invalid shader bundle entry");
+            return false;
+        }
+        // Find relies on the order
+        const string_view name = NameOf(data, entry.nameOffset, entry.nameSize);
+        if ((&entry != entries.data()) && !NameLess(previous, name)) {
+            PLUGIN_LOG_E("shader bundle entries not sorted");
+            return false;
+        }
+        previous = name;
+    }
+    data_ = data;
+    entries_ = entries;
+    return true;
+}
+
+size_t ShaderBundle::GetFileCount() const
+{
+    return entries_.size();
+}
+
+string_view ShaderBundle::GetName(const size_t index) const
+{
+    if (index < entries_.size()) {
+        return NameOf(data_, entries_[index].nameOffset, entries_[index].nameSize);
+    }
+    return {};
+}
+
+array_view<const uint8_t> ShaderBundle::GetData(const size_t index) const
+{
+    if (index < entries_.size()) {
+        return {data_.data() + entries_[index].dataOffset, entries_[index].dataSize};
+    }
+    return {};
+}
+
+array_view<const uint8_t> ShaderBundle::Find(const string_view name) const
+{
+    const auto pos = std::lower_bound(entries_.cbegin(), entries_.cend(), name,
+        [data = data_](const Entry& entry, const string_view value) {
+            return NameLess(NameOf(data, entry.nameOffset, entry.nameSize), value);
+        });
+    if ((pos != entries_.cend()) && (NameOf(data_, pos->nameOffset, pos->nameSize) == name)) {
+        return {data_.data() + pos->dataOffset, pos->dataSize};
+    }
+    return {};
+}
+RENDER_END_NAMESPACE()
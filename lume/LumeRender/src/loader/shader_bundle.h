@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOADER_SHADER_BUNDLE_H
+#define LOADER_SHADER_BUNDLE_H
+
+#include <cstdint>
+
+#include <base/containers/array_view.h>
+#include <base/containers/string_view.h>
+#include <base/containers/vector.h>
+#include <core/io/intf_file.h>
+#include <core/namespace.h>
+#include <render/namespace.h>
+
+CORE_BEGIN_NAMESPACE()
+class IFileManager;
+CORE_END_NAMESPACE()
+RENDER_BEGIN_NAMESPACE()
+
+/** Shader bundle.
+ * Read only view to a shader bundle written by LumeShaderCompiler (--bundle). The bundle packs the compiled shader
+ * files of a shader path (.shader, .spv, .gl, .gles and .lsb) into a single file with a sorted index, so the files can
+ * be looked up without touching the file system. The file is used in place when it's memory mapped.
+ */
+class ShaderBundle final {
+public:
+    /** File name of the bundle at the root of a shader path. */
+    static constexpr BASE_NS::string_view FILENAME{"shaders.shaderbundle"};
+
+    ShaderBundle() = default;
+    ~ShaderBundle() = default;
+    ShaderBundle(const ShaderBundle&) = delete;
+    ShaderBundle& operator=(const ShaderBundle&) = delete;
+
+    /** Opens and validates a bundle file.
+     * @param fileManager A file manager to access the file in given uri.
+     * @param uri Uri to the bundle file.
+     * @return True if the bundle was loaded.
+     */
+    bool Load(CORE_NS::IFileManager& fileManager, BASE_NS::string_view uri);
+
+    /** Validates a bundle in memory. The data must outlive the bundle.
+     * @param data Contents of a bundle file.
+     * @return True if the data is a valid bundle.
+     */
+    bool Load(BASE_NS::array_view<const uint8_t> data);
+
+    /** Number of files in the bundle. */
+    size_t GetFileCount() const;
+
+    /** Name of a file, relative to the bundle root. */
+    BASE_NS::string_view GetName(size_t index) const;
+
+    /** Contents of a file. */
+    BASE_NS::array_view<const uint8_t> GetData(size_t index) const;
+
+    /** Finds a file by name.
+     * @param name Path of the file relative to the bundle root.
+     * @return Contents of the file, or an empty view if the file isn't in the bundle.
+     */
+    BASE_NS::array_view<const uint8_t> Find(BASE_NS::string_view name) const;
+
+private:
+    struct Entry {
+        uint32_t nameOffset;
+        uint32_t nameSize;
+        uint32_t dataOffset;
+        uint32_t dataSize;
+    };
+
+    CORE_NS::IFile::Ptr file_;
+    BASE_NS::vector<uint8_t> fileData_;
+    BASE_NS::array_view<const uint8_t> data_;
+    BASE_NS::array_view<const Entry> entries_;
+};
+RENDER_END_NAMESPACE()
+
+#endif  // LOADER_SHADER_BUNDLE_H
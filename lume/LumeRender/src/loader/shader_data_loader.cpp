@@ -221,6 +221,7 @@ ShaderDataLoader::LoadResult ShaderDataLoader::Load(IFileManager& fileManager, c
 
 ShaderDataLoader::LoadResult ShaderDataLoader::Load(const string_view uri, string&& jsonData)
 {
+    uri_ = uri;
     LoadResult result;
     const auto json = json::parse(jsonData.data());
     if (json) {
@@ -71,9 +71,15 @@ public:
      */
     LoadResult Load(CORE_NS::IFileManager& fileManager, BASE_NS::string_view uri);
 
-private:
+    /** Loads shader state from given json string.
+     * @param uri Uri of the json file.
+     * @param jsonData Contents of the json file.
+     * @return A structure containing result for the parsing operation.
+     */
     LoadResult Load(BASE_NS::string_view uri, BASE_NS::string&& jsonData);
 
+private:
+
     BASE_NS::string uri_;
     BASE_NS::string baseCategory_;
 
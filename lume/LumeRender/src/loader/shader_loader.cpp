@@ -15,13 +15,18 @@
 
 #include "loader/shader_loader.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 #include <set>
 
 #include <base/containers/array_view.h>
+#include <base/containers/unordered_map.h>
 #include <base/containers/vector.h>
+#include <core/implementation_uids.h>
 #include <core/io/intf_file_manager.h>
+#include <core/plugin/intf_class_register.h>
+#include <core/threading/intf_thread_pool.h>
 #include <render/device/gpu_resource_desc.h>
 #include <render/device/pipeline_layout_desc.h>
 #include <render/namespace.h>
@@ -29,6 +34,7 @@
 #include "device/shader_manager.h"
 #include "loader/json_util.h"
 #include "loader/pipeline_layout_loader.h"
+#include "loader/shader_bundle.h"
 #include "loader/shader_data_loader.h"
 #include "loader/shader_state_loader.h"
 #include "loader/vertex_input_declaration_loader.h"
@@ -96,6 +102,67 @@ vector<uint8_t> ReadFile(IFile& file, const string_view uri)
     }
     return fileData;
 }
+
+// Helper class for running lambda as a ThreadPool task.
+template <typename Fn>
+class FunctionTask final : public IThreadPool::ITask {
+public:
+    explicit FunctionTask(Fn&& func) : func_(BASE_NS::move(func)){};
+
+    void operator()() override
+    {
+        func_();
+    }
+
+protected:
+    void Destroy() override
+    {
+        delete this;
+    }
+
+private:
+    Fn func_;
+};
+
+template <typename Fn>
+inline IThreadPool::ITask::Ptr CreateFunctionTask(Fn&& func)
+{
+    return IThreadPool::ITask::Ptr{new FunctionTask<Fn>(BASE_NS::move(func))};
+}
+
+// Runs func(index) for all the indices, in batches on a temporary thread pool when there's enough work. The render
+// thread pool isn't available yet when the shader libraries are loaded.
+template <typename Fn>
+void ParallelFor(const size_t count, const Fn& func)
+{
+    constexpr size_t MIN_FILES_PER_THREAD{4U};
+    constexpr size_t BATCHES_PER_THREAD{4U};
+    const auto factory = GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY);
+    const size_t threadCount =
+        factory ? std::min(static_cast<size_t>(factory->GetNumberOfCores()), count / MIN_FILES_PER_THREAD) : 0U;
+    if (threadCount <= 1U) {
+        for (size_t index = 0; index < count; ++index) {
+            func(index);
+        }
+        return;
+    }
+    IThreadPool::Ptr threadPool = factory->CreateThreadPool(static_cast<uint32_t>(threadCount));
+    const size_t batchCount = std::min(count, threadCount * BATCHES_PER_THREAD);
+    vector<IThreadPool::IResult::Ptr> results;
+    results.reserve(batchCount);
+    for (size_t batch = 0; batch < batchCount; ++batch) {
+        const size_t begin = (count * batch) / batchCount;
+        const size_t end = (count * (batch + 1U)) / batchCount;
+        results.push_back(threadPool->Push(CreateFunctionTask([&func, begin, end]() {
+            for (size_t index = begin; index < end; ++index) {
+                func(index);
+            }
+        })));
+    }
+    for (const auto& result : results) {
+        result->Wait();
+    }
+}
 }  // namespace
 
 ShaderLoader::ShaderLoader(IFileManager& fileManager, ShaderManager& shaderManager, const DeviceBackendType type)
@@ -131,7 +198,20 @@ void ShaderLoader::Load(const ShaderManager::ShaderFilePathDesc& desc)
     if (!desc.shaderPath.empty()) {
         auto const shadersPath = fileManager_.OpenDirectory(desc.shaderPath);
         if (shadersPath) {
-            RecurseDirectory(desc.shaderPath, *shadersPath);
+            vector<string> shaderFiles;
+            ShaderBundle bundle;
+            if (bundle.Load(fileManager_, desc.shaderPath + ShaderBundle::FILENAME)) {
+                for (size_t index = 0; index < bundle.GetFileCount(); ++index) {
+                    const string_view name = bundle.GetName(index);
+                    if (HasExtension(ShaderDataFileExtensions[ShaderDataFileType::SHADER].data(), name)) {
+                        shaderFiles.push_back(desc.shaderPath + name);
+                    }
+                }
+                LoadShaders(shaderFiles, {desc.shaderPath, &bundle});
+            } else {
+                RecurseDirectory(desc.shaderPath, *shadersPath, shaderFiles);
+                LoadShaders(shaderFiles, {});
+            }
         } else {
             PLUGIN_LOG_W("shader path (%s) not found.", desc.shaderPath.data());
         }
@@ -179,42 +259,7 @@ void ShaderLoader::HandleShaderFile(
         if (result.success) {
             auto const handle = CreateShader(loader, forceReload);
 #if (RENDER_DEV_ENABLED == 1)
-            const auto shaderVariants = loader.GetShaderVariants();
-            for (const auto& shaderVariant : shaderVariants) {
-                // Dev related book-keeping for reloading of spv files
-                auto const handleType = handle.GetHandleType();
-                string compShader{};
-                string vertShader{};
-                string fragShader{};
-                for (const auto& spvInfo : shaderVariant.shaders) {
-                    switch (spvInfo.shaderType) {
-                        case CORE_SHADER_STAGE_COMPUTE_BIT:
-                            compShader = spvInfo.shaderSpvPath;
-                            break;
-                        case CORE_SHADER_STAGE_FRAGMENT_BIT:
-                            fragShader = spvInfo.shaderSpvPath;
-                            break;
-                        case CORE_SHADER_STAGE_VERTEX_BIT:
-                            vertShader = spvInfo.shaderSpvPath;
-                            break;
-                        default:
-                            break;
-                    }
-                }
-                if ((!compShader.empty()) && (handleType == RenderHandleType::COMPUTE_SHADER_STATE_OBJECT)) {
-                    auto& ref = fileToShaderNames_[move(compShader)];
-                    ref.shaderStageFlags = ShaderStageFlagBits::CORE_SHADER_STAGE_COMPUTE_BIT;
-                    ref.shaderNames.emplace_back(fullFileName);
-                } else if ((!vertShader.empty()) && (!fragShader.empty()) &&
-                           (handleType == RenderHandleType::SHADER_STATE_OBJECT)) {
-                    auto& refVert = fileToShaderNames_[move(vertShader)];
-                    refVert.shaderStageFlags = ShaderStageFlagBits::CORE_SHADER_STAGE_VERTEX_BIT;
-                    refVert.shaderNames.emplace_back(fullFileName);
-                    auto& refFrag = fileToShaderNames_[move(fragShader)];
-                    refFrag.shaderStageFlags = ShaderStageFlagBits::CORE_SHADER_STAGE_FRAGMENT_BIT;
-                    refFrag.shaderNames.emplace_back(fullFileName);
-                }
-            }
+            StoreShaderFileNames(fullFileName, loader, handle);
 #endif
         } else {
             PLUGIN_LOG_E("unable to load shader json %s : %s", fullFileName.data(), result.error.c_str());
@@ -222,6 +267,49 @@ void ShaderLoader::HandleShaderFile(
     }
 }
 
+#if (RENDER_DEV_ENABLED == 1)
+void ShaderLoader::StoreShaderFileNames(
+    const string_view fullFileName, const ShaderDataLoader& loader, const RenderHandleReference& handle)
+{
+    const auto shaderVariants = loader.GetShaderVariants();
+    for (const auto& shaderVariant : shaderVariants) {
+        // Dev related book-keeping for reloading of spv files
+        auto const handleType = handle.GetHandleType();
+        string compShader{};
+        string vertShader{};
+        string fragShader{};
+        for (const auto& spvInfo : shaderVariant.shaders) {
+            switch (spvInfo.shaderType) {
+                case CORE_SHADER_STAGE_COMPUTE_BIT:
+                    compShader = spvInfo.shaderSpvPath;
+                    break;
+                case CORE_SHADER_STAGE_FRAGMENT_BIT:
+                    fragShader = spvInfo.shaderSpvPath;
+                    break;
+                case CORE_SHADER_STAGE_VERTEX_BIT:
+                    vertShader = spvInfo.shaderSpvPath;
+                    break;
+                default:
+                    break;
+            }
+        }
+        if ((!compShader.empty()) && (handleType == RenderHandleType::COMPUTE_SHADER_STATE_OBJECT)) {
+            auto& ref = fileToShaderNames_[move(compShader)];
+            ref.shaderStageFlags = ShaderStageFlagBits::CORE_SHADER_STAGE_COMPUTE_BIT;
+            ref.shaderNames.emplace_back(fullFileName);
+        } else if ((!vertShader.empty()) && (!fragShader.empty()) &&
+                   (handleType == RenderHandleType::SHADER_STATE_OBJECT)) {
+            auto& refVert = fileToShaderNames_[move(vertShader)];
+            refVert.shaderStageFlags = ShaderStageFlagBits::CORE_SHADER_STAGE_VERTEX_BIT;
+            refVert.shaderNames.emplace_back(fullFileName);
+            auto& refFrag = fileToShaderNames_[move(fragShader)];
+            refFrag.shaderStageFlags = ShaderStageFlagBits::CORE_SHADER_STAGE_FRAGMENT_BIT;
+            refFrag.shaderNames.emplace_back(fullFileName);
+        }
+    }
+}
+#endif
+
 void ShaderLoader::HandleShaderStateFile(const string_view fullFileName, const IDirectory::Entry& entry)
 {
     if (HasExtension(ShaderDataFileExtensions[ShaderDataFileType::SHADER_STATE].data(), entry.name)) {
@@ -271,7 +359,7 @@ void ShaderLoader::HandleVertexInputDeclarationFile(const string_view fullFileNa
     }
 }
 
-void ShaderLoader::RecurseDirectory(const string_view currentPath, const IDirectory& directory)
+void ShaderLoader::RecurseDirectory(const string_view currentPath, const IDirectory& directory, vector<string>& uris)
 {
     for (auto const& entry : directory.GetEntries()) {
         switch (entry.type) {
@@ -279,9 +367,8 @@ void ShaderLoader::RecurseDirectory(const string_view currentPath, const IDirect
             case IDirectory::Entry::Type::UNKNOWN:
                 break;
             case IDirectory::Entry::Type::FILE: {
-                // does not force the shader module re-creations
                 if (HasExtension(ShaderDataFileExtensions[ShaderDataFileType::SHADER].data(), entry.name)) {
-                    HandleShaderFile(currentPath + entry.name, entry, false);
+                    uris.push_back(currentPath + entry.name);
                 }
                 break;
             }
@@ -292,7 +379,7 @@ void ShaderLoader::RecurseDirectory(const string_view currentPath, const IDirect
                 auto nextDirectory = currentPath + entry.name + '/';
                 auto dir = fileManager_.OpenDirectory(nextDirectory);
                 if (dir) {
-                    RecurseDirectory(nextDirectory, *dir);
+                    RecurseDirectory(nextDirectory, *dir, uris);
                 }
                 break;
             }
@@ -300,25 +387,107 @@ void ShaderLoader::RecurseDirectory(const string_view currentPath, const IDirect
     }
 }
 
-ShaderLoader::ShaderFile ShaderLoader::LoadShaderFile(const string_view shader, const ShaderStageFlags stageBits)
+array_view<const uint8_t> ShaderLoader::BundleFiles::Find(const string_view uri) const
+{
+    if (bundle && uri.starts_with(root)) {
+        return bundle->Find(uri.substr(root.size()));
+    }
+    return {};
+}
+
+void ShaderLoader::LoadShaders(const array_view<const string> uris, const BundleFiles& bundle)
+{
+    // parse the shader jsons
+    struct ParsedShader {
+        ShaderDataLoader loader;
+        ShaderDataLoader::LoadResult result;
+    };
+    vector<ParsedShader> shaders(uris.size());
+    ParallelFor(uris.size(), [this, &uris, &bundle, &shaders](const size_t index) {
+        auto& shader = shaders[index];
+        if (const auto data = bundle.Find(uris[index]); !data.empty()) {
+            shader.result =
+                shader.loader.Load(uris[index], string(reinterpret_cast<const char*>(data.data()), data.size()));
+        } else {
+            shader.result = shader.loader.Load(fileManager_, uris[index]);
+        }
+    });
+
+    // read the shader modules which are not created yet, each only once
+    struct ShaderModuleFile {
+        string_view uri;
+        ShaderStageFlags stageBits;
+        ShaderFile file;
+    };
+    vector<ShaderModuleFile> files;
+    {
+        unordered_map<string_view, bool> added;
+        for (const auto& shader : shaders) {
+            if (!shader.result.success) {
+                continue;
+            }
+            for (const auto& variant : shader.loader.GetShaderVariants()) {
+                for (const auto& spvInfo : variant.shaders) {
+                    const string_view uri = spvInfo.shaderSpvPath;
+                    if (!uri.empty() && (shaderMgr_.GetShaderModuleIndex(uri) == INVALID_SM_INDEX) &&
+                        added.insert({uri, true}).second) {
+                        files.push_back({uri, spvInfo.shaderType, {}});
+                    }
+                }
+            }
+        }
+    }
+    ParallelFor(files.size(), [this, &bundle, &files](const size_t index) {
+        files[index].file = LoadShaderFile(files[index].uri, files[index].stageBits, bundle);
+    });
+    for (auto& file : files) {
+        if (!file.file.info.spvData.empty()) {
+            // the views in info stay valid as the vectors' buffers are moved along
+            shaderFiles_.insert_or_assign(file.uri, move(file.file));
+        }
+    }
+
+    // registration to the shader manager in the original order, does not force the shader module re-creations
+    for (size_t index = 0; index < shaders.size(); ++index) {
+        const auto& shader = shaders[index];
+        if (shader.result.success) {
+            auto const handle = CreateShader(shader.loader, false);
+#if (RENDER_DEV_ENABLED == 1)
+            StoreShaderFileNames(uris[index], shader.loader, handle);
+#endif
+        } else {
+            PLUGIN_LOG_E("unable to load shader json %s : %s", uris[index].data(), shader.result.error.c_str());
+        }
+    }
+    shaderFiles_.clear();
+}
+
+ShaderLoader::ShaderFile ShaderLoader::LoadShaderFile(
+    const string_view shader, const ShaderStageFlags stageBits, const BundleFiles& bundle) const
 {
     ShaderLoader::ShaderFile info;
-    IFile::Ptr shaderFile;
+    string shaderUri;
     switch (type_) {
         case DeviceBackendType::VULKAN:
         case DeviceBackendType::MALEOON:
-            shaderFile = fileManager_.OpenFile(shader);
+        case DeviceBackendType::HEADLESS:
+            shaderUri = shader;
             break;
         case DeviceBackendType::OPENGLES:
-            shaderFile = fileManager_.OpenFile(shader + ".gles");
+            shaderUri = shader + ".gles";
             break;
         case DeviceBackendType::OPENGL:
-            shaderFile = fileManager_.OpenFile(shader + ".gl");
+            shaderUri = shader + ".gl";
             break;
         default:
             break;
     }
-    if (shaderFile) {
+    if (shaderUri.empty()) {
+        PLUGIN_LOG_E("shader file not found (%s)", shader.data());
+    } else if (const auto data = bundle.Find(shaderUri); !data.empty()) {
+        // used in place from the bundle
+        info.info = {stageBits, data, ShaderReflectionData{bundle.Find(shader + ".lsb")}};
+    } else if (IFile::Ptr shaderFile = fileManager_.OpenFile(shaderUri); shaderFile) {
         info.data = ReadFile(*shaderFile, shader);
 
         if (IFile::Ptr reflectionFile = fileManager_.OpenFile(shader + ".lsb"); reflectionFile) {
@@ -331,6 +500,23 @@ ShaderLoader::ShaderFile ShaderLoader::LoadShaderFile(const string_view shader,
     return info;
 }
 
+uint32_t ShaderLoader::CreateShaderModule(
+    const string_view shader, const ShaderStageFlags stageBits, const bool forceReload)
+{
+    uint32_t index = (forceReload) ? INVALID_SM_INDEX : shaderMgr_.GetShaderModuleIndex(shader);
+    if (index == INVALID_SM_INDEX) {
+        if (const auto pos = shaderFiles_.find(shader); pos != shaderFiles_.end()) {
+            index = shaderMgr_.CreateShaderModule(shader, pos->second.info);
+        } else {
+            const auto shaderFile = LoadShaderFile(shader, stageBits, {});
+            if (!shaderFile.info.spvData.empty()) {
+                index = shaderMgr_.CreateShaderModule(shader, shaderFile.info);
+            }
+        }
+    }
+    return index;
+}
+
 RenderHandleReference ShaderLoader::CreateComputeShader(const ShaderDataLoader& dataLoader, const bool forceReload)
 {
     RenderHandleReference firstShaderVariantRhr;
@@ -349,18 +535,8 @@ RenderHandleReference ShaderLoader::CreateComputeShader(const ShaderDataLoader&
             }
         }
 
-        uint32_t index = INVALID_SM_INDEX;
-        if (!forceReload) {
-            index = shaderMgr_.GetShaderModuleIndex(computeShader);
-        }
-        if (index == INVALID_SM_INDEX) {
-            const auto shaderFile = LoadShaderFile(computeShader, ShaderStageFlagBits::CORE_SHADER_STAGE_COMPUTE_BIT);
-            if (!shaderFile.data.empty()) {
-                index = shaderMgr_.CreateShaderModule(computeShader, shaderFile.info);
-            } else {
-                PLUGIN_LOG_E("shader file not found (%s)", computeShader.data());
-            }
-        }
+        const uint32_t index =
+            CreateShaderModule(computeShader, ShaderStageFlagBits::CORE_SHADER_STAGE_COMPUTE_BIT, forceReload);
         if (index != INVALID_SM_INDEX) {
             const string_view uri = dataLoader.GetUri();
             const string_view baseCategory = dataLoader.GetBaseCategory();
@@ -428,20 +604,10 @@ RenderHandleReference ShaderLoader::CreateGraphicsShader(const ShaderDataLoader&
             }
         }
 
-        uint32_t vertIndex = (forceReload) ? INVALID_SM_INDEX : shaderMgr_.GetShaderModuleIndex(vertexShader);
-        if (vertIndex == INVALID_SM_INDEX) {
-            const auto shaderFile = LoadShaderFile(vertexShader, ShaderStageFlagBits::CORE_SHADER_STAGE_VERTEX_BIT);
-            if (!shaderFile.data.empty()) {
-                vertIndex = shaderMgr_.CreateShaderModule(vertexShader, shaderFile.info);
-            }
-        }
-        uint32_t fragIndex = (forceReload) ? INVALID_SM_INDEX : shaderMgr_.GetShaderModuleIndex(fragmentShader);
-        if (fragIndex == INVALID_SM_INDEX) {
-            const auto shaderFile = LoadShaderFile(fragmentShader, ShaderStageFlagBits::CORE_SHADER_STAGE_FRAGMENT_BIT);
-            if (!shaderFile.data.empty()) {
-                fragIndex = shaderMgr_.CreateShaderModule(fragmentShader, shaderFile.info);
-            }
-        }
+        const uint32_t vertIndex =
+            CreateShaderModule(vertexShader, ShaderStageFlagBits::CORE_SHADER_STAGE_VERTEX_BIT, forceReload);
+        const uint32_t fragIndex =
+            CreateShaderModule(fragmentShader, ShaderStageFlagBits::CORE_SHADER_STAGE_FRAGMENT_BIT, forceReload);
         if ((vertIndex != INVALID_SM_INDEX) && (fragIndex != INVALID_SM_INDEX)) {
             const string_view uri = dataLoader.GetUri();
             // creating the default graphics state with full name
@@ -29,6 +29,7 @@
 #include <render/resource_handle.h>
 
 #include "device/shader_manager.h"
+#include "loader/shader_bundle.h"
 #include "loader/shader_data_loader.h"
 #include "loader/shader_state_loader.h"
 
@@ -55,7 +56,10 @@ public:
     /** Destructor. */
     ~ShaderLoader() = default;
 
-    /** Looks for json files with given paths, parses them, and loads the listed shaders. */
+    /** Looks for json files with given paths, parses them, and loads the listed shaders. If the shader path has a
+     * shader bundle (ShaderBundle::FILENAME) the shaders are read from the bundle instead. Shader files are parsed and
+     * read in parallel, only the registration to the shader manager is serial.
+     */
     void Load(const ShaderManager::ShaderFilePathDesc& desc);
 
     /** Looks for json files with given path, parses them, and loads the listed data. */
@@ -66,13 +70,23 @@ private:
     void HandleShaderStateFile(BASE_NS::string_view currentPath, const CORE_NS::IDirectory::Entry& entry);
     void HandlePipelineLayoutFile(BASE_NS::string_view currentPath, const CORE_NS::IDirectory::Entry& entry);
     void HandleVertexInputDeclarationFile(BASE_NS::string_view currentPath, const CORE_NS::IDirectory::Entry& entry);
-    void RecurseDirectory(BASE_NS::string_view currentPath, const CORE_NS::IDirectory& directory);
+    void RecurseDirectory(
+        BASE_NS::string_view currentPath, const CORE_NS::IDirectory& directory, BASE_NS::vector<BASE_NS::string>& uris);
     struct ShaderFile {
         BASE_NS::vector<uint8_t> data;
         BASE_NS::vector<uint8_t> reflectionData;
         ShaderModuleCreateInfo info;
     };
-    ShaderFile LoadShaderFile(BASE_NS::string_view shader, ShaderStageFlags stageBits);
+    // Files of a shader bundle, uris starting with root are looked up from the bundle.
+    struct BundleFiles {
+        BASE_NS::string_view root;
+        const ShaderBundle* bundle{nullptr};
+
+        BASE_NS::array_view<const uint8_t> Find(BASE_NS::string_view uri) const;
+    };
+    void LoadShaders(BASE_NS::array_view<const BASE_NS::string> uris, const BundleFiles& bundle);
+    ShaderFile LoadShaderFile(BASE_NS::string_view shader, ShaderStageFlags stageBits, const BundleFiles& bundle) const;
+    uint32_t CreateShaderModule(BASE_NS::string_view shader, ShaderStageFlags stageBits, bool forceReload);
     RenderHandleReference CreateComputeShader(const ShaderDataLoader& dataLoader, bool forceReload);
     RenderHandleReference CreateGraphicsShader(const ShaderDataLoader& dataLoader, bool forceReload);
     RenderHandleReference CreateShader(const ShaderDataLoader& dataLoader, bool forceReload);
@@ -92,6 +106,9 @@ private:
     ShaderManager& shaderMgr_;
     DeviceBackendType type_;
 
+    // Shader files read ahead by LoadShaders, consumed when the shader modules are created.
+    BASE_NS::unordered_map<BASE_NS::string, ShaderFile> shaderFiles_;
+
     struct ShaderModuleShaders {
         ShaderStageFlags shaderStageFlags{0u};
         BASE_NS::vector<BASE_NS::string> shaderNames;
@@ -100,6 +117,9 @@ private:
     // Maps shader source file to shader resource names which use the shader.
     // For book-keeping in dev mode for spv reloading.
     BASE_NS::unordered_map<BASE_NS::string, ShaderModuleShaders> fileToShaderNames_;
+
+    void StoreShaderFileNames(
+        BASE_NS::string_view fullFileName, const ShaderDataLoader& loader, const RenderHandleReference& handle);
 #endif
 };
 RENDER_END_NAMESPACE()
@@ -108,6 +108,12 @@ inline bool IsValidHandle(const BindableImage& img)
 {
     return RenderHandleUtil::IsValid(img.handle);
 }
+
+// Vulkan and headless sample a single image layer directly, other backends copy the layer first.
+inline bool NeedsLayerCopy(const DeviceBackendType backendType)
+{
+    return (backendType != DeviceBackendType::VULKAN) && (backendType != DeviceBackendType::HEADLESS);
+}
 }  // namespace
 
 void RenderNodePostProcessUtil::Init(
@@ -218,7 +224,7 @@ void RenderNodePostProcessUtil::Init(
 
     ProcessPostProcessConfiguration();
 
-    if (deviceBackendType_ != DeviceBackendType::VULKAN) {
+    if (NeedsLayerCopy(deviceBackendType_)) {
         // prepare for possible layer copy
         renderCopyLayer_.Init(renderNodeContextMgr);
     }
@@ -322,7 +328,7 @@ void RenderNodePostProcessUtil::PreExecute(const IRenderNodePostProcessUtil::Pos
 
     // prepare for possible layer copy
     glOptimizedLayerCopyEnabled_ = false;
-    if ((deviceBackendType_ != DeviceBackendType::VULKAN) &&
+    if (NeedsLayerCopy(deviceBackendType_) &&
         (images_.input.layer != PipelineStateConstants::GPU_IMAGE_ALL_LAYERS)) {
         if ((ppConfig_.enableFlags & GL_LAYER_CANNOT_OPT_FLAGS) == 0U) {
             // optimize with combine
@@ -563,7 +569,7 @@ void RenderNodePostProcessUtil::Execute(IRenderCommandList& cmdList)
 
     // prepare for possible layer copy if not using optimized paths for layers
     BindableImage currentInput = images_.input;
-    if ((deviceBackendType_ != DeviceBackendType::VULKAN) &&
+    if (NeedsLayerCopy(deviceBackendType_) &&
         (images_.input.layer != PipelineStateConstants::GPU_IMAGE_ALL_LAYERS) && (!glOptimizedLayerCopyEnabled_)) {
         BindableImage layerCopyOutput;
         layerCopyOutput.handle = ti_.layerCopyImage.GetHandle();
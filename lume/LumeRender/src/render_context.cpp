@@ -58,6 +58,10 @@
 #include "maleoon/device_mln.h"
 #endif
 
+#if RENDER_HAS_HEADLESS_BACKEND
+#include "headless/device_headless.h"
+#endif
+
 #include <algorithm>
 
 using namespace BASE_NS;
@@ -683,6 +687,12 @@ unique_ptr<Device> RenderContext::CreateDevice(const RenderCreateInfo& createInf
             return CreateDeviceMln(*this);
 #else
             return nullptr;
+#endif
+        case DeviceBackendType::HEADLESS:
+#if (RENDER_HAS_HEADLESS_BACKEND)
+            return CreateDeviceHeadless(*this);
+#else
+            return nullptr;
 #endif
         default:
             break;
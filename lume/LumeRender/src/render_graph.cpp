@@ -15,11 +15,13 @@
 
 #include "render_graph.h"
 
+#include <algorithm>
 #include <cinttypes>
 
 #include <base/containers/array_view.h>
 #include <base/containers/fixed_string.h>
 #include <base/math/mathf.h>
+#include <core/threading/intf_thread_pool.h>
 #include <render/namespace.h>
 
 #include "device/device.h"
@@ -31,10 +33,40 @@
 #include "util/log.h"
 
 using namespace BASE_NS;
+using namespace CORE_NS;
 
 RENDER_BEGIN_NAMESPACE()
 namespace {
 constexpr uint32_t INVALID_TRACK_IDX{~0u};
+// render nodes per task when gathering descriptor set resources in parallel
+constexpr uint32_t DESCRIPTOR_RESOURCE_NODES_PER_TASK{4U};
+
+// Helper class for running lambda as a ThreadPool task.
+template <typename Fn>
+class FunctionTask final : public IThreadPool::ITask {
+public:
+    explicit FunctionTask(Fn&& func) : func_(BASE_NS::move(func)){};
+
+    void operator()() override
+    {
+        func_();
+    }
+
+protected:
+    void Destroy() override
+    {
+        delete this;
+    }
+
+private:
+    Fn func_;
+};
+
+template <typename Fn>
+inline IThreadPool::ITask::Ptr CreateFunctionTask(Fn&& func)
+{
+    return IThreadPool::ITask::Ptr{new FunctionTask<Fn>(BASE_NS::move(func))};
+}
 
 #if (RENDER_DEV_ENABLED == 1)
 constexpr const bool CORE_RENDER_GRAPH_FULL_DEBUG_PRINT = false;
@@ -342,9 +374,10 @@ void UpdateMultiRenderCommandListRenderPasses(Device& device, RenderGraph::Multi
         }
 #endif
     }
-    // NOTE: only use merge subpasses in vulkan at the moment
+    // NOTE: only use merge subpasses in vulkan at the moment, headless follows vulkan to measure the same work
     if ((device.GetBackendType() != DeviceBackendType::VULKAN) &&
-        (device.GetBackendType() != DeviceBackendType::MALEOON)) {
+        (device.GetBackendType() != DeviceBackendType::MALEOON) &&
+        (device.GetBackendType() != DeviceBackendType::HEADLESS)) {
         mergeSubpasses = false;
     }
 
@@ -616,6 +649,15 @@ CommandBarrier GetQueueOwnershipTransferBarrier(const RenderGraph::GpuQueueTrans
     };
 }
 
+// barrier points of these commands have dedicated handling, others get their barriers from descriptor sets
+bool HasDescriptorSetBarriers(const RenderCommandType type)
+{
+    return (type != RenderCommandType::CLEAR_COLOR_IMAGE) && (type != RenderCommandType::BLIT_IMAGE) &&
+           (type != RenderCommandType::COPY_BUFFER) && (type != RenderCommandType::COPY_BUFFER_IMAGE) &&
+           (type != RenderCommandType::COPY_IMAGE) && (type != RenderCommandType::BUILD_ACCELERATION_STRUCTURE) &&
+           (type != RenderCommandType::COPY_ACCELERATION_STRUCTURE_INSTANCES);
+}
+
 bool CheckForBarrierNeed(const unordered_map<RenderHandle, uint32_t>& handledCustomBarriers,
     const uint32_t customBarrierCount, const RenderHandle handle)
 {
@@ -679,8 +721,8 @@ void RenderGraph::BeginFrame()
     stateCache_.usesSwapchainImage = false;
 }
 
-void RenderGraph::ProcessRenderNodeGraph(
-    const bool checkBackbufferDependancy, const array_view<RenderNodeGraphNodeStore*> renderNodeGraphNodeStores)
+void RenderGraph::ProcessRenderNodeGraph(const bool checkBackbufferDependancy,
+    const array_view<RenderNodeGraphNodeStore*> renderNodeGraphNodeStores, ITaskQueue* queue)
 {
     stateCache_.checkForBackbufferDependency = checkBackbufferDependancy;
 
@@ -727,6 +769,12 @@ void RenderGraph::ProcessRenderNodeGraph(
     }
 #endif
 
+    // local pass: gather the dynamic descriptor set resources of every render node and resolve the barriers of the
+    // resources whose state is known within the render node (parallel if queue given)
+    CollectNodeDescriptorResources(renderNodeGraphNodeStores, queue);
+
+    // serial pass: track resource states over render nodes, create the barriers which depend on the previous render
+    // nodes, and merge the local render node end states
     // need to store some of the resource for frame state in undefined state (i.e. reset on frame boundaries)
     ProcessRenderNodeGraphNodeStores(renderNodeGraphNodeStores, stateCache_);
 
@@ -783,6 +831,7 @@ void RenderGraph::ProcessRenderNodeGraphNodeStores(
             array_view<const RenderCommandWithType> cmdListRef = ref.renderCommandList->GetRenderCommands();
             // go through commands that affect or need transitions and barriers
             ProcessRenderNodeCommands(cmdListRef, nodeIdx, ref, stateCache);
+            MergeLocalResourceStates(stateCache.nodeCounter, nodeIdx);
 
             // needs backbuffer/swapchain wait
             if (stateCache.usesSwapchainImage) {
@@ -800,6 +849,357 @@ void RenderGraph::ProcessRenderNodeGraphNodeStores(
     }
 }
 
+void RenderGraph::CollectNodeDescriptorResources(
+    const array_view<RenderNodeGraphNodeStore*>& renderNodeGraphNodeStores, ITaskQueue* queue)
+{
+    // same order as the serial processing, i.e. node counter order
+    nodeDescriptorResourceNodes_.clear();
+    nodeDescriptorResourceBase_ = stateCache_.nodeCounter;
+    for (const RenderNodeGraphNodeStore* graphStore : renderNodeGraphNodeStores) {
+        if (!graphStore) {
+            continue;
+        }
+        for (const auto& ref : graphStore->renderNodeContextData) {
+            nodeDescriptorResourceNodes_.push_back(&ref);
+        }
+    }
+    const auto nodeCount = static_cast<uint32_t>(nodeDescriptorResourceNodes_.size());
+    if (nodeDescriptorResourceNodes_.size() > nodeDescriptorResources_.size()) {
+        nodeDescriptorResources_.resize(nodeDescriptorResourceNodes_.size());
+    }
+
+    const uint32_t taskCount =
+        (nodeCount + DESCRIPTOR_RESOURCE_NODES_PER_TASK - 1U) / DESCRIPTOR_RESOURCE_NODES_PER_TASK;
+    if ((!queue) || (taskCount <= 1U)) {
+        for (uint32_t nodeIdx = 0U; nodeIdx < nodeCount; ++nodeIdx) {
+            CollectNodeResources(*nodeDescriptorResourceNodes_[nodeIdx], nodeDescriptorResources_[nodeIdx]);
+        }
+        return;
+    }
+
+    // every task writes only to its own render node range
+    uint64_t taskId = 0;
+    for (uint32_t taskIdx = 0U; taskIdx < taskCount; ++taskIdx) {
+        const uint32_t beginIdx = taskIdx * DESCRIPTOR_RESOURCE_NODES_PER_TASK;
+        const uint32_t endIdx = Math::min(beginIdx + DESCRIPTOR_RESOURCE_NODES_PER_TASK, nodeCount);
+        queue->Submit(taskId++, CreateFunctionTask([this, beginIdx, endIdx]() {
+            for (uint32_t nodeIdx = beginIdx; nodeIdx < endIdx; ++nodeIdx) {
+                CollectNodeResources(*nodeDescriptorResourceNodes_[nodeIdx], nodeDescriptorResources_[nodeIdx]);
+            }
+        }));
+    }
+    queue->Execute();
+    queue->Clear();
+}
+
+void RenderGraph::CollectNodeResources(const RenderNodeContextData& nodeData, NodeDescriptorResources& resources) const
+{
+    CollectDescriptorResources(nodeData, resources);
+    ResolveLocalResourceStates(nodeData, resources);
+}
+
+void RenderGraph::CollectDescriptorResources(const RenderNodeContextData& nodeData, NodeDescriptorResources& resources)
+{
+    resources.resources.clear();
+    resources.barrierPoints.clear();
+    resources.barrierPointCursor = 0U;
+    if ((!nodeData.renderCommandList) || (!nodeData.nodeContextDescriptorSetMgr)) {
+        return;
+    }
+
+    const auto& nodeDescriptorSetMgrRef = *nodeData.nodeContextDescriptorSetMgr;
+    const auto cmdListRef = nodeData.renderCommandList->GetRenderCommands();
+    const auto allDescriptorSetHandlesForBarriers = nodeData.renderCommandList->GetDescriptorSetHandles();
+    const auto descriptorSetHandleCount = static_cast<uint32_t>(allDescriptorSetHandlesForBarriers.size());
+    for (uint32_t listIdx = 0; listIdx < static_cast<uint32_t>(cmdListRef.size()); ++listIdx) {
+        const auto& cmdRef = cmdListRef[listIdx];
+        if (cmdRef.type != RenderCommandType::BARRIER_POINT) {
+            continue;
+        }
+        const auto& rc = *static_cast<const RenderCommandBarrierPoint*>(cmdRef.rc);
+        if (!HasDescriptorSetBarriers(rc.renderCommandType)) {
+            continue;
+        }
+        const uint32_t descriptorSetHandleBeginIndex =
+            Math::min(rc.descriptorSetHandleIndexBegin, descriptorSetHandleCount);
+        const uint32_t descriptorSetHandleMaxIndex =
+            Math::min(descriptorSetHandleBeginIndex + rc.descriptorSetHandleCount, descriptorSetHandleCount);
+        const auto resourceIndexBegin = static_cast<uint32_t>(resources.resources.size());
+        for (uint32_t idx = descriptorSetHandleBeginIndex; idx < descriptorSetHandleMaxIndex; ++idx) {
+            CollectDescriptorSetResources(
+                allDescriptorSetHandlesForBarriers[idx], nodeDescriptorSetMgrRef, resources.resources);
+        }
+        const auto resourceCount = static_cast<uint32_t>(resources.resources.size()) - resourceIndexBegin;
+        if (resourceCount > 0U) {
+            resources.barrierPoints.push_back({listIdx, resourceIndexBegin, resourceCount});
+        }
+    }
+}
+
+void RenderGraph::CollectDescriptorSetResources(const RenderHandle descriptorSetHandle,
+    const NodeContextDescriptorSetManager& nodeDescriptorSetMgrRef, vector<DescriptorResource>& resources)
+{
+    if (RenderHandleUtil::GetHandleType(descriptorSetHandle) != RenderHandleType::DESCRIPTOR_SET) {
+        return;
+    }
+
+    // NOTE: for global descriptor sets we didn't know with render command list if it had dynamic resources
+    const uint32_t additionalData = RenderHandleUtil::GetAdditionalData(descriptorSetHandle);
+    if (additionalData & NodeContextDescriptorSetManager::GLOBAL_DESCRIPTOR_BIT) {
+        if (!nodeDescriptorSetMgrRef.HasDynamicBarrierResources(descriptorSetHandle)) {
+            return;
+        }
+    }
+
+    // only dynamic resources are tracked, custom barriers are checked in the serial pass
+    const auto bindingResources = nodeDescriptorSetMgrRef.GetCpuDescriptorSetData(descriptorSetHandle);
+    const auto& buffers = bindingResources.buffers;
+    const auto& images = bindingResources.images;
+    for (const auto& refBuf : buffers) {
+        const auto& ref = refBuf.desc;
+        const uint32_t descriptorCount = ref.binding.descriptorCount;
+        // skip, array bindings which are bound from first index, they have also descriptorCount 0
+        if (descriptorCount == 0) {
+            continue;
+        }
+        const uint32_t arrayOffset = ref.arrayOffset;
+        PLUGIN_ASSERT((arrayOffset + descriptorCount - 1) <= buffers.size());
+        for (uint32_t idx = 0; idx < descriptorCount; ++idx) {
+            // first is the ref, starting from 1 we use array offsets
+            const auto& bRes = (idx == 0) ? ref : buffers[arrayOffset + idx - 1].desc;
+            // NOTE: buffer arrays are checked with the first element
+            if (RenderHandleUtil::IsDynamicResource(ref.resource.handle)) {
+                resources.push_back({ref.resource.handle, &bRes, nullptr});
+            }
+        }
+    }
+    for (const auto& refImg : images) {
+        const auto& ref = refImg.desc;
+        const uint32_t descriptorCount = ref.binding.descriptorCount;
+        // skip, array bindings which are bound from first index, they have also descriptorCount 0
+        if (descriptorCount == 0) {
+            continue;
+        }
+        const uint32_t arrayOffset = ref.arrayOffset;
+        PLUGIN_ASSERT((arrayOffset + descriptorCount - 1) <= images.size());
+        for (uint32_t idx = 0; idx < descriptorCount; ++idx) {
+            // first is the ref, starting from 1 we use array offsets
+            const auto& bRes = (idx == 0) ? ref : images[arrayOffset + idx - 1].desc;
+            if (RenderHandleUtil::IsDynamicResource(bRes.resource.handle)) {
+                resources.push_back({bRes.resource.handle, nullptr, &bRes});
+            }
+        }
+    }
+}
+
+bool RenderGraph::CollectOtherResourceIds(const RenderNodeContextData& nodeData, vector<uint64_t>& ids)
+{
+    const auto& cmdList = *nodeData.renderCommandList;
+    for (const auto& ref : cmdList.GetCustomBarriers()) {
+        ids.push_back(ref.resourceHandle.id);
+    }
+    for (const auto& ref : cmdList.GetRenderpassVertexInputBufferBarriers()) {
+        ids.push_back(ref.bufferHandle.id);
+    }
+    for (const auto& ref : cmdList.GetRenderpassIndirectBufferBarriers()) {
+        ids.push_back(ref.bufferHandle.id);
+    }
+    for (const auto& cmdRef : cmdList.GetRenderCommands()) {
+        if (cmdRef.type == RenderCommandType::BEGIN_RENDER_PASS) {
+            const auto& rc = *static_cast<const RenderCommandBeginRenderPass*>(cmdRef.rc);
+            for (uint32_t idx = 0U; idx < rc.renderPassDesc.attachmentCount; ++idx) {
+                ids.push_back(rc.renderPassDesc.attachmentHandles[idx].id);
+            }
+        } else if (cmdRef.type == RenderCommandType::DISPATCH_INDIRECT) {
+            ids.push_back(static_cast<const RenderCommandDispatchIndirect*>(cmdRef.rc)->argsHandle.id);
+        } else if (cmdRef.type == RenderCommandType::BARRIER_POINT) {
+            // clears, blits, and copies are resolved only in the serial pass
+            const auto& rc = *static_cast<const RenderCommandBarrierPoint*>(cmdRef.rc);
+            if (!HasDescriptorSetBarriers(rc.renderCommandType)) {
+                return false;
+            }
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    return true;
+}
+
+void RenderGraph::ResolveLocalResourceStates(
+    const RenderNodeContextData& nodeData, NodeDescriptorResources& resources) const
+{
+    resources.localBarriers.clear();
+    resources.localStates.clear();
+    resources.localStateIndices.clear();
+    resources.otherResourceIds.clear();
+    if (resources.resources.empty() || (!CollectOtherResourceIds(nodeData, resources.otherResourceIds))) {
+        return;
+    }
+    const auto isOtherResource = [&ids = resources.otherResourceIds](const RenderHandle handle) {
+        return std::binary_search(ids.cbegin(), ids.cend(), handle.id);
+    };
+
+    // find the resources which are only used through descriptor sets
+    for (const auto& ref : resources.resources) {
+        const RenderHandle handle = ref.buffer ? ref.buffer->resource.handle : ref.image->resource.handle;
+        const GpuQueue::QueueType queueType =
+            ref.buffer ? ref.buffer->state.gpuQueue.type : ref.image->state.gpuQueue.type;
+        uint32_t stateIdx = static_cast<uint32_t>(resources.localStates.size());
+        if (const auto iter = resources.localStateIndices.find(handle.id);
+            iter != resources.localStateIndices.cend()) {
+            stateIdx = iter->second;
+        } else {
+            resources.localStateIndices[handle.id] = stateIdx;
+            auto& localState = resources.localStates.emplace_back();
+            localState.handle = handle;
+            localState.queueType = queueType;
+            const uint32_t arrayIndex = RenderHandleUtil::GetIndexPart(handle);
+            // mip states are not resolved locally
+            localState.resolvable = RenderHandleUtil::IsDynamicResource(handle) && (!isOtherResource(handle)) &&
+                                    (ref.buffer ? (arrayIndex < gpuBufferDataIndices_.size())
+                                                : ((arrayIndex < gpuImageDataIndices_.size()) &&
+                                                      (!RenderHandleUtil::IsDynamicAdditionalStateResource(handle))));
+        }
+        auto& localState = resources.localStates[stateIdx];
+        if ((localState.queueType != queueType) || isOtherResource(ref.barrierCheckHandle)) {
+            localState.resolvable = false;
+        }
+    }
+
+    // resolve the uses after the state is known within the render node
+    const auto cmdListRef = nodeData.renderCommandList->GetRenderCommands();
+    const GpuQueue gpuQueue = nodeData.renderCommandList->GetGpuQueue();
+    for (const auto& bp : resources.barrierPoints) {
+        const RenderCommandWithType rcWithType{
+            RenderCommandType::BARRIER_POINT, cmdListRef[bp.commandListCommandIndex].rc};
+        for (uint32_t idx = bp.resourceIndexBegin; idx < (bp.resourceIndexBegin + bp.resourceCount); ++idx) {
+            auto& ref = resources.resources[idx];
+            const RenderHandle handle = ref.buffer ? ref.buffer->resource.handle : ref.image->resource.handle;
+            auto& localState = resources.localStates[resources.localStateIndices[handle.id]];
+            if (!localState.resolvable) {
+                continue;
+            }
+            if (ref.buffer) {
+                ResolveLocalBufferUse(*ref.buffer, gpuQueue, ref, localState, resources.localBarriers);
+            } else {
+                ResolveLocalImageUse(*ref.image, gpuQueue, rcWithType, ref, localState, resources.localBarriers);
+            }
+        }
+    }
+}
+
+void RenderGraph::ResolveLocalBufferUse(const BufferDescriptor& desc, const GpuQueue& gpuQueue,
+    DescriptorResource& ref, LocalResourceState& localState, vector<CommandBarrier>& localBarriers)
+{
+    const GpuResourceState& dstState = desc.state;
+    const BindableBuffer& res = desc.resource;
+    // same as UpdateStateAndCreateBarriersGpuBuffer, the first use is resolved with the tracked state
+    if (localState.known) {
+        const ResourceBarrier prevStateRb = GetSrcBufferBarrier(localState.state, res);
+        if ((prevStateRb.accessFlags & WRITE_ACCESS_FLAGS) || (dstState.accessFlags & WRITE_ACCESS_FLAGS)) {
+            ref.localBarrierIndex = static_cast<uint32_t>(localBarriers.size());
+            localBarriers.push_back(CommandBarrier{
+                res.handle, prevStateRb, dstState.gpuQueue, GetDstBufferBarrier(dstState, res), gpuQueue});
+        }
+        ref.local = true;
+        localState.hasLocalUse = true;
+    }
+    localState.state = dstState;
+    localState.buffer = res;
+    localState.known = true;
+}
+
+void RenderGraph::ResolveLocalImageUse(const ImageDescriptor& desc, const GpuQueue& gpuQueue,
+    const RenderCommandWithType& rcWithType, DescriptorResource& ref, LocalResourceState& localState,
+    vector<CommandBarrier>& localBarriers)
+{
+    const GpuResourceState& state = desc.state;
+    const BindableImage& res = desc.resource;
+    if (!localState.known) {
+        // resolved with the tracked state, a write always updates the state
+        if (state.accessFlags & WRITE_ACCESS_FLAGS) {
+            localState.state = state;
+            localState.image = res;
+            localState.prevRc = rcWithType;
+            localState.known = true;
+        }
+        return;
+    }
+    // same as UpdateStateAndCreateBarriersGpuImage without mips and queue transfers
+    const GpuResourceState prevStateForBarrier =
+        FillMissingDepthSrcState(localState.state, localState.image.imageLayout, res.handle);
+    const ResourceBarrier prevStateRb = GetSrcImageBarrier(prevStateForBarrier, localState.image);
+    const bool layoutChanged = (prevStateRb.optionalImageLayout != res.imageLayout);
+    const bool writeTarget = (prevStateRb.accessFlags & WRITE_ACCESS_FLAGS) || (state.accessFlags & WRITE_ACCESS_FLAGS);
+    const bool inputAttachment = (state.accessFlags == CORE_ACCESS_INPUT_ATTACHMENT_READ_BIT);
+    if ((layoutChanged || writeTarget) && (!inputAttachment)) {
+        ref.localBarrierIndex = static_cast<uint32_t>(localBarriers.size());
+        localBarriers.push_back(CommandBarrier{
+            res.handle, prevStateRb, localState.state.gpuQueue, GetDstImageBarrier(state, res), gpuQueue});
+        localState.state = state;
+        localState.image = res;
+        localState.prevRc = rcWithType;
+    }
+    ref.local = true;
+    localState.hasLocalUse = true;
+}
+
+RenderGraph::NodeDescriptorResources* RenderGraph::GetNodeDescriptorResources(const uint32_t nodeCounter)
+{
+    const uint32_t nodeIdx = nodeCounter - nodeDescriptorResourceBase_;
+    if ((nodeCounter < nodeDescriptorResourceBase_) || (nodeIdx >= nodeDescriptorResourceNodes_.size())) {
+        return nullptr;
+    }
+    return &nodeDescriptorResources_[nodeIdx];
+}
+
+array_view<const RenderGraph::DescriptorResource> RenderGraph::GetDescriptorResources(
+    const uint32_t nodeCounter, const uint32_t commandListCommandIndex)
+{
+    NodeDescriptorResources* node = GetNodeDescriptorResources(nodeCounter);
+    if (!node) {
+        return {};
+    }
+    // barrier points are consumed in command list order
+    auto& nodeRef = *node;
+    const auto barrierPointCount = static_cast<uint32_t>(nodeRef.barrierPoints.size());
+    while ((nodeRef.barrierPointCursor < barrierPointCount) &&
+           (nodeRef.barrierPoints[nodeRef.barrierPointCursor].commandListCommandIndex < commandListCommandIndex)) {
+        nodeRef.barrierPointCursor++;
+    }
+    if ((nodeRef.barrierPointCursor < barrierPointCount) &&
+        (nodeRef.barrierPoints[nodeRef.barrierPointCursor].commandListCommandIndex == commandListCommandIndex)) {
+        const auto& bp = nodeRef.barrierPoints[nodeRef.barrierPointCursor++];
+        return {nodeRef.resources.data() + bp.resourceIndexBegin, bp.resourceCount};
+    }
+    return {};
+}
+
+void RenderGraph::MergeLocalResourceStates(const uint32_t nodeCounter, const uint32_t renderNodeIndex)
+{
+    const NodeDescriptorResources* node = GetNodeDescriptorResources(nodeCounter);
+    if (!node) {
+        return;
+    }
+    // the uses before the local ones have been resolved in the serial pass and the render node has no other uses
+    for (const auto& ref : node->localStates) {
+        if (!ref.hasLocalUse) {
+            continue;
+        }
+        if (RenderHandleUtil::GetHandleType(ref.handle) == RenderHandleType::GPU_BUFFER) {
+            auto& stateRef = GetBufferResourceStateRef(ref.handle, ref.state.gpuQueue);
+            stateRef.state = ref.state;
+            stateRef.resource = ref.buffer;
+            stateRef.prevRenderNodeIndex = renderNodeIndex;
+        } else {
+            auto& stateRef = GetImageResourceStateRef(ref.handle, ref.state.gpuQueue);
+            stateRef.state = ref.state;
+            stateRef.resource = ref.image;
+            stateRef.prevRc = ref.prevRc;
+            stateRef.prevRenderNodeIndex = renderNodeIndex;
+        }
+    }
+}
+
 void RenderGraph::PatchGpuResourceQueueTransfers(RenderNodeGraphNodeStore* rngQueueTransferStore,
     uint32_t rngQueueTransferIdx, array_view<RenderNodeContextData> frameRenderNodeContextData)
 {
@@ -1265,8 +1665,6 @@ void RenderGraph::RenderCommand(const uint32_t renderNodeIndex, const uint32_t c
     // go through required descriptors for current upcoming event
     const auto& customBarrierListRef = nodeData.renderCommandList->GetCustomBarriers();
     const auto& cmdListRef = nodeData.renderCommandList->GetRenderCommands();
-    const auto& allDescriptorSetHandlesForBarriers = nodeData.renderCommandList->GetDescriptorSetHandles();
-    const auto& nodeDescriptorSetMgrRef = *nodeData.nodeContextDescriptorSetMgr;
 
     parameterCachePools_.combinedBarriers.clear();
     parameterCachePools_.handledCustomBarriers.clear();
@@ -1317,15 +1715,11 @@ void RenderGraph::RenderCommand(const uint32_t renderNodeIndex, const uint32_t c
         if (rc.renderCommandType == RenderCommandType::DISPATCH_INDIRECT) {
             HandleDispatchIndirect(parameters, commandListCommandIndex, cmdListRef);
         }
-        const uint32_t descriptorSetHandleBeginIndex = Math::min(
-            rc.descriptorSetHandleIndexBegin, static_cast<uint32_t>(allDescriptorSetHandlesForBarriers.size()));
-        const uint32_t descriptorSetHandleEndIndex = descriptorSetHandleBeginIndex + rc.descriptorSetHandleCount;
-        const uint32_t descriptorSetHandleMaxIndex =
-            Math::min(descriptorSetHandleEndIndex, static_cast<uint32_t>(allDescriptorSetHandlesForBarriers.size()));
-        const auto descriptorSetHandlesForBarriers =
-            array_view(allDescriptorSetHandlesForBarriers.data() + descriptorSetHandleBeginIndex,
-                allDescriptorSetHandlesForBarriers.data() + descriptorSetHandleMaxIndex);
-        HandleDescriptorSets(parameters, descriptorSetHandlesForBarriers, nodeDescriptorSetMgrRef);
+        // descriptor set resources have been gathered and partly resolved in the local pass
+        const NodeDescriptorResources* node = GetNodeDescriptorResources(stateCache.nodeCounter);
+        HandleDescriptorSetResources(parameters,
+            GetDescriptorResources(stateCache.nodeCounter, commandListCommandIndex),
+            node ? array_view<const CommandBarrier>(node->localBarriers) : array_view<const CommandBarrier>{});
     }
 
     if (!parameters.combinedBarriers.empty()) {
@@ -1911,62 +2305,25 @@ void RenderGraph::HandleDispatchIndirect(ParameterCache& params, const uint32_t&
     }
 }
 
-void RenderGraph::HandleDescriptorSets(ParameterCache& params,
-    const array_view<const RenderHandle>& descriptorSetHandlesForBarriers,
-    const NodeContextDescriptorSetManager& nodeDescriptorSetMgrRef)
+void RenderGraph::HandleDescriptorSetResources(ParameterCache& params,
+    const array_view<const DescriptorResource>& descriptorResources,
+    const array_view<const CommandBarrier>& localBarriers)
 {
-    for (const RenderHandle descriptorSetHandle : descriptorSetHandlesForBarriers) {
-        if (RenderHandleUtil::GetHandleType(descriptorSetHandle) != RenderHandleType::DESCRIPTOR_SET) {
-            continue;
-        }
-
-        // NOTE: for global descriptor sets we didn't know with render command list if it had dynamic resources
-        const uint32_t additionalData = RenderHandleUtil::GetAdditionalData(descriptorSetHandle);
-        if (additionalData & NodeContextDescriptorSetManager::GLOBAL_DESCRIPTOR_BIT) {
-            if (!nodeDescriptorSetMgrRef.HasDynamicBarrierResources(descriptorSetHandle)) {
-                continue;
-            }
-        }
-
-        const auto bindingResources = nodeDescriptorSetMgrRef.GetCpuDescriptorSetData(descriptorSetHandle);
-        const auto& buffers = bindingResources.buffers;
-        const auto& images = bindingResources.images;
-        for (const auto& refBuf : buffers) {
-            const auto& ref = refBuf.desc;
-            const uint32_t descriptorCount = ref.binding.descriptorCount;
-            // skip, array bindings which are bound from first index, they have also descriptorCount 0
-            if (descriptorCount == 0) {
-                continue;
-            }
-            const uint32_t arrayOffset = ref.arrayOffset;
-            PLUGIN_ASSERT((arrayOffset + descriptorCount - 1) <= buffers.size());
-            for (uint32_t idx = 0; idx < descriptorCount; ++idx) {
-                // first is the ref, starting from 1 we use array offsets
-                const auto& bRes = (idx == 0) ? ref : buffers[arrayOffset + idx - 1].desc;
-                if (CheckForBarrierNeed(params.handledCustomBarriers, params.customBarrierCount, ref.resource.handle)) {
-                    UpdateStateAndCreateBarriersGpuBuffer(bRes.state, bRes.resource, params);
-                }
+    for (const auto& ref : descriptorResources) {
+        if (ref.local) {
+            // the state is merged after the render node
+            if (ref.localBarrierIndex < localBarriers.size()) {
+                params.combinedBarriers.push_back(localBarriers[ref.localBarrierIndex]);
+            }
+        } else if (CheckForBarrierNeed(
+                       params.handledCustomBarriers, params.customBarrierCount, ref.barrierCheckHandle)) {
+            if (ref.buffer) {
+                UpdateStateAndCreateBarriersGpuBuffer(ref.buffer->state, ref.buffer->resource, params);
+            } else if (ref.image) {
+                UpdateStateAndCreateBarriersGpuImage(ref.image->state, ref.image->resource, params);
             }
         }
-        for (const auto& refImg : images) {
-            const auto& ref = refImg.desc;
-            const uint32_t descriptorCount = ref.binding.descriptorCount;
-            // skip, array bindings which are bound from first index, they have also descriptorCount 0
-            if (descriptorCount == 0) {
-                continue;
-            }
-            const uint32_t arrayOffset = ref.arrayOffset;
-            PLUGIN_ASSERT((arrayOffset + descriptorCount - 1) <= images.size());
-            for (uint32_t idx = 0; idx < descriptorCount; ++idx) {
-                // first is the ref, starting from 1 we use array offsets
-                const auto& bRes = (idx == 0) ? ref : images[arrayOffset + idx - 1].desc;
-                if (CheckForBarrierNeed(
-                        params.handledCustomBarriers, params.customBarrierCount, bRes.resource.handle)) {
-                    UpdateStateAndCreateBarriersGpuImage(bRes.state, bRes.resource, params);
-                }
-            }
-        }
-    }  // end for
+    }
 }
 
 void RenderGraph::UpdateStateAndCreateBarriersGpuImage(
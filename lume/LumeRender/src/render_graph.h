@@ -20,6 +20,8 @@
 
 #include <base/containers/unordered_map.h>
 #include <base/containers/vector.h>
+#include <core/namespace.h>
+#include <render/device/pipeline_layout_desc.h>
 #include <render/device/pipeline_state_desc.h>
 #include <render/namespace.h>
 #include <render/resource_handle.h>
@@ -27,6 +29,10 @@
 #include "device/gpu_resource_handle_util.h"
 #include "nodecontext/render_command_list.h"
 
+CORE_BEGIN_NAMESPACE()
+class ITaskQueue;
+CORE_END_NAMESPACE()
+
 RENDER_BEGIN_NAMESPACE()
 class Device;
 class GpuResourceManager;
@@ -53,9 +59,12 @@ public:
     /** Process all render nodes and patch needed barriers.
      * backbufferHandle Backbuffer handle for automatic backbuffer/swapchain dependency.
      * renderNodeGraphNodeStore All render node graph render nodes.
+     * queue Optional task queue for the local per render node pass. The local pass gathers the descriptor set
+     * resources and resolves the barriers of resources whose state is known within the render node. The serial pass
+     * creates the barriers which depend on the previous render nodes and merges the render node states in order.
      */
-    void ProcessRenderNodeGraph(
-        bool checkBackbufferDependancy, BASE_NS::array_view<RenderNodeGraphNodeStore*> renderNodeGraphNodeStores);
+    void ProcessRenderNodeGraph(bool checkBackbufferDependancy,
+        BASE_NS::array_view<RenderNodeGraphNodeStore*> renderNodeGraphNodeStores, CORE_NS::ITaskQueue* queue = nullptr);
 
     struct RenderGraphBufferState {
         GpuResourceState state;
@@ -126,6 +135,75 @@ private:
     };
     StateCache stateCache_;
 
+    // Dynamic descriptor set resource of a barrier point, gathered before the state tracking.
+    struct DescriptorResource {
+        // handle which is checked against the custom barriers of the barrier point
+        RenderHandle barrierCheckHandle;
+        const BufferDescriptor* buffer{nullptr};
+        const ImageDescriptor* image{nullptr};
+        // resolved in the local pass, the barrier is in the local barriers of the render node (if any)
+        bool local{false};
+        uint32_t localBarrierIndex{~0U};
+    };
+    struct BarrierPointResources {
+        uint32_t commandListCommandIndex{0U};
+        uint32_t resourceIndexBegin{0U};
+        uint32_t resourceCount{0U};
+    };
+    // State of a resource within a render node in the local pass. The state is known after the first use which always
+    // updates the tracked state (any buffer use, image write). Uses up to that are resolved in the serial pass.
+    struct LocalResourceState {
+        RenderHandle handle;
+        GpuResourceState state;
+        BindableBuffer buffer;
+        BindableImage image;
+        RenderCommandWithType prevRc;
+        GpuQueue::QueueType queueType{GpuQueue::QueueType::UNDEFINED};
+        // only used through descriptor sets with a single queue type in the render node
+        bool resolvable{true};
+        bool known{false};
+        bool hasLocalUse{false};
+    };
+    // Local (per render node) pass results. Only reads render node data and can be run in parallel.
+    struct NodeDescriptorResources {
+        BASE_NS::vector<DescriptorResource> resources;
+        BASE_NS::vector<BarrierPointResources> barrierPoints;
+        // next barrier point to be consumed by the serial pass
+        uint32_t barrierPointCursor{0U};
+
+        BASE_NS::vector<CommandBarrier> localBarriers;
+        // resources used through descriptor sets, the states with local uses are merged after the render node
+        BASE_NS::vector<LocalResourceState> localStates;
+        BASE_NS::unordered_map<uint64_t, uint32_t> localStateIndices;
+        // sorted ids of the resources which the render node uses in other ways than through descriptor sets
+        BASE_NS::vector<uint64_t> otherResourceIds;
+    };
+    // indexed with StateCache::nodeCounter, not shrunk to keep the allocations over frames
+    BASE_NS::vector<NodeDescriptorResources> nodeDescriptorResources_;
+    BASE_NS::vector<const RenderNodeContextData*> nodeDescriptorResourceNodes_;
+    // node counter value of the first collected render node
+    uint32_t nodeDescriptorResourceBase_{0U};
+
+    void CollectNodeDescriptorResources(
+        const BASE_NS::array_view<RenderNodeGraphNodeStore*>& renderNodeGraphNodeStores, CORE_NS::ITaskQueue* queue);
+    static void CollectDescriptorResources(const RenderNodeContextData& nodeData, NodeDescriptorResources& resources);
+    static void CollectDescriptorSetResources(RenderHandle descriptorSetHandle,
+        const NodeContextDescriptorSetManager& nodeDescriptorSetMgrRef,
+        BASE_NS::vector<DescriptorResource>& resources);
+    void CollectNodeResources(const RenderNodeContextData& nodeData, NodeDescriptorResources& resources) const;
+    static bool CollectOtherResourceIds(const RenderNodeContextData& nodeData, BASE_NS::vector<uint64_t>& ids);
+    void ResolveLocalResourceStates(const RenderNodeContextData& nodeData, NodeDescriptorResources& resources) const;
+    static void ResolveLocalBufferUse(const BufferDescriptor& desc, const GpuQueue& gpuQueue, DescriptorResource& ref,
+        LocalResourceState& localState, BASE_NS::vector<CommandBarrier>& localBarriers);
+    static void ResolveLocalImageUse(const ImageDescriptor& desc, const GpuQueue& gpuQueue,
+        const RenderCommandWithType& rcWithType, DescriptorResource& ref, LocalResourceState& localState,
+        BASE_NS::vector<CommandBarrier>& localBarriers);
+    NodeDescriptorResources* GetNodeDescriptorResources(uint32_t nodeCounter);
+    BASE_NS::array_view<const DescriptorResource> GetDescriptorResources(
+        uint32_t nodeCounter, uint32_t commandListCommandIndex);
+    // stores the render node end states of the resources resolved in the local pass
+    void MergeLocalResourceStates(uint32_t nodeCounter, uint32_t renderNodeIndex);
+
     struct BeginRenderPassParameters {
         RenderCommandBeginRenderPass& rc;
         StateCache& stateCache;
@@ -205,9 +283,9 @@ private:
     void HandleCopyAccelerationStructureInstances(ParameterCache& params, const uint32_t& commandListCommandIndex,
         const BASE_NS::array_view<const RenderCommandWithType>& cmdListRef);
 
-    void HandleDescriptorSets(ParameterCache& params,
-        const BASE_NS::array_view<const RenderHandle>& descriptorSetHandlesForBarriers,
-        const NodeContextDescriptorSetManager& nodeDescriptorSetMgrRef);
+    void HandleDescriptorSetResources(ParameterCache& params,
+        const BASE_NS::array_view<const DescriptorResource>& descriptorResources,
+        const BASE_NS::array_view<const CommandBarrier>& localBarriers);
 
     void UpdateStateAndCreateBarriersGpuImage(
         const GpuResourceState& resourceState, const BindableImage& res, RenderGraph::ParameterCache& params);
@@ -273,11 +273,11 @@ inline bool WaitForFence(const Device& device, RenderFrameSync& renderFrameSync)
 }
 
 // Helper for Renderer::RenderFrame
-inline void ProcessRenderNodeGraph(
-    Device& device, RenderGraph& renderGraph, array_view<RenderNodeGraphNodeStore*> graphNodeStoreView)
+inline void ProcessRenderNodeGraph(Device& device, RenderGraph& renderGraph,
+    array_view<RenderNodeGraphNodeStore*> graphNodeStoreView, ITaskQueue* queue)
 {
     RENDER_CPU_PERF_SCOPE("RenderFrame", "RenderGraph");
-    renderGraph.ProcessRenderNodeGraph(device.HasSwapchain(), graphNodeStoreView);
+    renderGraph.ProcessRenderNodeGraph(device.HasSwapchain(), graphNodeStoreView, queue);
 }
 
 // Helper for Renderer::ExecuteRenderNodes
@@ -499,6 +499,7 @@ void CreateDefaultRenderNodeGraphs(const Device& device, RenderNodeGraphManager&
     rnd.description.queue = {GpuQueue::QueueType::GRAPHICS, 0u};
     rngd.nodes.push_back(move(rnd));
 #if (RENDER_VULKAN_RT_ENABLED == 1)
+    // headless has no acceleration structures
     if (device.GetBackendType() == DeviceBackendType::VULKAN ||
         device.GetBackendType() == DeviceBackendType::MALEOON) {
         rnd.typeName = "CORE_RN_DEFAULT_ACCELERATION_STRUCTURE_STAGING";
@@ -769,7 +770,9 @@ void Renderer::RenderFrameImpl(const array_view<const RenderHandle> renderNodeGr
     ExecuteRenderNodes(nodeStoresView);
 
     // render graph process for all render nodes of all render graphs
-    ProcessRenderNodeGraph(device_, *renderGraph_, nodeStoresView);
+    // NOTE: the render graph local pass only reads cpu data, and can be run in parallel with all backends
+    ProcessRenderNodeGraph(
+        device_, *renderGraph_, nodeStoresView, forceSequentialQueue_ ? nullptr : parallelQueue_.get());
 
     renderDataStoreMgr_.PostRender();
 
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#if RENDER_HAS_GL_BACKEND || RENDER_HAS_GLES_BACKEND
+#include <gles/program_binary_cache_gles.h>
+#endif  // RENDER_HAS_GL_BACKEND || RENDER_HAS_GLES_BACKEND
+
+#include "test_framework.h"
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace BASE_NS;
+using namespace RENDER_NS;
+
+#if RENDER_HAS_GL_BACKEND || RENDER_HAS_GLES_BACKEND
+namespace {
+constexpr uint64_t REVISION = 0x1234U;
+}  // namespace
+
+/**
+ * @tc.name: KeysAndRoundTrip
+ * @tc.desc: Tests that program binaries survive serialization and are found with the hashes of the program sources.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ProgramBinaryCacheGLES, KeysAndRoundTrip, testing::ext::TestSize.Level1)
+{
+    EXPECT_EQ(ProgramBinaryCacheGLES::HashSource(""), 0U);
+    EXPECT_NE(ProgramBinaryCacheGLES::HashSource("#version 320 es\n#define A 1\n"),
+        ProgramBinaryCacheGLES::HashSource("#version 320 es\n#define A 2\n"));
+    EXPECT_NE(ProgramBinaryCacheGLES::HashRevision("vendor", "renderer", "1.0"),
+        ProgramBinaryCacheGLES::HashRevision("vendor", "renderer", "1.1"));
+
+    const ProgramBinaryCacheGLES::Key graphics{
+        ProgramBinaryCacheGLES::HashSource("vert"), ProgramBinaryCacheGLES::HashSource("frag"), 0U};
+    const ProgramBinaryCacheGLES::Key compute{0U, 0U, ProgramBinaryCacheGLES::HashSource("comp")};
+    const uint8_t graphicsBinary[] = {1U, 2U, 3U, 4U, 5U};
+    const uint8_t computeBinary[] = {6U, 7U, 8U};
+
+    ProgramBinaryCacheGLES cache;
+    cache.Store(compute, 0x10U, computeBinary);
+    cache.Store(graphics, 0x20U, graphicsBinary);
+    // Empty binaries aren't stored.
+    cache.Store({1U, 2U, 3U}, 0x30U, {});
+    ASSERT_EQ(cache.GetProgramCount(), 2U);
+    const auto data = cache.Serialize(REVISION);
+
+    ProgramBinaryCacheGLES loaded;
+    ASSERT_TRUE(loaded.Deserialize(data, REVISION));
+    ASSERT_EQ(loaded.GetProgramCount(), 2U);
+    {
+        const auto binary = loaded.Find(graphics);
+        EXPECT_EQ(binary.binaryFormat, 0x20U);
+        ASSERT_EQ(binary.data.size(), sizeof(graphicsBinary));
+        EXPECT_EQ(memcmp(binary.data.data(), graphicsBinary, sizeof(graphicsBinary)), 0);
+    }
+    {
+        const auto binary = loaded.Find(compute);
+        EXPECT_EQ(binary.binaryFormat, 0x10U);
+        ASSERT_EQ(binary.data.size(), sizeof(computeBinary));
+        EXPECT_EQ(memcmp(binary.data.data(), computeBinary, sizeof(computeBinary)), 0);
+    }
+    EXPECT_TRUE(loaded.Find({graphics.vertHash, 0U, 0U}).data.empty());
+
+    // Replacing and erasing.
+    loaded.Store(graphics, 0x21U, computeBinary);
+    EXPECT_EQ(loaded.Find(graphics).binaryFormat, 0x21U);
+    EXPECT_EQ(loaded.Find(graphics).data.size(), sizeof(computeBinary));
+    loaded.Erase(graphics);
+    EXPECT_TRUE(loaded.Find(graphics).data.empty());
+    EXPECT_EQ(loaded.GetProgramCount(), 1U);
+}
+
+/**
+ * @tc.name: RejectsInvalidData
+ * @tc.desc: Tests that caches of another driver revision and truncated caches are discarded.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ProgramBinaryCacheGLES, RejectsInvalidData, testing::ext::TestSize.Level1)
+{
+    const uint8_t binary[] = {1U, 2U, 3U, 4U};
+    ProgramBinaryCacheGLES cache;
+    cache.Store({1U, 2U, 0U}, 1U, binary);
+    const auto data = cache.Serialize(REVISION);
+
+    ProgramBinaryCacheGLES loaded;
+    EXPECT_FALSE(loaded.Deserialize(data, REVISION + 1U));
+    EXPECT_EQ(loaded.GetProgramCount(), 0U);
+    EXPECT_FALSE(loaded.Deserialize({}, REVISION));
+    EXPECT_FALSE(loaded.Deserialize(array_view(data.data(), data.size() - 1U), REVISION));
+    EXPECT_EQ(loaded.GetProgramCount(), 0U);
+
+    // Version mismatch.
+    auto modified = data;
+    modified[0U] ^= 0xffU;
+    EXPECT_FALSE(loaded.Deserialize(modified, REVISION));
+
+    ASSERT_TRUE(loaded.Deserialize(data, REVISION));
+    EXPECT_EQ(loaded.GetProgramCount(), 1U);
+    loaded.Clear();
+    EXPECT_EQ(loaded.GetProgramCount(), 0U);
+}
+#endif  // RENDER_HAS_GL_BACKEND || RENDER_HAS_GLES_BACKEND
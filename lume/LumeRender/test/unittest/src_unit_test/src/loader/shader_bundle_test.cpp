@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <loader/shader_bundle.h>
+
+#include <base/containers/string.h>
+#include <base/containers/vector.h>
+
+#include "test_framework.h"
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace BASE_NS;
+using namespace RENDER_NS;
+
+namespace {
+struct File {
+    string_view name;
+    string_view data;
+};
+
+void Append32(vector<uint8_t>& out, uint32_t value)
+{
+    uint8_t bytes[sizeof(value)];
+    std::memcpy(bytes, &value, sizeof(value));
+    out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+// Same layout as LumeShaderCompiler writes: header, entries, names and 16 byte aligned data.
+vector<uint8_t> CreateBundle(array_view<const File> files)
+{
+    vector<uint8_t> bundle{'s', 'h', 'b', 1};
+    Append32(bundle, static_cast<uint32_t>(files.size()));
+    uint32_t offset = 8U + 16U * static_cast<uint32_t>(files.size());
+    vector<uint32_t> dataOffsets;
+    uint32_t nameOffset = offset;
+    for (const auto& file : files) {
+        offset += static_cast<uint32_t>(file.name.size());
+    }
+    for (const auto& file : files) {
+        offset = (offset + 15U) & ~15U;
+        dataOffsets.push_back(offset);
+        offset += static_cast<uint32_t>(file.data.size());
+    }
+    for (size_t i = 0; i < files.size(); ++i) {
+        Append32(bundle, nameOffset);
+        Append32(bundle, static_cast<uint32_t>(files[i].name.size()));
+        Append32(bundle, dataOffsets[i]);
+        Append32(bundle, static_cast<uint32_t>(files[i].data.size()));
+        nameOffset += static_cast<uint32_t>(files[i].name.size());
+    }
+    for (const auto& file : files) {
+        bundle.insert(bundle.end(), file.name.begin(), file.name.end());
+    }
+    for (size_t i = 0; i < files.size(); ++i) {
+        bundle.resize(dataOffsets[i]);
+        bundle.insert(bundle.end(), files[i].data.begin(), files[i].data.end());
+    }
+    return bundle;
+}
+}  // namespace
+
+/**
+ * @tc.name: LoadAndFind
+ * @tc.desc: Tests for reading files from a shader bundle.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ShaderBundle, LoadAndFind, testing::ext::TestSize.Level1)
+{
+    const File files[] = {
+        {"computeshader/a.comp.spv", "comp"},
+        {"shader/a.shader", "{}"},
+        {"shader/a.vert.spv", "vert"},
+        {"shader/a.vert.spv.lsb", "rfl"},
+    };
+    const vector<uint8_t> data = CreateBundle(files);
+
+    ShaderBundle bundle;
+    ASSERT_TRUE(bundle.Load(data));
+    ASSERT_EQ(bundle.GetFileCount(), 4U);
+    EXPECT_EQ(bundle.GetName(1U), "shader/a.shader");
+    EXPECT_EQ(bundle.GetData(1U).size(), 2U);
+    EXPECT_EQ(bundle.GetName(4U), "");
+    EXPECT_TRUE(bundle.GetData(4U).empty());
+
+    for (const auto& file : files) {
+        const auto found = bundle.Find(file.name);
+        ASSERT_EQ(found.size(), file.data.size());
+        EXPECT_EQ(string_view(reinterpret_cast<const char*>(found.data()), found.size()), file.data);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(found.data()) % 16U, reinterpret_cast<uintptr_t>(data.data()) % 16U);
+    }
+    EXPECT_TRUE(bundle.Find("shader/a").empty());
+    EXPECT_TRUE(bundle.Find("shader/a.vert.spv.gles").empty());
+    EXPECT_TRUE(bundle.Find("").empty());
+
+    // empty bundle
+    const vector<uint8_t> empty = CreateBundle({});
+    ASSERT_TRUE(bundle.Load(empty));
+    EXPECT_EQ(bundle.GetFileCount(), 0U);
+    EXPECT_TRUE(bundle.Find("shader/a.shader").empty());
+}
+
+/**
+ * @tc.name: InvalidBundles
+ * @tc.desc: Tests that corrupted shader bundles are rejected.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_ShaderBundle, InvalidBundles, testing::ext::TestSize.Level1)
+{
+    const File files[] = {
+        {"shader/a.shader", "{}"},
+        {"shader/b.shader", "{}"},
+    };
+    const vector<uint8_t> valid = CreateBundle(files);
+    ShaderBundle bundle;
+    {
+        EXPECT_FALSE(bundle.Load(array_view<const uint8_t>(valid.data(), 4U)));
+        EXPECT_EQ(bundle.GetFileCount(), 0U);
+    }
+    {
+        // wrong version
+        auto data = valid;
+        data[3U] = 2U;
+        EXPECT_FALSE(bundle.Load(data));
+    }
+    {
+        // more entries than fit in the file
+        auto data = valid;
+        data[4U] = 0xffU;
+        EXPECT_FALSE(bundle.Load(data));
+    }
+    {
+        // data out of bounds
+        auto data = valid;
+        data.resize(data.size() - 1U);
+        EXPECT_FALSE(bundle.Load(data));
+    }
+    {
+        const File unsorted[] = {
+            {"shader/b.shader", "{}"},
+            {"shader/a.shader", "{}"},
+        };
+        EXPECT_FALSE(bundle.Load(CreateBundle(unsorted)));
+        EXPECT_TRUE(bundle.Find("shader/a.shader").empty());
+    }
+}
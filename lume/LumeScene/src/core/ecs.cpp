@@ -182,6 +182,7 @@ void Ecs::Uninitialize()
     materialQuery.reset();
     animationQuery.reset();
     rootEntity_ = {};
+    nodeIndex_ = {};
     nodeSystem = {};
     picking = {};
     externalPicking_.reset();
@@ -233,6 +234,12 @@ CORE3D_NS::ISceneNode* Ecs::FindNode(BASE_NS::string_view path)
     if (path.empty() || path == "/") {
         return GetNode(rootEntity_);
     }
+    // GetNode refreshes the node hierarchy if the node components have changed.
+    GetNode(rootEntity_);
+    if (const auto entity = nodeIndex_.FindPath(path, GetNodeGenerations()); CORE_NS::EntityUtil::IsValid(entity)) {
+        return nodeSystem->GetNode(entity);
+    }
+    const auto fullPath = path;
     CORE3D_NS::ISceneNode* node = &nodeSystem->GetRootNode();
     BASE_NS::string_view p = FirstSegment(path);
     while (node && !path.empty()) {
@@ -240,9 +247,29 @@ CORE3D_NS::ISceneNode* Ecs::FindNode(BASE_NS::string_view path)
         path.remove_prefix(p.size() + 1);
         p = FirstSegment(path);
     }
+    if (node) {
+        nodeIndex_.StorePath(fullPath, node->GetEntity());
+    }
     return node;
 }
 
+bool Ecs::FindNodes(CORE_NS::Entity root, BASE_NS::string_view name, size_t maxCount, bool breadthFirst,
+    BASE_NS::vector<CORE_NS::Entity>& result)
+{
+    SCENE_ASSERT_THREAD(thread_);
+    GetNode(rootEntity_);
+    if (!nodeIndex_.Update(nodeSystem->GetRootNode(), GetNodeGenerations())) {
+        return false;
+    }
+    return nodeIndex_.FindNodes(root, name, maxCount, breadthFirst, result);
+}
+
+NodeIndex::Generations Ecs::GetNodeGenerations() const
+{
+    return {nodeComponentManager->GetGenerationCounter(), nameComponentManager->GetGenerationCounter(),
+        ecs->GetEntityManager().GetGenerationCounter()};
+}
+
 CORE3D_NS::ISceneNode* Ecs::FindNodeParent(BASE_NS::string_view path)
 {
     SCENE_ASSERT_THREAD(thread_);
@@ -451,6 +478,7 @@ void Ecs::OnChildChanged(const CORE3D_NS::ISceneNode& parent, CORE3D_NS::INodeSy
     const CORE3D_NS::ISceneNode& child, size_t index)
 {
     SCENE_ASSERT_THREAD(thread_);
+    nodeIndex_.Invalidate();
     if (auto i = interface_pointer_cast<IOnNodeChanged>(scene_)) {
         META_NS::ContainerChangeType cchange{};
         if (type == CORE3D_NS::INodeSystem::SceneNodeListener::EventType::ADDED) {
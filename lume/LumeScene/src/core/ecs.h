@@ -52,6 +52,7 @@
 #include "../ecs_component/entity_owner_component_info.h"
 #include "../ecs_component/resource_component_info.h"
 #include "ecs_listener.h"
+#include "node_index.h"
 
 SCENE_BEGIN_NAMESPACE()
 
@@ -67,6 +68,10 @@ public:
 
     CORE3D_NS::ISceneNode* FindNode(BASE_NS::string_view path);
     CORE3D_NS::ISceneNode* FindNodeParent(BASE_NS::string_view path);
+    // Appends the nodes named name in the subtree of root, including root, in breadth first or depth first order.
+    // Returns false if root is not part of the node hierarchy.
+    bool FindNodes(CORE_NS::Entity root, BASE_NS::string_view name, size_t maxCount, bool breadthFirst,
+        BASE_NS::vector<CORE_NS::Entity>& result);
 
     bool SetNodeName(CORE_NS::Entity ent, BASE_NS::string_view name);  // fix
     bool SetNodeParentAndName(CORE_NS::Entity ent, BASE_NS::string_view name, CORE3D_NS::ISceneNode* parent);
@@ -154,12 +159,15 @@ private:
 
     void InitializeComponentManagers();
 
+    NodeIndex::Generations GetNodeGenerations() const;
+
 private:
     std::optional<CORE3D_NS::IPicking::Ptr> externalPicking_;
     std::thread::id thread_;
     BASE_NS::weak_ptr<IInternalScene> scene_;
     CORE_NS::Entity rootEntity_{};
     BASE_NS::unordered_map<BASE_NS::string, CORE_NS::IComponentManager*> components_;
+    NodeIndex nodeIndex_;
 };
 
 struct EcsCopyResult {
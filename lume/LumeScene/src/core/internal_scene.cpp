@@ -460,9 +460,9 @@ bool InternalScene::FindNodesBfs(const CORE3D_NS::ISceneNode& root, BASE_NS::str
 {
     const auto rootChildren = root.GetChildren();
     BASE_NS::vector<CORE3D_NS::ISceneNode*> queue{rootChildren.begin(), rootChildren.end()};
-    while (!queue.empty()) {
-        const auto child = queue.front();
-        queue.erase(queue.begin());
+    // Consume the queue from the head, erasing the front would make the search quadratic.
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const auto child = queue[head];
         if (child) {
             if (child->GetName() == name && AppendFoundNode(child->GetEntity(), id, maxCount, nodes)) {
                 return true;
@@ -475,21 +475,20 @@ bool InternalScene::FindNodesBfs(const CORE3D_NS::ISceneNode& root, BASE_NS::str
     return false;
 }
 
-void InternalScene::FindNodesDfs(const CORE3D_NS::ISceneNode& root, BASE_NS::string_view name, size_t maxCount,
+bool InternalScene::FindNodesDfs(const CORE3D_NS::ISceneNode& root, BASE_NS::string_view name, size_t maxCount,
     META_NS::ObjectId id, BASE_NS::vector<INode::Ptr>& nodes) const
 {
     for (auto&& child : root.GetChildren()) {
         if (child) {
-            auto found = FindNodes(
-                child->GetEntity(), name, maxCount - nodes.size(), id, META_NS::TraversalType::FULL_HIERARCHY);
-            if (!found.empty()) {
-                nodes.insert(nodes.end(), found.begin(), found.end());
+            if (child->GetName() == name && AppendFoundNode(child->GetEntity(), id, maxCount, nodes)) {
+                return true;
+            }
+            if (FindNodesDfs(*child, name, maxCount, id, nodes)) {
+                return true;
             }
-        }
-        if (maxCount && nodes.size() >= maxCount) {
-            break;
         }
     }
+    return false;
 }
 
 BASE_NS::vector<INode::Ptr> InternalScene::FindNodes(CORE_NS::Entity root, BASE_NS::string_view name, size_t maxCount,
@@ -499,6 +498,15 @@ BASE_NS::vector<INode::Ptr> InternalScene::FindNodes(CORE_NS::Entity root, BASE_
     if (!ecs_) {
         return nodes;
     }
+    const bool breadthFirst = traversalType == META_NS::TraversalType::BREADTH_FIRST_ORDER;
+    BASE_NS::vector<CORE_NS::Entity> entities;
+    if (ecs_->FindNodes(root, name, maxCount, breadthFirst, entities)) {
+        for (const auto& entity : entities) {
+            AppendFoundNode(entity, id, 0, nodes);
+        }
+        return nodes;
+    }
+    // The hierarchy has changed since the last search, walk it instead of rebuilding the index.
     const auto node = ecs_->GetNode(root);
     if (!node) {
         return nodes;
@@ -506,7 +514,7 @@ BASE_NS::vector<INode::Ptr> InternalScene::FindNodes(CORE_NS::Entity root, BASE_
     if (node->GetName() == name && AppendFoundNode(root, id, maxCount, nodes)) {
         return nodes;
     }
-    if (traversalType == META_NS::TraversalType::BREADTH_FIRST_ORDER) {
+    if (breadthFirst) {
         FindNodesBfs(*node, name, maxCount, id, nodes);
     } else {
         FindNodesDfs(*node, name, maxCount, id, nodes);
@@ -204,9 +204,10 @@ private:
     bool FindNodesBfs(const CORE3D_NS::ISceneNode& root, BASE_NS::string_view name, size_t maxCount,
         META_NS::ObjectId id, BASE_NS::vector<INode::Ptr>& nodes) const;
 
-    // Depth-first body of FindNodes. Used for any non-BREADTH_FIRST_ORDER traversal — the original
+    // Depth-first (pre-order) body of FindNodes. Used for any non-BREADTH_FIRST_ORDER traversal — the original
     // FindNodes treats every non-BFS variant identically, so the specific DFS order is not threaded through.
-    void FindNodesDfs(const CORE3D_NS::ISceneNode& root, BASE_NS::string_view name, size_t maxCount,
+    // Returns true once maxCount results are accumulated.
+    bool FindNodesDfs(const CORE3D_NS::ISceneNode& root, BASE_NS::string_view name, size_t maxCount,
         META_NS::ObjectId id, BASE_NS::vector<INode::Ptr>& nodes) const;
 
     // Looks up entity's INode proxy (constructing it if not cached) and appends it to nodes.
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "node_index.h"
+
+#include <algorithm>
+
+SCENE_BEGIN_NAMESPACE()
+
+void NodeIndex::Invalidate()
+{
+    valid_ = false;
+    seen_ = {};
+    paths_.clear();
+}
+
+bool NodeIndex::Update(const CORE3D_NS::ISceneNode& root, const Generations& generations)
+{
+    if (valid_ && generations == built_) {
+        return true;
+    }
+    if (!(generations == seen_)) {
+        valid_ = false;
+        seen_ = generations;
+        return false;
+    }
+    Build(root);
+    valid_ = true;
+    built_ = generations;
+    return true;
+}
+
+void NodeIndex::Build(const CORE3D_NS::ISceneNode& root)
+{
+    order_.clear();
+    names_.clear();
+
+    // Depth first numbering. A node's subtree ends where the numbering continues after its last descendant.
+    struct Visit {
+        const CORE3D_NS::ISceneNode* node;
+        size_t child;
+    };
+    BASE_NS::vector<Visit> stack;
+    BASE_NS::vector<BASE_NS::string> nodeNames;
+    uint32_t counter = 0;
+    stack.push_back({&root, 0});
+    order_[root.GetEntity()] = {counter++, 0};
+    nodeNames.push_back(root.GetName());
+    while (!stack.empty()) {
+        auto& visit = stack.back();
+        const auto children = visit.node->GetChildren();
+        if (visit.child == children.size()) {
+            order_[visit.node->GetEntity()].subtreeEnd = counter;
+            stack.pop_back();
+            continue;
+        }
+        if (const auto* child = children[visit.child++]) {
+            order_[child->GetEntity()] = {counter++, 0};
+            nodeNames.push_back(child->GetName());
+            stack.push_back({child, 0});
+        }
+    }
+    for (const auto& [entity, order] : order_) {
+        names_[nodeNames[order.depthFirst]].depthFirst.push_back({entity, order.depthFirst});
+    }
+    for (auto& [name, named] : names_) {
+        std::sort(named.depthFirst.begin(), named.depthFirst.end(),
+            [](const Entry& lhs, const Entry& rhs) { return lhs.depthFirst < rhs.depthFirst; });
+    }
+
+    // Breadth first numbering, the queue is consumed from the head instead of erasing from the front.
+    BASE_NS::vector<const CORE3D_NS::ISceneNode*> queue{&root};
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const auto* node = queue[head];
+        const auto& order = order_[node->GetEntity()];
+        names_[nodeNames[order.depthFirst]].breadthFirst.push_back({node->GetEntity(), order.depthFirst});
+        for (const auto* child : node->GetChildren()) {
+            if (child) {
+                queue.push_back(child);
+            }
+        }
+    }
+}
+
+bool NodeIndex::FindNodes(CORE_NS::Entity root, BASE_NS::string_view name, size_t maxCount, bool breadthFirst,
+    BASE_NS::vector<CORE_NS::Entity>& result) const
+{
+    const auto rootPos = order_.find(root);
+    if (!valid_ || rootPos == order_.end()) {
+        return false;
+    }
+    const auto namePos = names_.find(name);
+    if (namePos == names_.end()) {
+        return true;
+    }
+    const auto begin = rootPos->second.depthFirst;
+    const auto end = rootPos->second.subtreeEnd;
+    const auto inSubtree = [begin, end](const Entry& entry) {
+        return entry.depthFirst >= begin && entry.depthFirst < end;
+    };
+    const auto full = [&result, maxCount]() { return maxCount && result.size() == maxCount; };
+    if (breadthFirst) {
+        for (const auto& entry : namePos->second.breadthFirst) {
+            if (inSubtree(entry)) {
+                result.push_back(entry.entity);
+                if (full()) {
+                    break;
+                }
+            }
+        }
+    } else {
+        // The subtree is a contiguous range of the depth first order.
+        const auto& entries = namePos->second.depthFirst;
+        auto it = std::lower_bound(entries.begin(), entries.end(), begin,
+            [](const Entry& entry, uint32_t index) { return entry.depthFirst < index; });
+        for (; it != entries.end() && it->depthFirst < end && !full(); ++it) {
+            result.push_back(it->entity);
+        }
+    }
+    return true;
+}
+
+CORE_NS::Entity NodeIndex::FindPath(BASE_NS::string_view path, const Generations& generations)
+{
+    if (!(generations == pathGenerations_)) {
+        paths_.clear();
+        pathGenerations_ = generations;
+        return {};
+    }
+    if (const auto pos = paths_.find(path); pos != paths_.end()) {
+        return pos->second;
+    }
+    return {};
+}
+
+void NodeIndex::StorePath(BASE_NS::string_view path, CORE_NS::Entity entity)
+{
+    paths_[BASE_NS::string(path)] = entity;
+}
+
+SCENE_END_NAMESPACE()
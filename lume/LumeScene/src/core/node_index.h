@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SCENE_SRC_CORE_NODE_INDEX_H
+#define SCENE_SRC_CORE_NODE_INDEX_H
+
+#include <scene/base/types.h>
+
+#include <3d/ecs/systems/intf_node_system.h>
+#include <base/containers/string.h>
+#include <base/containers/string_view.h>
+#include <base/containers/unordered_map.h>
+#include <base/containers/vector.h>
+#include <core/ecs/entity.h>
+
+SCENE_BEGIN_NAMESPACE()
+
+/// Name and path lookup for the nodes of the node system hierarchy.
+/// The name index numbers the nodes in depth first and breadth first order so that the nodes with a given name in any
+/// subtree are found without walking the hierarchy, in the same order as a traversal of the subtree would find them.
+/// Changes to the hierarchy and the names are detected from the generation counters of the node and name component
+/// managers and the entity manager, and from node system events.
+class NodeIndex {
+public:
+    struct Generations {
+        uint32_t node;
+        uint32_t name;
+        uint32_t entity;
+
+        bool operator==(const Generations& other) const
+        {
+            return node == other.node && name == other.name && entity == other.entity;
+        }
+    };
+
+    /// Marks the index to be rebuilt on next use.
+    void Invalidate();
+
+    /// Returns true if the name index is up to date with generations and FindNodes can be used.
+    /// The index is rebuilt only when it is used twice without changes in between, lookups interleaved with changes
+    /// e.g. while a scene is being built walk the hierarchy instead of rebuilding the index on each lookup.
+    bool Update(const CORE3D_NS::ISceneNode& root, const Generations& generations);
+
+    /// Appends the nodes named name in the subtree starting from root, including root itself, to result in
+    /// breadth first or depth first order. maxCount 0 means all the nodes.
+    /// Returns false if root isn't in the index.
+    bool FindNodes(CORE_NS::Entity root, BASE_NS::string_view name, size_t maxCount, bool breadthFirst,
+        BASE_NS::vector<CORE_NS::Entity>& result) const;
+
+    /// Node previously stored for a path, or an invalid entity. Stored paths are forgotten when the generations
+    /// change.
+    CORE_NS::Entity FindPath(BASE_NS::string_view path, const Generations& generations);
+    void StorePath(BASE_NS::string_view path, CORE_NS::Entity entity);
+
+private:
+    void Build(const CORE3D_NS::ISceneNode& root);
+
+    struct Order {
+        // Depth first index of the node, the subtree of the node is [depthFirst, subtreeEnd).
+        uint32_t depthFirst;
+        uint32_t subtreeEnd;
+    };
+    struct Entry {
+        CORE_NS::Entity entity;
+        uint32_t depthFirst;
+    };
+    struct Named {
+        // Nodes with the same name sorted by depth first and by breadth first index.
+        BASE_NS::vector<Entry> depthFirst;
+        BASE_NS::vector<Entry> breadthFirst;
+    };
+
+    bool valid_{};
+    // Generations of the name index, and of the last lookup which didn't rebuild the index.
+    Generations built_{};
+    Generations seen_{};
+    BASE_NS::unordered_map<CORE_NS::Entity, Order> order_;
+    BASE_NS::unordered_map<BASE_NS::string, Named> names_;
+
+    Generations pathGenerations_{};
+    BASE_NS::unordered_map<BASE_NS::string, CORE_NS::Entity> paths_;
+};
+
+SCENE_END_NAMESPACE()
+
+#endif
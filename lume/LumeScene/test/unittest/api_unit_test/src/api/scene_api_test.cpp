@@ -342,6 +342,43 @@ UNIT_TEST_F(API_SceneApiTest, FindNodesTraversalOrder, testing::ext::TestSize.Le
     EXPECT_THAT(firstsBreadth, ::testing::ElementsAre(l1_1, l2_1, l2_2));
 }
 
+/**
+ * @tc.name: FindNodesAfterHierarchyChanges
+ * @tc.desc: Tests that repeated name and path lookups follow renamed and moved nodes.
+ * @tc.type: FUNC
+ */
+UNIT_TEST_F(API_SceneApiTest, FindNodesAfterHierarchyChanges, testing::ext::TestSize.Level1)
+{
+    auto& scene = GetScene();
+    auto factory = scene.GetResourceFactory();
+    auto a = factory.CreateNode("//a");
+    auto b = factory.CreateNode("//b");
+    auto aTarget = factory.CreateNode("//a/target");
+    auto bTarget = factory.CreateNode("//b/target");
+
+    // The second lookup without changes in between uses the index.
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_THAT(scene.FindNodes("target", 0), ::testing::ElementsAre(aTarget, bTarget));
+        EXPECT_THAT(b.FindNodes("target", 0), ::testing::ElementsAre(bTarget));
+        EXPECT_EQ(scene.GetNode("//a/target"), aTarget);
+    }
+
+    EXPECT_TRUE(META_NS::SetName(aTarget.GetPtr<INode>(), "other"));
+    UpdateScene();
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_THAT(scene.FindNodes("target", 0), ::testing::ElementsAre(bTarget));
+        EXPECT_THAT(scene.FindNodes("other", 0), ::testing::ElementsAre(aTarget));
+        EXPECT_EQ(scene.GetNode("//a/other"), aTarget);
+    }
+
+    EXPECT_TRUE(a.AddChild(bTarget));
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_THAT(a.FindNodes("target", 0), ::testing::ElementsAre(bTarget));
+        EXPECT_TRUE(b.FindNodes("target", 0).empty());
+        EXPECT_EQ(scene.GetNode("//a/target"), bTarget);
+    }
+}
+
 /**
  * @tc.name: GetComponent
  * @tc.desc: Tests for Get Component. [AUTO-GENERATED]
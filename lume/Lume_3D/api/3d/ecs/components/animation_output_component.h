@@ -30,12 +30,25 @@ CORE3D_BEGIN_NAMESPACE()
  * Animation output component represents animation keyframe data.
  */
 BEGIN_COMPONENT(IAnimationOutputComponentManager, AnimationOutputComponent)
+#if !defined(IMPLEMENT_MANAGER)
+/** Layout of the keyframe data. */
+enum class Encoding : uint8_t {
+    /** Keyframe values of the type, one per timestamp of the track's AnimationInputComponent. */
+    RAW = 0,
+    /** Keyframes reduced and quantized at import, with their own timestamps. Rotations are stored as the three
+     * smallest quaternion components in 16 bits each and other values as 16 bit fractions of the value range. Only
+     * step and linear interpolation are supported. */
+    QUANTIZED = 1,
+};
+#endif
 /** Type hash of the keyframe data. If the property targetted by AnimationTrack
  * doesn't match with this type information (PropertyTypeDecl::compareHash), the track will be skipped. */
 DEFINE_PROPERTY(uint64_t, type, "Keyframe Datatype Hash", 0, )
 /** Keyframe data. Data is stored as byte array but actual data type is specified in AnimationOutputComponent::type.
  */
 DEFINE_PROPERTY(BASE_NS::vector<uint8_t>, data, "Keyframe Data", 0, )
+/** Layout of data. */
+DEFINE_PROPERTY(Encoding, encoding, "Keyframe Encoding", 0, VALUE(Encoding::RAW))
 
 END_COMPONENT(IAnimationOutputComponentManager, AnimationOutputComponent, "aefd2f02-9178-46d1-8ef2-81a262f0a212")
 #if !defined(IMPLEMENT_MANAGER)
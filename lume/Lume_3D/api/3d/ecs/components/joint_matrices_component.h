@@ -18,6 +18,7 @@
 
 #if !defined(IMPLEMENT_MANAGER)
 #include <3d/namespace.h>
+#include <base/containers/array_view.h>
 #include <base/math/matrix.h>
 #include <base/math/vector.h>
 #include <core/ecs/component_struct_macros.h>
@@ -67,7 +68,13 @@ DEFINE_PROPERTY(BASE_NS::Math::Vec3, jointsAabbMin, "Combined Joint AABB Min Val
  */
 DEFINE_PROPERTY(BASE_NS::Math::Vec3, jointsAabbMax, "Combined Joint AABB Max Values", 0, ARRAY_VALUE(0.0f, 0.0f, 0.0f))
 
-END_COMPONENT(IJointMatricesComponentManager, JointMatricesComponent, "59d701be-f741-4faa-b5d6-a4f20ad4e317")
+END_COMPONENT_EXT(
+    IJointMatricesComponentManager, JointMatricesComponent, "59d701be-f741-4faa-b5d6-a4f20ad4e317",
+    /** Get all the components for bulk iteration.
+     * @return Components in ComponentId order. The view is invalidated when components are added or garbage
+     * collected. Modifications must be done with Set or Write.
+     */
+    virtual BASE_NS::array_view<const JointMatricesComponent> GetComponents() const = 0;)
 #if !defined(IMPLEMENT_MANAGER)
 CORE3D_END_NAMESPACE()
 #endif
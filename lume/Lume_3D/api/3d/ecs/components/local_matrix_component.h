@@ -19,6 +19,7 @@
 #if !defined(IMPLEMENT_MANAGER)
 
 #include <3d/namespace.h>
+#include <base/containers/array_view.h>
 #include <base/math/matrix.h>
 #include <core/ecs/component_struct_macros.h>
 #include <core/ecs/intf_component_manager.h>
@@ -28,7 +29,13 @@ CORE3D_BEGIN_NAMESPACE()
 BEGIN_COMPONENT(ILocalMatrixComponentManager, LocalMatrixComponent)
 /** Local matrix component */
 DEFINE_PROPERTY(BASE_NS::Math::Mat4X4, matrix, "Local Matrix", 0, VALUE(BASE_NS::Math::IDENTITY_4X4))
-END_COMPONENT(ILocalMatrixComponentManager, LocalMatrixComponent, "06dce540-17f6-4446-ad43-2bfd7c61aa0d")
+END_COMPONENT_EXT(
+    ILocalMatrixComponentManager, LocalMatrixComponent, "06dce540-17f6-4446-ad43-2bfd7c61aa0d",
+    /** Get all the components for bulk iteration.
+     * @return Components in ComponentId order. The view is invalidated when components are added or garbage
+     * collected. Modifications must be done with Set or Write.
+     */
+    virtual BASE_NS::array_view<const LocalMatrixComponent> GetComponents() const = 0;)
 #if !defined(IMPLEMENT_MANAGER)
 CORE3D_END_NAMESPACE()
 #endif
@@ -178,6 +178,16 @@ DEFINE_PROPERTY(BASE_NS::vector<Submesh>, submeshes, "Submeshes", 0, )
 /** Joint bounds */
 DEFINE_PROPERTY(BASE_NS::vector<float>, jointBounds, "Joint Bounds", 0, )
 
+/** Optional CPU copy of the vertex positions used for triangle accurate picking. Filled by IMeshBuilder when
+ * configured with PICKING_DATA. Positions are in mesh space, indexed by pickingIndices.
+ */
+DEFINE_PROPERTY(BASE_NS::vector<BASE_NS::Math::Vec3>, pickingPositions, "Picking Positions", 0, )
+
+/** Triangle list indices to pickingPositions. Triangles are stored submesh by submesh, each submesh owning
+ * indexCount / 3 triangles, or vertexCount / 3 when it has no index buffer.
+ */
+DEFINE_PROPERTY(BASE_NS::vector<uint32_t>, pickingIndices, "Picking Indices", 0, )
+
 /** AABB min */
 DEFINE_PROPERTY(BASE_NS::Math::Vec3, aabbMin, "Min AABB", 0, ARRAY_VALUE(0.0f, 0.0f, 0.0f))
 
@@ -18,6 +18,7 @@
 
 #if !defined(IMPLEMENT_MANAGER)
 #include <3d/namespace.h>
+#include <base/containers/array_view.h>
 #include <base/math/matrix.h>
 #include <core/ecs/component_struct_macros.h>
 #include <core/ecs/intf_component_manager.h>
@@ -36,7 +37,13 @@ DEFINE_PROPERTY(BASE_NS::Math::Mat4X4, matrix, "World Matrix", 0, VALUE(BASE_NS:
  */
 DEFINE_PROPERTY(BASE_NS::Math::Mat4X4, prevMatrix, "Previous World Matrix", 0, VALUE(BASE_NS::Math::IDENTITY_4X4))
 
-END_COMPONENT(IWorldMatrixComponentManager, WorldMatrixComponent, "4f76b9cc-4586-434d-a4dd-3bd115188d48")
+END_COMPONENT_EXT(
+    IWorldMatrixComponentManager, WorldMatrixComponent, "4f76b9cc-4586-434d-a4dd-3bd115188d48",
+    /** Get all the components for bulk iteration.
+     * @return Components in ComponentId order. The view is invalidated when components are added or garbage
+     * collected. Modifications must be done with Set or Write.
+     */
+    virtual BASE_NS::array_view<const WorldMatrixComponent> GetComponents() const = 0;)
 #if !defined(IMPLEMENT_MANAGER)
 CORE3D_END_NAMESPACE()
 #endif
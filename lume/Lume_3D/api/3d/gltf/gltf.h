@@ -188,8 +188,11 @@ enum GltfResourceImportFlagBits {
     CORE_GLTF_IMPORT_RESOURCE_SKIP_UNUSED = 0x00000080,
     /** Keep mesh data for CPU access. Allowing CPU access increases memory usage. */
     CORE_GLTF_IMPORT_RESOURCE_MESH_CPU_ACCESS = 0x00000100,
+    /** Reduce and quantize translation, rotation and scale keyframes with linear or step interpolation. Decreases
+     * memory usage with a small loss of precision, see AnimationOutputComponent::Encoding. */
+    CORE_GLTF_IMPORT_RESOURCE_ANIMATION_COMPRESSED = 0x00000200,
     /** All flags bits */
-    CORE_GLTF_IMPORT_RESOURCE_FLAG_BITS_ALL = 0x7FFFFEFF
+    CORE_GLTF_IMPORT_RESOURCE_FLAG_BITS_ALL = 0x7FFFFCFF
 };
 
 /** Container for flags for resource import. */
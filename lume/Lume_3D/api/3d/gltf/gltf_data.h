@@ -18,6 +18,7 @@
 
 #include <cstdint>
 
+#include <base/containers/array_view.h>
 #include <base/containers/atomics.h>
 #include <base/containers/string.h>
 #include <base/containers/unique_ptr.h>
@@ -25,6 +26,7 @@
 #include <base/math/matrix.h>
 #include <base/math/quaternion.h>
 #include <base/math/vector.h>
+#include <core/io/intf_file.h>
 #include <core/namespace.h>
 
 CORE3D_BEGIN_NAMESPACE()
@@ -146,8 +148,14 @@ struct Buffer {
     /** URI to the buffer data. Either empty (GLB buffer), a file path, or a data-URI. */
     BASE_NS::string uri;
 
-    /** Raw data for this buffer. Populated after LoadBuffers(). */
+    /** Raw data for this buffer. Populated after LoadBuffers() unless the data could be used in place. */
     BASE_NS::vector<uint8_t> data;
+
+    /** Buffer data used in place from a memory mapped or in-memory file, used instead of data when not empty. */
+    BASE_NS::array_view<const uint8_t> mappedData;
+
+    /** File backing mappedData when it isn't owned by the glTF data itself. */
+    CORE_NS::IFile::Ptr mappedFile;
 };
 
 struct BufferView {
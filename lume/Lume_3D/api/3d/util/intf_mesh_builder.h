@@ -44,6 +44,9 @@ public:
         /** Don't use staging buffer. Requires less memory and avoids copying data from staging to final buffers, but
            this implies host visible buffers which can have . */
         NO_STAGING_BUFFER = 0x1,
+        /** Keep a CPU copy of the triangle list positions and indices in MeshComponent::pickingPositions and
+           MeshComponent::pickingIndices for triangle accurate picking. */
+        PICKING_DATA = 0x2,
     };
 
     /** Initialization parameters. */
@@ -82,6 +82,27 @@ struct RayTriangleCastResult {
     uint64_t triangleIndex{0};
 };
 
+/** Raycast result for ray-mesh intersection. */
+struct RayMeshCastResult {
+    /** Node that was hit. */
+    ISceneNode* node{nullptr};
+
+    /** Distance to the hit position. */
+    float distance{0.0f};
+
+    /** Position of the hit. */
+    BASE_NS::Math::Vec3 worldPosition{0.0f, 0.0f, 0.0f};
+
+    /** Barycentric coordinates of the hit position relative to the second and third corner of the triangle. */
+    BASE_NS::Math::Vec2 hitUv{0.0f, 0.0f};
+
+    /** Index of the submesh hit. */
+    uint32_t submeshIndex{0};
+
+    /** Index of the triangle hit within the submesh. */
+    uint32_t triangleIndex{0};
+};
+
 class IPicking : public CORE_NS::IInterface {
 public:
     static constexpr auto UID = BASE_NS::Uid{"9a4791d7-19e2-4dc0-a4fd-b0804d153d70"};
@@ -198,6 +219,33 @@ public:
     virtual BASE_NS::vector<RayTriangleCastResult> RayCastFromCamera(CORE_NS::IEcs const& ecs, CORE_NS::Entity camera,
         const BASE_NS::Math::Vec2& screenPos, BASE_NS::array_view<const BASE_NS::Math::Vec3> triangles) const = 0;
 
+    /**
+     * Get the closest triangle hit by ray for each node. Only meshes with picking data (MeshComponent::pickingIndices)
+     * are tested, skinned meshes are ignored. Back facing triangles are not hit. Only entities included in the given
+     * layer mask are in the result.
+     * @param ecs Entity component system where hit test is done.
+     * @param start Starting point of the ray.
+     * @param direction Direction of the ray.
+     * @param layerMask Layer mask for limiting the returned result.
+     * @return Array of ray-mesh cast results that describe the node, submesh and triangle that was hit (ordered by
+     * distance).
+     */
+    virtual BASE_NS::vector<RayMeshCastResult> RayCastMeshes(CORE_NS::IEcs const& ecs,
+        const BASE_NS::Math::Vec3& start, const BASE_NS::Math::Vec3& direction, uint64_t layerMask) const = 0;
+
+    /**
+     * Get the closest triangle hit by ray for each node using a camera and 2D screen coordinates as input. See
+     * RayCastMeshes.
+     * @param ecs EntityComponentSystem where hit test is done.
+     * @param camera Camera entity to be used for the hit test.
+     * @param screenPos screen coordinates for hit test. Where (0, 0) is the upper left corner of the screen and (1, 1)
+     * the lower right corner.
+     * @param layerMask Layer mask for limiting the returned result.
+     * @return Array of ray-mesh cast results (ordered by distance).
+     */
+    virtual BASE_NS::vector<RayMeshCastResult> RayCastMeshesFromCamera(CORE_NS::IEcs const& ecs,
+        CORE_NS::Entity camera, const BASE_NS::Math::Vec2& screenPos, uint64_t layerMask) const = 0;
+
 protected:
     IPicking() = default;
     virtual ~IPicking() = default;
@@ -23,7 +23,11 @@
 
 CORE_BEGIN_NAMESPACE()
 using BASE_NS::vector;
+using CORE3D_NS::AnimationOutputComponent;
 DECLARE_PROPERTY_TYPE(vector<uint8_t>);
+DECLARE_PROPERTY_TYPE(AnimationOutputComponent::Encoding);
+
+ENUM_TYPE_METADATA(AnimationOutputComponent::Encoding, ENUM_VALUE(RAW, "Raw"), ENUM_VALUE(QUANTIZED, "Quantized"))
 CORE_END_NAMESPACE()
 
 CORE3D_BEGIN_NAMESPACE()
@@ -15,8 +15,8 @@
 
 #include <3d/ecs/components/joint_matrices_component.h>
 
-#include "ComponentTools/base_manager.h"
-#include "ComponentTools/base_manager.inl"
+#include "ComponentTools/dense_base_manager.h"
+#include "ComponentTools/dense_base_manager.inl"
 
 #define IMPLEMENT_MANAGER
 #include <core/property_tools/property_macros.h>
@@ -25,19 +25,20 @@ CORE3D_BEGIN_NAMESPACE()
 using BASE_NS::array_view;
 using BASE_NS::countof;
 
-using CORE_NS::BaseManager;
+using CORE_NS::DenseBaseManager;
 using CORE_NS::IComponentManager;
 using CORE_NS::IEcs;
 using CORE_NS::Property;
 
-class JointMatricesComponentManager final : public BaseManager<JointMatricesComponent, IJointMatricesComponentManager> {
+class JointMatricesComponentManager final
+    : public DenseBaseManager<JointMatricesComponent, IJointMatricesComponentManager> {
     BEGIN_PROPERTY(JointMatricesComponent, componentMetaData_)
 #include <3d/ecs/components/joint_matrices_component.h>
     END_PROPERTY();
 
 public:
     explicit JointMatricesComponentManager(IEcs& ecs)
-        : BaseManager<JointMatricesComponent, IJointMatricesComponentManager>(
+        : DenseBaseManager<JointMatricesComponent, IJointMatricesComponentManager>(
               ecs, CORE_NS::GetName<JointMatricesComponent>(), 0U)
     {}
 
@@ -60,6 +61,11 @@ public:
     {
         return componentMetaData_;
     }
+
+    array_view<const JointMatricesComponent> GetComponents() const override
+    {
+        return GetComponentData();
+    }
 };
 
 IComponentManager* IJointMatricesComponentManagerInstance(IEcs& ecs)
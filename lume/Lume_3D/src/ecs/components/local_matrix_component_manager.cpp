@@ -15,8 +15,8 @@
 
 #include <3d/ecs/components/local_matrix_component.h>
 
-#include "ComponentTools/base_manager.h"
-#include "ComponentTools/base_manager.inl"
+#include "ComponentTools/dense_base_manager.h"
+#include "ComponentTools/dense_base_manager.inl"
 
 #define IMPLEMENT_MANAGER
 #include <core/property_tools/property_macros.h>
@@ -25,19 +25,21 @@ CORE3D_BEGIN_NAMESPACE()
 using BASE_NS::array_view;
 using BASE_NS::countof;
 
-using CORE_NS::BaseManager;
+using CORE_NS::DenseBaseManager;
 using CORE_NS::IComponentManager;
 using CORE_NS::IEcs;
 using CORE_NS::Property;
 
-class LocalMatrixComponentManager final : public BaseManager<LocalMatrixComponent, ILocalMatrixComponentManager> {
+class LocalMatrixComponentManager final
+    : public DenseBaseManager<LocalMatrixComponent, ILocalMatrixComponentManager> {
     BEGIN_PROPERTY(LocalMatrixComponent, componentMetaData_)
 #include <3d/ecs/components/local_matrix_component.h>
     END_PROPERTY();
 
 public:
     explicit LocalMatrixComponentManager(IEcs& ecs)
-        : BaseManager<LocalMatrixComponent, ILocalMatrixComponentManager>(ecs, CORE_NS::GetName<LocalMatrixComponent>())
+        : DenseBaseManager<LocalMatrixComponent, ILocalMatrixComponentManager>(
+              ecs, CORE_NS::GetName<LocalMatrixComponent>())
     {}
 
     ~LocalMatrixComponentManager() = default;
@@ -59,6 +61,11 @@ public:
     {
         return componentMetaData_;
     }
+
+    array_view<const LocalMatrixComponent> GetComponents() const override
+    {
+        return GetComponentData();
+    }
 };
 
 IComponentManager* ILocalMatrixComponentManagerInstance(IEcs& ecs)
@@ -31,6 +31,8 @@ DECLARE_PROPERTY_TYPE(MeshComponent::Submesh);
 DECLARE_PROPERTY_TYPE(MeshComponent::Submesh::BufferAccess);
 DECLARE_PROPERTY_TYPE(MeshComponent::Submesh::IndexBufferAccess);
 DECLARE_PROPERTY_TYPE(vector<MeshComponent::Submesh>);
+DECLARE_PROPERTY_TYPE(vector<BASE_NS::Math::Vec3>);
+DECLARE_PROPERTY_TYPE(vector<uint32_t>);
 DECLARE_PROPERTY_TYPE(RENDER_NS::GraphicsState::InputAssembly);
 DECLARE_PROPERTY_TYPE(RENDER_NS::PrimitiveTopology);
 
@@ -46,6 +46,8 @@
 
 #include "ecs/components/initial_transform_component.h"
 #include "ecs/systems/animation_playback.h"
+#include "util/animation_compression.h"
+#include "util/keyframe_sampler.h"
 #include "util/log.h"
 
 CORE3D_BEGIN_NAMESPACE()
@@ -115,15 +117,15 @@ private:
 
 class AnimationSystem::AnimateTask final : public IThreadPool::ITask {
 public:
-    AnimateTask(AnimationSystem& system, size_t offset, size_t count)
-        : system_(system), offset_(offset), count_(count){};
+    AnimateTask(AnimationSystem& system, size_t offset, size_t count, KeyframeSampler& sampler)
+        : system_(system), offset_(offset), count_(count), sampler_(sampler){};
 
     void operator()() override
     {
         const auto offset = Math::min(offset_, system_.trackOrder_.size());
         const auto count = Math::min(count_, system_.trackOrder_.size() - offset);
         const auto results = array_view(static_cast<const uint32_t*>(system_.trackOrder_.data()) + offset, count);
-        system_.AnimateTracks(results);
+        system_.AnimateTracks(results, sampler_);
     }
 
 protected:
@@ -134,6 +136,7 @@ private:
     AnimationSystem& system_;
     size_t offset_;
     size_t count_;
+    KeyframeSampler& sampler_;
 };
 
 namespace {
@@ -500,20 +503,19 @@ void AnimateTrack(const PropertyTypeDecl& type, const AnimationSystem::Interpola
 }
 
 void FindFrameIndices(const bool forward, const float currentTimestamp, const array_view<const float> timestamps,
-    size_t& currentFrameIndex, size_t& nextFrameIndex)
+    size_t& cursor, size_t& currentFrameIndex, size_t& nextFrameIndex)
 {
     size_t current;
     size_t next;
-    const auto begin = timestamps.begin();
-    const auto end = timestamps.end();
-    const auto pos = std::upper_bound(begin, end, currentTimestamp);
+    // cursor is the result of the previous frame, first timestamp after currentTimestamp.
+    cursor = FindKeyframe(timestamps, currentTimestamp, cursor);
     if (forward) {
         // Find next frame (forward).
-        next = static_cast<size_t>(std::distance(begin, pos));
+        next = cursor;
         current = next - 1;
     } else {
         // Find next frame (backward).
-        current = static_cast<size_t>(std::distance(begin, pos));
+        current = cursor;
         next = current ? current - 1 : 0;
     }
 
@@ -522,6 +524,104 @@ void FindFrameIndices(const bool forward, const float currentTimestamp, const ar
     nextFrameIndex = std::clamp(next, size_t(0), timestamps.size() - 1);
 }
 
+bool GetValueType(const PropertyTypeDecl& type, KeyframeSampler::ValueType& valueType, size_t& components)
+{
+    switch (type) {
+        case PropertyType::FLOAT_T:
+            valueType = KeyframeSampler::ValueType::FLOAT;
+            components = 1U;
+            return true;
+        case PropertyType::VEC2_T:
+            valueType = KeyframeSampler::ValueType::VEC2;
+            components = 2U;
+            return true;
+        case PropertyType::VEC3_T:
+            valueType = KeyframeSampler::ValueType::VEC3;
+            components = 3U;
+            return true;
+        case PropertyType::VEC4_T:
+            valueType = KeyframeSampler::ValueType::VEC4;
+            components = 4U;
+            return true;
+        case PropertyType::QUAT_T:
+            valueType = KeyframeSampler::ValueType::QUAT;
+            components = 4U;
+            return true;
+        default:
+            return false;
+    }
+}
+
+KeyframeSampler::Mode GetMode(AnimationTrackComponent::Interpolation interpolation)
+{
+    switch (interpolation) {
+        case AnimationTrackComponent::Interpolation::STEP:
+            return KeyframeSampler::Mode::STEP;
+        default:
+        case AnimationTrackComponent::Interpolation::LINEAR:
+            return KeyframeSampler::Mode::LINEAR;
+        case AnimationTrackComponent::Interpolation::SPLINE:
+            return KeyframeSampler::Mode::SPLINE;
+    }
+}
+
+// Queues the track to be evaluated with the other tracks of the same type and interpolation mode. Returns false for
+// types which aren't batched and for keyframe indices out of range, those are handled by AnimateTrack.
+bool AddSample(KeyframeSampler& sampler, const PropertyTypeDecl& type,
+    const AnimationSystem::InterpolationData& interpolation, const AnimationOutputComponent& outputComponent,
+    const InitialTransformComponent& initialValue, InitialTransformComponent& resultValue)
+{
+    KeyframeSampler::ValueType valueType;
+    size_t components;
+    if (!GetValueType(type, valueType, components)) {
+        return false;
+    }
+    const KeyframeSampler::Mode mode = GetMode(interpolation.mode);
+    const size_t valueCount = outputComponent.data.size() / (components * sizeof(float));
+    // spline keyframes are three values, sampling reads up to two values after the index.
+    const size_t lastIndex = Math::max(interpolation.startIndex, interpolation.endIndex) +
+                             ((mode == KeyframeSampler::Mode::SPLINE) ? 2U : 0U);
+    if (lastIndex >= valueCount) {
+        return false;
+    }
+    const auto* values = Cast<const float*>(outputComponent.data.data());
+    sampler.Add(valueType, mode,
+        KeyframeSample{values + interpolation.startIndex * components, values + interpolation.endIndex * components,
+            Cast<const float*>(&initialValue.initialData), Cast<float*>(&resultValue.initialData), interpolation.t,
+            interpolation.weight});
+    return true;
+}
+
+// Decodes the two keyframes of a quantized track to storage allocated from the sampler and queues the track like
+// AddSample. Quantized tracks use only step and linear interpolation.
+bool AddQuantizedSample(KeyframeSampler& sampler, const PropertyTypeDecl& type,
+    const AnimationSystem::InterpolationData& interpolation, const AnimationOutputComponent& outputComponent,
+    const InitialTransformComponent& initialValue, InitialTransformComponent& resultValue)
+{
+    KeyframeSampler::ValueType valueType;
+    size_t components;
+    if (!GetValueType(type, valueType, components)) {
+        return false;
+    }
+    const KeyframeSampler::Mode mode = GetMode(interpolation.mode);
+    AnimationCompression::Track track;
+    if ((mode == KeyframeSampler::Mode::SPLINE) || !AnimationCompression::GetTrack(outputComponent.data, track) ||
+        (track.header->components != components) ||
+        (Math::max(interpolation.startIndex, interpolation.endIndex) >= track.header->keyframeCount)) {
+        return false;
+    }
+    float* values = sampler.Allocate(components * 2U);
+    if (!values) {
+        return false;
+    }
+    AnimationCompression::DecodeKeyframe(track, interpolation.startIndex, values);
+    AnimationCompression::DecodeKeyframe(track, interpolation.endIndex, values + components);
+    sampler.Add(valueType, mode,
+        KeyframeSample{values, values + components, Cast<const float*>(&initialValue.initialData),
+            Cast<float*>(&resultValue.initialData), interpolation.t, interpolation.weight});
+    return true;
+}
+
 void UpdateStateAndTracks(IAnimationStateComponentManager& stateManager_,
     IAnimationTrackComponentManager& trackManager_, IAnimationInputComponentManager& inputManager_,
     Entity animationEntity, const AnimationComponent& animationComponent, array_view<const Entity> targetEntities)
@@ -1145,6 +1245,9 @@ void AnimationSystem::AnimateTrackValues()
     animTasks_.reserve(remaining_ ? (tasks_ + 1U) : tasks_);
     animTaskStart_ = taskId_;
 
+    // One sampler per task and one for the tracks animated on this thread.
+    samplers_.resize(tasks_ + 1U);
+
     auto batch = [this](size_t i, size_t offset, size_t count) {
         // Start task for calculating which keyframes are used.
         auto& frameIndexTask = frameIndexTasks_.emplace_back(*this, offset, count);
@@ -1152,7 +1255,7 @@ void AnimationSystem::AnimateTrackValues()
 
         // Start task for interpolating between the selected keyframes.
         // This work requires the initial values as well as the keyframe indices.
-        auto& task = animTasks_.emplace_back(*this, offset, count);
+        auto& task = animTasks_.emplace_back(*this, offset, count, samplers_[i]);
         const IThreadPool::ITask* dependencies[] = {&initTasks_[i], &frameIndexTask};
         taskResults_.push_back(threadPool_->Push(IThreadPool::ITask::Ptr{&task}, dependencies));
         ++taskId_;
@@ -1165,7 +1268,7 @@ void AnimationSystem::AnimateTrackValues()
     } else {
         const auto results = array_view(static_cast<const uint32_t*>(trackOrder_.data()), remaining_);
         CalculateFrameIndices(results);
-        AnimateTracks(results);
+        AnimateTracks(results, samplers_[tasks_]);
     }
 }
 
@@ -1290,15 +1393,24 @@ void AnimationSystem::CalculateFrameIndices(array_view<const uint32_t> resultInd
         }
         if (auto track = animationTrackManager_.Read(trackId); track) {
             if (const auto inputData = inputManager_.Read(track->timestamps); inputData) {
-                const array_view<const float> timestamps = inputData->timestamps;
+                array_view<const float> timestamps = inputData->timestamps;
+                // Quantized outputs have their own keyframe times as keyframes may have been removed.
+                if (const auto outputData = outputManager_.Read(track->data);
+                    outputData && (outputData->encoding == AnimationOutputComponent::Encoding::QUANTIZED)) {
+                    AnimationCompression::Track quantized;
+                    timestamps = AnimationCompression::GetTrack(outputData->data, quantized)
+                                     ? quantized.timestamps
+                                     : array_view<const float>{};
+                }
                 // Ensure we have data.
                 if (!timestamps.empty()) {
+                    size_t cursor = frameIndices_[trackId].cursor;
                     size_t currentFrameIndex;
                     size_t nextFrameIndex;
 
                     const auto currentTime = trackValues_[trackId].timePosition;
-                    FindFrameIndices(
-                        trackValues_[trackId].forward, currentTime, timestamps, currentFrameIndex, nextFrameIndex);
+                    FindFrameIndices(trackValues_[trackId].forward, currentTime, timestamps, cursor, currentFrameIndex,
+                        nextFrameIndex);
 
                     float currentOffset = 0.f;
                     if (currentFrameIndex != nextFrameIndex) {
@@ -1309,14 +1421,14 @@ void AnimationSystem::CalculateFrameIndices(array_view<const uint32_t> resultInd
                         currentOffset = std::clamp(currentOffset, 0.0f, 1.0f);
                     }
 
-                    frameIndices_[trackId] = FrameData{currentOffset, currentFrameIndex, nextFrameIndex};
+                    frameIndices_[trackId] = FrameData{currentOffset, currentFrameIndex, nextFrameIndex, cursor};
                 }
             }
         }
     }
 }
 
-void AnimationSystem::AnimateTracks(array_view<const uint32_t> resultIndices)
+void AnimationSystem::AnimateTracks(array_view<const uint32_t> resultIndices, KeyframeSampler& sampler)
 {
 #if (CORE3D_DEV_ENABLED == 1)
     CORE_CPU_PERF_SCOPE("CORE3D", "AnimationSystem", "AnimateTracks", CORE3D_PROFILER_DEFAULT_COLOR);
@@ -1337,7 +1449,7 @@ void AnimationSystem::AnimateTracks(array_view<const uint32_t> resultIndices)
 
                 auto entry = GetEntry(*trackHandle);
                 if (!entry.component || !entry.property) {
-                    return;
+                    continue;
                 }
 
                 // special handling for IPropertyHandle*. need to fetch the property types behind the pointer.
@@ -1361,9 +1473,12 @@ void AnimationSystem::AnimateTracks(array_view<const uint32_t> resultIndices)
                     continue;
                 }
 
+                const bool quantized = outputHandle->encoding == AnimationOutputComponent::Encoding::QUANTIZED;
                 // spline interpolation takes three values: in-tangent, data point, and out-tangent
                 const size_t inputCount =
-                    (trackHandle->interpolationMode == AnimationTrackComponent::Interpolation::SPLINE) ? 3U : 1U;
+                    (!quantized && (trackHandle->interpolationMode == AnimationTrackComponent::Interpolation::SPLINE))
+                        ? 3U
+                        : 1U;
                 const FrameData& currentFrame = frameIndices_[trackId];
                 const InterpolationData interpolationData{trackHandle->interpolationMode,
                     currentFrame.currentFrameIndex * inputCount,
@@ -1375,12 +1490,26 @@ void AnimationSystem::AnimateTracks(array_view<const uint32_t> resultIndices)
                 // property.
                 // identifying such tracks would save updating the initial data in AnimationSystem::Update and
                 // interpolating between initial and result.
-                AnimateTrack(
-                    entry.property->type, interpolationData, *outputHandle, trackValues.initial, trackValues.result);
+                // The keyframe values stay valid after releasing outputHandle as the outputs aren't modified while
+                // the system is updating.
+                if (quantized) {
+                    if (!AddQuantizedSample(sampler, entry.property->type, interpolationData, *outputHandle,
+                            trackValues.initial, trackValues.result)) {
+                        PLUGIN_LOG_ONCE_D(to_string(Hash(trackId, outputHandle->type)),
+                            "AnimateTrack failed, unsupported quantized track %" PRIx64, outputHandle->type);
+                        continue;
+                    }
+                } else if (!AddSample(sampler, entry.property->type, interpolationData, *outputHandle,
+                               trackValues.initial, trackValues.result)) {
+                    AnimateTrack(entry.property->type, interpolationData, *outputHandle, trackValues.initial,
+                        trackValues.result);
+                }
                 trackValues.updated = true;
             }
         }
     }
+    // Evaluate the batched tracks grouped by type and interpolation mode.
+    sampler.Evaluate();
 }
 
 void AnimationSystem::ApplyResults(array_view<const uint32_t> resultIndices)
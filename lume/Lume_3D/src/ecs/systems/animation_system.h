@@ -28,6 +28,7 @@
 #include <core/threading/intf_thread_pool.h>
 
 #include "ecs/components/initial_transform_component.h"
+#include "util/keyframe_sampler.h"
 
 CORE_BEGIN_NAMESPACE()
 class IEcs;
@@ -102,6 +103,8 @@ private:
         float currentOffset;
         size_t currentFrameIndex;
         size_t nextFrameIndex;
+        // Result of the previous keyframe search, see FindKeyframe.
+        size_t cursor;
     };
 
     enum class TrackState : uint8_t {
@@ -142,7 +145,7 @@ private:
     void InitializeTrackValues(BASE_NS::array_view<const uint32_t> resultIndices);
     void ResetTargetProperties(BASE_NS::array_view<const uint32_t> resultIndices);
     void CalculateFrameIndices(BASE_NS::array_view<const uint32_t> resultIndices);
-    void AnimateTracks(BASE_NS::array_view<const uint32_t> resultIndices);
+    void AnimateTracks(BASE_NS::array_view<const uint32_t> resultIndices, KeyframeSampler& sampler);
     void ApplyResults(BASE_NS::array_view<const uint32_t> resultIndices);
 
     const PropertyEntry& GetEntry(const AnimationTrackComponent& track);
@@ -189,6 +192,7 @@ private:
 
     BASE_NS::vector<AnimateTask> animTasks_;
     uint64_t animTaskStart_{0U};
+    BASE_NS::vector<KeyframeSampler> samplers_;
 
     BASE_NS::vector<TrackValues> trackValues_;
     BASE_NS::vector<FrameData> frameIndices_;
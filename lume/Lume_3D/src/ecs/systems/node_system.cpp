@@ -15,6 +15,7 @@
 
 #include "node_system.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdlib>
 #include <utility>
@@ -43,6 +44,8 @@ namespace {
 constexpr auto NODE_INDEX = 0U;
 constexpr auto LOCAL_INDEX = 1U;
 constexpr auto WORLD_INDEX = 2U;
+// Hierarchy levels smaller than this are propagated in the calling thread.
+constexpr size_t MIN_PROPAGATE_TASK_SIZE = 256U;
 
 template <typename ListType, typename ValueType>
 inline auto Find(ListType&& list, ValueType&& value)
@@ -127,26 +130,6 @@ bool LookupNodesByComponent(
     return result;
 }
 
-void CalculateWorldMatrix(
-    Math::Mat4X4& pm, ILocalMatrixComponentManager& localMatrixManager, const ComponentQuery::ResultRow& row)
-{
-    if (auto local = localMatrixManager.Read(row.components[LOCAL_INDEX])) {
-        pm = pm * local->matrix;
-    }
-}
-
-void UpdateWorldMatrix(
-    const Math::Mat4X4& pm, IWorldMatrixComponentManager& worldMatrixManager, const ComponentQuery::ResultRow& row)
-{
-    auto id = row.components[WORLD_INDEX];
-    if (id == IComponentManager::INVALID_COMPONENT_ID) {
-        worldMatrixManager.Create(row.entity);
-        id = worldMatrixManager.GetComponentId(row.entity);
-    }
-    if (auto worldMatrixHandle = worldMatrixManager.Write(row.components[WORLD_INDEX])) {
-        worldMatrixHandle->matrix = pm;
-    }
-}
 }  // namespace
 
 // Interface that allows nodes to access other nodes and request cache updates.
@@ -189,6 +172,8 @@ public:
         uint32_t localMatrixGeneration{0U};
         uint16_t depth{0U};
         bool enabled{false};
+        // NodeSystem::gatherIndex_ of the last traversal which visited this node.
+        uint32_t gatherIndex{0U};
     };
 
     SceneNode(const SceneNode& other) = delete;
@@ -1091,10 +1076,29 @@ private:
 // State when traversing node tree.
 struct NodeSystem::State {
     SceneNode* node;
-    Math::Mat4X4 parentMatrix;
+    // Index of the parent's world matrix in hierarchy_.
+    uint32_t parentIndex;
     bool parentEnabled;
 };
 
+class NodeSystem::PropagateTask final : public IThreadPool::ITask {
+public:
+    PropagateTask(NodeSystem& system, array_view<const uint32_t> entries) : system_(system), entries_(entries) {};
+
+    void operator()() override
+    {
+        system_.PropagateTransformations(entries_);
+    }
+
+protected:
+    void Destroy() override
+    {}
+
+private:
+    NodeSystem& system_;
+    array_view<const uint32_t> entries_;
+};
+
 struct NodeSystem::NodeInfo {
     Entity parent;
     bool isEffectivelyEnabled;
@@ -1118,7 +1122,8 @@ NodeSystem::NodeSystem(IEcs& ecs)
       transformManager_(*(GetManager<ITransformComponentManager>(ecs))),
       localMatrixManager_(*(GetManager<ILocalMatrixComponentManager>(ecs))),
       worldMatrixManager_(*(GetManager<IWorldMatrixComponentManager>(ecs))),
-      cache_(make_unique<NodeCache>(ecs.GetEntityManager(), nameManager_, nodeManager_, transformManager_))
+      cache_(make_unique<NodeCache>(ecs.GetEntityManager(), nameManager_, nodeManager_, transformManager_)),
+      threadPool_(ecs.GetThreadPool())
 {}
 
 string_view NodeSystem::GetName() const
@@ -1294,44 +1299,14 @@ void NodeSystem::RefreshAllNodes()
     // Make sure node cache is valid.
     cache_->Refresh();
 
-    stack_.clear();
-    stack_.reserve(nodeManager_.GetComponentCount());
+    // World matrices are calculated also for disabled nodes.
+    ++gatherIndex_;
     for (auto* child : GetRootNode().GetChildren()) {
         if (child) {
-            stack_.push_back(State{static_cast<SceneNode*>(child), Math::IDENTITY_4X4, child->GetEnabled()});
-        }
-    }
-    while (!stack_.empty()) {
-        auto state = stack_.back();
-        stack_.pop_back();
-
-        auto row = nodeQuery_.FindResultRow(state.node->GetEntity());
-        if (!row) {
-            continue;
-        }
-        const auto nodeInfo = ProcessNode(state.node, state.parentEnabled, row);
-
-        Math::Mat4X4& pm = state.parentMatrix;
-
-        if (row->IsValidComponentId(LOCAL_INDEX)) {
-            CalculateWorldMatrix(pm, localMatrixManager_, *row);
-            UpdateWorldMatrix(pm, worldMatrixManager_, *row);
-
-            // Save the values that were used to calculate current world matrix.
-            state.node->lastState_.localMatrixGeneration =
-                localMatrixManager_.GetComponentGeneration(row->components[LOCAL_INDEX]);
-            if (state.node->lastState_.parent != nodeInfo.parent) {
-                state.node->lastState_.parent = nodeInfo.parent;
-                state.node->lastState_.parentNode = static_cast<SceneNode*>(GetNode(nodeInfo.parent));
-            }
-        }
-        for (auto* child : state.node->GetChildren()) {
-            if (!child) {
-                continue;
-            }
-            stack_.push_back(State{static_cast<SceneNode*>(child), pm, nodeInfo.isEffectivelyEnabled});
+            GatherTransformations(*child, Math::IDENTITY_4X4, child->GetEnabled(), true);
         }
     }
+    UpdateTransformations();
 
     // Store generation counters.
     localMatrixGeneration_ = localMatrixManager_.GetGenerationCounter();
@@ -1435,10 +1410,15 @@ bool NodeSystem::Update(bool, uint64_t, uint64_t)
     // Update world transformations for changed tree branches. Remember parent as nodes are sorted according to depth
     // and parent so we don't have to that often fetch the information.
     const auto* root = &GetRootNode();
+    ++gatherIndex_;
     bool parentEnabled = true;
     Math::Mat4X4 parentMatrix(Math::IDENTITY_4X4);
     const ISceneNode* parent = nullptr;
     for (const auto node : changedNodes) {
+        if (static_cast<const SceneNode*>(node)->lastState_.gatherIndex == gatherIndex_) {
+            // Already handled as part of an ancestor's subtree.
+            continue;
+        }
         const ISceneNode* nodeParent = node->GetParent();
         if (nodeParent && nodeParent != parent) {
             parent = nodeParent;
@@ -1472,8 +1452,9 @@ bool NodeSystem::Update(bool, uint64_t, uint64_t)
             parent = nullptr;
         }
 
-        UpdateTransformations(*node, parentMatrix, parentEnabled);
+        GatherTransformations(*node, parentMatrix, parentEnabled, false);
     }
+    UpdateTransformations();
 
     // Store generation counters.
     localMatrixGeneration_ = localMatrixManager_.GetGenerationCounter();
@@ -1569,29 +1550,50 @@ NodeSystem::NodeInfo NodeSystem::ProcessNode(
     return info;
 }
 
-void NodeSystem::UpdateTransformations(ISceneNode& node, Math::Mat4X4 const& matrix, bool enabled)
+void NodeSystem::GatherTransformations(
+    ISceneNode& node, Math::Mat4X4 const& matrix, bool enabled, bool includeDisabled)
 {
 #if (CORE3D_DEV_ENABLED == 1)
-    CORE_CPU_PERF_SCOPE("CORE3D", "NodeSystem", "UpdateTransformations", CORE3D_PROFILER_DEFAULT_COLOR);
+    CORE_CPU_PERF_SCOPE("CORE3D", "NodeSystem", "GatherTransformations", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
+    auto& hierarchy = hierarchy_;
+    // Level zero entry for the parent matrix of this subtree.
+    const auto rootIndex = static_cast<uint32_t>(hierarchy.parent.size());
+    hierarchy.parent.push_back(rootIndex);
+    hierarchy.level.push_back(0U);
+    hierarchy.localId.push_back(IComponentManager::INVALID_COMPONENT_ID);
+    hierarchy.worldId.push_back(IComponentManager::INVALID_COMPONENT_ID);
+    hierarchy.world.push_back(matrix);
+
     stack_.clear();
-    stack_.reserve(nodeManager_.GetComponentCount());
-    stack_.push_back(State{static_cast<SceneNode*>(&node), matrix, enabled});
+    stack_.push_back(State{static_cast<SceneNode*>(&node), rootIndex, enabled});
     while (!stack_.empty()) {
         auto state = stack_.back();
         stack_.pop_back();
 
+        state.node->lastState_.gatherIndex = gatherIndex_;
         auto row = nodeQuery_.FindResultRow(state.node->GetEntity());
         if (!row) {
             continue;
         }
         const auto nodeInfo = ProcessNode(state.node, state.parentEnabled, row);
 
-        Math::Mat4X4& pm = state.parentMatrix;
-
-        if (nodeInfo.isEffectivelyEnabled && row->IsValidComponentId(LOCAL_INDEX)) {
-            CalculateWorldMatrix(pm, localMatrixManager_, *row);
-            UpdateWorldMatrix(pm, worldMatrixManager_, *row);
+        // Children of nodes without a local matrix use the same parent matrix.
+        auto matrixIndex = state.parentIndex;
+        if ((includeDisabled || nodeInfo.isEffectivelyEnabled) && row->IsValidComponentId(LOCAL_INDEX)) {
+            auto worldId = row->components[WORLD_INDEX];
+            if (worldId == IComponentManager::INVALID_COMPONENT_ID) {
+                worldMatrixManager_.Create(row->entity);
+                worldId = worldMatrixManager_.GetComponentId(row->entity);
+            }
+            matrixIndex = static_cast<uint32_t>(hierarchy.parent.size());
+            const auto level = hierarchy.level[state.parentIndex] + 1U;
+            hierarchy.maxLevel = Math::max(hierarchy.maxLevel, level);
+            hierarchy.parent.push_back(state.parentIndex);
+            hierarchy.level.push_back(level);
+            hierarchy.localId.push_back(row->components[LOCAL_INDEX]);
+            hierarchy.worldId.push_back(worldId);
+            hierarchy.world.push_back(Math::IDENTITY_4X4);
 
             // Save the values that were used to calculate current world matrix.
             state.node->lastState_.localMatrixGeneration =
@@ -1601,16 +1603,105 @@ void NodeSystem::UpdateTransformations(ISceneNode& node, Math::Mat4X4 const& mat
                 state.node->lastState_.parentNode = static_cast<SceneNode*>(GetNode(nodeInfo.parent));
             }
         }
-        if (nodeInfo.isEffectivelyEnabled || nodeInfo.effectivelyEnabledChanged) {
+        if (includeDisabled || nodeInfo.isEffectivelyEnabled || nodeInfo.effectivelyEnabledChanged) {
             for (auto* child : state.node->GetChildren()) {
                 if (child) {
-                    stack_.push_back(State{static_cast<SceneNode*>(child), pm, nodeInfo.isEffectivelyEnabled});
+                    stack_.push_back(
+                        State{static_cast<SceneNode*>(child), matrixIndex, nodeInfo.isEffectivelyEnabled});
                 }
             }
         }
     }
 }
 
+void NodeSystem::UpdateTransformations()
+{
+#if (CORE3D_DEV_ENABLED == 1)
+    CORE_CPU_PERF_SCOPE("CORE3D", "NodeSystem", "UpdateTransformations", CORE3D_PROFILER_DEFAULT_COLOR);
+#endif
+    auto& hierarchy = hierarchy_;
+    const auto entryCount = static_cast<uint32_t>(hierarchy.parent.size());
+
+    // Counting sort of the entries by level. Entries on the same level don't depend on each other.
+    hierarchy.levelOffsets.clear();
+    hierarchy.levelOffsets.resize(hierarchy.maxLevel + 2U, 0U);
+    for (const auto level : hierarchy.level) {
+        ++hierarchy.levelOffsets[level + 1U];
+    }
+    for (uint32_t level = 1U; level < hierarchy.levelOffsets.size(); ++level) {
+        hierarchy.levelOffsets[level] += hierarchy.levelOffsets[level - 1U];
+    }
+    hierarchy.order.resize(entryCount);
+    {
+        // Use the level start offsets as insertion positions, and restore them afterwards.
+        for (uint32_t i = 0U; i < entryCount; ++i) {
+            hierarchy.order[hierarchy.levelOffsets[hierarchy.level[i]]++] = i;
+        }
+        for (uint32_t level = hierarchy.maxLevel + 1U; level > 0U; --level) {
+            hierarchy.levelOffsets[level] = hierarchy.levelOffsets[level - 1U];
+        }
+        hierarchy.levelOffsets[0U] = 0U;
+    }
+
+    // Level zero has the fixed parent matrices. Each following level is split into tasks if it's large enough.
+    const auto threadCount = threadPool_ ? threadPool_->GetNumberOfThreads() : 0U;
+    for (uint32_t level = 1U; level <= hierarchy.maxLevel; ++level) {
+        const auto begin = hierarchy.levelOffsets[level];
+        const auto count = static_cast<size_t>(hierarchy.levelOffsets[level + 1U] - begin);
+        const auto entries = array_view<const uint32_t>(hierarchy.order.data() + begin, count);
+        if ((threadCount == 0U) || (count < (MIN_PROPAGATE_TASK_SIZE * 2U))) {
+            PropagateTransformations(entries);
+            continue;
+        }
+        const auto taskSize = Math::max(MIN_PROPAGATE_TASK_SIZE, count / (threadCount + 1U));
+        const auto tasks = count / taskSize;
+
+        tasks_.clear();
+        tasks_.reserve(tasks);
+        taskResults_.clear();
+        taskResults_.reserve(tasks);
+        for (size_t i = 0U; i < tasks; ++i) {
+            auto& task = tasks_.emplace_back(*this, array_view(entries.data() + i * taskSize, taskSize));
+            taskResults_.push_back(threadPool_->Push(IThreadPool::ITask::Ptr{&task}));
+        }
+        // Propagate the tail in the calling thread.
+        if (const auto remaining = count - (tasks * taskSize); remaining) {
+            PropagateTransformations(array_view(entries.data() + tasks * taskSize, remaining));
+        }
+        for (const auto& result : taskResults_) {
+            result->Wait();
+        }
+    }
+
+    // Writing components updates the manager's generation counters, so the results are stored in the calling thread.
+    for (uint32_t i = 0U; i < entryCount; ++i) {
+        if (const auto worldId = hierarchy.worldId[i]; worldId != IComponentManager::INVALID_COMPONENT_ID) {
+            if (auto worldMatrixHandle = worldMatrixManager_.Write(worldId)) {
+                worldMatrixHandle->matrix = hierarchy.world[i];
+            }
+        }
+    }
+
+    hierarchy.parent.clear();
+    hierarchy.level.clear();
+    hierarchy.localId.clear();
+    hierarchy.worldId.clear();
+    hierarchy.world.clear();
+    hierarchy.maxLevel = 0U;
+}
+
+void NodeSystem::PropagateTransformations(array_view<const uint32_t> entries)
+{
+    auto& hierarchy = hierarchy_;
+    for (const auto index : entries) {
+        auto& world = hierarchy.world[index];
+        world = hierarchy.world[hierarchy.parent[index]];
+        if (auto local = localMatrixManager_.Read(hierarchy.localId[index])) {
+            world = world * local->matrix;
+        }
+    }
+}
+
 void NodeSystem::GatherNodeEntities(const ISceneNode& node, vector<Entity>& entities) const
 {
     entities.push_back(node.GetEntity());
@@ -1627,19 +1718,13 @@ void NodeSystem::UpdatePreviousWorldMatrices()
     CORE_CPU_PERF_SCOPE("CORE3D", "NodeSystem", "UpdatePreviousWorldMatrices", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
     if (worldMatrixGeneration_ != worldMatrixManager_.GetGenerationCounter()) {
-        const auto components = worldMatrixManager_.GetComponentCount();
-        for (IComponentManager::ComponentId id = 0U; id < components; ++id) {
-            auto handle = worldMatrixManager_.GetData(id);
-            // this shouldn't be possible as we are going through 0..number of components.
-            if (!handle) {
+        // Compare using the contiguous component data and lock only the components which need to be written.
+        const auto components = worldMatrixManager_.GetComponents();
+        for (IComponentManager::ComponentId id = 0U; id < components.size(); ++id) {
+            if (components[id].prevMatrix == components[id].matrix) {
                 continue;
             }
-            if (auto comp = ScopedHandle<const WorldMatrixComponent>(*handle)) {
-                if (comp->prevMatrix == comp->matrix) {
-                    continue;
-                }
-            }
-            if (auto comp = ScopedHandle<WorldMatrixComponent>(*handle)) {
+            if (auto comp = worldMatrixManager_.Write(id)) {
                 comp->prevMatrix = comp->matrix;
             }
         }
@@ -25,6 +25,7 @@
 #include <base/math/matrix.h>
 #include <core/ecs/intf_ecs.h>
 #include <core/namespace.h>
+#include <core/threading/intf_thread_pool.h>
 
 CORE3D_BEGIN_NAMESPACE()
 class INameComponentManager;
@@ -79,12 +80,30 @@ private:
     class NodeAccess;
     class SceneNode;
     class NodeCache;
+    class PropagateTask;
     struct State;
     struct NodeInfo;
 
+    // Flattened copy of the node hierarchy being updated. Entries are appended while traversing so a parent is always
+    // before its children. Level zero entries only hold the parent matrices of the traversed subtrees.
+    struct Hierarchy {
+        BASE_NS::vector<uint32_t> parent;
+        BASE_NS::vector<uint32_t> level;
+        BASE_NS::vector<CORE_NS::IComponentManager::ComponentId> localId;
+        BASE_NS::vector<CORE_NS::IComponentManager::ComponentId> worldId;
+        BASE_NS::vector<BASE_NS::Math::Mat4X4> world;
+        // Entry indices sorted by level, and where each level starts in order.
+        BASE_NS::vector<uint32_t> order;
+        BASE_NS::vector<uint32_t> levelOffsets;
+        uint32_t maxLevel{0U};
+    };
+
     BASE_NS::vector<ISceneNode*> CollectChangedNodes();
     NodeInfo ProcessNode(SceneNode* node, const bool parentEnabled, const CORE_NS::ComponentQuery::ResultRow* row);
-    void UpdateTransformations(ISceneNode& node, BASE_NS::Math::Mat4X4 const& matrix, bool enabled);
+    void GatherTransformations(
+        ISceneNode& node, BASE_NS::Math::Mat4X4 const& matrix, bool enabled, bool includeDisabled);
+    void UpdateTransformations();
+    void PropagateTransformations(BASE_NS::array_view<const uint32_t> entries);
     void GatherNodeEntities(const ISceneNode& node, BASE_NS::vector<CORE_NS::Entity>& entities) const;
     void UpdatePreviousWorldMatrices();
 
@@ -98,15 +117,21 @@ private:
     IWorldMatrixComponentManager& worldMatrixManager_;
 
     BASE_NS::unique_ptr<NodeCache> cache_;
+    CORE_NS::IThreadPool::Ptr threadPool_;
 
     CORE_NS::ComponentQuery nodeQuery_;
 
     uint32_t localMatrixGeneration_ = 0;
     uint32_t worldMatrixGeneration_ = 0;
     uint32_t nodeGeneration_ = 0;
+    // Incremented for each traversal, used for marking visited nodes.
+    uint32_t gatherIndex_ = 0;
 
     BASE_NS::vector<CORE_NS::Entity> modifiedEntities_;
     BASE_NS::vector<State> stack_;
+    Hierarchy hierarchy_;
+    BASE_NS::vector<PropagateTask> tasks_;
+    BASE_NS::vector<CORE_NS::IThreadPool::IResult::Ptr> taskResults_;
 };
 CORE3D_END_NAMESPACE()
 
@@ -96,6 +96,8 @@
 
 #include "ecs/components/previous_joint_matrices_component.h"
 #include "ecs/systems/render_preprocessor_system.h"
+#include "render/datastore/render_data_store_default_material.h"
+#include "render/datastore/render_data_store_light_probe.h"
 #include "util/component_util_functions.h"
 #include "util/log.h"
 #include "util/mesh_util.h"
@@ -207,6 +209,9 @@ static constexpr const auto RQ_JM = 4U;
 static constexpr const auto RQ_PJM = 5U;
 static constexpr const auto RQ_N = 6U;
 
+// renderables are gathered on multiple threads only when each task gets at least this many rows
+static constexpr size_t MIN_RENDERABLES_PER_TASK = 1024U;
+
 static constexpr const string_view STATE_OPAQUE_NAME{"3dshaderstates://core3d_dm.shadergs"};
 static constexpr const string_view STATE_TRANSLUCENT_NAME{"3dshaderstates://core3d_dm.shadergs"};
 static constexpr const string_view STATE_DEPTH_NAME{"3dshaderstates://core3d_dm_depth.shadergs"};
@@ -1407,11 +1412,11 @@ bool GetEntityLayerMask(const ILayerComponentManager& layerMgr, Entity entity, u
     return false;
 }
 
-LightProbeVolumeOpt GetLightProbesVolumeFromMainCamera(IEntityManager& entityMgr, ICameraComponentManager* cameraMgr,
+Entity GetLightProbeGroupFromMainCamera(IEntityManager& entityMgr, ICameraComponentManager* cameraMgr,
     ILightProbeGroupComponentManager* lightProbeGroupMgr, INodeComponentManager* nodeMgr,
-    ILayerComponentManager* layerMgr, BASE_NS::refcnt_ptr<IRenderDataStoreLightProbe> dsLightProbe)
+    ILayerComponentManager* layerMgr)
 {
-    if (!cameraMgr || !lightProbeGroupMgr || !nodeMgr || !layerMgr || !dsLightProbe) {
+    if (!cameraMgr || !lightProbeGroupMgr || !nodeMgr || !layerMgr) {
         return {};
     }
 
@@ -1475,11 +1480,7 @@ LightProbeVolumeOpt GetLightProbesVolumeFromMainCamera(IEntityManager& entityMgr
         lightProbeGroupEntity = entity;
         break;
     }
-    if (!EntityUtil::IsValid(lightProbeGroupEntity)) {
-        return {};
-    }
-
-    return dsLightProbe->GetLightProbeVolume(lightProbeGroupEntity.id);
+    return lightProbeGroupEntity;
 }
 
 RenderMaterialFlags GetSubmeshRenderMaterialFlag(bool hasValidTetrahedron, RenderMaterialFlags flag)
@@ -1498,6 +1499,26 @@ RenderMaterialFlags GetSubmeshRenderMaterialFlag(bool hasValidTetrahedron, Rende
 
 }  // namespace
 
+class RenderSystem::RenderableTask final : public IThreadPool::ITask {
+public:
+    RenderableTask(RenderSystem& system, array_view<const ComponentQuery::ResultRow> results, uint32_t bufferIndex)
+        : system_(system), results_(results), bufferIndex_(bufferIndex){};
+
+    void operator()() override
+    {
+        system_.ProcessRenderableRows(results_, bufferIndex_);
+    }
+
+protected:
+    void Destroy() override
+    {}
+
+private:
+    RenderSystem& system_;
+    array_view<const ComponentQuery::ResultRow> results_;
+    uint32_t bufferIndex_{0U};
+};
+
 RenderSystem::RenderSystem(IEcs& ecs)
     : ecs_(ecs),
       nodeMgr_(GetManager<INodeComponentManager>(ecs)),
@@ -1526,7 +1547,8 @@ RenderSystem::RenderSystem(IEcs& ecs)
       graphicsStateMgr_(GetManager<IGraphicsStateComponentManager>(ecs)),
       lightProbeMgr_(GetManager<ILightProbeGroupComponentManager>(ecs)),
       transformMgr_(GetManager<ITransformComponentManager>(ecs)),
-      RENDER_SYSTEM_PROPERTIES(&properties_, array_view(ComponentMetadata))
+      RENDER_SYSTEM_PROPERTIES(&properties_, array_view(ComponentMetadata)),
+      threadPool_(ecs.GetThreadPool())
 {
     if (IEngine* engine = ecs_.GetClassFactory().GetInterface<IEngine>()) {
         frustumUtil_ = CORE3D_NS::GetInstance<IFrustumUtil>(UID_FRUSTUM_UTIL);
@@ -1609,9 +1631,18 @@ void RenderSystem::SetDataStorePointers(IRenderDataStoreManager& manager)
     dsLight_ = refcnt_ptr<IRenderDataStoreDefaultLight>(manager.GetRenderDataStore(properties_.dataStoreLight));
     dsMaterial_ =
         refcnt_ptr<IRenderDataStoreDefaultMaterial>(manager.GetRenderDataStore(properties_.dataStoreMaterial));
+    dsMaterialRetained_ = nullptr;
+    if (dsMaterial_ && (dsMaterial_->GetTypeName() == RenderDataStoreDefaultMaterial::TYPE_NAME)) {
+        dsMaterialRetained_ = static_cast<RenderDataStoreDefaultMaterial*>(dsMaterial_.get());
+        dsMaterialRetained_->SetRetainedFrameMeshDataEnabled(true);
+    }
     dsRenderPostProcesses_ = refcnt_ptr<IRenderDataStoreRenderPostProcesses>(manager.Create(
         IRenderDataStoreRenderPostProcesses::UID, (properties_.dataStorePrefix + RPP_DATA_STORE_NAME).data()));
     dsLightProbe_ = refcnt_ptr<IRenderDataStoreLightProbe>(manager.GetRenderDataStore(properties_.dataStoreLightProbe));
+    dsLightProbeLocator_ = nullptr;
+    if (dsLightProbe_ && (dsLightProbe_->GetTypeName() == RenderDataStoreLightProbe::TYPE_NAME)) {
+        dsLightProbeLocator_ = static_cast<RenderDataStoreLightProbe*>(dsLightProbe_.get());
+    }
 }
 
 const IEcs& RenderSystem::GetECS() const
@@ -2019,84 +2050,220 @@ void RenderSystem::EvaluateRenderDataStoreOutput()
         info.shadowCasterBoundingSphere, sceneBoundingSpherePosition_, sceneBoundingSphereRadius_);
 }
 
-void RenderSystem::ProcessRenderables()
+bool RenderSystem::ProcessRetainedRenderables(const bool renderablesChanged)
 {
-    renderableQuery_.Execute();
+    if (!dsMaterialRetained_ || !dsMaterialRetained_->HasRetainedFrameMeshData()) {
+        return false;
+    }
+    // node, render mesh, skin, and renderable set changes need a full update
+    auto& gens = retainedGenerations_;
+    if (renderablesChanged || (gens.node != nodeMgr_->GetGenerationCounter()) ||
+        (gens.renderMesh != renderMeshMgr_->GetGenerationCounter()) ||
+        (gens.skin != skinMgr_->GetGenerationCounter())) {
+        return false;
+    }
+    if (!PatchRetainedRenderables()) {
+        return false;
+    }
+    dsMaterialRetained_->SubmitRetainedFrameMeshData();
+    return true;
+}
 
-    IComponentManager::ComponentId jointId = IComponentManager::INVALID_COMPONENT_ID;
-    IComponentManager::ComponentId prevJointId = IComponentManager::INVALID_COMPONENT_ID;
+RenderSystem::RenderableRowGenerations RenderSystem::GetRenderableRowGenerations(
+    const ComponentQuery::ResultRow& row) const
+{
+    RenderableRowGenerations generations;
+    generations.worldMatrix = worldMatrixMgr_->GetComponentGeneration(row.components[RQ_WM]);
+    if (row.IsValidComponentId(RQ_L)) {
+        generations.layer = layerMgr_->GetComponentGeneration(row.components[RQ_L]);
+    }
+    if (row.IsValidComponentId(RQ_JM)) {
+        generations.joint = jointMatricesMgr_->GetComponentGeneration(row.components[RQ_JM]);
+    }
+    if (row.IsValidComponentId(RQ_PJM)) {
+        generations.prevJoint = prevJointMatricesMgr_->GetComponentGeneration(row.components[RQ_PJM]);
+    }
+    return generations;
+}
+
+bool RenderSystem::PatchRetainedRenderables()
+{
+    auto& gens = retainedGenerations_;
+    const uint32_t worldMatrixGeneration = worldMatrixMgr_->GetGenerationCounter();
+    const uint32_t layerGeneration = layerMgr_->GetGenerationCounter();
+    const uint32_t jointGeneration = jointMatricesMgr_->GetGenerationCounter();
+    const uint32_t prevJointGeneration = prevJointMatricesMgr_->GetGenerationCounter();
+    if ((gens.worldMatrix == worldMatrixGeneration) && (gens.layer == layerGeneration) &&
+        (gens.joint == jointGeneration) && (gens.prevJoint == prevJointGeneration)) {
+        return true;
+    }
     const auto queryResults = renderableQuery_.GetResults();
-    for (const auto& row : queryResults) {
-        jointId = IComponentManager::INVALID_COMPONENT_ID;
-        prevJointId = IComponentManager::INVALID_COMPONENT_ID;
-
-        const auto& entity = row.entity;
-        if (auto rmcHandle = renderMeshMgr_->Read(row.components[RQ_RMC])) {
-            uint32_t sceneId = 0U;
-            RenderMeshFlags renderMeshFlags = 0U;
-            bool enabled = false;  // not going to rendering if there's no node (could go..)
-            if (row.IsValidComponentId(RQ_N)) {
-                if (auto nodeHandle = nodeMgr_->Read(row.components[RQ_N]); nodeHandle) {
-                    sceneId = nodeHandle->sceneId;
-                    enabled = nodeHandle->effectivelyEnabled;
-                    if (nodeHandle->flags & NodeComponent::FlagBits::CONTRIBUTE_GI_BIT) {
-                        renderMeshFlags |= RENDER_MESH_CONTRIBUTE_GI_BIT;
-                    }
-                }
-            }
-            if (!enabled) {
-                continue;
-            }
-            RenderMeshBatchData renderMeshBatch;
-            if (EntityUtil::IsValid(rmcHandle->renderMeshBatch)) {
-                if (auto batchRenderMeshComponent = renderMeshMgr_->Read(rmcHandle->renderMeshBatch);
-                    batchRenderMeshComponent) {
-                    renderMeshBatch.renderMeshId = rmcHandle->renderMeshBatch.id;
-                    renderMeshBatch.meshId = batchRenderMeshComponent->mesh.id;
-                }
+    if (queryResults.size() != renderableRowGenerations_.size()) {
+        return false;
+    }
+    // NOTE: component events are delivered with the next ProcessEvents, the changes of this frame are found by
+    // comparing the component generations of each row to the generations when the row was last added
+    for (size_t i = 0U; i < queryResults.size(); ++i) {
+        const auto& row = queryResults[i];
+        const RenderableRowGenerations rowGenerations = GetRenderableRowGenerations(row);
+        auto& retainedRow = renderableRowGenerations_[i];
+        if ((rowGenerations.worldMatrix == retainedRow.worldMatrix) && (rowGenerations.layer == retainedRow.layer) &&
+            (rowGenerations.joint == retainedRow.joint) && (rowGenerations.prevJoint == retainedRow.prevJoint)) {
+            continue;
+        }
+        RenderMeshData rmd;
+        RenderMeshSkinData rmsd;
+        RenderMeshBatchData renderMeshBatch;
+        if (GetRenderableData(row, rmd, rmsd, renderMeshBatch) &&
+            !dsMaterialRetained_->UpdateRetainedFrameRenderMesh(rmd, rmsd)) {
+            return false;
+        }
+        retainedRow = rowGenerations;
+    }
+    gens.worldMatrix = worldMatrixGeneration;
+    gens.layer = layerGeneration;
+    gens.joint = jointGeneration;
+    gens.prevJoint = prevJointGeneration;
+    return true;
+}
+
+bool RenderSystem::GetRenderableData(const ComponentQuery::ResultRow& row, RenderMeshData& rmd,
+    RenderMeshSkinData& rmsd, RenderMeshBatchData& renderMeshBatch) const
+{
+    const auto& entity = row.entity;
+    auto rmcHandle = renderMeshMgr_->Read(row.components[RQ_RMC]);
+    if (!rmcHandle) {
+        return false;
+    }
+    uint32_t sceneId = 0U;
+    RenderMeshFlags renderMeshFlags = 0U;
+    bool enabled = false;  // not going to rendering if there's no node (could go..)
+    if (row.IsValidComponentId(RQ_N)) {
+        if (auto nodeHandle = nodeMgr_->Read(row.components[RQ_N]); nodeHandle) {
+            sceneId = nodeHandle->sceneId;
+            enabled = nodeHandle->effectivelyEnabled;
+            if (nodeHandle->flags & NodeComponent::FlagBits::CONTRIBUTE_GI_BIT) {
+                renderMeshFlags |= RENDER_MESH_CONTRIBUTE_GI_BIT;
             }
+        }
+    }
+    if (!enabled) {
+        return false;
+    }
+    if (EntityUtil::IsValid(rmcHandle->renderMeshBatch)) {
+        if (auto batchRenderMeshComponent = renderMeshMgr_->Read(rmcHandle->renderMeshBatch);
+            batchRenderMeshComponent) {
+            renderMeshBatch.renderMeshId = rmcHandle->renderMeshBatch.id;
+            renderMeshBatch.meshId = batchRenderMeshComponent->mesh.id;
+        }
+    }
+
+    const WorldMatrixComponent& world = worldMatrixMgr_->Get(row.components[RQ_WM]);
+    const uint64_t layerMask = !row.IsValidComponentId(RQ_L) ? LayerConstants::DEFAULT_LAYER_MASK
+                                                             : layerMgr_->Read(row.components[RQ_L])->layerMask;
+
+    // Pack per-instance RenderMeshFlags into the high 32 bits of sceneId (UBO layers.w).
+    const uint64_t sceneIdPacked = static_cast<uint64_t>(sceneId) | (static_cast<uint64_t>(renderMeshFlags) << 32U);
+    // this is a batch of same material, so the material uniform data is duplicated
+    rmd = {world.matrix, world.matrix, world.prevMatrix, entity.id, rmcHandle->mesh.id, layerMask, sceneIdPacked};
+    std::copy(std::begin(rmcHandle->customData), std::end(rmcHandle->customData), std::begin(rmd.customData));
+    // Optional skin, cannot change based on submesh)
+    if (row.IsValidComponentId(RQ_SM) && row.IsValidComponentId(RQ_JM) && row.IsValidComponentId(RQ_PJM)) {
+        const IComponentManager::ComponentId jointId = row.components[RQ_JM];
+        const IComponentManager::ComponentId prevJointId = row.components[RQ_PJM];
+        if (auto skin = skinMgr_->Read(row.components[RQ_SM])) {
+            rmsd.id = skin->skinRoot.id;
+        } else {
+            static_assert(RenderSceneDataConstants::INVALID_INDEX == INVALID_ENTITY);
+            rmsd.id = RenderSceneDataConstants::INVALID_INDEX;
+        }
+        auto const jointMatricesData = jointMatricesMgr_->Read(jointId);
+        auto const prevJointMatricesData = prevJointMatricesMgr_->Read(prevJointId);
+        const SkinProcessData spd{&(*jointMatricesData), &(*prevJointMatricesData)};
 
-            const WorldMatrixComponent& world = worldMatrixMgr_->Get(row.components[RQ_WM]);
-            const uint64_t layerMask = !row.IsValidComponentId(RQ_L) ? LayerConstants::DEFAULT_LAYER_MASK
-                                                                     : layerMgr_->Read(row.components[RQ_L])->layerMask;
-
-            // Pack per-instance RenderMeshFlags into the high 32 bits of sceneId (UBO layers.w).
-            const uint64_t sceneIdPacked =
-                static_cast<uint64_t>(sceneId) | (static_cast<uint64_t>(renderMeshFlags) << 32U);
-            // this is a batch of same material, so the material uniform data is duplicated
-            RenderMeshData rmd{
-                world.matrix, world.matrix, world.prevMatrix, entity.id, rmcHandle->mesh.id, layerMask, sceneIdPacked};
-            std::copy(std::begin(rmcHandle->customData), std::end(rmcHandle->customData), std::begin(rmd.customData));
-            // Optional skin, cannot change based on submesh)
+        PLUGIN_ASSERT(spd.prevJointMatricesComponent);
+        rmsd.skinJointMatrices = array_view<Math::Mat4X4 const>(
+            spd.jointMatricesComponent->jointMatrices, spd.jointMatricesComponent->count);
+        rmsd.prevSkinJointMatrices = array_view<Math::Mat4X4 const>(
+            spd.prevJointMatricesComponent->jointMatrices, spd.prevJointMatricesComponent->count);
+        rmsd.aabb.minAabb = spd.jointMatricesComponent->jointsAabbMin;
+        rmsd.aabb.maxAabb = spd.jointMatricesComponent->jointsAabbMax;
+    }
+    return true;
+}
+
+void RenderSystem::ProcessRenderableRows(
+    const array_view<const ComponentQuery::ResultRow> rows, const uint32_t bufferIndex)
+{
+    for (const auto& row : rows) {
+        RenderMeshData rmd;
+        RenderMeshSkinData rmsd;
+        RenderMeshBatchData renderMeshBatch;
+        if (GetRenderableData(row, rmd, rmsd, renderMeshBatch)) {
+            dsMaterialRetained_->AddFrameRenderMeshDataToBuffer(bufferIndex, rmd, rmsd, renderMeshBatch);
+        }
+    }
+}
+
+void RenderSystem::ProcessRenderables()
+{
+    bool renderablesChanged = false;
+    if (renderableQuery_.Execute()) {
+        const auto& stats = renderableQuery_.GetExecuteStatistics();
+        renderablesChanged = stats.fullRebuild || (stats.evaluatedRows > 0U) || (stats.removedRows > 0U);
+    }
+    if (ProcessRetainedRenderables(renderablesChanged)) {
+        return;
+    }
+    if (dsMaterialRetained_) {
+        dsMaterialRetained_->DiscardRetainedFrameMeshData();
+    }
+
+    const auto queryResults = renderableQuery_.GetResults();
+    const size_t resultCount = queryResults.size();
+    const size_t threadCount = threadPool_ ? threadPool_->GetNumberOfThreads() : 0U;
+    if (dsMaterialRetained_ && (threadCount > 0U) && (resultCount >= (MIN_RENDERABLES_PER_TASK * 2U))) {
+        // rows are gathered in chunks to per task buffers, and the data store adds the buffers in order. The last
+        // range and the remainder are processed in the calling thread.
+        const size_t taskSize = Math::max(MIN_RENDERABLES_PER_TASK, resultCount / (threadCount + 1U));
+        const size_t tasks = (resultCount / taskSize) - 1U;
+        dsMaterialRetained_->SetFrameRenderMeshBufferCount(static_cast<uint32_t>(tasks + 1U));
+
+        renderableTasks_.clear();
+        renderableTasks_.reserve(tasks);
+        renderableTaskResults_.clear();
+        renderableTaskResults_.reserve(tasks);
+        for (size_t i = 0; i < tasks; ++i) {
+            auto& task = renderableTasks_.emplace_back(
+                *this, array_view(queryResults.data() + i * taskSize, taskSize), static_cast<uint32_t>(i));
+            renderableTaskResults_.push_back(threadPool_->Push(IThreadPool::ITask::Ptr{&task}));
+        }
+        ProcessRenderableRows(array_view(queryResults.data() + tasks * taskSize, resultCount - tasks * taskSize),
+            static_cast<uint32_t>(tasks));
+        for (const auto& result : renderableTaskResults_) {
+            result->Wait();
+        }
+    } else {
+        for (const auto& row : queryResults) {
+            RenderMeshData rmd;
             RenderMeshSkinData rmsd;
-            if (row.IsValidComponentId(RQ_SM) && row.IsValidComponentId(RQ_JM) && row.IsValidComponentId(RQ_PJM)) {
-                jointId = row.components[RQ_JM];
-                prevJointId = row.components[RQ_PJM];
-                if (auto skin = skinMgr_->Read(row.components[RQ_SM])) {
-                    rmsd.id = skin->skinRoot.id;
-                } else {
-                    static_assert(RenderSceneDataConstants::INVALID_INDEX == INVALID_ENTITY);
-                    rmsd.id = RenderSceneDataConstants::INVALID_INDEX;
-                }
-                auto const jointMatricesData = jointMatricesMgr_->Read(jointId);
-                auto const prevJointMatricesData = prevJointMatricesMgr_->Read(prevJointId);
-                const SkinProcessData spd{&(*jointMatricesData), &(*prevJointMatricesData)};
-
-                PLUGIN_ASSERT(spd.prevJointMatricesComponent);
-                rmsd.skinJointMatrices = array_view<Math::Mat4X4 const>(
-                    spd.jointMatricesComponent->jointMatrices, spd.jointMatricesComponent->count);
-                rmsd.prevSkinJointMatrices = array_view<Math::Mat4X4 const>(
-                    spd.prevJointMatricesComponent->jointMatrices, spd.prevJointMatricesComponent->count);
-                rmsd.aabb.minAabb = spd.jointMatricesComponent->jointsAabbMin;
-                rmsd.aabb.maxAabb = spd.jointMatricesComponent->jointsAabbMax;
+            RenderMeshBatchData renderMeshBatch;
+            if (GetRenderableData(row, rmd, rmsd, renderMeshBatch)) {
+                dsMaterial_->AddFrameRenderMeshData(rmd, rmsd, renderMeshBatch);
             }
-
-            dsMaterial_->AddFrameRenderMeshData(rmd, rmsd, renderMeshBatch);
         }
     }
 
     // force submission
     dsMaterial_->SubmitFrameMeshData();
+
+    retainedGenerations_ = {jointMatricesMgr_->GetGenerationCounter(), prevJointMatricesMgr_->GetGenerationCounter(),
+        layerMgr_->GetGenerationCounter(), nodeMgr_->GetGenerationCounter(), renderMeshMgr_->GetGenerationCounter(),
+        skinMgr_->GetGenerationCounter(), worldMatrixMgr_->GetGenerationCounter()};
+    renderableRowGenerations_.resize(resultCount);
+    for (size_t i = 0U; i < resultCount; ++i) {
+        renderableRowGenerations_[i] = GetRenderableRowGenerations(queryResults[i]);
+    }
 }
 
 void RenderSystem::ProcessEnvironments(const RenderConfigurationComponent& renderConfig)
@@ -2350,25 +2517,6 @@ void RenderSystem::ProcessReflection(const ComponentQuery::ResultRow& row,
     // (3) RenderMeshComponent
     const WorldMatrixComponent reflectionPlaneMatrix = worldMatrixMgr_->Get(row.components[1u]);
 
-    // cull plane (sphere) from camera
-    bool insideFrustum = true;
-    if (frustumUtil_ && picking_) {
-        const RenderMeshComponent rmc = renderMeshMgr_->Get(row.components[3U]);
-        if (const auto meshHandle = meshMgr_->Read(rmc.mesh); meshHandle) {
-            // frustum planes created without jitter
-            const Frustum frustum = frustumUtil_->CreateFrustum(camera.matrices.proj * camera.matrices.view);
-            const auto mam =
-                picking_->GetWorldAABB(reflectionPlaneMatrix.matrix, meshHandle->aabbMin, meshHandle->aabbMax);
-            const float radius = Math::Magnitude(mam.maxAABB - mam.minAABB) * 0.5f;
-            const Math::Vec3 pos = Math::Vec3(reflectionPlaneMatrix.matrix[3U]);
-            insideFrustum = frustumUtil_->SphereFrustumCollision(frustum, pos, radius);
-            // NOTE: add normal check for camera (cull based on normal and camera view)
-        }
-    }
-    if (!insideFrustum) {
-        return;  // early out
-    }
-
     // Calculate reflected view matrix from camera matrix.
     // Reflection plane.
     const Math::Vec3 translation = reflectionPlaneMatrix.matrix.w;
@@ -2480,13 +2628,26 @@ void RenderSystem::ProcessReflections(const RenderScene& renderScene)
         return;  // early out
     }
 
-    constexpr RenderCamera::Flags disableFlags{RenderCamera::CAMERA_FLAG_REFLECTION_BIT |
-                                               RenderCamera::CAMERA_FLAG_SHADOW_BIT |
-                                               RenderCamera::CAMERA_FLAG_OPAQUE_BIT};
-    constexpr RenderCamera::Flags enableFlags{RenderCamera::CAMERA_FLAG_ALLOW_REFLECTION_BIT};
+    const auto reflectsCamera = [](const RenderCamera& cam) {
+        constexpr RenderCamera::Flags disableFlags{RenderCamera::CAMERA_FLAG_REFLECTION_BIT |
+                                                   RenderCamera::CAMERA_FLAG_SHADOW_BIT |
+                                                   RenderCamera::CAMERA_FLAG_OPAQUE_BIT};
+        constexpr RenderCamera::Flags enableFlags{RenderCamera::CAMERA_FLAG_ALLOW_REFLECTION_BIT};
+        return ((cam.flags & disableFlags) == 0) && ((cam.flags & enableFlags) != 0);
+    };
+
+    // first gather the active planes and their bounding spheres, the spheres are culled against all cameras at once
+    vector<const ComponentQuery::ResultRow*> planeRows;
+    vector<PlanarReflectionComponent> planeComponents;
+    vector<uint32_t> planeSceneIds;
+    vector<float> planeSpheres[4U];
+    planeRows.reserve(queryResults.size());
+    planeComponents.reserve(queryResults.size());
+    planeSceneIds.reserve(queryResults.size());
+    for (auto& sphereData : planeSpheres) {
+        sphereData.reserve(queryResults.size());
+    }
     for (const auto& row : queryResults) {
-        // first loop all cameras to get the maximum size for this frame
-        // might be visible with multiple cameras with different camera sizes
         // ReflectionsQuery has four required components:
         // (0) PlanarReflectionComponent
         // (1) WorldMatrixComponent
@@ -2501,18 +2662,62 @@ void RenderSystem::ProcessReflections(const RenderScene& renderScene)
         if ((rc.additionalFlags & PlanarReflectionComponent::FlagBits::ACTIVE_RENDER_BIT) == 0) {
             continue;
         }
+        // planes without bounds are never culled
+        const Math::Mat4X4 world = worldMatrixMgr_->Get(row.components[1u]).matrix;
+        Math::Vec3 pos = Math::Vec3(world[3U]);
+        float radius = std::numeric_limits<float>::infinity();
+        if (picking_) {
+            const RenderMeshComponent rmc = renderMeshMgr_->Get(row.components[3U]);
+            if (const auto meshHandle = meshMgr_->Read(rmc.mesh); meshHandle) {
+                const auto mam = picking_->GetWorldAABB(world, meshHandle->aabbMin, meshHandle->aabbMax);
+                radius = Math::Magnitude(mam.maxAABB - mam.minAABB) * 0.5f;
+            }
+        }
+        planeRows.push_back(&row);
+        planeComponents.push_back(rc);
+        planeSceneIds.push_back(nodeComponent.sceneId);
+        planeSpheres[0U].push_back(pos.x);
+        planeSpheres[1U].push_back(pos.y);
+        planeSpheres[2U].push_back(pos.z);
+        planeSpheres[3U].push_back(radius);
+    }
+
+    // cull plane (sphere) from camera
+    // NOTE: add normal check for camera (cull based on normal and camera view)
+    const size_t visibilityWords = (planeRows.size() + 63U) / 64U;
+    vector<uint64_t> planeVisibility(cameras.size() * visibilityWords, ~0ULL);
+    if (frustumUtil_ && !planeRows.empty()) {
+        const FrustumSpheres spheres{planeSpheres[0U], planeSpheres[1U], planeSpheres[2U], planeSpheres[3U]};
+        for (size_t camIdx = 0U; camIdx < cameras.size(); ++camIdx) {
+            const auto& cam = cameras[camIdx];
+            if (reflectsCamera(cam)) {
+                // frustum planes created without jitter
+                const Frustum frustum = frustumUtil_->CreateFrustum(cam.matrices.proj * cam.matrices.view);
+                frustumUtil_->SpheresFrustumCollision({&frustum, 1U}, spheres,
+                    {planeVisibility.data() + (camIdx * visibilityWords), visibilityWords});
+            }
+        }
+    }
+
+    for (size_t planeIdx = 0U; planeIdx < planeRows.size(); ++planeIdx) {
+        const PlanarReflectionComponent& rc = planeComponents[planeIdx];
+        const uint32_t sceneId = planeSceneIds[planeIdx];
+        // first loop all cameras to get the maximum size for this frame
+        // might be visible with multiple cameras with different camera sizes
         Math::UVec2 targetRes = {0U, 0U};
         for (const auto& cam : cameras) {
-            if (((cam.flags & disableFlags) == 0) && ((cam.flags & enableFlags) != 0) &&
-                (cam.sceneId == nodeComponent.sceneId)) {
+            if (reflectsCamera(cam) && (cam.sceneId == sceneId)) {
                 ProcessReflectionTargetSize(rc, cam, targetRes);
             }
         }
         // then process with correct frame target resolution
-        for (const auto& cam : cameras) {
-            if (((cam.flags & disableFlags) == 0) && ((cam.flags & enableFlags) != 0) &&
-                (cam.sceneId == nodeComponent.sceneId)) {
-                ProcessReflection(row, rc, cam, targetRes);
+        const size_t visibilityWord = planeIdx / 64U;
+        const uint64_t visibilityBit = 1ULL << (planeIdx % 64U);
+        for (size_t camIdx = 0U; camIdx < cameras.size(); ++camIdx) {
+            const auto& cam = cameras[camIdx];
+            if (reflectsCamera(cam) && (cam.sceneId == sceneId) &&
+                (planeVisibility[(camIdx * visibilityWords) + visibilityWord] & visibilityBit)) {
+                ProcessReflection(*planeRows[planeIdx], rc, cam, targetRes);
             }
         }
     }
@@ -3343,17 +3548,49 @@ void RenderSystem::HandleLightProbeDestroyEvents() noexcept
     }
 }
 
+LightProbeVolumeOpt RenderSystem::GetLightProbeVolumeFromMainCamera(const LightProbeLocator*& locator) const
+{
+    locator = nullptr;
+    if (!dsLightProbe_) {
+        return {};
+    }
+    const Entity lightProbeGroupEntity =
+        GetLightProbeGroupFromMainCamera(ecs_.GetEntityManager(), cameraMgr_, lightProbeMgr_, nodeMgr_, layerMgr_);
+    if (!EntityUtil::IsValid(lightProbeGroupEntity)) {
+        return {};
+    }
+    if (dsLightProbeLocator_) {
+        locator = dsLightProbeLocator_->GetLightProbeLocator(lightProbeGroupEntity.id);
+    }
+    return dsLightProbe_->GetLightProbeVolume(lightProbeGroupEntity.id);
+}
+
+LightProbeInterpolatedDataOpt RenderSystem::GetInterpolatedLightProbeData(
+    const LightProbeVolume& lightProbeVolume, const LightProbeLocator* locator, const RenderSubmesh& submesh)
+{
+    if (!locator) {
+        return LightProbeUtil::GetInterpolatedLightProbeData(lightProbeVolume, submesh.bounds.worldCenter);
+    }
+    // start from the tetrahedron where the render mesh was in the previous frame
+    uint32_t& hint = lightProbeTetrahedronHints_[submesh.indices.id];
+    return LightProbeUtil::GetInterpolatedLightProbeData(lightProbeVolume, *locator, submesh.bounds.worldCenter, hint);
+}
+
 void RenderSystem::ProcessLightProbeShRecalculate() noexcept
 {
 #if (CORE3D_DEV_ENABLED == 1)
     CORE_CPU_PERF_SCOPE("CORE3D", "RenderSystem", "ProcessLightProbeShRecalculate", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
-    const auto& lightProbeVolumeOpt = GetLightProbesVolumeFromMainCamera(
-        ecs_.GetEntityManager(), cameraMgr_, lightProbeMgr_, nodeMgr_, layerMgr_, dsLightProbe_);
+    const LightProbeLocator* locator = nullptr;
+    const auto lightProbeVolumeOpt = GetLightProbeVolumeFromMainCamera(locator);
     if (!lightProbeVolumeOpt) {
         return;
     }
     const auto& submeshes = dsMaterial_->GetSubmeshes();
+    // drop the hints of removed render meshes now and then, stale hints only cost a longer walk
+    if (lightProbeTetrahedronHints_.size() > (submeshes.size() * 2U)) {
+        lightProbeTetrahedronHints_.clear();
+    }
     const auto& submeshesMaterialFlags = dsMaterial_->GetSubmeshMaterialFlags();
     for (size_t i = 0U; i < submeshes.size(); ++i) {
         auto& submesh = submeshes[i];
@@ -3366,8 +3603,7 @@ void RenderSystem::ProcessLightProbeShRecalculate() noexcept
         if ((renderSubmeshMaterialFlags & RENDER_MATERIAL_LIGHT_PROBE_RECEIVER_BIT) == 0) {
             continue;
         }
-        auto lightProbeShOpt = LightProbeUtil::GetInterpolatedLightProbeData(
-            lightProbeVolumeOpt.lightProbeVolume, submesh.bounds.worldCenter);
+        auto lightProbeShOpt = GetInterpolatedLightProbeData(lightProbeVolumeOpt.lightProbeVolume, locator, submesh);
 
         auto updatedRenderSubmeshMaterialFlags =
             GetSubmeshRenderMaterialFlag(lightProbeShOpt, renderSubmeshMaterialFlags);
@@ -3390,8 +3626,8 @@ void RenderSystem::HandleRecalculateCertainLightProbeShEvents() noexcept
     CORE_CPU_PERF_SCOPE(
         "CORE3D", "RenderSystem", "HandleRecalculateCertainLightProbeShEvents", CORE3D_PROFILER_DEFAULT_COLOR);
 #endif
-    const auto& lightProbeVolumeOpt = GetLightProbesVolumeFromMainCamera(
-        ecs_.GetEntityManager(), cameraMgr_, lightProbeMgr_, nodeMgr_, layerMgr_, dsLightProbe_);
+    const LightProbeLocator* locator = nullptr;
+    const auto lightProbeVolumeOpt = GetLightProbeVolumeFromMainCamera(locator);
 
     if (!lightProbeVolumeOpt) {
         PLUGIN_LOG_E("HandleRecalculateCertainLightProbeShEvents invalid light probe volume");
@@ -3418,8 +3654,8 @@ void RenderSystem::HandleRecalculateCertainLightProbeShEvents() noexcept
             if ((renderSubmeshMaterialFlags & RENDER_MATERIAL_LIGHT_PROBE_RECEIVER_BIT) == 0) {
                 continue;
             }
-            auto lightProbeShOpt = LightProbeUtil::GetInterpolatedLightProbeData(
-                lightProbeVolumeOpt.lightProbeVolume, submesh.bounds.worldCenter);
+            auto lightProbeShOpt =
+                GetInterpolatedLightProbeData(lightProbeVolumeOpt.lightProbeVolume, locator, submesh);
 
             auto updatedRenderSubmeshMaterialFlags =
                 GetSubmeshRenderMaterialFlag(lightProbeShOpt, renderSubmeshMaterialFlags);
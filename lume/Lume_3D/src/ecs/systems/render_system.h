@@ -28,6 +28,7 @@
 #include <base/math/vector.h>
 #include <core/namespace.h>
 #include <core/property_tools/property_api_impl.h>
+#include <core/threading/intf_thread_pool.h>
 #include <render/namespace.h>
 #include <render/resource_handle.h>
 
@@ -80,6 +81,9 @@ class IRenderDataStoreDefaultLight;
 class IRenderDataStoreLightProbe;
 class IRenderDataStoreDefaultMaterial;
 class IRenderDataStoreDefaultScene;
+class RenderDataStoreDefaultMaterial;
+class RenderDataStoreLightProbe;
+class LightProbeLocator;
 
 class IRenderPreprocessorSystem;
 class ITransformComponentManager;
@@ -166,6 +170,23 @@ private:
     RenderConfigurationComponent GetRenderConfigurationComponent();
     CORE_NS::Entity ProcessScene(const RenderConfigurationComponent& sc);
     void ProcessRenderables();
+    // reads the render mesh data of a renderable row, returns false if the renderable is not rendered
+    bool GetRenderableData(const CORE_NS::ComponentQuery::ResultRow& row, RenderMeshData& rmd,
+        RenderMeshSkinData& rmsd, RenderMeshBatchData& renderMeshBatch) const;
+    // adds the rows to a per thread buffer of the material data store
+    void ProcessRenderableRows(
+        BASE_NS::array_view<const CORE_NS::ComponentQuery::ResultRow> rows, uint32_t bufferIndex);
+    // patches the retained render mesh data of the previous frame, returns false if a full update is needed
+    bool ProcessRetainedRenderables(bool renderablesChanged);
+    // patches the renderables whose components have changed after their render mesh data was added
+    bool PatchRetainedRenderables();
+    struct RenderableRowGenerations {
+        uint32_t worldMatrix = 0U;
+        uint32_t layer = 0U;
+        uint32_t joint = 0U;
+        uint32_t prevJoint = 0U;
+    };
+    RenderableRowGenerations GetRenderableRowGenerations(const CORE_NS::ComponentQuery::ResultRow& row) const;
     void ProcessEnvironments(const RenderConfigurationComponent& sceneComponent);
     void ProcessCameras(const RenderConfigurationComponent& sceneComponent, const CORE_NS::Entity& mainCameraEntity,
         RenderScene& renderScene);
@@ -185,6 +206,9 @@ private:
 
     void ProcessRenderNodeGraphs(const RenderConfigurationComponent& renderConfig, const RenderScene& renderScene);
     void ProcessLightProbeShRecalculate() noexcept;
+    LightProbeVolumeOpt GetLightProbeVolumeFromMainCamera(const LightProbeLocator*& locator) const;
+    LightProbeInterpolatedDataOpt GetInterpolatedLightProbeData(
+        const LightProbeVolume& lightProbeVolume, const LightProbeLocator* locator, const RenderSubmesh& submesh);
     void DestroyRenderDataStores();
     CameraRngsOutput GetCameraRenderNodeGraphs(const RenderScene& renderScene, const RenderCamera& renderCamera);
     RENDER_NS::RenderHandleReference GetSceneRenderNodeGraph(const RenderScene& renderScene);
@@ -213,8 +237,12 @@ private:
     BASE_NS::refcnt_ptr<IRenderDataStoreDefaultCamera> dsCamera_;
     BASE_NS::refcnt_ptr<IRenderDataStoreDefaultLight> dsLight_;
     BASE_NS::refcnt_ptr<IRenderDataStoreDefaultMaterial> dsMaterial_;
+    // same as dsMaterial_ when the default implementation is in use, for retained render mesh data
+    RenderDataStoreDefaultMaterial* dsMaterialRetained_ = nullptr;
     BASE_NS::refcnt_ptr<IRenderDataStoreDefaultScene> dsScene_;
     BASE_NS::refcnt_ptr<IRenderDataStoreLightProbe> dsLightProbe_;
+    // same as dsLightProbe_ when the default implementation is in use, for the light probe search structures
+    RenderDataStoreLightProbe* dsLightProbeLocator_ = nullptr;
     BASE_NS::refcnt_ptr<RENDER_NS::IRenderDataStoreRenderPostProcesses> dsRenderPostProcesses_;
     RENDER_NS::IShaderManager* shaderMgr_ = nullptr;
     RENDER_NS::IGpuResourceManager* gpuResourceMgr_ = nullptr;
@@ -269,6 +297,23 @@ private:
     uint32_t materialGeneration_ = 0U;
     uint32_t meshGeneration_ = 0U;
 
+    // generations of the retained render mesh data
+    struct RetainedRenderableGenerations {
+        uint32_t joint = 0U;
+        uint32_t prevJoint = 0U;
+        uint32_t layer = 0U;
+        uint32_t node = 0U;
+        uint32_t renderMesh = 0U;
+        uint32_t skin = 0U;
+        uint32_t worldMatrix = 0U;
+    };
+    RetainedRenderableGenerations retainedGenerations_;
+    // component generations of each renderable query row when its render mesh data was added
+    BASE_NS::vector<RenderableRowGenerations> renderableRowGenerations_;
+
+    // tetrahedron of the light probe volume where each render mesh was found last
+    BASE_NS::unordered_map<uint64_t, uint32_t> lightProbeTetrahedronHints_;
+
     BASE_NS::vector<CORE_NS::Entity> graphicsStateModifiedEvents_;
     BASE_NS::vector<CORE_NS::Entity> materialModifiedEvents_;
     BASE_NS::vector<CORE_NS::Entity> materialDestroyedEvents_;
@@ -301,6 +346,11 @@ private:
 
     CORE_NS::PropertyApiImpl<IRenderSystem::Properties> RENDER_SYSTEM_PROPERTIES;
 
+    CORE_NS::IThreadPool::Ptr threadPool_;
+    class RenderableTask;
+    BASE_NS::vector<RenderableTask> renderableTasks_;
+    BASE_NS::vector<CORE_NS::IThreadPool::IResult::Ptr> renderableTaskResults_;
+
     uint64_t totalTime_{0u};
     uint64_t deltaTime_{0u};
     uint64_t frameIndex_{0u};
@@ -62,6 +62,7 @@
 #include "gltf/data.h"
 #include "gltf/gltf2_data_structures.h"
 #include "gltf/gltf2_util.h"
+#include "util/animation_compression.h"
 #include "util/json_util.h"
 #include "util/log.h"
 
@@ -775,15 +776,24 @@ Accessor* AnimationInput(
     return {};
 }
 
-Accessor* AnimationOutput(const IAnimationOutputComponentManager& outputManager, const Entity& animationOutput,
-    AnimationPath type, BufferHelper& bufferHelper)
+Accessor* AnimationOutput(const IAnimationInputComponentManager& inputManager, const Entity& animationInput,
+    const IAnimationOutputComponentManager& outputManager, const Entity& animationOutput, AnimationPath type,
+    AnimationTrackComponent::Interpolation mode, BufferHelper& bufferHelper)
 {
     Accessor accessor;
     // Setup the accessor to match the keyframe data for current animation type. Translation and scale are vec3s,
     // rotation is quaternions, and morph animation is floats.
     auto outputData = array_view<const uint8_t>();
+    // glTF has no quantized keyframes, those are resampled at the timestamps of the input.
+    vector<uint8_t> decompressed;
     if (auto outputHandle = outputManager.Read(animationOutput); outputHandle) {
         outputData = outputHandle->data;
+        if (outputHandle->encoding == AnimationOutputComponent::Encoding::QUANTIZED) {
+            if (auto inputHandle = inputManager.Read(animationInput); inputHandle) {
+                decompressed = AnimationCompression::Decompress(outputData, mode, inputHandle->timestamps);
+            }
+            outputData = decompressed;
+        }
         switch (type) {
             case AnimationPath::TRANSLATION:
             case AnimationPath::SCALE: {
@@ -821,8 +831,8 @@ unique_ptr<AnimationSampler> CreateAnimationSampler(const AnimationTrackComponen
     auto exportSampler = make_unique<AnimationSampler>();
     exportSampler->interpolation = GetAnimationInterpolation(trackComponent.interpolationMode);
     exportSampler->input = AnimationInput(animationInputManager, trackComponent.timestamps, bufferHelper);
-    exportSampler->output =
-        AnimationOutput(animationOutputManager, trackComponent.data, GetAnimationPath(trackComponent), bufferHelper);
+    exportSampler->output = AnimationOutput(animationInputManager, trackComponent.timestamps, animationOutputManager,
+        trackComponent.data, GetAnimationPath(trackComponent), trackComponent.interpolationMode, bufferHelper);
     return exportSampler;
 }
 
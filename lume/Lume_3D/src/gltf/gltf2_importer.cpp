@@ -76,6 +76,7 @@
 #include <render/intf_render_context.h>
 
 #include "gltf/gltf2_util.h"
+#include "util/animation_compression.h"
 #include "util/log.h"
 #include "util/mesh_builder.h"
 #include "util/mesh_util.h"
@@ -89,11 +90,17 @@ using namespace RENDER_NS;
 
 namespace {
 // How many threads the GLTF2Importer will use to run tasks.
-constexpr const uint32_t IMPORTER_THREADS = 2u;
+constexpr const uint32_t MIN_IMPORTER_THREADS = 2u;
+constexpr const uint32_t MAX_IMPORTER_THREADS = 4u;
 constexpr string_view POD_DATA_STORE_NAME{"RenderDataStorePod"};
 constexpr string_view VERTEX_INPUT_DECLARATIONS{"VertexInputDeclarations"};
 constexpr string_view BASE_COLOR_FLAGS{"BaseColorFlags"};
 constexpr string_view MIPMAPS_FLAG{"MipmapsFlag"};
+#if (CORE_PERF_ENABLED == 1)
+constexpr string_view IMPORT_PHASE_NAMES[] = {"Buffers", "Samplers", "Images", "Textures", "Materials",
+    "AnimationSamplers", "Animations", "Skins", "Meshes"};
+static_assert(countof(IMPORT_PHASE_NAMES) == static_cast<size_t>(GLTF2::ImportPhase::FINISHED));
+#endif
 
 // Helper class for running lambda as a ThreadPool task.
 template <typename Fn>
@@ -122,6 +129,16 @@ inline IThreadPool::ITask::Ptr CreateFunctionTask(Fn&& func)
     return IThreadPool::ITask::Ptr{new FunctionTask<Fn>(BASE_NS::move(func))};
 }
 
+IThreadPool::Ptr CreateImporterThreadPool()
+{
+    // Leave one core for the thread executing the import tasks.
+    auto* factory = CORE3D_NS::GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY);
+    const uint32_t cores = factory->GetNumberOfCores();
+    const uint32_t threads =
+        Math::clamp((cores > 1u) ? (cores - 1u) : cores, MIN_IMPORTER_THREADS, MAX_IMPORTER_THREADS);
+    return factory->CreateThreadPool(threads);
+}
+
 template <class T>
 size_t FindIndex(const vector<unique_ptr<T>>& container, T const* item)
 {
@@ -1528,6 +1545,31 @@ bool BuildAnimationOutput(GLTF2::Data const& data, IFileManager& fileManager, GL
     return animationOutputDataResult.success;
 }
 
+// Replaces the raw keyframes of translation, rotation and scale tracks with quantized data. Tracks which aren't
+// supported or don't compress are kept as is.
+void CompressAnimationOutput(GLTF2::Data const& data, IFileManager& fileManager, const GLTF2::AnimationSampler& sampler,
+    GLTF2::AnimationPath path, AnimationOutputComponent& outputComponent)
+{
+    if ((path != GLTF2::AnimationPath::TRANSLATION) && (path != GLTF2::AnimationPath::ROTATION) &&
+        (path != GLTF2::AnimationPath::SCALE)) {
+        return;
+    }
+    const auto mode = ConvertAnimationInterpolation(sampler.interpolation);
+    if (mode == AnimationTrackComponent::Interpolation::SPLINE) {
+        return;
+    }
+    AnimationInputComponent input;
+    if (!BuildAnimationInput(data, fileManager, *sampler.input, input)) {
+        return;
+    }
+    if (auto compressed = AnimationCompression::Compress(outputComponent.type, mode, input.timestamps,
+            outputComponent.data);
+        !compressed.empty()) {
+        outputComponent.data = move(compressed);
+        outputComponent.encoding = AnimationOutputComponent::Encoding::QUANTIZED;
+    }
+}
+
 #if defined(GLTF2_EXTENSION_KHR_TEXTURE_TRANSFORM)
 void FillTextureTransform(const GLTF2::TextureInfo& textureInfo, MaterialComponent::TextureTransform& desc)
 {
@@ -2959,8 +3001,7 @@ GLTF2Importer::GLTF2Importer(IEngine& engine, IRenderContext& renderContext, IEc
 }
 
 GLTF2Importer::GLTF2Importer(IEngine& engine, IRenderContext& renderContext, IEcs& ecs)
-    : GLTF2Importer(engine, renderContext, ecs,
-          *GetInstance<ITaskQueueFactory>(UID_TASK_QUEUE_FACTORY)->CreateThreadPool(IMPORTER_THREADS))
+    : GLTF2Importer(engine, renderContext, ecs, *CreateImporterThreadPool())
 {}
 
 GLTF2Importer::~GLTF2Importer()
@@ -3079,6 +3120,9 @@ void GLTF2Importer::ImportGLTF(const IGLTFData& data, const GltfImportOptions& o
     for (auto& finishedGatherTasks : finishedGatherTasks_) {
         finishedGatherTasks.clear();
     }
+    for (auto& gatherTime : gatherTimes_) {
+        gatherTime = 0;
+    }
 
     // Build tasks.
     Prepare();
@@ -3086,11 +3130,9 @@ void GLTF2Importer::ImportGLTF(const IGLTFData& data, const GltfImportOptions& o
     // Fill in task queues for first tasks.
     StartPhase(ImportPhase::BUFFERS);
 
-    // Run until completed.
+    // Run until completed, importing gathered data as soon as it is available.
     while (!Execute(0)) {
-        if (gatherResults_[static_cast<uint32_t>(phase_)]) {
-            gatherResults_[static_cast<uint32_t>(phase_)]->Wait();
-        }
+        WaitGatherTasks();
     }
 }
 
@@ -3136,6 +3178,15 @@ void GLTF2Importer::ImportGLTFAsync(const IGLTFData& data, const GltfImportOptio
         StartPhase(ImportPhase::FINISHED);
         return;
     }
+    for (auto& pendingGatherTasks : pendingGatherTasks_) {
+        pendingGatherTasks = 0U;
+    }
+    for (auto& finishedGatherTasks : finishedGatherTasks_) {
+        finishedGatherTasks.clear();
+    }
+    for (auto& gatherTime : gatherTimes_) {
+        gatherTime = 0;
+    }
 
     // Build tasks.
     Prepare();
@@ -3184,17 +3235,25 @@ void GLTF2Importer::LaunchGatherTasks(size_t firstTask, ImportPhase phase)
     auto first = tasks_.begin() + static_cast<ptrdiff_t>(firstTask);
     const auto end = tasks_.end();
     const auto taskCount = static_cast<size_t>(std::distance(first, end));
-    vector<const IThreadPool::ITask*> tasks;
-    tasks.reserve(taskCount);
-    while (first != end) {
-        auto& task = **first;
-        if (task.phase == phase) {
-            task.state = ImporterTask::State::Gather;
-            auto threadTask = IThreadPool::ITask::Ptr{new GatherThreadTask(*this, task)};
-            tasks.push_back(threadTask.get());
-            threadPool_->PushNoWait(BASE_NS::move(threadTask), BASE_NS::array_view(&bufferTask_, 1U));
+    vector<ImporterTask*> gatherTasks;
+    gatherTasks.reserve(taskCount);
+    for (; first != end; ++first) {
+        if ((*first)->phase == phase) {
+            gatherTasks.push_back(first->get());
         }
-        ++first;
+    }
+    {
+        // Counted before pushing as the tasks may finish immediately.
+        std::lock_guard lock(gatherTasksLock_);
+        pendingGatherTasks_[static_cast<uint32_t>(phase)] += gatherTasks.size();
+    }
+    vector<const IThreadPool::ITask*> tasks;
+    tasks.reserve(gatherTasks.size());
+    for (auto* task : gatherTasks) {
+        task->state = ImporterTask::State::Gather;
+        auto threadTask = IThreadPool::ITask::Ptr{new GatherThreadTask(*this, *task)};
+        tasks.push_back(threadTask.get());
+        threadPool_->PushNoWait(BASE_NS::move(threadTask), BASE_NS::array_view(&bufferTask_, 1U));
     }
     // Add a task which waits for all the gather tasks for this cateory.
     if (!tasks.empty()) {
@@ -3284,19 +3343,25 @@ bool GLTF2Importer::ProgressTask(ImporterTask& task)
 
 void GLTF2Importer::Gather(ImporterTask& task)
 {
+    const auto phase = static_cast<uint32_t>(task.phase);
     {
         CORE_CPU_PERF_SCOPE("CORE3D", "Gather", task.name, CORE3D_PROFILER_DEFAULT_COLOR);
 
+        const auto start = std::chrono::steady_clock::now();
         if (cancelled_ || !task.gather()) {
             task.success = false;
         }
+        gatherTimes_[phase] += std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
     }
 
     {
         // Mark task completed.
         std::lock_guard lock(gatherTasksLock_);
-        finishedGatherTasks_[static_cast<uint32_t>(task.phase)].push_back(task.id);
+        finishedGatherTasks_[phase].push_back(task.id);
+        --pendingGatherTasks_[phase];
     }
+    gatherTasksCondition_.notify_one();
 }
 
 void GLTF2Importer::Import(ImporterTask& task)
@@ -3482,6 +3547,15 @@ void FillMeshDataForCpuAccess(
 
 void GLTF2Importer::StartPhase(ImportPhase phase)
 {
+    const auto now = std::chrono::steady_clock::now();
+    if (!tasks_.empty()) {
+        if (phase_ < phase) {
+            ReportPhaseTiming(phase, now);
+        } else if (phase == ImportPhase::BUFFERS) {
+            importStartTime_ = now;
+        }
+    }
+    phaseStartTime_ = now;
     phase_ = phase;
     pendingImportTasks_ = 0;
     completedTasks_ = 0;
@@ -3513,10 +3587,9 @@ void GLTF2Importer::StartPhase(ImportPhase phase)
 
 GLTF2Importer::ImporterTask* GLTF2Importer::FindTaskById(uint64_t id)
 {
-    for (size_t i = 0; i < tasks_.size(); ++i) {
-        if (tasks_[i]->id == id) {
-            return tasks_[i].get();
-        }
+    // QueueTask uses the index in tasks_ as the id.
+    if ((id < tasks_.size()) && (tasks_[id]->id == id)) {
+        return tasks_[id].get();
     }
 
     return nullptr;
@@ -3529,7 +3602,7 @@ bool GLTF2Importer::Execute(uint32_t timeBudget)
     }
 
     // Handle data gathering.
-    HandleGatherTasks();
+    const bool gatherDone = HandleGatherTasks();
 
     // 'timeBudget' is given in microseconds
     const auto budget = std::chrono::microseconds(timeBudget);
@@ -3557,8 +3630,7 @@ bool GLTF2Importer::Execute(uint32_t timeBudget)
     }
 
     // All tasks done for this phase?
-    if ((!gatherResults_[static_cast<uint32_t>(phase_)] || gatherResults_[static_cast<uint32_t>(phase_)]->IsDone()) &&
-        pendingImportTasks_ == 0) {
+    if (gatherDone && pendingImportTasks_ == 0) {
         // Proceed to next phase.
         StartPhase((ImportPhase)(phase_ + 1));
     }
@@ -3589,13 +3661,16 @@ void GLTF2Importer::HandleImportTasks()
     }
 }
 
-void GLTF2Importer::HandleGatherTasks()
+bool GLTF2Importer::HandleGatherTasks()
 {
     auto& result = gatherResults_[static_cast<uint32_t>(phase_)];
-    if (!result || !result->IsDone()) {
-        return;
+    if (!result) {
+        return true;
     }
 
+    // Finished tasks are moved to the import phase right away instead of waiting for the whole phase. Completion is
+    // checked before collecting the finished tasks so that none of them are left behind when the phase ends.
+    const bool done = result->IsDone();
     vector<uint64_t> finishedGatherTasks;
     {
         std::lock_guard lock(gatherTasksLock_);
@@ -3619,29 +3694,108 @@ void GLTF2Importer::HandleGatherTasks()
             }
         }
     }
+    return done;
+}
+
+void GLTF2Importer::WaitGatherTasks()
+{
+    const auto phase = static_cast<uint32_t>(phase_);
+    auto& result = gatherResults_[phase];
+    if (!result) {
+        return;
+    }
+
+    bool drained = false;
+    {
+        std::unique_lock lock(gatherTasksLock_);
+        gatherTasksCondition_.wait(
+            lock, [this, phase]() { return !finishedGatherTasks_[phase].empty() || !pendingGatherTasks_[phase]; });
+        drained = finishedGatherTasks_[phase].empty();
+    }
+    if (drained) {
+        // All the gather tasks have finished, the result is done right after.
+        result->Wait();
+    }
+}
+
+void GLTF2Importer::ReportPhaseTiming(ImportPhase nextPhase, std::chrono::steady_clock::time_point now)
+{
+#if (CORE_PERF_ENABLED == 1)
+    auto* factory = CORE3D_NS::GetInstance<IPerformanceDataManagerFactory>(UID_PERFORMANCE_FACTORY);
+    auto* perfData = factory ? factory->Get("CORE3D") : nullptr;
+    if (!perfData) {
+        return;
+    }
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    const auto phase = static_cast<uint32_t>(phase_);
+    // Wall time of the phase, and the time the threads spent gathering its data which may overlap earlier phases.
+    perfData->UpdateData(
+        "GLTF2ImporterPhase", IMPORT_PHASE_NAMES[phase], duration_cast<microseconds>(now - phaseStartTime_).count());
+    perfData->UpdateData("GLTF2ImporterGather", IMPORT_PHASE_NAMES[phase], gatherTimes_[phase].load());
+    if (nextPhase == ImportPhase::FINISHED) {
+        perfData->UpdateData("GLTF2Importer", "Import", duration_cast<microseconds>(now - importStartTime_).count());
+    }
+#endif
 }
 
 void GLTF2Importer::PrepareBufferTasks()
 {
-    // Buffers task.
     const auto firstTask = static_cast<ptrdiff_t>(tasks_.size());
-    auto task = make_unique<ImporterTask>();
-    task->name = "Load buffers";
-    task->phase = ImportPhase::BUFFERS;
-    task->gather = [this, t = task.get()]() -> bool {
-        BufferLoadResult result = LoadBuffers(data_, engine_.GetFileManager());
-        t->errors += result.error;
-        return result.success;
-    };
-    QueueTask(BASE_NS::move(task));
+    const auto bufferCount = data_->buffers.size();
+    // A GLB has all the buffers in one binary blob read through a shared file, so they are loaded in one gather.
+    // Buffers coming from separate files or data URIs are loaded in parallel.
+    if (data_->memoryFile_ || (bufferCount <= 1U)) {
+        auto task = make_unique<ImporterTask>();
+        task->name = "Load buffers";
+        task->phase = ImportPhase::BUFFERS;
+        task->gather = [this, t = task.get()]() -> bool {
+            BufferLoadResult result = LoadBuffers(data_, engine_.GetFileManager());
+            t->errors += result.error;
+            return result.success;
+        };
+        QueueTask(BASE_NS::move(task));
+    } else {
+        for (size_t i = 0; i < bufferCount; ++i) {
+            auto task = make_unique<ImporterTask>();
+            task->name = "Load buffer";
+            task->phase = ImportPhase::BUFFERS;
+            task->gather = [this, i, t = task.get()]() -> bool {
+                BufferLoadResult result = LoadBuffer(*data_, i, engine_.GetFileManager());
+                t->errors += result.error;
+                return result.success;
+            };
+            QueueTask(BASE_NS::move(task));
+        }
+    }
+    const auto taskCount = tasks_.size() - static_cast<size_t>(firstTask);
+    {
+        std::lock_guard lock(gatherTasksLock_);
+        pendingGatherTasks_[static_cast<uint32_t>(ImportPhase::BUFFERS)] += taskCount;
+    }
+    auto& result = gatherResults_[static_cast<uint32_t>(ImportPhase::BUFFERS)];
+    if (taskCount == 1U) {
+        auto& task = **(tasks_.begin() + firstTask);
+        task.state = ImporterTask::State::Gather;
+        auto threadTask = IThreadPool::ITask::Ptr{new GatherThreadTask(*this, task)};
+        bufferTask_ = threadTask.get();
+        result = threadPool_->Push(BASE_NS::move(threadTask));
+        return;
+    }
+
+    vector<const IThreadPool::ITask*> loadTasks;
+    loadTasks.reserve(taskCount);
+    for (auto it = tasks_.begin() + firstTask; it != tasks_.end(); ++it) {
+        (*it)->state = ImporterTask::State::Gather;
+        auto threadTask = IThreadPool::ITask::Ptr{new GatherThreadTask(*this, **it)};
+        loadTasks.push_back(threadTask.get());
+        threadPool_->PushNoWait(BASE_NS::move(threadTask));
+    }
 
-    // We're loading all the buffers in one gather. This is probably fine as typical glTF files have just one binary
-    // blob.
-    (*(tasks_.begin() + firstTask))->state = ImporterTask::State::Gather;
-    auto threadTask = IThreadPool::ITask::Ptr{new GatherThreadTask(*this, *(*(tasks_.begin() + firstTask)))};
+    // The rest of the gather tasks depend on the buffer views being ready.
+    auto threadTask = CreateFunctionTask([this]() { UpdateBufferViews(*data_); });
     bufferTask_ = threadTask.get();
-    ++pendingGatherTasks_[static_cast<uint32_t>(ImportPhase::BUFFERS)];
-    gatherResults_[static_cast<uint32_t>(ImportPhase::BUFFERS)] = threadPool_->Push(BASE_NS::move(threadTask));
+    result = threadPool_->Push(BASE_NS::move(threadTask), loadTasks);
 }
 
 void GLTF2Importer::PrepareSamplerTasks()
@@ -4122,8 +4276,14 @@ GLTF2Importer::GatheredDataTask<GLTF2Importer::ComponentTaskData<AnimationOutput
         auto task = make_unique<GatheredDataTask<ComponentTaskData<AnimationOutputComponent>>>();
         task->name = "Import animation output";
         task->phase = ImportPhase::ANIMATION_SAMPLERS;
-        task->gather = [this, accessor = track.sampler->output, path = track.channel.path, t = task.get()]() -> bool {
-            return BuildAnimationOutput(*data_, engine_.GetFileManager(), *accessor, path, t->data.component);
+        task->gather = [this, sampler = track.sampler, path = track.channel.path, t = task.get()]() -> bool {
+            if (!BuildAnimationOutput(*data_, engine_.GetFileManager(), *sampler->output, path, t->data.component)) {
+                return false;
+            }
+            if (flags_ & CORE_GLTF_IMPORT_RESOURCE_ANIMATION_COMPRESSED) {
+                CompressAnimationOutput(*data_, engine_.GetFileManager(), *sampler, path, t->data.component);
+            }
+            return true;
         };
         task->import = [em = &ecs_->GetEntityManager(), animationOutputManager, t = task.get()]() -> bool {
             t->data.entity = em->CreateReferenceCounted();
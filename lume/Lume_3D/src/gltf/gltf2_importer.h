@@ -17,6 +17,8 @@
 #define CORE__GLTF__GLTF2_IMPORTER_H
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
 
 #include <3d/gltf/gltf.h>
@@ -159,7 +161,9 @@ private:
     void CompleteTask(ImporterTask& task);
 
     void StartPhase(ImportPhase phase);
-    void HandleGatherTasks();
+    bool HandleGatherTasks();
+    void WaitGatherTasks();
+    void ReportPhaseTiming(ImportPhase nextPhase, std::chrono::steady_clock::time_point now);
     void HandleImportTasks();
     bool ResolveImportOptions(const GltfImportOptions& options);
     bool ResolveVertexInputDeclaration(BASE_NS::string_view vertexInputDeclarationPath);
@@ -196,9 +200,16 @@ private:
     GLTFImportResult result_;
 
     std::mutex gatherTasksLock_;
+    // Signaled when a gather task finishes.
+    std::condition_variable gatherTasksCondition_;
     BASE_NS::vector<uint64_t> finishedGatherTasks_[static_cast<uint32_t>(ImportPhase::FINISHED)];
 
+    // Gather tasks launched but not yet finished, guarded by gatherTasksLock_.
     size_t pendingGatherTasks_[static_cast<uint32_t>(ImportPhase::FINISHED)]{};
+    // Time spent in gather tasks in microseconds, summed over all the threads.
+    std::atomic_int64_t gatherTimes_[static_cast<uint32_t>(ImportPhase::FINISHED)]{};
+    std::chrono::steady_clock::time_point importStartTime_;
+    std::chrono::steady_clock::time_point phaseStartTime_;
     size_t pendingImportTasks_{0};
     size_t completedTasks_{0};
 
@@ -77,7 +77,7 @@ vector<uint8_t> Read(Accessor const& accessor)
     // this would allow progressing tasks depending on which part of a buffer has been loaded instead of waiting for the
     // whole buffer.
     if (accessor.bufferView && accessor.bufferView->meshoptCompression.buffer &&
-        !accessor.bufferView->meshoptCompression.buffer->data.empty()) {
+        !GetBufferData(*accessor.bufferView->meshoptCompression.buffer).empty()) {
 #if defined(__OHOS_PLATFORM__)
         // Open the dynamic meshopt library.
         void* handle = dlopen("libmeshoptimizer.z.so", RTLD_LAZY);
@@ -109,10 +109,11 @@ vector<uint8_t> Read(Accessor const& accessor)
         meshoptCompression.dataLock.Lock();
         if (meshoptCompression.data.empty()) {
             // meshoptCompression.byteOffset + byteLength validated against buffer->byteLength in
-            // ParseMeshoptCompression (gltf2_loader.cpp). ReadBufferFile guarantees buffer->data.size() >=
+            // ParseMeshoptCompression (gltf2_loader.cpp). ReadBufferFile guarantees buffer data size >=
             // buffer->byteLength.
             meshoptCompression.data.resize(accessor.bufferView->byteLength);
-            const uint8_t* compressed = meshoptCompression.buffer->data.data() + meshoptCompression.byteOffset;
+            const uint8_t* compressed =
+                GetBufferData(*meshoptCompression.buffer).data() + meshoptCompression.byteOffset;
             uint8_t* decompressed = meshoptCompression.data.data();
             if (meshoptCompression.mode == CompressionMode::ATTRIBUTES) {
                 const auto ret = meshopt_decodeVertexBuffer(decompressed,
@@ -355,6 +356,12 @@ BufferLoadResult ReadBufferFile(Buffer& buffer, IFile& file, const uint64_t offs
     if (remaining < buffer.byteLength) {
         return BufferLoadResult{false, "Buffer larger than file: " + buffer.uri + '\n'};
     }
+    // Files which are mapped to memory are used in place.
+    if (const auto mapped = file.GetMappedData(); (mapped.size() >= position) &&
+                                                  ((mapped.size() - position) >= buffer.byteLength)) {
+        buffer.mappedData = array_view(mapped.data() + position, buffer.byteLength);
+        return BufferLoadResult{};
+    }
     buffer.data.resize(buffer.byteLength);
     if (file.Read(buffer.data.data(), buffer.byteLength) != buffer.byteLength) {
         return BufferLoadResult{false, "Failed to read buffer: " + buffer.uri + '\n'};
@@ -384,7 +391,12 @@ BufferLoadResult LoadBuffer(Data const& data, Buffer& buffer, IFileManager& file
         return BufferLoadResult{false, "Failed open uri: " + buffer.uri + '\n'};
     }
 
-    return ReadBufferFile(buffer, *filePtr, offset);
+    auto result = ReadBufferFile(buffer, *filePtr, offset);
+    if (result.success && !buffer.mappedData.empty()) {
+        // Keep a file opened for this buffer alive while its data is used. The GLB file is owned by the data.
+        buffer.mappedFile = move(file);
+    }
+    return result;
 }
 
 void LoadSparseAccessor(Accessor const& accessor, GLTFLoadDataResult& result)
@@ -1316,29 +1328,55 @@ BufferLoadResult LoadBuffers(const Data* data, IFileManager& fileManager)
         return result;
     }
     // Load data to all buffers.
-    for (const auto& buffer : data->buffers) {
-        if (buffer && buffer->data.empty()) {
-#if defined(GLTF2_EXTENSION_EXT_MESHOPT_COMPRESSION)
-            if (data->meshCompression && (data->defaultResourcesOffset < 0) && buffer->uri.empty()) {
-                continue;
-            }
-#endif
-            result = LoadBuffer(*data, *buffer, fileManager);
-            if (!result.success) {
-                return result;
-            }
+    for (size_t i = 0; i < data->buffers.size(); ++i) {
+        result = LoadBuffer(*data, i, fileManager);
+        if (!result.success) {
+            return result;
         }
     }
 
+    UpdateBufferViews(*data);
+
+    return result;
+}
+
+BufferLoadResult LoadBuffer(const Data& data, size_t index, IFileManager& fileManager)
+{
+    if (index >= data.buffers.size()) {
+        return BufferLoadResult{false, "Invalid buffer index\n"};
+    }
+    const auto& buffer = data.buffers[index];
+    if (!buffer || !GetBufferData(*buffer).empty()) {
+        return BufferLoadResult{};
+    }
+#if defined(GLTF2_EXTENSION_EXT_MESHOPT_COMPRESSION)
+    if (data.meshCompression && (data.defaultResourcesOffset < 0) && buffer->uri.empty()) {
+        return BufferLoadResult{};
+    }
+#endif
+    return LoadBuffer(data, *buffer, fileManager);
+}
+
+void UpdateBufferViews(const Data& data)
+{
     // Set up bufferview data pointers. BufferView bounds (byteOffset + byteLength <= buffer->byteLength)
-    // are validated at parse time. ReadBufferFile guarantees buffer->data.size() >= buffer->byteLength.
-    for (const auto& view : data->bufferViews) {
-        if (view && view->buffer && (view->byteOffset < view->buffer->data.size())) {
-            view->data = &(view->buffer->data[view->byteOffset]);
+    // are validated at parse time. ReadBufferFile guarantees buffer data size >= buffer->byteLength.
+    for (const auto& view : data.bufferViews) {
+        if (!view || !view->buffer) {
+            continue;
+        }
+        if (const auto bufferData = GetBufferData(*view->buffer); view->byteOffset < bufferData.size()) {
+            view->data = bufferData.data() + view->byteOffset;
         }
     }
+}
 
-    return result;
+array_view<const uint8_t> GetBufferData(const Buffer& buffer)
+{
+    if (!buffer.mappedData.empty()) {
+        return buffer.mappedData;
+    }
+    return buffer.data;
 }
 
 UriLoadResult LoadUri(const string_view uri, const string_view expectedMimeType, const string_view filePath,
@@ -1487,6 +1525,8 @@ void Data::ReleaseBuffers()
     for (size_t i = 0u; i < buffers.size(); ++i) {
         Buffer* buffer = buffers[i].get();
         buffer->data = vector<uint8_t>();
+        buffer->mappedData = {};
+        buffer->mappedFile.reset();
     }
 }
 
@@ -16,6 +16,7 @@
 #ifndef CORE__GLTF__GLTF2_UTIL_H
 #define CORE__GLTF__GLTF2_UTIL_H
 
+#include <base/containers/array_view.h>
 #include <base/containers/string.h>
 #include <base/containers/string_view.h>
 #include <base/containers/vector.h>
@@ -107,6 +108,16 @@ struct BufferLoadResult {
 // Populate GLTF buffers with data.
 BufferLoadResult LoadBuffers(const Data* data, CORE_NS::IFileManager& fileManager);
 
+// Populate a single GLTF buffer with data. Different buffers can be loaded concurrently unless they are read from
+// the shared memory file of a GLB.
+BufferLoadResult LoadBuffer(const Data& data, size_t index, CORE_NS::IFileManager& fileManager);
+
+// Set up buffer view data pointers once all the buffers have been loaded.
+void UpdateBufferViews(const Data& data);
+
+// Loaded data of a buffer, either the data used in place from the file or the copy read from it.
+BASE_NS::array_view<const uint8_t> GetBufferData(const Buffer& buffer);
+
 enum UriLoadResult {
     URI_LOAD_SUCCESS,
     URI_LOAD_FAILED_INVALID_MIME_TYPE,
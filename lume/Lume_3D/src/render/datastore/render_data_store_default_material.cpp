@@ -49,6 +49,8 @@ namespace {
 namespace {
 constexpr size_t MEMORY_ALIGNMENT{64};
 constexpr uint32_t BATCH_COUNT{64U};
+// with fewer submeshes culling them one by one is cheaper than building a hierarchy
+constexpr size_t MIN_BVH_SUBMESH_COUNT{256U};
 
 static constexpr uint64_t MATERIAL_TYPE_SHIFT{32u};
 static constexpr uint64_t MATERIAL_TYPE_MASK{0xF00000000u};
@@ -130,6 +132,20 @@ inline bool IsShadowCaster(
     return false;
 }
 
+// the material data which is baked into the frame submeshes, uniforms and resources are read with the index
+inline bool IsSameFrameMaterialData(
+    const RenderDataDefaultMaterial::MaterialData& lhs, const RenderDataDefaultMaterial::MaterialData& rhs)
+{
+    return (lhs.materialShader.shader.GetHandle() == rhs.materialShader.shader.GetHandle()) &&
+           (lhs.materialShader.graphicsState.GetHandle() == rhs.materialShader.graphicsState.GetHandle()) &&
+           (lhs.depthShader.shader.GetHandle() == rhs.depthShader.shader.GetHandle()) &&
+           (lhs.depthShader.graphicsState.GetHandle() == rhs.depthShader.graphicsState.GetHandle()) &&
+           (lhs.extraMaterialRenderingFlags == rhs.extraMaterialRenderingFlags) &&
+           (lhs.renderMaterialFlags == rhs.renderMaterialFlags) && (lhs.customRenderSlotId == rhs.customRenderSlotId) &&
+           (lhs.materialType == rhs.materialType) && (lhs.renderSortLayer == rhs.renderSortLayer) &&
+           (lhs.renderSortLayerOrder == rhs.renderSortLayerOrder);
+}
+
 RenderMinAndMax GetWorldAABB(const Math::Mat4X4& world, const RenderMinAndMax& aabb)
 {
     // Based on https://gist.github.com/cmf028/81e8d3907035640ee0e3fdd69ada543f
@@ -387,6 +403,56 @@ inline Math::Mat4X4* AllocateMatrices(
     return static_cast<Math::Mat4X4*>(AllocateMatrixMemory(allocator, byteSize));
 }
 
+void ResetMatrixMemory(RenderDataStoreDefaultMaterial::LinearAllocatorStruct& allocator)
+{
+    if (!allocator.allocators.empty()) {
+        allocator.currentIndex = 0;
+        if (allocator.allocators.size() == 1) {  // size is good for this frame
+            allocator.allocators[allocator.currentIndex]->Reset();
+        } else if (allocator.allocators.size() > 1) {
+            size_t fullByteSize = 0;
+            for (auto& ref : allocator.allocators) {
+                fullByteSize += ref->GetCurrentByteSize();
+                ref.reset();
+            }
+            allocator.allocators.clear();
+            // create new single allocation for combined previous size and some extra bytes
+            allocator.allocators.push_back(make_unique<LinearAllocator>(fullByteSize, MEMORY_ALIGNMENT));
+        }
+    }
+}
+
+// makes room for the count of matrices in the current allocator to copy them without new allocations
+void ReserveMatrices(RenderDataStoreDefaultMaterial::LinearAllocatorStruct& allocator, const size_t count)
+{
+    const size_t byteSize = count * sizeof(Math::Mat4X4);
+    if (byteSize == 0U) {
+        return;
+    }
+    if (!allocator.allocators.empty()) {
+        const auto& current = allocator.allocators[allocator.currentIndex];
+        if ((current->GetByteSize() - current->GetCurrentByteSize()) >= byteSize) {
+            return;
+        }
+    }
+    allocator.allocators.push_back(make_unique<LinearAllocator>(byteSize, MEMORY_ALIGNMENT));
+    allocator.currentIndex = static_cast<uint32_t>(allocator.allocators.size() - 1);
+}
+
+void CopySkinJointMatrices(Math::Mat4X4* data, const uint32_t jointCount, const bool storePreviousFrameData,
+    const array_view<const Math::Mat4X4> skinJointMatrices, const array_view<const Math::Mat4X4> prevSkinJointMatrices)
+{
+    const uint32_t byteSize = sizeof(Math::Mat4X4) * jointCount;
+    CloneData(data, byteSize, skinJointMatrices.data(), byteSize);
+    if (storePreviousFrameData) {
+        // copy current to previous if given prevSkinJointMatrices is not valid
+        const Math::Mat4X4* prevData = (skinJointMatrices.size() == prevSkinJointMatrices.size())
+                                           ? prevSkinJointMatrices.data()
+                                           : skinJointMatrices.data();
+        CloneData(data + jointCount, byteSize, prevData, byteSize);
+    }
+}
+
 inline void FillBindlessIndices(const RenderDataStoreDefaultMaterial::MaterialHandleResourceIndices& defValues,
     const RenderDataDefaultMaterial::MaterialHandles& handles, RenderDataDefaultMaterial::AllMaterialUniforms& uniforms)
 {
@@ -653,6 +719,10 @@ void RenderDataStoreDefaultMaterial::PreRender()
 {
     // make sure that data is submitted
     SubmitFrameMeshData();
+    // the frame data is now in use and cannot be discarded before the next clear
+    retained_.kept = false;
+    // render nodes only read the hierarchy so it's built before they run
+    BuildSubmeshBvh();
 }
 
 void RenderDataStoreDefaultMaterial::PostRender()
@@ -665,13 +735,37 @@ void RenderDataStoreDefaultMaterial::Clear()
     // NOTE: clear is at the moment called typically two times
     // this could be further optimized to know if clear has already been called
 
-    renderFrameObjectInfo_ = {};
     shadowBoundingVolume_ = {};
+    submeshBvh_.Clear();
 
+    // retained frame data is kept as is and patched by the next frame
+    retained_.externalFrameData = false;
+    if (retained_.valid) {
+        retained_.kept = true;
+    } else {
+        retained_.kept = false;
+        renderFrameObjectInfo_ = {};
+        ClearFrameMeshData();
+    }
+    // drop render meshes which were not submitted
+    for (auto& buffer : frameRenderMeshBuffers_) {
+        buffer.renderMeshes.clear();
+        buffer.jointMatrixCount = 0U;
+    }
+
+    // NOTE: re-fetch if default slots are invalid
+    if (materialRenderSlots_.opaqueMask != 0) {
+        GetDefaultRenderSlots();
+    }
+}
+
+void RenderDataStoreDefaultMaterial::ClearFrameMeshData()
+{
     meshData_.frameMeshData.clear();
     meshData_.frameSubmeshes.clear();
     meshData_.frameSkinIndices.clear();
     meshData_.frameJointMatrixIndices.clear();
+    retained_.skinJointOwners.clear();
     meshData_.frameSubmeshMaterialFlags.clear();
     meshData_.frameMeshBlasInstanceData.clear();
     meshData_.frameLightProbeInterpolatedData.clear();
@@ -721,27 +815,7 @@ void RenderDataStoreDefaultMaterial::Clear()
         slotRef.second.objectCounts = {};
     }
 
-    if (!meshJointMatricesAllocator_.allocators.empty()) {
-        meshJointMatricesAllocator_.currentIndex = 0;
-        if (meshJointMatricesAllocator_.allocators.size() == 1) {  // size is good for this frame
-            meshJointMatricesAllocator_.allocators[meshJointMatricesAllocator_.currentIndex]->Reset();
-        } else if (meshJointMatricesAllocator_.allocators.size() > 1) {
-            size_t fullByteSize = 0;
-            for (auto& ref : meshJointMatricesAllocator_.allocators) {
-                fullByteSize += ref->GetCurrentByteSize();
-                ref.reset();
-            }
-            meshJointMatricesAllocator_.allocators.clear();
-            // create new single allocation for combined previous size and some extra bytes
-            meshJointMatricesAllocator_.allocators.push_back(
-                make_unique<LinearAllocator>(fullByteSize, MEMORY_ALIGNMENT));
-        }
-    }
-
-    // NOTE: re-fetch if default slots are invalid
-    if (materialRenderSlots_.opaqueMask != 0) {
-        GetDefaultRenderSlots();
-    }
+    ResetMatrixMemory(meshJointMatricesAllocator_);
 }
 
 void RenderDataStoreDefaultMaterial::Ref()
@@ -774,6 +848,7 @@ void RenderDataStoreDefaultMaterial::DestroyMaterialData(const uint64_t id)
 
         // destroy from material map
         matData_.materialIdToIndex.erase(iter);
+        retained_.valid = false;
     }
 }
 
@@ -792,6 +867,7 @@ void RenderDataStoreDefaultMaterial::DestroyMeshData(const uint64_t id)
 
         // destroy from mesh map
         meshData_.meshIdToIndex.erase(iter);
+        retained_.valid = false;
     }
 }
 
@@ -844,6 +920,13 @@ uint32_t RenderDataStoreDefaultMaterial::AddMaterialDataImpl(const uint32_t matI
     const RenderDataDefaultMaterial::MaterialData& materialData, const array_view<const uint8_t> customData,
     const array_view<const RenderHandleReference> customResourceData)
 {
+    // retained frame data has the material indices and the material data baked in
+    const bool materialUpdate = (matIndex != ~0U) && (matIndex < matData_.data.size());
+    RenderDataDefaultMaterial::MaterialData prevMaterialData;
+    if (materialUpdate) {
+        prevMaterialData = matData_.data[matIndex].md;
+    }
+
     uint32_t materialIndex = matIndex;
     // matData_.frameIndices can have higher counts)
     PLUGIN_ASSERT(matData_.allUniforms.size() == matData_.data.size());
@@ -892,6 +975,9 @@ uint32_t RenderDataStoreDefaultMaterial::AddMaterialDataImpl(const uint32_t matI
     auto& currRenderSlotData = matData_.renderSlotData[materialIndex];
     ExtentRenderMaterialFlagsForComplexity(currMaterialData.materialType, currMaterialData.renderMaterialFlags);
     FillMaterialDefaultRenderSlotData(shaderMgr_, materialRenderSlots_, currMaterialData, currRenderSlotData);
+    if ((!materialUpdate) || (!IsSameFrameMaterialData(prevMaterialData, currMaterialData))) {
+        retained_.valid = false;
+    }
 
     if (!customData.empty()) {
         const auto maxByteSize = Math::min(static_cast<uint32_t>(customData.size_bytes()),
@@ -998,6 +1084,7 @@ RenderFrameMaterialIndices RenderDataStoreDefaultMaterial::AddFrameMaterialData(
     // NOTE: this data is added as is
     // cannot be retrieved with id or anything
     // mostly used for some debug meshes etc.
+    AddExternalFrameMeshData();
     const uint32_t materialIndex =
         AddMaterialDataImpl(~0U, materialUniforms, materialHandles, materialData, customPropertyData, customBindings);
     // add for automatic destruction after rendering
@@ -1037,6 +1124,7 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
     if (frameMeshDataSubmitted_) {
         return;
     }
+    AddFrameRenderMeshBuffers();
     frameMeshDataSubmitted_ = true;
 
     // make sure that the base material indices are alive and well
@@ -1047,6 +1135,18 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
         }
     }
 
+    // the batches are recorded for patching only when the whole frame is built from the render mesh data
+    const bool recordRetained =
+        retained_.enabled && meshData_.frameMeshData.empty() && meshData_.frameSubmeshes.empty();
+    bool retainable = recordRetained && (!rtEnabled_) && (!retained_.externalFrameData);
+    if (recordRetained) {
+        retained_.batches.clear();
+        retained_.submeshes.clear();
+        retained_.frameMeshes.clear();
+        retained_.idToFrameMeshIndex.clear();
+        retained_.dirtyBatches.clear();
+    }
+
     // NOTES:
     // 1. When using skinning the skinning AABB is the mesh AABB and submesh AABB calculations are irrelevant
     // 2. Full mesh AABB is currently irrelevant, it could be used in the future for coarse culling
@@ -1058,6 +1158,7 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
                                     array_view<RenderMeshBatchDataContainer>
                                         batchData) {
         const uint32_t fullBatchCount = static_cast<uint32_t>(batchData.size());
+        const uint32_t meshIndex = static_cast<uint32_t>(&meshDataContainer - meshData_.data.data());
         uint32_t fullBatchCounter = 0U;
         uint32_t batchIndex = 0U;
         uint32_t baseRenderMeshIndex = 0U;
@@ -1091,6 +1192,16 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
 
             if (batchIndex == 0) {
                 baseRenderMeshIndex = static_cast<uint32_t>(meshData_.frameMeshData.size());
+                if (recordRetained) {
+                    const uint32_t submeshBegin = static_cast<uint32_t>(meshData_.frameSubmeshes.size());
+                    retained_.batches.push_back({meshIndex, baseRenderMeshIndex, 0U, submeshBegin, submeshBegin});
+                }
+            }
+            if (recordRetained) {
+                retained_.idToFrameMeshIndex.insert_or_assign(
+                    rmd.id, static_cast<uint32_t>(meshData_.frameMeshData.size()));
+                retained_.frameMeshes.push_back({batchMeshRef.forcedAabb,
+                    static_cast<uint32_t>(retained_.batches.size() - 1U), skinJointIndex});
             }
             MeshDataContainer* rmbcMesh = nullptr;
             if (materialInstancing && (batchMeshRef.rmcBatchMeshIndex < meshData_.data.size())) {
@@ -1182,6 +1293,14 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
 
                     // add bounds to shadow casters
                     ExtentShadowSceneBounds(shadowCaster, finalAabb, shadowBoundingVolume_);
+
+                    if (recordRetained) {
+                        // additional material submeshes share the bounds but are not added to the shadow bounds
+                        retained_.submeshes.push_back({finalAabb, submeshIdx, shadowCaster});
+                        while (retained_.submeshes.size() < meshData_.frameSubmeshes.size()) {
+                            retained_.submeshes.push_back({finalAabb, submeshIdx, false});
+                        }
+                    }
                 }
                 // add instanced materials from the correct mesh
                 if (materialInstancing) {
@@ -1198,6 +1317,12 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
                 }
             }
             if (submitBatch) {
+                if (recordRetained) {
+                    auto& batch = retained_.batches.back();
+                    batch.frameMeshCount =
+                        static_cast<uint32_t>(meshData_.frameMeshData.size()) - batch.frameMeshIndexBegin;
+                    batch.frameSubmeshIndexEnd = static_cast<uint32_t>(meshData_.frameSubmeshes.size());
+                }
                 // reset
                 shadowCaster = false;
                 batchIndex = 0;
@@ -1238,42 +1363,84 @@ void RenderDataStoreDefaultMaterial::SubmitFrameMeshData()
     }
     // update shadow caster bounds
     renderFrameObjectInfo_.shadowCasterBoundingSphere = CalculateFinalSceneBoundingSphere(shadowBoundingVolume_);
+
+    if (recordRetained) {
+        FinishRetainedFrameMeshData(retainable);
+    } else {
+        retained_.valid = false;
+    }
 }
 
 uint32_t RenderDataStoreDefaultMaterial::AddMeshData(const RenderMeshData& meshData)
 {
     frameMeshDataSubmitted_ = false;
+    AddExternalFrameMeshData();
     // DEPRECATED support, needs to work for compatibility
     const uint32_t renderMeshIdx = static_cast<uint32_t>(meshData_.frameMeshData.size());
     meshData_.frameMeshData.push_back(meshData);
     return renderMeshIdx;
 }
 
-void RenderDataStoreDefaultMaterial::AddFrameRenderMeshData(
-    const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& batchData)
+bool RenderDataStoreDefaultMaterial::GetFrameRenderMeshIndices(const RenderMeshData& meshData,
+    const RenderMeshBatchData& batchData, FrameRenderMeshIndices& indices) const
 {
-    frameMeshDataSubmitted_ = false;
-
     // with real render mesh batch component we need the actual mesh where batching happens
-    const bool isRmbc = (batchData.meshId != RenderSceneDataConstants::INVALID_ID) &&
-                        (batchData.renderMeshId != RenderSceneDataConstants::INVALID_ID);
-    const uint64_t meshId = isRmbc ? batchData.meshId : meshData.meshId;
-    const uint64_t batchDataMeshId = isRmbc ? meshData.meshId : RenderSceneDataConstants::INVALID_ID;
-    auto iter = meshData_.meshIdToIndex.find(meshId);
-    if (iter == meshData_.meshIdToIndex.end()) {
+    indices.rmbc = (batchData.meshId != RenderSceneDataConstants::INVALID_ID) &&
+                   (batchData.renderMeshId != RenderSceneDataConstants::INVALID_ID);
+    const uint64_t meshId = indices.rmbc ? batchData.meshId : meshData.meshId;
+    const auto iter = meshData_.meshIdToIndex.find(meshId);
+    if (iter == meshData_.meshIdToIndex.cend()) {
 #if (CORE3D_VALIDATION_ENABLED == 1)
         const auto str = "AddFrameRenderMeshData_" + to_string(meshId);
         PLUGIN_LOG_ONCE_W(str, "CORE3D_VALIDATION: Mesh id not found for render mesh");
 #endif
-        return;
+        return false;
     }
 
     PLUGIN_ASSERT(iter->second < meshData_.data.size());
     if (iter->second >= meshData_.data.size()) {
-        return;
+        return false;
+    }
+    indices.meshIndex = iter->second;
+    if (indices.rmbc) {
+        if (const auto rmbcIter = meshData_.meshIdToIndex.find(meshData.meshId);
+            rmbcIter != meshData_.meshIdToIndex.cend()) {
+            indices.rmbcMeshIndex = rmbcIter->second;
+        }
     }
 
-    auto& mesh = meshData_.data[iter->second];
+    const auto& world = meshData.world;
+    // negative scale requires a different graphics state and assuming most of the content
+    // doesn't have negative scaling we'll just use separate draws for inverted meshes instead
+    // of instanced draws. negative scaling factor can be determined by checking is the
+    // determinant of the 3x3 sub-matrix negative.
+    const float determinant = world.x.x * (world.y.y * world.z.z - world.z.y * world.y.z) -
+                              world.x.y * (world.y.x * world.z.z - world.y.z * world.z.x) +
+                              world.x.z * (world.y.x * world.z.y - world.y.y * world.z.x);
+    indices.inverseWinding = (determinant < 0.f);
+    return true;
+}
+
+void RenderDataStoreDefaultMaterial::AddFrameRenderMeshData(
+    const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& batchData)
+{
+    frameMeshDataSubmitted_ = false;
+    // new render meshes are added on top of a cleared frame
+    DiscardRetainedFrameMeshData();
+
+    FrameRenderMeshIndices indices;
+    if (GetFrameRenderMeshIndices(meshData, batchData, indices)) {
+        AddFrameRenderMeshDataImpl(meshData, meshSkinData, indices);
+    }
+}
+
+void RenderDataStoreDefaultMaterial::AddFrameRenderMeshDataImpl(
+    const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData, const FrameRenderMeshIndices& indices)
+{
+    if (indices.meshIndex >= meshData_.data.size()) {
+        return;
+    }
+    auto& mesh = meshData_.data[indices.meshIndex];
     // full mesh instancing checked later
     bool allowInstancing = true;
 
@@ -1284,43 +1451,89 @@ void RenderDataStoreDefaultMaterial::AddFrameRenderMeshData(
 
     const uint32_t skinJointIndex = AddFrameSkinJointMatricesImpl(
         meshSkinData.id, meshSkinData.skinJointMatrices, meshSkinData.prevSkinJointMatrices);
+    if (retained_.enabled && (skinJointIndex == static_cast<uint32_t>(retained_.skinJointOwners.size()))) {
+        // a shared skin has the joints of the first render mesh
+        retained_.skinJointOwners.push_back(meshData.id);
+    }
     // if joint matrices were stored and instancing is allowed check are there instances with a index. this
     // means the skin instance is different (potentially different joint matrices). skinning
     // supports only one UBO range of joint data and currently does not check sharing of data
     if (skinJointIndex != RenderSceneDataConstants::INVALID_INDEX) {
         const array_view<const RenderMeshBatchDataContainer> batchDataContainer =
-            (isRmbc) ? mesh.batchComponentFrameMeshData : mesh.batchFrameMeshData;
+            (indices.rmbc) ? mesh.batchComponentFrameMeshData : mesh.batchFrameMeshData;
 
         allowInstancing = std::none_of(batchDataContainer.cbegin(),
             batchDataContainer.cend(),
             [skinJointIndex](const RenderMeshBatchDataContainer& data) { return data.skinIndex != skinJointIndex; });
     }
-    if (allowInstancing) {
-        const auto& world = meshData.world;
-        // negative scale requires a different graphics state and assuming most of the content
-        // doesn't have negative scaling we'll just use separate draws for inverted meshes instead
-        // of instanced draws. negative scaling factor can be determined by checking is the
-        // determinant of the 3x3 sub-matrix negative.
-        const float determinant = world.x.x * (world.y.y * world.z.z - world.z.y * world.y.z) -
-                                  world.x.y * (world.y.x * world.z.z - world.y.z * world.z.x) +
-                                  world.x.z * (world.y.x * world.z.y - world.y.y * world.z.x);
-        if (determinant < 0.f) {
-            allowInstancing = false;
-        }
+    if (indices.inverseWinding) {
+        allowInstancing = false;
     }
-    uint32_t rmbcMeshIdx = RenderSceneDataConstants::INVALID_INDEX;
     if (!allowInstancing) {
-        mesh.frameMeshData.push_back({meshData, rmbcMeshIdx, skinJointIndex, meshSkinData.aabb});
+        mesh.frameMeshData.push_back(
+            {meshData, RenderSceneDataConstants::INVALID_INDEX, skinJointIndex, meshSkinData.aabb});
+    } else if (indices.rmbc) {
+        mesh.batchComponentFrameMeshData.push_back(
+            {meshData, indices.rmbcMeshIndex, skinJointIndex, meshSkinData.aabb});
     } else {
-        if (isRmbc) {
-            if (const auto rmbcIter = meshData_.meshIdToIndex.find(batchDataMeshId);
-                rmbcIter != meshData_.meshIdToIndex.cend()) {
-                rmbcMeshIdx = rmbcIter->second;
-            }
-            mesh.batchComponentFrameMeshData.push_back({meshData, rmbcMeshIdx, skinJointIndex, meshSkinData.aabb});
-        } else {
-            mesh.batchFrameMeshData.push_back({meshData, rmbcMeshIdx, skinJointIndex, meshSkinData.aabb});
+        mesh.batchFrameMeshData.push_back(
+            {meshData, RenderSceneDataConstants::INVALID_INDEX, skinJointIndex, meshSkinData.aabb});
+    }
+}
+
+void RenderDataStoreDefaultMaterial::SetFrameRenderMeshBufferCount(const uint32_t count)
+{
+    frameMeshDataSubmitted_ = false;
+    if (frameRenderMeshBuffers_.size() < count) {
+        frameRenderMeshBuffers_.resize(count);
+    }
+}
+
+void RenderDataStoreDefaultMaterial::AddFrameRenderMeshDataToBuffer(const uint32_t bufferIndex,
+    const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& batchData)
+{
+    // NOTE: called from multiple threads, only the buffer of the index can be accessed and the mesh data is only read
+    if (bufferIndex >= frameRenderMeshBuffers_.size()) {
+        PLUGIN_LOG_E("invalid bufferIndex for render mesh data");
+        return;
+    }
+    FrameRenderMeshIndices indices;
+    if (!GetFrameRenderMeshIndices(meshData, batchData, indices)) {
+        return;
+    }
+    auto& buffer = frameRenderMeshBuffers_[bufferIndex];
+    buffer.renderMeshes.push_back({meshData, meshSkinData, indices});
+    if (meshSkinData.id != RenderSceneDataConstants::INVALID_INDEX) {
+        // current and previous matrices at most
+        buffer.jointMatrixCount += 2U * std::min(static_cast<size_t>(RenderDataDefaultMaterial::MAX_SKIN_MATRIX_COUNT),
+                                            meshSkinData.skinJointMatrices.size());
+    }
+}
+
+void RenderDataStoreDefaultMaterial::AddFrameRenderMeshBuffers()
+{
+    size_t renderMeshCount = 0U;
+    size_t jointMatrixCount = 0U;
+    for (const auto& buffer : frameRenderMeshBuffers_) {
+        renderMeshCount += buffer.renderMeshes.size();
+        jointMatrixCount += buffer.jointMatrixCount;
+    }
+    if (renderMeshCount == 0U) {
+        return;
+    }
+    // new render meshes are added on top of a cleared frame
+    DiscardRetainedFrameMeshData();
+    // the joints of all the buffers are copied once to a single allocation
+    ReserveMatrices(meshJointMatricesAllocator_, jointMatrixCount);
+
+    // the buffers are added in order to get the same batches as with a single thread, the mesh look-ups were done
+    // when the buffers were filled
+    for (auto& buffer : frameRenderMeshBuffers_) {
+        for (const auto& renderMesh : buffer.renderMeshes) {
+            AddFrameRenderMeshDataImpl(renderMesh.meshData, renderMesh.meshSkinData, renderMesh.indices);
         }
+        buffer.renderMeshes.clear();
+        buffer.jointMatrixCount = 0U;
     }
 }
 
@@ -1365,6 +1578,7 @@ void RenderDataStoreDefaultMaterial::AddFrameSubmeshAdditionalMaterials(
 
 void RenderDataStoreDefaultMaterial::UpdateMeshData(const uint64_t id, const MeshDataWithHandleReference& meshData)
 {
+    retained_.valid = false;
     auto& md = meshData_;
     uint32_t index = ~0U;
 
@@ -1544,30 +1758,23 @@ uint32_t RenderDataStoreDefaultMaterial::AddFrameSkinJointMatricesImpl(const uin
         return skinJointIndex;
     }
     const bool storePreviousFrameData = (jointCount <= RenderDataDefaultMaterial::MAX_SKIN_MATRIX_COUNT_WITH_PREVIOUS);
-    const uint32_t byteSize = sizeof(Math::Mat4X4) * jointCount;
     const uint32_t previousFrameOffset = storePreviousFrameData ? jointCount : 0u;
     const uint32_t storedJointCount = storePreviousFrameData ? (jointCount * 2u) : jointCount;
     Math::Mat4X4* jointMatrixData = AllocateMatrices(meshJointMatricesAllocator_, storedJointCount);
     if (!jointMatrixData) {
         return skinJointIndex;
     }
-    CloneData(jointMatrixData, byteSize, skinJointMatrices.data(), byteSize);
-    if (storePreviousFrameData) {
-        if (skinJointMatrices.size() == prevSkinJointMatrices.size()) {
-            CloneData(jointMatrixData + previousFrameOffset, byteSize, prevSkinJointMatrices.data(), byteSize);
-        } else {
-            // copy current to previous if given prevSkinJointMatrices is not valid
-            CloneData(jointMatrixData + previousFrameOffset, byteSize, skinJointMatrices.data(), byteSize);
-        }
+    CopySkinJointMatrices(
+        jointMatrixData, jointCount, storePreviousFrameData, skinJointMatrices, prevSkinJointMatrices);
 #if (CORE3D_VALIDATION_ENABLED == 1)
-    } else {
+    if (!storePreviousFrameData) {
         const auto logKey = "SkinVelocityDisabled_" + to_string(id);
         PLUGIN_LOG_ONCE_W(logKey,
             "Skin joint count (%u) exceeds previous-frame skinning limit (%u). Velocity is disabled for this skin.",
             jointCount,
             RenderDataDefaultMaterial::MAX_SKIN_MATRIX_COUNT_WITH_PREVIOUS);
-#endif
     }
+#endif
 
     skinJointIndex = static_cast<uint32_t>(meshData_.frameJointMatrixIndices.size());
     meshData_.frameJointMatrixIndices.push_back(
@@ -1592,6 +1799,7 @@ void RenderDataStoreDefaultMaterial::AddSubmesh(const RenderSubmeshWithHandleRef
     const array_view<const IShaderManager::RenderSlotData> renderSlotAndShaders)
 {
     // DEPRECATED support
+    AddExternalFrameMeshData();
 #if (CORE3D_VALIDATION_ENABLED == 1)
     ValidateSubmesh(submesh);
 #endif
@@ -1711,6 +1919,7 @@ void RenderDataStoreDefaultMaterial::FillSubmeshImpl(
 void RenderDataStoreDefaultMaterial::SetRenderSlots(const RenderDataDefaultMaterial::MaterialSlotType materialSlotType,
     const BASE_NS::array_view<const uint32_t> renderSlotIds)
 {
+    retained_.valid = false;
     uint64_t mask = 0;
     for (const auto renderSlotId : renderSlotIds) {
         mask |= 1ULL << uint64_t(renderSlotId);
@@ -1907,6 +2116,7 @@ RenderFrameMaterialIndices RenderDataStoreDefaultMaterial::AddRenderSlotSubmeshe
     const RenderDataDefaultMaterial::MaterialData& materialData, const array_view<const uint8_t> customPropertyData,
     const array_view<const RenderHandleReference> customBindings)
 {
+    AddExternalFrameMeshData();
     const RenderFrameMaterialIndices rfmi =
         AddFrameMaterialData(materialUniforms, materialHandles, materialData, customPropertyData, customBindings);
 
@@ -1972,6 +2182,200 @@ array_view<const AsInstance> RenderDataStoreDefaultMaterial::GetMeshBlasData() c
     return meshData_.frameMeshBlasInstanceData;
 }
 
+const Bvh& RenderDataStoreDefaultMaterial::GetSubmeshBvh() const
+{
+    return submeshBvh_;
+}
+
+uint32_t RenderDataStoreDefaultMaterial::GetSubmeshBvhCount() const
+{
+    return static_cast<uint32_t>(submeshBvh_.GetPrimitives().size());
+}
+
+void RenderDataStoreDefaultMaterial::BuildSubmeshBvh()
+{
+    const auto& submeshes = meshData_.frameSubmeshes;
+    if (submeshes.size() < MIN_BVH_SUBMESH_COUNT) {
+        submeshBvh_.Clear();
+        return;
+    }
+    submeshBvhBounds_.resize(submeshes.size());
+    auto* bounds = submeshBvhBounds_.data();
+    for (const auto& submesh : submeshes) {
+        const Math::Vec3 radius(submesh.bounds.worldRadius, submesh.bounds.worldRadius, submesh.bounds.worldRadius);
+        *bounds++ = {submesh.bounds.worldCenter - radius, submesh.bounds.worldCenter + radius};
+    }
+    submeshBvh_.Build(submeshBvhBounds_);
+}
+
+void RenderDataStoreDefaultMaterial::SetRetainedFrameMeshDataEnabled(const bool enabled)
+{
+    if (retained_.enabled != enabled) {
+        retained_.enabled = enabled;
+        retained_.valid = false;
+    }
+}
+
+bool RenderDataStoreDefaultMaterial::HasRetainedFrameMeshData() const
+{
+    return retained_.valid && retained_.kept;
+}
+
+bool RenderDataStoreDefaultMaterial::UpdateRetainedFrameRenderMesh(
+    const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData)
+{
+    if (!HasRetainedFrameMeshData()) {
+        return false;
+    }
+    const auto iter = retained_.idToFrameMeshIndex.find(meshData.id);
+    if (iter == retained_.idToFrameMeshIndex.cend()) {
+        // not submitted e.g. mesh not found
+        return true;
+    }
+    const uint32_t frameMeshIndex = iter->second;
+    auto& rmd = meshData_.frameMeshData[frameMeshIndex];
+    // inverse winding changes the submesh flags and the instancing
+    if ((rmd.meshId != meshData.meshId) || (rmd.sceneId != meshData.sceneId) ||
+        ((Math::Determinant(rmd.world) < 0.0f) != (Math::Determinant(meshData.world) < 0.0f))) {
+        return false;
+    }
+
+    auto& frameMesh = retained_.frameMeshes[frameMeshIndex];
+    const uint32_t jointCount = std::min(
+        RenderDataDefaultMaterial::MAX_SKIN_MATRIX_COUNT, static_cast<uint32_t>(meshSkinData.skinJointMatrices.size()));
+    if (frameMesh.skinJointIndex == RenderSceneDataConstants::INVALID_INDEX) {
+        // a new skin changes the submesh flags and the instancing
+        if ((meshSkinData.id != RenderSceneDataConstants::INVALID_INDEX) && (jointCount > 0U)) {
+            return false;
+        }
+    } else {
+        if (frameMesh.skinJointIndex >= static_cast<uint32_t>(retained_.skinJointOwners.size())) {
+            return false;
+        }
+        // like with a full submit a shared skin has the joints of the first render mesh
+        if (retained_.skinJointOwners[frameMesh.skinJointIndex] == meshData.id) {
+            const auto& joints = meshData_.frameJointMatrixIndices[frameMesh.skinJointIndex];
+            const bool storePreviousFrameData =
+                (jointCount <= RenderDataDefaultMaterial::MAX_SKIN_MATRIX_COUNT_WITH_PREVIOUS);
+            if ((jointCount == 0U) || (joints.count != (storePreviousFrameData ? (jointCount * 2U) : jointCount))) {
+                return false;
+            }
+            CopySkinJointMatrices(joints.data, jointCount, storePreviousFrameData, meshSkinData.skinJointMatrices,
+                meshSkinData.prevSkinJointMatrices);
+        }
+        frameMesh.skinAabb = meshSkinData.aabb;
+    }
+
+    auto& batch = retained_.batches[frameMesh.batchIndex];
+    // the submeshes of a batch have the layer mask of the last instance
+    const bool lastInBatch = (frameMeshIndex + 1U == batch.frameMeshIndexBegin + batch.frameMeshCount);
+    if ((rmd.layerMask != meshData.layerMask) && lastInBatch) {
+        for (uint32_t idx = batch.frameSubmeshIndexBegin; idx < batch.frameSubmeshIndexEnd; ++idx) {
+            meshData_.frameSubmeshes[idx].layers.layerMask = meshData.layerMask;
+        }
+    }
+    rmd = meshData;
+
+    if (!batch.dirty) {
+        batch.dirty = true;
+        retained_.dirtyBatches.push_back(frameMesh.batchIndex);
+    }
+    return true;
+}
+
+void RenderDataStoreDefaultMaterial::SubmitRetainedFrameMeshData()
+{
+    if (!HasRetainedFrameMeshData()) {
+        return;
+    }
+    frameMeshDataSubmitted_ = true;
+    retained_.kept = false;
+
+    // only the bounds of the patched batches are re-calculated, the same way as with a full submit
+    for (const uint32_t batchIdx : retained_.dirtyBatches) {
+        auto& batch = retained_.batches[batchIdx];
+        batch.dirty = false;
+        if (batch.frameMeshCount == 0U) {
+            continue;
+        }
+        const auto& mesh = meshData_.data[batch.meshIndex];
+        const uint32_t frameMeshIndexEnd = batch.frameMeshIndexBegin + batch.frameMeshCount;
+        // skinned instances use the joint bounds and the last instance selects the bounds of the batch
+        RenderMinAndMax forcedAabb;
+        for (uint32_t meshIdx = batch.frameMeshIndexBegin; meshIdx < frameMeshIndexEnd; ++meshIdx) {
+            const auto& frameMesh = retained_.frameMeshes[meshIdx];
+            if (frameMesh.skinJointIndex != RenderSceneDataConstants::INVALID_INDEX) {
+                forcedAabb.minAabb = Math::min(forcedAabb.minAabb, frameMesh.skinAabb.minAabb);
+                forcedAabb.maxAabb = Math::max(forcedAabb.maxAabb, frameMesh.skinAabb.maxAabb);
+            }
+        }
+        const bool useJoints =
+            (retained_.frameMeshes[frameMeshIndexEnd - 1U].skinJointIndex != RenderSceneDataConstants::INVALID_INDEX);
+        for (uint32_t idx = batch.frameSubmeshIndexBegin; idx < batch.frameSubmeshIndexEnd; ++idx) {
+            auto& submesh = retained_.submeshes[idx];
+            RenderMinAndMax aabb = forcedAabb;
+            if (!useJoints) {
+                aabb = {};
+                const auto& submeshAabb = mesh.submeshes[submesh.submeshIndex].sd.aabb;
+                for (uint32_t meshIdx = batch.frameMeshIndexBegin; meshIdx < frameMeshIndexEnd; ++meshIdx) {
+                    if (retained_.frameMeshes[meshIdx].skinJointIndex != RenderSceneDataConstants::INVALID_INDEX) {
+                        continue;
+                    }
+                    const RenderMinAndMax rmam = GetWorldAABB(meshData_.frameMeshData[meshIdx].world, submeshAabb);
+                    aabb.minAabb = Math::min(aabb.minAabb, rmam.minAabb);
+                    aabb.maxAabb = Math::max(aabb.maxAabb, rmam.maxAabb);
+                }
+            }
+            submesh.aabb = aabb;
+            meshData_.frameSubmeshes[idx].bounds = GetSubmeshBounds(aabb);
+        }
+    }
+    const bool boundsChanged = !retained_.dirtyBatches.empty();
+    retained_.dirtyBatches.clear();
+
+    // scene bounds are accumulated in the submit order to get the same result as with a full submit
+    if (boundsChanged) {
+        shadowBoundingVolume_ = {};
+        for (const auto& submesh : retained_.submeshes) {
+            ExtentShadowSceneBounds(submesh.shadowCaster, submesh.aabb, shadowBoundingVolume_);
+        }
+        renderFrameObjectInfo_.shadowCasterBoundingSphere =
+            CalculateFinalSceneBoundingSphere(shadowBoundingVolume_);
+    }
+}
+
+void RenderDataStoreDefaultMaterial::DiscardRetainedFrameMeshData()
+{
+    if (retained_.kept) {
+        renderFrameObjectInfo_ = {};
+        shadowBoundingVolume_ = {};
+        ClearFrameMeshData();
+        retained_.kept = false;
+    }
+    retained_.valid = false;
+}
+
+void RenderDataStoreDefaultMaterial::AddExternalFrameMeshData()
+{
+    // data which is not recorded cannot be patched
+    DiscardRetainedFrameMeshData();
+    retained_.externalFrameData = true;
+}
+
+void RenderDataStoreDefaultMaterial::FinishRetainedFrameMeshData(const bool retainable)
+{
+    retained_.valid = retainable;
+    if (!retainable) {
+        retained_.batches.clear();
+        retained_.submeshes.clear();
+        retained_.frameMeshes.clear();
+        retained_.idToFrameMeshIndex.clear();
+    } else {
+        // material updates must not resize the frame indices which have the instance materials appended
+        canUpdateBaseMaterialCount_ = false;
+    }
+}
+
 // for plugin / factory interface
 refcnt_ptr<IRenderDataStore> RenderDataStoreDefaultMaterial::Create(
     RENDER_NS::IRenderContext& renderContext, const char* name)
@@ -31,6 +31,7 @@
 #include <base/util/uid.h>
 #include <render/device/intf_shader_manager.h>
 
+#include "util/bvh.h"
 #include "util/linear_allocator.h"
 
 RENDER_BEGIN_NAMESPACE()
@@ -193,6 +194,35 @@ public:
     // NOTE: hidden method at the moment
     // returns frame mesh blas data
     BASE_NS::array_view<const RENDER_NS::AsInstance> GetMeshBlasData() const;
+    // NOTE: hidden method at the moment
+    // returns hierarchy of frame submesh bounding spheres, built in PreRender. The hierarchy covers the submeshes
+    // [0, GetSubmeshBvhCount()), and is empty with small submesh counts.
+    const Bvh& GetSubmeshBvh() const;
+    uint32_t GetSubmeshBvhCount() const;
+
+    // NOTE: hidden methods at the moment
+    // Retained frame mesh data. When enabled, the frame data of SubmitFrameMeshData is kept over the frame boundary
+    // and render mesh world matrices, layer masks, and skin joint matrices can be patched in place instead of
+    // re-adding all the render meshes. Material updates which only change uniforms or resources keep the data.
+    // Mesh, material flag, shader, and additional frame data changes invalidate the retained data.
+    void SetRetainedFrameMeshDataEnabled(bool enabled);
+    // returns true if the previous frame data is kept and can be patched
+    bool HasRetainedFrameMeshData() const;
+    // returns false if the render mesh cannot be patched and a full submit is needed
+    bool UpdateRetainedFrameRenderMesh(const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData);
+    // updates the bounds of the patched render meshes, called instead of SubmitFrameMeshData
+    void SubmitRetainedFrameMeshData();
+    // clears the kept frame data before a full submit
+    void DiscardRetainedFrameMeshData();
+
+    // NOTE: hidden methods at the moment
+    // Per thread render mesh submission. After setting the buffer count each buffer can be filled from its own thread.
+    // The meshes are looked up when filling, and mesh data must not be updated before SubmitFrameMeshData. Skin joint
+    // matrices are not copied and must stay valid until SubmitFrameMeshData, which adds the buffers in buffer index
+    // order and copies the joints once.
+    void SetFrameRenderMeshBufferCount(uint32_t count);
+    void AddFrameRenderMeshDataToBuffer(uint32_t bufferIndex, const RenderMeshData& meshData,
+        const RenderMeshSkinData& meshSkinData, const RenderMeshBatchData& batchData);
 
     // for plugin / factory interface
     static constexpr const char* const TYPE_NAME = "RenderDataStoreDefaultMaterial";
@@ -331,6 +361,69 @@ public:
         BASE_NS::vector<LightProbeInterpolatedData> frameLightProbeInterpolatedData;
     };
 
+    // instances of a mesh which were submitted together
+    struct RetainedFrameMeshBatch {
+        uint32_t meshIndex{0U};
+        uint32_t frameMeshIndexBegin{0U};
+        uint32_t frameMeshCount{0U};
+        uint32_t frameSubmeshIndexBegin{0U};
+        uint32_t frameSubmeshIndexEnd{0U};
+        bool dirty{false};
+    };
+    struct RetainedFrameMesh {
+        // skin aabb, the bounds of skinned render meshes come from the joints
+        RenderMinAndMax skinAabb;
+        // index to RetainedFrameMeshData::batches
+        uint32_t batchIndex{0U};
+        uint32_t skinJointIndex{RenderSceneDataConstants::INVALID_INDEX};
+    };
+    struct RetainedFrameSubmesh {
+        // world aabb used for the bounds
+        RenderMinAndMax aabb;
+        // index to MeshDataContainer::submeshes
+        uint32_t submeshIndex{0U};
+        bool shadowCaster{false};
+    };
+    // mesh look-up and winding of a render mesh before it's added to the frame
+    struct FrameRenderMeshIndices {
+        uint32_t meshIndex{RenderSceneDataConstants::INVALID_INDEX};
+        uint32_t rmbcMeshIndex{RenderSceneDataConstants::INVALID_INDEX};
+        bool rmbc{false};
+        bool inverseWinding{false};
+    };
+    struct FrameRenderMeshBuffer {
+        struct RenderMesh {
+            RenderMeshData meshData;
+            // joint matrices reference the caller data
+            RenderMeshSkinData meshSkinData;
+            FrameRenderMeshIndices indices;
+        };
+        BASE_NS::vector<RenderMesh> renderMeshes;
+        // upper bound for the stored joint matrices of the render meshes
+        size_t jointMatrixCount{0U};
+    };
+
+    struct RetainedFrameMeshData {
+        BASE_NS::vector<RetainedFrameMeshBatch> batches;
+        // parallel to frameSubmeshes
+        BASE_NS::vector<RetainedFrameSubmesh> submeshes;
+        // parallel to frameMeshData
+        BASE_NS::vector<RetainedFrameMesh> frameMeshes;
+        // parallel to frameJointMatrixIndices, the render mesh id whose joints were stored
+        BASE_NS::vector<uint64_t> skinJointOwners;
+        // render mesh id to frameMeshData index
+        BASE_NS::unordered_map<uint64_t, uint32_t> idToFrameMeshIndex;
+        BASE_NS::vector<uint32_t> dirtyBatches;
+
+        bool enabled{false};
+        // frame data matches the records and can be patched
+        bool valid{false};
+        // frame data was not cleared at the frame boundary
+        bool kept{false};
+        // frame data was added outside of the render mesh data
+        bool externalFrameData{false};
+    };
+
 private:
     uint32_t AddMaterialDataImpl(uint32_t matIndex,
         const RenderDataDefaultMaterial::InputMaterialUniforms& materialUniforms,
@@ -364,6 +457,15 @@ private:
 
     void UpdateMeshBlasData(MeshDataContainer& meshData);
     void UpdateFrameMeshBlasInstanceData(const MeshDataContainer& meshData, const BASE_NS::Math::Mat4X4& transform);
+    void BuildSubmeshBvh();
+    void ClearFrameMeshData();
+    bool GetFrameRenderMeshIndices(
+        const RenderMeshData& meshData, const RenderMeshBatchData& batchData, FrameRenderMeshIndices& indices) const;
+    void AddFrameRenderMeshDataImpl(const RenderMeshData& meshData, const RenderMeshSkinData& meshSkinData,
+        const FrameRenderMeshIndices& indices);
+    void AddFrameRenderMeshBuffers();
+    void AddExternalFrameMeshData();
+    void FinishRetainedFrameMeshData(bool retainable);
 
     const BASE_NS::string name_;
     RENDER_NS::IRenderContext& renderContext_;
@@ -391,6 +493,9 @@ private:
     // helpers
     BASE_NS::vector<uint32_t> materialFrameOffsets_;
     BASE_NS::vector<RenderMinAndMax> submeshAabbs_;
+    BASE_NS::vector<Bvh::Aabb> submeshBvhBounds_;
+
+    Bvh submeshBvh_;
 
     bool rtEnabled_{false};
     bool bindlessEnabled_{false};
@@ -398,6 +503,8 @@ private:
     bool canUpdateBaseMaterialCount_{true};
 
     SceneBoundingVolumeHelper shadowBoundingVolume_;
+    RetainedFrameMeshData retained_;
+    BASE_NS::vector<FrameRenderMeshBuffer> frameRenderMeshBuffers_;
     // for bindless global resource indices
     MaterialHandleResourceIndices bindlessResourceIndices_;
 
@@ -58,10 +58,12 @@ bool RenderDataStoreLightProbe::BuildTetrahedralMesh(uint64_t lightProbeId)
         return false;
     }
 
-    BowyerWatsonDelaunay3D::LightProbeVolume bwLightProbeDelaunay{l->second.volume.lightProbes, l->second.tetVec};
+    BowyerWatsonDelaunay3D::LightProbeVolume bwLightProbeDelaunay{
+        l->second.volume.lightProbes, l->second.tetVec, &l->second.adjacency};
     BowyerWatsonDelaunay3D delaunay3D;
     delaunay3D.BuildTetrahedralMesh(bwLightProbeDelaunay);
     l->second.volume.tetrahedrons = l->second.tetVec;
+    l->second.locator.Build(l->second.volume, l->second.adjacency);
     return !l->second.volume.tetrahedrons.empty();
 }
 
@@ -73,11 +75,15 @@ void RenderDataStoreLightProbe::AddLightProbes(
         PLUGIN_LOG_W("override light probe with id");
         l->second.volume.lightProbes = lightProbes;
         l->second.volume.tetrahedrons = {};
+        l->second.adjacency.clear();
+        l->second.locator.Build(l->second.volume, {});
         return;
     }
 
-    lightProbeVolume_[lightProbeId].volume.lightProbes = lightProbes;
-    lightProbeVolume_[lightProbeId].tetVec = {};
+    auto& added = lightProbeVolume_[lightProbeId];
+    added.volume.lightProbes = lightProbes;
+    added.tetVec = {};
+    added.locator.Build(added.volume, {});
 }
 
 void RenderDataStoreLightProbe::RemoveLightProbes(uint64_t lightProbeId)
@@ -101,6 +107,15 @@ LightProbeVolumeOpt RenderDataStoreLightProbe::GetLightProbeVolume(uint64_t ligh
     return result;
 }
 
+const LightProbeLocator* RenderDataStoreLightProbe::GetLightProbeLocator(uint64_t lightProbeEntity) const
+{
+    auto it = lightProbeVolume_.find(lightProbeEntity);
+    if (it != lightProbeVolume_.end()) {
+        return &it->second.locator;
+    }
+    return nullptr;
+}
+
 // for plugin / factory interface
 refcnt_ptr<RENDER_NS::IRenderDataStore> RenderDataStoreLightProbe::Create(RENDER_NS::IRenderContext&, const char* name)
 {
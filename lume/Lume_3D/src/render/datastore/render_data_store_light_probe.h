@@ -17,6 +17,7 @@
 #define CORE3D_RENDER_DATA_STORE_LIGHT_PROBE_H
 
 #include <cstdint>
+#include <util/light_probe_locator.h>
 #include <util/light_probe_util.h>
 
 #include <3d/light_probe_types/light_probe.h>
@@ -79,6 +80,10 @@ public:
     bool BuildTetrahedralMesh(uint64_t lightProbeId) override;
 
     LightProbeVolumeOpt GetLightProbeVolume(uint64_t lightProbeEntity) const override;
+
+    // Search structures of the volume, valid until the volume is changed or removed.
+    const LightProbeLocator* GetLightProbeLocator(uint64_t lightProbeEntity) const;
+
     static constexpr const char* const TYPE_NAME = "RenderDataStoreLightProbe";
     static BASE_NS::refcnt_ptr<RENDER_NS::IRenderDataStore> Create(
         RENDER_NS::IRenderContext& renderContext, const char* name);
@@ -88,6 +93,8 @@ private:
     struct LightProbeVolumeBindTetVec {
         LightProbeVolume volume;
         BASE_NS::vector<Tetrahedron> tetVec;
+        BASE_NS::vector<TetrahedronAdjacency> adjacency;
+        LightProbeLocator locator;
     };
 
     BASE_NS::unordered_map<uint64_t, LightProbeVolumeBindTetVec> lightProbeVolume_;
@@ -772,7 +772,8 @@ void RenderNodeDefaultMaterialRenderSlot::ProcessSlotSubmeshes(
         currentScene_.camData.cameraIdx,
         currentScene_.mvCameraIndices,
         rsi,
-        sortedSlotSubmeshes_);
+        sortedSlotSubmeshes_,
+        slotCullBuffers_);
 }
 
 array_view<const DynamicStateEnum> RenderNodeDefaultMaterialRenderSlot::GetDynamicStates() const
@@ -801,7 +801,7 @@ void RenderNodeDefaultShadowRenderSlot::ProcessSlotSubmeshes(const IRenderDataSt
     const IRenderNodeSceneUtil::RenderSlotInfo rsi{
         currentScene_.renderSlotId, jsonInputs_.sortType, jsonInputs_.cullType, 0};
     RenderNodeSceneUtil::GetRenderSlotSubmeshes(
-        dataStoreCamera, dataStoreMaterial, cameraIndex, {}, rsi, sortedSlotSubmeshes_);
+        dataStoreCamera, dataStoreMaterial, cameraIndex, {}, rsi, sortedSlotSubmeshes_, slotCullBuffers_);
 }
 
 void RenderNodeDefaultShadowRenderSlot::ParseRenderNodeInputs()
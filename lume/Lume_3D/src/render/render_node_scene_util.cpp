@@ -46,6 +46,8 @@ using namespace RENDER_NS;
 
 namespace {
 static constexpr uint64_t INVALID_CAM_ID{0xFFFFFFFFffffffff};
+// render slots with fewer submeshes are culled one by one even when the submesh hierarchy is available
+static constexpr size_t MIN_BVH_CULL_SUBMESH_COUNT{64U};
 
 inline bool operator<(const SlotSubmeshIndex& lhs, const SlotSubmeshIndex& rhs)
 {
@@ -182,6 +184,66 @@ bool IsObjectCulled(IFrustumUtil& frustumUtil, const Frustum& camFrustum, const
     return !notCulled;
 }
 
+Bvh::Containment ClassifyAabb(const Frustum& frustum, const Bvh::Node& node)
+{
+    bool inside = true;
+    for (const auto& plane : frustum.planes) {
+        // box corners furthest along and against the plane normal
+        const Math::Vec3 far((plane.x >= 0.0f) ? node.max.x : node.min.x, (plane.y >= 0.0f) ? node.max.y : node.min.y,
+            (plane.z >= 0.0f) ? node.max.z : node.min.z);
+        const Math::Vec3 near((plane.x >= 0.0f) ? node.min.x : node.max.x, (plane.y >= 0.0f) ? node.min.y : node.max.y,
+            (plane.z >= 0.0f) ? node.min.z : node.max.z);
+        if ((Math::Dot(Math::Vec3(plane), far) + plane.w) < 0.0f) {
+            return Bvh::Containment::OUTSIDE;
+        }
+        if ((Math::Dot(Math::Vec3(plane), near) + plane.w) <= 0.0f) {
+            inside = false;
+        }
+    }
+    return inside ? Bvh::Containment::INSIDE : Bvh::Containment::INTERSECTS;
+}
+
+// Sets the visibility bits of submeshes inside the frustum. Classifying nodes is conservative, submeshes of nodes
+// partially inside are tested the same way as without the hierarchy.
+void CullSubmeshes(IFrustumUtil& frustumUtil, const Frustum& frustum, const Bvh& bvh,
+    const array_view<const RenderSubmesh> submeshes, vector<uint64_t>& visible)
+{
+    bvh.Traverse([&frustum](const Bvh::Node& node) { return ClassifyAabb(frustum, node); },
+        [&](const uint32_t index, const bool inside) {
+            uint64_t& bits = visible[index / 64U];
+            const uint64_t bit = 1ULL << (index % 64U);
+            if ((bits & bit) == 0U) {
+                if (inside || frustumUtil.SphereFrustumCollision(
+                                  frustum, submeshes[index].bounds.worldCenter, submeshes[index].bounds.worldRadius)) {
+                    bits |= bit;
+                }
+            }
+        });
+}
+
+// Culls the submeshes of a render slot in one batch, bit idx is set when slot submesh idx is visible in any frustum.
+void CullSlotSubmeshes(IFrustumUtil& frustumUtil, const array_view<const Frustum> frustums,
+    const array_view<const RenderSubmesh> submeshes, const array_view<const uint32_t> slotSubmeshIndices,
+    vector<float>& spheres, vector<uint64_t>& visible)
+{
+    const size_t count = slotSubmeshIndices.size();
+    spheres.resize(count * 4U);
+    float* const centerX = spheres.data();
+    float* const centerY = centerX + count;
+    float* const centerZ = centerY + count;
+    float* const radius = centerZ + count;
+    for (size_t idx = 0; idx < count; ++idx) {
+        const auto& bounds = submeshes[slotSubmeshIndices[idx]].bounds;
+        centerX[idx] = bounds.worldCenter.x;
+        centerY[idx] = bounds.worldCenter.y;
+        centerZ[idx] = bounds.worldCenter.z;
+        radius[idx] = bounds.worldRadius;
+    }
+    visible.resize((count + 63U) / 64U);
+    frustumUtil.SpheresFrustumCollision(frustums,
+        {{centerX, count}, {centerY, count}, {centerZ, count}, {radius, count}}, visible);
+}
+
 inline constexpr RenderSlotCullType GetRenderSlotBaseCullType(
     const RenderSlotCullType cullType, const RenderCamera& camera)
 {
@@ -290,6 +352,16 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
     const IRenderDataStoreDefaultMaterial& dataStoreMaterial, const uint32_t cameraIndex,
     const array_view<const uint32_t> addCameraIndices, const IRenderNodeSceneUtil::RenderSlotInfo& renderSlotInfo,
     vector<SlotSubmeshIndex>& refSubmeshIndices)
+{
+    SlotCullBuffers cullBuffers;
+    GetRenderSlotSubmeshes(dataStoreCamera, dataStoreMaterial, cameraIndex, addCameraIndices, renderSlotInfo,
+        refSubmeshIndices, cullBuffers);
+}
+
+void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCamera& dataStoreCamera,
+    const IRenderDataStoreDefaultMaterial& dataStoreMaterial, const uint32_t cameraIndex,
+    const array_view<const uint32_t> addCameraIndices, const IRenderNodeSceneUtil::RenderSlotInfo& renderSlotInfo,
+    vector<SlotSubmeshIndex>& refSubmeshIndices, SlotCullBuffers& cullBuffers)
 {
     // Get IFrustumUtil from global plugin registry.
     auto frustumUtil = CORE3D_NS::GetInstance<IFrustumUtil>(UID_FRUSTUM_UTIL);
@@ -327,16 +399,22 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
             camFrustum = frustumUtil->CreateFrustum(cam.matrices.proj * cam.matrices.view);
         }
     }
-    vector<Frustum> addFrustums;
+    // the camera frustum followed by the additional camera frustums
+    auto& frustums = cullBuffers.frustums;
+    frustums.clear();
     if (rsCullType == RenderSlotCullType::VIEW_FRUSTUM_CULL) {
-        addFrustums.reserve(addCameraIndices.size());
+        frustums.push_back(camFrustum);
         for (const auto& indexRef : addCameraIndices) {
             if (indexRef < maxCameraCount) {
-                addFrustums.push_back(
+                frustums.push_back(
                     frustumUtil->CreateFrustum(cameras[indexRef].matrices.proj * cameras[indexRef].matrices.view));
             }
         }
     }
+    array_view<const Frustum> addFrustums;
+    if (!frustums.empty()) {
+        addFrustums = array_view<const Frustum>(frustums.data() + 1U, frustums.size() - 1U);
+    }
 
     constexpr uint64_t maxUDepth = RenderDataStoreDefaultMaterial::SLOT_SORT_MAX_DEPTH;
     constexpr uint64_t sDepthShift = RenderDataStoreDefaultMaterial::SLOT_SORT_DEPTH_SHIFT;
@@ -348,6 +426,39 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
     const auto& slotSubmeshMatData = dataStoreMaterial.GetSlotSubmeshMaterialData(renderSlotInfo.id);
     const auto& submeshes = dataStoreMaterial.GetSubmeshes();
 
+    // with many submeshes cull the whole frame's submesh hierarchy once instead of each submesh
+    const Bvh* bvh = nullptr;
+    uint32_t bvhCount = 0U;
+    // visibility bits of the frame's submeshes with the hierarchy, otherwise of the slot's submeshes
+    auto& visible = cullBuffers.visible;
+    if ((rsCullType == RenderSlotCullType::VIEW_FRUSTUM_CULL) &&
+        (slotSubmeshIndices.size() >= MIN_BVH_CULL_SUBMESH_COUNT) &&
+        (dataStoreMaterial.GetTypeName() == RenderDataStoreDefaultMaterial::TYPE_NAME)) {
+        const auto& dsMat = static_cast<const RenderDataStoreDefaultMaterial&>(dataStoreMaterial);
+        if (const auto& submeshBvh = dsMat.GetSubmeshBvh(); !submeshBvh.Empty()) {
+            bvh = &submeshBvh;
+            bvhCount = Math::min(dsMat.GetSubmeshBvhCount(), static_cast<uint32_t>(submeshes.size()));
+            visible.clear();
+            visible.resize((submeshes.size() + 63U) / 64U, 0U);
+            for (const auto& frustum : frustums) {
+                CullSubmeshes(*frustumUtil, frustum, *bvh, submeshes, visible);
+            }
+        }
+    }
+    // otherwise cull the slot's submeshes in one batch
+    if ((rsCullType == RenderSlotCullType::VIEW_FRUSTUM_CULL) && (!bvh)) {
+        CullSlotSubmeshes(*frustumUtil, frustums, submeshes, slotSubmeshIndices, cullBuffers.spheres, visible);
+    }
+    auto isCulled = [&](const size_t idx, const uint32_t submeshIndex, const RenderSubmesh& submesh) {
+        if (!bvh) {
+            return (visible[idx / 64U] & (1ULL << (idx % 64U))) == 0U;
+        }
+        if (submeshIndex < bvhCount) {
+            return (visible[submeshIndex / 64U] & (1ULL << (submeshIndex % 64U))) == 0U;
+        }
+        return IsObjectCulled(*frustumUtil, camFrustum, addFrustums, submesh);
+    };
+
     refSubmeshIndices.clear();
     refSubmeshIndices.reserve(slotSubmeshIndices.size());
     for (size_t idx = 0; idx < slotSubmeshIndices.size(); ++idx) {
@@ -367,7 +478,7 @@ void RenderNodeSceneUtil::GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCa
         const bool notCulled =
             ((submeshMatData.renderMaterialFlags & RenderMaterialFlagBits::RENDER_MATERIAL_CAMERA_EFFECT_BIT) ||
                 (rsCullType != RenderSlotCullType::VIEW_FRUSTUM_CULL) ||
-                (!IsObjectCulled(*frustumUtil, camFrustum, addFrustums, submesh)));
+                (!isCulled(idx, submeshIndex, submesh)));
         const bool discardedMat = (submeshMatData.renderMaterialFlags & renderSlotInfo.materialDiscardFlags);
         if (notCulled && (!discardedMat)) {
             const Math::Vec4 pos = (camView * Math::Vec4(submesh.bounds.worldCenter, 1.0f));
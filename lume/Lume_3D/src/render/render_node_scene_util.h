@@ -22,6 +22,7 @@
 #include <3d/render/render_data_defines_3d.h>
 #include <base/containers/array_view.h>
 #include <base/containers/vector.h>
+#include <core/util/intf_frustum_util.h>
 #include <render/datastore/render_data_store_render_pods.h>
 #include <render/device/pipeline_state_desc.h>
 #include <render/render_data_structures.h>
@@ -81,6 +82,18 @@ public:
         const IRenderNodeSceneUtil::RenderSlotInfo& renderSlotInfo,
         BASE_NS::vector<SlotSubmeshIndex>& refSubmeshIndices);
 
+    /** Culling scratch of GetRenderSlotSubmeshes, kept by the render node to reuse the allocations every frame. */
+    struct SlotCullBuffers {
+        BASE_NS::vector<CORE_NS::Frustum> frustums;
+        BASE_NS::vector<float> spheres;
+        BASE_NS::vector<uint64_t> visible;
+    };
+    static void GetRenderSlotSubmeshes(const IRenderDataStoreDefaultCamera& dataStoreCamera,
+        const IRenderDataStoreDefaultMaterial& dataStoreMaterial, const uint32_t cameraIndex,
+        const BASE_NS::array_view<const uint32_t> addCameraIndices,
+        const IRenderNodeSceneUtil::RenderSlotInfo& renderSlotInfo,
+        BASE_NS::vector<SlotSubmeshIndex>& refSubmeshIndices, SlotCullBuffers& cullBuffers);
+
     static SceneBufferHandles GetSceneBufferHandles(
         RENDER_NS::IRenderNodeContextManager& renderNodeContextMgr, const BASE_NS::string_view sceneName);
     static SceneCameraBufferHandles GetSceneCameraBufferHandles(
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/animation_compression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <base/math/mathf.h>
+#include <base/math/quaternion.h>
+#include <base/math/quaternion_util.h>
+#include <core/property/property_types.h>
+
+CORE3D_BEGIN_NAMESPACE()
+using namespace BASE_NS;
+using namespace CORE_NS;
+
+namespace {
+constexpr uint32_t MAX_QUANTIZED = 0xFFFFU;
+// Smallest three components use 15 bits, the top bits of the first two hold the index of the dropped component.
+constexpr uint32_t MAX_QUANTIZED_ROTATION = 0x7FFFU;
+constexpr uint32_t ROTATION_INDEX_SHIFT = 15U;
+constexpr float SQRT2 = 1.41421356237f;
+// Longest run of keyframes replaced by one interpolated segment, bounds the cost of the reduction.
+constexpr size_t MAX_SEGMENT_LENGTH = 256U;
+
+using Header = AnimationCompression::Header;
+
+// Floats per keyframe for the supported types, zero for others.
+uint16_t GetComponentCount(uint64_t type)
+{
+    if (type == PropertyType::FLOAT_T) {
+        return 1U;
+    }
+    if (type == PropertyType::VEC2_T) {
+        return 2U;
+    }
+    if (type == PropertyType::VEC3_T) {
+        return 3U;
+    }
+    if ((type == PropertyType::VEC4_T) || (type == PropertyType::QUAT_T)) {
+        return 4U;
+    }
+    return 0U;
+}
+
+inline size_t GetValueCount(const Header& header)
+{
+    return header.rotation ? 3U : header.components;
+}
+
+inline const Math::Quat& AsQuat(const float* values)
+{
+    return *static_cast<const Math::Quat*>(static_cast<const void*>(values));
+}
+
+// Interpolated value of keyframes start and end the same way as the animation system.
+void Interpolate(AnimationTrackComponent::Interpolation mode, bool rotation, size_t components, const float* start,
+    const float* end, float t, float* result)
+{
+    if (mode == AnimationTrackComponent::Interpolation::STEP) {
+        std::copy(t > 0.5f ? end : start, (t > 0.5f ? end : start) + components, result);
+    } else if (rotation) {
+        const Math::Quat value = Math::Slerp(AsQuat(start), AsQuat(end), t);
+        result[0U] = value.x;
+        result[1U] = value.y;
+        result[2U] = value.z;
+        result[3U] = value.w;
+    } else {
+        for (size_t i = 0U; i < components; ++i) {
+            result[i] = Math::lerp(start[i], end[i], t);
+        }
+    }
+}
+
+float GetError(bool rotation, size_t components, const float* expected, const float* actual)
+{
+    float error = 0.0f;
+    if (rotation) {
+        // q and -q are the same rotation.
+        const float sign = (Math::Dot(AsQuat(expected), AsQuat(actual)) < 0.0f) ? -1.0f : 1.0f;
+        for (size_t i = 0U; i < components; ++i) {
+            error = Math::max(error, Math::abs(expected[i] - sign * actual[i]));
+        }
+    } else {
+        for (size_t i = 0U; i < components; ++i) {
+            error = Math::max(error, Math::abs(expected[i] - actual[i]));
+        }
+    }
+    return error;
+}
+
+inline float GetFactor(array_view<const float> timestamps, size_t start, size_t end, float time)
+{
+    const float length = timestamps[end] - timestamps[start];
+    return (length > 0.0f) ? ((time - timestamps[start]) / length) : 0.0f;
+}
+
+// Indices of the keyframes needed to reproduce the track within tolerance.
+vector<uint32_t> SelectKeyframes(AnimationTrackComponent::Interpolation mode, bool rotation, size_t components,
+    array_view<const float> timestamps, const float* values, float tolerance)
+{
+    const size_t count = timestamps.size();
+    vector<uint32_t> kept;
+    kept.push_back(0U);
+    if (count < 3U) {
+        for (size_t i = 1U; i < count; ++i) {
+            kept.push_back(static_cast<uint32_t>(i));
+        }
+        return kept;
+    }
+    if (mode == AnimationTrackComponent::Interpolation::STEP) {
+        // Keyframes are picked at the midpoint between two keyframes, so only keyframes surrounded by equal values
+        // can be dropped without moving the step.
+        for (size_t i = 1U; (i + 1U) < count; ++i) {
+            const float* value = values + i * components;
+            if ((GetError(rotation, components, value - components, value) > tolerance) ||
+                (GetError(rotation, components, value, value + components) > tolerance)) {
+                kept.push_back(static_cast<uint32_t>(i));
+            }
+        }
+    } else {
+        // Extend the segment from the last kept keyframe as long as the skipped keyframes are within tolerance.
+        float interpolated[4U];
+        size_t anchor = 0U;
+        for (size_t end = 2U; end < count; ++end) {
+            bool fits = (end - anchor) <= MAX_SEGMENT_LENGTH;
+            for (size_t i = anchor + 1U; fits && (i < end); ++i) {
+                Interpolate(mode, rotation, components, values + anchor * components, values + end * components,
+                    GetFactor(timestamps, anchor, end, timestamps[i]), interpolated);
+                fits = GetError(rotation, components, values + i * components, interpolated) <= tolerance;
+            }
+            if (!fits) {
+                anchor = end - 1U;
+                kept.push_back(static_cast<uint32_t>(anchor));
+            }
+        }
+    }
+    kept.push_back(static_cast<uint32_t>(count - 1U));
+    return kept;
+}
+
+void EncodeRotation(const float* values, uint16_t* quantized)
+{
+    Math::Quat q = Math::Normalize(AsQuat(values));
+    float components[4U]{q.x, q.y, q.z, q.w};
+    uint32_t largest = 0U;
+    for (uint32_t i = 1U; i < 4U; ++i) {
+        if (Math::abs(components[i]) > Math::abs(components[largest])) {
+            largest = i;
+        }
+    }
+    const float sign = (components[largest] < 0.0f) ? -1.0f : 1.0f;
+    uint32_t out = 0U;
+    for (uint32_t i = 0U; i < 4U; ++i) {
+        if (i == largest) {
+            continue;
+        }
+        // The smaller components are within [-1/sqrt(2), 1/sqrt(2)].
+        const float normalized = Math::clamp01((sign * components[i] * SQRT2 + 1.0f) * 0.5f);
+        quantized[out++] = static_cast<uint16_t>(std::lround(normalized * static_cast<float>(MAX_QUANTIZED_ROTATION)));
+    }
+    quantized[0U] |= static_cast<uint16_t>((largest >> 1U) << ROTATION_INDEX_SHIFT);
+    quantized[1U] |= static_cast<uint16_t>((largest & 1U) << ROTATION_INDEX_SHIFT);
+}
+
+void DecodeRotation(const uint16_t* quantized, float* values)
+{
+    const uint32_t largest =
+        ((static_cast<uint32_t>(quantized[0U]) >> ROTATION_INDEX_SHIFT) << 1U) |
+        (static_cast<uint32_t>(quantized[1U]) >> ROTATION_INDEX_SHIFT);
+    constexpr float scale = 2.0f / static_cast<float>(MAX_QUANTIZED_ROTATION);
+    float sum = 0.0f;
+    uint32_t in = 0U;
+    for (uint32_t i = 0U; i < 4U; ++i) {
+        if (i == largest) {
+            continue;
+        }
+        const float value =
+            (static_cast<float>(quantized[in++] & MAX_QUANTIZED_ROTATION) * scale - 1.0f) * (1.0f / SQRT2);
+        values[i] = value;
+        sum += value * value;
+    }
+    values[largest] = Math::sqrt(Math::max(0.0f, 1.0f - sum));
+}
+}  // namespace
+
+vector<uint8_t> AnimationCompression::Compress(uint64_t type, AnimationTrackComponent::Interpolation mode,
+    array_view<const float> timestamps, array_view<const uint8_t> data, float tolerance)
+{
+    const uint16_t components = GetComponentCount(type);
+    if (!components || (mode == AnimationTrackComponent::Interpolation::SPLINE) || timestamps.empty() ||
+        (data.size() != timestamps.size() * components * sizeof(float))) {
+        return {};
+    }
+    const bool rotation = (type == PropertyType::QUAT_T);
+    const auto* values = static_cast<const float*>(static_cast<const void*>(data.data()));
+    const vector<uint32_t> kept = SelectKeyframes(mode, rotation, components, timestamps, values, tolerance);
+
+    Header header{};
+    header.keyframeCount = static_cast<uint32_t>(kept.size());
+    header.components = components;
+    header.rotation = rotation ? 1U : 0U;
+    if (!rotation) {
+        for (uint16_t c = 0U; c < components; ++c) {
+            float minimum = values[kept.front() * components + c];
+            float maximum = minimum;
+            for (const auto index : kept) {
+                minimum = Math::min(minimum, values[index * components + c]);
+                maximum = Math::max(maximum, values[index * components + c]);
+            }
+            header.minimum[c] = minimum;
+            header.step[c] = (maximum - minimum) / static_cast<float>(MAX_QUANTIZED);
+        }
+    }
+
+    const size_t valueCount = GetValueCount(header);
+    vector<uint8_t> result(sizeof(Header) + kept.size() * (sizeof(float) + valueCount * sizeof(uint16_t)));
+    auto* dstHeader = static_cast<Header*>(static_cast<void*>(result.data()));
+    *dstHeader = header;
+    auto* dstTimestamps = static_cast<float*>(static_cast<void*>(dstHeader + 1));
+    auto* dstValues = static_cast<uint16_t*>(static_cast<void*>(dstTimestamps + kept.size()));
+    for (const auto index : kept) {
+        *dstTimestamps++ = timestamps[index];
+        const float* value = values + index * components;
+        if (rotation) {
+            EncodeRotation(value, dstValues);
+        } else {
+            for (uint16_t c = 0U; c < components; ++c) {
+                const float normalized = (header.step[c] > 0.0f) ? ((value[c] - header.minimum[c]) / header.step[c])
+                                                                 : 0.0f;
+                dstValues[c] = static_cast<uint16_t>(
+                    std::lround(std::clamp(normalized, 0.0f, static_cast<float>(MAX_QUANTIZED))));
+            }
+        }
+        dstValues += valueCount;
+    }
+    return result;
+}
+
+bool AnimationCompression::GetTrack(array_view<const uint8_t> data, Track& track)
+{
+    if (data.size() < sizeof(Header)) {
+        return false;
+    }
+    const auto* header = static_cast<const Header*>(static_cast<const void*>(data.data()));
+    if (!header->keyframeCount || !header->components || (header->components > 4U) ||
+        (header->rotation && (header->components != 4U))) {
+        return false;
+    }
+    const size_t count = header->keyframeCount;
+    if (data.size() != sizeof(Header) + count * (sizeof(float) + GetValueCount(*header) * sizeof(uint16_t))) {
+        return false;
+    }
+    const auto* timestamps = static_cast<const float*>(static_cast<const void*>(header + 1));
+    track.header = header;
+    track.timestamps = array_view(timestamps, count);
+    track.values = static_cast<const uint16_t*>(static_cast<const void*>(timestamps + count));
+    return true;
+}
+
+bool AnimationCompression::Scale(array_view<uint8_t> data, float scale)
+{
+    Track track;
+    if (!GetTrack(data, track) || track.header->rotation) {
+        return false;
+    }
+    auto* header = static_cast<Header*>(static_cast<void*>(data.data()));
+    for (uint16_t c = 0U; c < header->components; ++c) {
+        header->minimum[c] *= scale;
+        header->step[c] *= scale;
+    }
+    return true;
+}
+
+void AnimationCompression::DecodeKeyframe(const Track& track, size_t index, float* values)
+{
+    const Header& header = *track.header;
+    const uint16_t* quantized = track.values + index * GetValueCount(header);
+    if (header.rotation) {
+        DecodeRotation(quantized, values);
+    } else {
+        for (uint16_t c = 0U; c < header.components; ++c) {
+            values[c] = header.minimum[c] + static_cast<float>(quantized[c]) * header.step[c];
+        }
+    }
+}
+
+vector<uint8_t> AnimationCompression::Decompress(
+    array_view<const uint8_t> data, AnimationTrackComponent::Interpolation mode, array_view<const float> timestamps)
+{
+    Track track;
+    if (!GetTrack(data, track)) {
+        return {};
+    }
+    const size_t components = track.header->components;
+    vector<uint8_t> result(timestamps.size() * components * sizeof(float));
+    auto* dst = static_cast<float*>(static_cast<void*>(result.data()));
+    float start[4U];
+    float end[4U];
+    const auto keyframes = track.timestamps;
+    for (const float time : timestamps) {
+        // Same keyframe selection as the animation system when playing forward.
+        const size_t next = static_cast<size_t>(
+            std::upper_bound(keyframes.begin(), keyframes.end(), time) - keyframes.begin());
+        const size_t endIndex = Math::min(next, keyframes.size() - 1U);
+        const size_t startIndex = next ? (next - 1U) : 0U;
+        DecodeKeyframe(track, startIndex, start);
+        DecodeKeyframe(track, endIndex, end);
+        const float t =
+            (startIndex != endIndex) ? std::clamp(GetFactor(keyframes, startIndex, endIndex, time), 0.0f, 1.0f) : 0.0f;
+        Interpolate(mode, track.header->rotation != 0U, components, start, end, t, dst);
+        dst += components;
+    }
+    return result;
+}
+CORE3D_END_NAMESPACE()
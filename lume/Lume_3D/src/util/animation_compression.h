@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_UTIL_ANIMATION_COMPRESSION_H
+#define CORE_UTIL_ANIMATION_COMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <3d/ecs/components/animation_track_component.h>
+#include <3d/namespace.h>
+#include <base/containers/array_view.h>
+#include <base/containers/vector.h>
+
+CORE3D_BEGIN_NAMESPACE()
+/** Encoding and decoding of AnimationOutputComponent::Encoding::QUANTIZED keyframe data.
+ * The data starts with a Header, followed by the timestamps of the kept keyframes as floats, and the quantized values
+ * as uint16_t, three per rotation and one per component for other types.
+ */
+class AnimationCompression {
+public:
+    /** Default maximum difference between the original keyframes and the interpolated values when dropping
+     * keyframes. Quantization adds at most half a quantization step. */
+    static constexpr float DEFAULT_TOLERANCE = 0.0001f;
+
+    struct Header {
+        uint32_t keyframeCount;
+        /** Floats per decoded keyframe. */
+        uint16_t components;
+        /** Non zero when the values are smallest three encoded quaternions. */
+        uint16_t rotation;
+        /** Range quantization: value = minimum + quantized * step. */
+        float minimum[4U];
+        float step[4U];
+    };
+
+    /** View into quantized keyframe data. */
+    struct Track {
+        const Header* header;
+        BASE_NS::array_view<const float> timestamps;
+        const uint16_t* values;
+    };
+
+    /** Reduces and quantizes raw keyframes. type is the AnimationOutputComponent::type, supported types are float,
+     * vectors and quaternions with step or linear interpolation. Returns empty when the track isn't supported or
+     * the data doesn't match the timestamps.
+     */
+    static BASE_NS::vector<uint8_t> Compress(uint64_t type, AnimationTrackComponent::Interpolation mode,
+        BASE_NS::array_view<const float> timestamps, BASE_NS::array_view<const uint8_t> data,
+        float tolerance = DEFAULT_TOLERANCE);
+
+    /** Validates the data and fills track. */
+    static bool GetTrack(BASE_NS::array_view<const uint8_t> data, Track& track);
+
+    /** Multiplies the values of quantized data by scale by scaling the quantization range. Returns false for
+     * rotations and invalid data. */
+    static bool Scale(BASE_NS::array_view<uint8_t> data, float scale);
+
+    /** Decodes header->components floats of keyframe index to values. */
+    static void DecodeKeyframe(const Track& track, size_t index, float* values);
+
+    /** Samples quantized data at each of the timestamps, giving raw keyframes e.g. for exporting or editing. */
+    static BASE_NS::vector<uint8_t> Decompress(BASE_NS::array_view<const uint8_t> data,
+        AnimationTrackComponent::Interpolation mode, BASE_NS::array_view<const float> timestamps);
+
+    AnimationCompression() = delete;
+};
+CORE3D_END_NAMESPACE()
+
+#endif  // CORE_UTIL_ANIMATION_COMPRESSION_H
@@ -19,12 +19,105 @@
 #include <array>
 #include <cmath>
 #include <limits>
-#include <map>
+#include <numeric>
+#include <random>
 #include <util/log.h>
 
 #include <3d/light_probe_types/light_probe_constants.h>
+#include <base/math/vector_util.h>
 
 CORE3D_BEGIN_NAMESPACE()
+namespace {
+constexpr uint32_t INVALID_TETRAHEDRON = TetrahedronAdjacency::INVALID_NEIGHBOR;
+constexpr uint32_t VERTEX_COUNT = LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT;
+// Tetrahedrons flatter than this relative to their edge lengths are not created.
+constexpr float MIN_RELATIVE_VOLUME = 1e-5f;
+// Points closer than this to an existing vertex are skipped.
+constexpr float DUPLICATE_DISTANCE_SQUARED = 1e-10f;
+constexpr uint32_t HILBERT_BITS = 16U;
+// The first round of the insertion order is at most this large.
+constexpr uint32_t MIN_ROUND_SIZE = 64U;
+
+// Six times the signed volume, positive for the vertex order of the super tetrahedron.
+float Orientation(const BASE_NS::Math::Vec3& a, const BASE_NS::Math::Vec3& b, const BASE_NS::Math::Vec3& c,
+    const BASE_NS::Math::Vec3& d)
+{
+    return BASE_NS::Math::Dot(b - a, BASE_NS::Math::Cross(c - a, d - a));
+}
+
+// Orientation of the tetrahedron with the vertex replaced by the point. Positive when the point is on the same side
+// of the opposite face as the vertex.
+float ReplacedOrientation(const Tetrahedron& tet, uint32_t vertex, const BASE_NS::Math::Vec3& point)
+{
+    BASE_NS::Math::Vec3 vertices[VERTEX_COUNT] = {tet.vertices[0], tet.vertices[1], tet.vertices[2], tet.vertices[3]};
+    vertices[vertex] = point;
+    return Orientation(vertices[0], vertices[1], vertices[2], vertices[3]);
+}
+
+// Checks that the tetrahedron made of the point and the face opposite of the vertex isn't inverted or flat.
+bool IsFaceVisible(const Tetrahedron& tet, uint32_t vertex, const BASE_NS::Math::Vec3& point)
+{
+    float scale = 1.0f;
+    for (uint32_t i = 0U; i < VERTEX_COUNT; ++i) {
+        if (i != vertex) {
+            scale *= BASE_NS::Math::distance(tet.vertices[i], point);
+        }
+    }
+    return ReplacedOrientation(tet, vertex, point) > (scale * MIN_RELATIVE_VOLUME);
+}
+
+bool IsInConflict(const BASE_NS::Math::Vec3& point, const Tetrahedron& tet)
+{
+    const float distSquared = BASE_NS::Math::Distance2(point, tet.circumcenter);
+    const float tolerance = std::max(tet.circumradiusSquared * 1e-4f, 1e-5f);
+    return distSquared <= tet.circumradiusSquared + tolerance;
+}
+
+uint32_t FindSlot(const TetrahedronAdjacency& adjacency, uint32_t neighbor)
+{
+    for (uint32_t i = 0U; i < VERTEX_COUNT; ++i) {
+        if (adjacency.neighbors[i] == neighbor) {
+            return i;
+        }
+    }
+    return INVALID_TETRAHEDRON;
+}
+
+// Distance along a 3D Hilbert curve of a point with HILBERT_BITS bits per coordinate.
+uint64_t HilbertIndex(uint32_t x, uint32_t y, uint32_t z)
+{
+    uint32_t axes[3U] = {x, y, z};
+    // Undo the excess work, J. Skilling "Programming the Hilbert curve".
+    for (uint32_t q = 1U << (HILBERT_BITS - 1U); q > 1U; q >>= 1U) {
+        const uint32_t p = q - 1U;
+        for (uint32_t i = 0U; i < 3U; ++i) {
+            if (axes[i] & q) {
+                axes[0U] ^= p;
+            } else {
+                const uint32_t t = (axes[0U] ^ axes[i]) & p;
+                axes[0U] ^= t;
+                axes[i] ^= t;
+            }
+        }
+    }
+    // Gray encode.
+    axes[1U] ^= axes[0U];
+    axes[2U] ^= axes[1U];
+    uint32_t t = 0U;
+    for (uint32_t q = 1U << (HILBERT_BITS - 1U); q > 1U; q >>= 1U) {
+        if (axes[2U] & q) {
+            t ^= q - 1U;
+        }
+    }
+    uint64_t index = 0U;
+    for (uint32_t bit = HILBERT_BITS; bit > 0U; --bit) {
+        for (uint32_t i = 0U; i < 3U; ++i) {
+            index = (index << 1U) | (((axes[i] ^ t) >> (bit - 1U)) & 1U);
+        }
+    }
+    return index;
+}
+}  // namespace
 
 void BowyerWatsonDelaunay3D::BuildTetrahedralMesh(LightProbeVolume& lightProbeVolume)
 {
@@ -40,19 +133,28 @@ void BowyerWatsonDelaunay3D::BuildTetrahedralMesh(LightProbeVolume& lightProbeVo
     }
 
     lightProbeVolume.tetrahedrons.clear();
+    if (lightProbeVolume.adjacency) {
+        lightProbeVolume.adjacency->clear();
+    }
     allPoints_.clear();
 
     for (const auto& probe : lightProbeVolume.lightProbes) {
         allPoints_.push_back(probe.position);
     }
 
+    BASE_NS::vector<uint32_t> order;
+    SortInsertionOrder(static_cast<uint32_t>(lightProbeVolume.lightProbes.size()), order);
+
     CreateSuperTetrahedron(lightProbeVolume);
 
-    for (uint32_t i = 0; i < static_cast<uint32_t>(lightProbeVolume.lightProbes.size()); ++i) {
-        InsertPoint(i, lightProbeVolume);
+    for (const uint32_t pointIndex : order) {
+        InsertPoint(pointIndex, lightProbeVolume);
     }
     RemoveSuperTetrahedron(lightProbeVolume);
     allPoints_.clear();
+    neighbors_.clear();
+    cavityStamps_.clear();
+    vertexStamps_.clear();
     PLUGIN_LOG_I("BowyerWatson: Generated %zu tetrahedra from %zu light probes",
         lightProbeVolume.tetrahedrons.size(),
         lightProbeVolume.lightProbes.size());
@@ -96,78 +198,274 @@ void BowyerWatsonDelaunay3D::CreateSuperTetrahedron(LightProbeVolume& lightProbe
 
     ComputeCircumsphere(superTet, lightProbeVolume);
     lightProbeVolume.tetrahedrons.push_back(superTet);
+
+    neighbors_.clear();
+    neighbors_.push_back({{INVALID_TETRAHEDRON, INVALID_TETRAHEDRON, INVALID_TETRAHEDRON, INVALID_TETRAHEDRON}});
+    cavityStamps_.clear();
+    cavityStamps_.push_back(0U);
+    vertexStamps_.clear();
+    vertexStamps_.resize(allPoints_.size(), 0U);
+    cavityStamp_ = 0U;
+    vertexStamp_ = 0U;
+    lastTetrahedron_ = 0U;
 }
 
-void BowyerWatsonDelaunay3D::InsertPoint(uint32_t pointIndex, LightProbeVolume& lightProbeVolume)
+void BowyerWatsonDelaunay3D::SortInsertionOrder(uint32_t pointCount, BASE_NS::vector<uint32_t>& order) const
 {
-    const BASE_NS::Math::Vec3& point = allPoints_[pointIndex];
-
-    BASE_NS::vector<uint32_t> badTetrahedra;
-
-    for (uint32_t i = 0; i < static_cast<uint32_t>(lightProbeVolume.tetrahedrons.size()); ++i) {
-        float distSquared = BASE_NS::Math::Distance2(point, lightProbeVolume.tetrahedrons[i].circumcenter);
-        float circumRadiusSquared = lightProbeVolume.tetrahedrons[i].circumradiusSquared;
-        float tolerance = std::max(circumRadiusSquared * 1e-4f, 1e-5f);
+    // Biased randomized insertion order: the points are shuffled into rounds doubling in size and each round is
+    // sorted along a Hilbert curve. Consecutive points are close to each other so locating them is a short walk,
+    // while the randomization keeps the intermediate meshes well shaped.
+    order.resize(pointCount);
+    std::iota(order.begin(), order.end(), 0U);
+    std::mt19937 generator(pointCount);
+    std::shuffle(order.begin(), order.end(), generator);
+
+    BASE_NS::Math::Vec3 minP = allPoints_[0U];
+    BASE_NS::Math::Vec3 maxP = minP;
+    for (uint32_t i = 1U; i < pointCount; ++i) {
+        minP = BASE_NS::Math::min(minP, allPoints_[i]);
+        maxP = BASE_NS::Math::max(maxP, allPoints_[i]);
+    }
+    const BASE_NS::Math::Vec3 extent = maxP - minP;
+    const float range = std::max({extent.x, extent.y, extent.z, std::numeric_limits<float>::min()});
+    const float quantize = static_cast<float>((1U << HILBERT_BITS) - 1U) / range;
+    BASE_NS::vector<uint64_t> keys(pointCount);
+    for (uint32_t i = 0U; i < pointCount; ++i) {
+        const BASE_NS::Math::Vec3 p = (allPoints_[i] - minP) * quantize;
+        keys[i] = HilbertIndex(static_cast<uint32_t>(p.x), static_cast<uint32_t>(p.y), static_cast<uint32_t>(p.z));
+    }
 
-        if (distSquared <= circumRadiusSquared + tolerance) {
-            badTetrahedra.push_back(i);
-        }
+    uint32_t end = pointCount;
+    while (end > 0U) {
+        const uint32_t begin = (end > MIN_ROUND_SIZE) ? (end / 2U) : 0U;
+        std::sort(order.begin() + begin, order.begin() + end,
+            [&keys](uint32_t lhs, uint32_t rhs) { return keys[lhs] < keys[rhs]; });
+        end = begin;
     }
+}
 
-    if (badTetrahedra.empty()) {
-        return;
+bool BowyerWatsonDelaunay3D::InsertPoint(uint32_t pointIndex, LightProbeVolume& lightProbeVolume)
+{
+    const BASE_NS::Math::Vec3& point = allPoints_[pointIndex];
+    const uint32_t seed = LocatePoint(point, lightProbeVolume);
+    if (seed == INVALID_TETRAHEDRON) {
+        return false;
+    }
+    for (const auto& vertex : lightProbeVolume.tetrahedrons[seed].vertices) {
+        if (BASE_NS::Math::Distance2(vertex, point) <= DUPLICATE_DISTANCE_SQUARED) {
+            return false;
+        }
     }
 
-    std::map<std::array<uint32_t, 3>, FaceData> uniqueFaces;
-    std::map<std::array<uint32_t, 3>, int> faceCounts;
+    GrowCavity(seed, point, lightProbeVolume);
 
-    for (uint32_t tetIndex : badTetrahedra) {
-        const Tetrahedron& tet = lightProbeVolume.tetrahedrons[tetIndex];
-        FaceData faces[4] = {
-            {{tet.indices[1], tet.indices[2], tet.indices[3]}, {tet.vertices[1], tet.vertices[2], tet.vertices[3]}},
-            {{tet.indices[0], tet.indices[2], tet.indices[3]}, {tet.vertices[0], tet.vertices[2], tet.vertices[3]}},
-            {{tet.indices[0], tet.indices[1], tet.indices[3]}, {tet.vertices[0], tet.vertices[1], tet.vertices[3]}},
-            {{tet.indices[0], tet.indices[1], tet.indices[2]}, {tet.vertices[0], tet.vertices[1], tet.vertices[2]}},
-        };
+    // Rounding can make the cavity non star shaped, shrink it until every boundary face is visible from the point
+    // and no vertex would be left inside.
+    for (uint32_t invalid = FindInvalidCavityTetrahedron(pointIndex, seed, lightProbeVolume);
+         invalid != INVALID_TETRAHEDRON; invalid = FindInvalidCavityTetrahedron(pointIndex, seed, lightProbeVolume)) {
+        if (invalid == seed) {
+            return false;
+        }
+        cavityStamps_[invalid] = 0U;
+        const auto pos = std::find(cavity_.begin(), cavity_.end(), invalid);
+        *pos = cavity_.back();
+        cavity_.pop_back();
+    }
 
-        for (const auto& face : faces) {
-            std::array<uint32_t, LightProbeConstants::VERTICES_PER_FACE_COUNT> sortedIndices = {
-                face.indices[0], face.indices[1], face.indices[2]};
-            std::sort(sortedIndices.begin(), sortedIndices.end());
+    FillCavity(pointIndex, lightProbeVolume);
+    return true;
+}
 
-            faceCounts[sortedIndices]++;
-            if (faceCounts[sortedIndices] == 1) {
-                uniqueFaces[sortedIndices] = face;
+uint32_t BowyerWatsonDelaunay3D::LocatePoint(
+    const BASE_NS::Math::Vec3& point, const LightProbeVolume& lightProbeVolume) const
+{
+    // Visibility walk from the previous insertion, which is close by thanks to the insertion order. The face tests
+    // start from a different face each step so the walk can't cycle.
+    const auto& tetrahedrons = lightProbeVolume.tetrahedrons;
+    uint32_t current = (lastTetrahedron_ < tetrahedrons.size()) ? lastTetrahedron_ : 0U;
+    uint32_t previous = INVALID_TETRAHEDRON;
+    for (size_t step = 0U; step < tetrahedrons.size(); ++step) {
+        const Tetrahedron& tet = tetrahedrons[current];
+        uint32_t next = current;
+        for (uint32_t i = 0U; i < VERTEX_COUNT; ++i) {
+            const uint32_t face = static_cast<uint32_t>(step + i) % VERTEX_COUNT;
+            const uint32_t neighbor = neighbors_[current].neighbors[face];
+            if ((neighbor != previous) && (ReplacedOrientation(tet, face, point) < 0.0f)) {
+                next = neighbor;
+                break;
             }
         }
+        if (next == current) {
+            return current;
+        }
+        if (next == INVALID_TETRAHEDRON) {
+            // Outside of the super tetrahedron.
+            return INVALID_TETRAHEDRON;
+        }
+        previous = current;
+        current = next;
     }
+    // Didn't converge, any tetrahedron in conflict can seed the cavity.
+    for (uint32_t i = 0U; i < static_cast<uint32_t>(tetrahedrons.size()); ++i) {
+        if (IsInConflict(point, tetrahedrons[i])) {
+            return i;
+        }
+    }
+    return INVALID_TETRAHEDRON;
+}
 
-    for (const auto& pair : faceCounts) {
-        if (pair.second == 1) {
-            const FaceData& face = uniqueFaces[pair.first];
-            Tetrahedron newTet;
+void BowyerWatsonDelaunay3D::GrowCavity(
+    uint32_t seed, const BASE_NS::Math::Vec3& point, const LightProbeVolume& lightProbeVolume)
+{
+    // The tetrahedrons whose circumsphere contains the point form a connected region around the seed.
+    ++cavityStamp_;
+    cavity_.clear();
+    cavity_.push_back(seed);
+    cavityStamps_[seed] = cavityStamp_;
+    for (size_t i = 0U; i < cavity_.size(); ++i) {
+        for (const uint32_t neighbor : neighbors_[cavity_[i]].neighbors) {
+            if ((neighbor != INVALID_TETRAHEDRON) && (cavityStamps_[neighbor] != cavityStamp_) &&
+                IsInConflict(point, lightProbeVolume.tetrahedrons[neighbor])) {
+                cavityStamps_[neighbor] = cavityStamp_;
+                cavity_.push_back(neighbor);
+            }
+        }
+    }
+}
 
-            newTet.indices[0] = face.indices[0];
-            newTet.indices[1] = face.indices[1];
-            newTet.indices[2] = face.indices[2];
-            newTet.indices[3] = pointIndex;
+uint32_t BowyerWatsonDelaunay3D::FindInvalidCavityTetrahedron(
+    uint32_t pointIndex, uint32_t seed, const LightProbeVolume& lightProbeVolume)
+{
+    const auto& tetrahedrons = lightProbeVolume.tetrahedrons;
+    const BASE_NS::Math::Vec3& point = allPoints_[pointIndex];
+    boundary_.clear();
+    ++vertexStamp_;
+    for (const uint32_t tetIndex : cavity_) {
+        const Tetrahedron& tet = tetrahedrons[tetIndex];
+        for (uint32_t face = 0U; face < VERTEX_COUNT; ++face) {
+            const uint32_t outside = neighbors_[tetIndex].neighbors[face];
+            if ((outside != INVALID_TETRAHEDRON) && (cavityStamps_[outside] == cavityStamp_)) {
+                continue;
+            }
+            if (!IsFaceVisible(tet, face, point)) {
+                return tetIndex;
+            }
+            BoundaryFace boundaryFace{{tet.indices[0], tet.indices[1], tet.indices[2], tet.indices[3]}, face, outside,
+                (outside != INVALID_TETRAHEDRON) ? FindSlot(neighbors_[outside], tetIndex) : 0U};
+            boundaryFace.indices[face] = pointIndex;
+            boundary_.push_back(boundaryFace);
+            for (uint32_t i = 0U; i < VERTEX_COUNT; ++i) {
+                if (i != face) {
+                    vertexStamps_[tet.indices[i]] = vertexStamp_;
+                }
+            }
+        }
+    }
+    // A vertex which isn't on the boundary would be lost, keep one of its tetrahedrons out of the cavity.
+    for (const uint32_t tetIndex : cavity_) {
+        for (const uint32_t vertex : tetrahedrons[tetIndex].indices) {
+            if (vertexStamps_[vertex] == vertexStamp_) {
+                continue;
+            }
+            for (const uint32_t other : cavity_) {
+                const auto& indices = tetrahedrons[other].indices;
+                const bool hasVertex = std::find(std::begin(indices), std::end(indices), vertex) != std::end(indices);
+                if ((other != seed) && hasVertex) {
+                    return other;
+                }
+            }
+            return seed;
+        }
+    }
+    return INVALID_TETRAHEDRON;
+}
 
-            newTet.vertices[0] = face.vertices[0];
-            newTet.vertices[1] = face.vertices[1];
-            newTet.vertices[2] = face.vertices[2];
-            newTet.vertices[3] = point;
+void BowyerWatsonDelaunay3D::FillCavity(uint32_t pointIndex, LightProbeVolume& lightProbeVolume)
+{
+    auto& tetrahedrons = lightProbeVolume.tetrahedrons;
+    pointFaces_.clear();
+    for (size_t i = 0U; i < boundary_.size(); ++i) {
+        const BoundaryFace& face = boundary_[i];
+        // Cavity slots are reused before appending.
+        uint32_t tetIndex;
+        if (i < cavity_.size()) {
+            tetIndex = cavity_[i];
+        } else {
+            tetIndex = static_cast<uint32_t>(tetrahedrons.size());
+            tetrahedrons.emplace_back();
+            neighbors_.emplace_back();
+            cavityStamps_.push_back(0U);
+        }
+        Tetrahedron& tet = tetrahedrons[tetIndex];
+        for (uint32_t j = 0U; j < VERTEX_COUNT; ++j) {
+            tet.indices[j] = face.indices[j];
+            tet.vertices[j] = allPoints_[face.indices[j]];
+        }
+        ComputeCircumsphere(tet, lightProbeVolume);
+        cavityStamps_[tetIndex] = 0U;
+
+        auto& adjacency = neighbors_[tetIndex];
+        adjacency = {{INVALID_TETRAHEDRON, INVALID_TETRAHEDRON, INVALID_TETRAHEDRON, INVALID_TETRAHEDRON}};
+        adjacency.neighbors[face.opposite] = face.outside;
+        if (face.outside != INVALID_TETRAHEDRON) {
+            neighbors_[face.outside].neighbors[face.outsideSlot] = tetIndex;
+        }
+        // The other faces contain the point and are shared with another new tetrahedron, match them by the
+        // remaining edge.
+        for (uint32_t slot = 0U; slot < VERTEX_COUNT; ++slot) {
+            if (slot == face.opposite) {
+                continue;
+            }
+            uint32_t edge[2U] = {};
+            uint32_t count = 0U;
+            for (uint32_t j = 0U; j < VERTEX_COUNT; ++j) {
+                if ((j != slot) && (face.indices[j] != pointIndex)) {
+                    edge[count++] = face.indices[j];
+                }
+            }
+            const uint64_t key = (static_cast<uint64_t>(std::min(edge[0U], edge[1U])) << 32U) |
+                                 std::max(edge[0U], edge[1U]);
+            if (const auto pos = pointFaces_.find(key); pos != pointFaces_.end()) {
+                const uint32_t other = pos->second / VERTEX_COUNT;
+                neighbors_[other].neighbors[pos->second % VERTEX_COUNT] = tetIndex;
+                adjacency.neighbors[slot] = other;
+                pointFaces_.erase(pos);
+            } else {
+                pointFaces_.insert({key, tetIndex * VERTEX_COUNT + slot});
+            }
+        }
+    }
+    lastTetrahedron_ = boundary_.empty() ? lastTetrahedron_ : cavity_[0U];
 
-            ComputeCircumsphere(newTet, lightProbeVolume);
-            lightProbeVolume.tetrahedrons.push_back(newTet);
+    // Release the unused cavity slots, highest first so the swapped in tetrahedron is never one of them.
+    if (cavity_.size() > boundary_.size()) {
+        std::sort(cavity_.begin() + static_cast<ptrdiff_t>(boundary_.size()), cavity_.end(), std::greater<>());
+        for (size_t i = boundary_.size(); i < cavity_.size(); ++i) {
+            RemoveTetrahedron(cavity_[i], lightProbeVolume);
         }
     }
+}
 
-    std::sort(badTetrahedra.rbegin(), badTetrahedra.rend());
-    for (uint32_t tetIndex : badTetrahedra) {
-        if (tetIndex < static_cast<uint32_t>(lightProbeVolume.tetrahedrons.size())) {
-            lightProbeVolume.tetrahedrons.erase(lightProbeVolume.tetrahedrons.begin() + tetIndex);
+void BowyerWatsonDelaunay3D::RemoveTetrahedron(uint32_t index, LightProbeVolume& lightProbeVolume)
+{
+    auto& tetrahedrons = lightProbeVolume.tetrahedrons;
+    const uint32_t last = static_cast<uint32_t>(tetrahedrons.size() - 1U);
+    if (index != last) {
+        tetrahedrons[index] = tetrahedrons[last];
+        neighbors_[index] = neighbors_[last];
+        cavityStamps_[index] = cavityStamps_[last];
+        for (const uint32_t neighbor : neighbors_[index].neighbors) {
+            if (neighbor != INVALID_TETRAHEDRON) {
+                neighbors_[neighbor].neighbors[FindSlot(neighbors_[neighbor], last)] = index;
+            }
+        }
+        if (lastTetrahedron_ == last) {
+            lastTetrahedron_ = index;
         }
     }
+    tetrahedrons.pop_back();
+    neighbors_.pop_back();
+    cavityStamps_.pop_back();
 }
 
 void BowyerWatsonDelaunay3D::ComputeCircumsphere(Tetrahedron& tet, const LightProbeVolume& lightProbeVolume)
@@ -213,11 +511,13 @@ void BowyerWatsonDelaunay3D::ComputeCircumsphere(Tetrahedron& tet, const LightPr
 
 void BowyerWatsonDelaunay3D::RemoveSuperTetrahedron(LightProbeVolume& lightProbeVolume)
 {
-    BASE_NS::vector<Tetrahedron> validTetrahedra;
-
-    for (const auto& tet : lightProbeVolume.tetrahedrons) {
+    auto& tetrahedrons = lightProbeVolume.tetrahedrons;
+    BASE_NS::vector<uint32_t> remap(tetrahedrons.size(), INVALID_TETRAHEDRON);
+    uint32_t count = 0U;
+    for (uint32_t tetIndex = 0U; tetIndex < static_cast<uint32_t>(tetrahedrons.size()); ++tetIndex) {
+        const Tetrahedron& tet = tetrahedrons[tetIndex];
         bool hasSuperVertex = false;
-        for (uint32_t i = 0U; i < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++i) {
+        for (uint32_t i = 0U; i < VERTEX_COUNT; ++i) {
             if (tet.indices[i] >= superTetrahedronStartIndex_) {
                 hasSuperVertex = true;
                 break;
@@ -225,11 +525,23 @@ void BowyerWatsonDelaunay3D::RemoveSuperTetrahedron(LightProbeVolume& lightProbe
         }
 
         if (!hasSuperVertex) {
-            validTetrahedra.push_back(tet);
+            remap[tetIndex] = count;
+            tetrahedrons[count] = tet;
+            neighbors_[count] = neighbors_[tetIndex];
+            ++count;
         }
     }
+    tetrahedrons.resize(count);
+    neighbors_.resize(count);
 
-    lightProbeVolume.tetrahedrons = validTetrahedra;
+    if (lightProbeVolume.adjacency) {
+        for (auto& adjacency : neighbors_) {
+            for (auto& neighbor : adjacency.neighbors) {
+                neighbor = (neighbor != INVALID_TETRAHEDRON) ? remap[neighbor] : INVALID_TETRAHEDRON;
+            }
+        }
+        *lightProbeVolume.adjacency = neighbors_;
+    }
 }
 
 CORE3D_END_NAMESPACE()
@@ -18,21 +18,31 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <functional>
 
 #include <3d/light_probe_types/light_probe.h>
 #include <3d/light_probe_types/light_probe_constants.h>
+#include <base/containers/unordered_map.h>
 #include <base/containers/vector.h>
 #include <base/math/vector.h>
 #include <core/namespace.h>
 
 CORE3D_BEGIN_NAMESPACE()
 
+// Face neighbors of a tetrahedron. neighbors[i] shares the face opposite of vertex i.
+struct TetrahedronAdjacency {
+    static constexpr uint32_t INVALID_NEIGHBOR = ~0U;
+    uint32_t neighbors[LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT];
+};
+
 class BowyerWatsonDelaunay3D {
 public:
     struct LightProbeVolume {
         BASE_NS::array_view<const LightProbeGroupComponent::LightProbe> lightProbes;
         BASE_NS::vector<Tetrahedron>& tetrahedrons;
+        // Optional, filled with the neighbors of each tetrahedron when given.
+        BASE_NS::vector<TetrahedronAdjacency>* adjacency = nullptr;
     };
     BowyerWatsonDelaunay3D() = default;
     ~BowyerWatsonDelaunay3D() = default;
@@ -40,20 +50,45 @@ public:
     void BuildTetrahedralMesh(LightProbeVolume& lightProbeVolume);
 
 private:
-    struct FaceData {
-        uint32_t indices[3];
-        BASE_NS::Math::Vec3 vertices[3];
+    // Face of the cavity boundary, the new tetrahedron is the cavity tetrahedron with the opposite vertex replaced
+    // by the inserted point.
+    struct BoundaryFace {
+        uint32_t indices[LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT];
+        uint32_t opposite;
+        // Tetrahedron outside of the cavity and its neighbor slot pointing to the cavity.
+        uint32_t outside;
+        uint32_t outsideSlot;
     };
 
     void CreateSuperTetrahedron(LightProbeVolume& lightProbeVolume);
+    void SortInsertionOrder(uint32_t pointCount, BASE_NS::vector<uint32_t>& order) const;
 
-    void InsertPoint(uint32_t pointIndex, LightProbeVolume& lightProbeVolume);
+    bool InsertPoint(uint32_t pointIndex, LightProbeVolume& lightProbeVolume);
+    uint32_t LocatePoint(const BASE_NS::Math::Vec3& point, const LightProbeVolume& lightProbeVolume) const;
+    void GrowCavity(uint32_t seed, const BASE_NS::Math::Vec3& point, const LightProbeVolume& lightProbeVolume);
+    uint32_t FindInvalidCavityTetrahedron(
+        uint32_t pointIndex, uint32_t seed, const LightProbeVolume& lightProbeVolume);
+    void FillCavity(uint32_t pointIndex, LightProbeVolume& lightProbeVolume);
+    void RemoveTetrahedron(uint32_t index, LightProbeVolume& lightProbeVolume);
 
     void ComputeCircumsphere(Tetrahedron& tet, const LightProbeVolume& lightProbeVolume);
     void RemoveSuperTetrahedron(LightProbeVolume& lightProbeVolume);
 
     uint32_t superTetrahedronStartIndex_ = 0;
     BASE_NS::vector<BASE_NS::Math::Vec3> allPoints_;
+
+    // Build time helpers, parallel to the tetrahedrons.
+    BASE_NS::vector<TetrahedronAdjacency> neighbors_;
+    BASE_NS::vector<uint32_t> cavityStamps_;
+    // Parallel to allPoints_.
+    BASE_NS::vector<uint32_t> vertexStamps_;
+    uint32_t cavityStamp_ = 0U;
+    uint32_t vertexStamp_ = 0U;
+    uint32_t lastTetrahedron_ = 0U;
+    BASE_NS::vector<uint32_t> cavity_;
+    BASE_NS::vector<BoundaryFace> boundary_;
+    // Faces of the new tetrahedrons around the inserted point keyed by their other two vertices.
+    BASE_NS::unordered_map<uint64_t, uint32_t> pointFaces_;
 };
 
 CORE3D_END_NAMESPACE()
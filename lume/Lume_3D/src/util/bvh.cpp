@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bvh.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include <base/math/vector_util.h>
+
+CORE3D_BEGIN_NAMESPACE()
+using namespace BASE_NS;
+
+namespace {
+constexpr uint32_t BIN_COUNT = 16U;
+// Ranges up to this size can become leaves when splitting them doesn't lower the SAH cost.
+constexpr uint32_t MAX_SAH_LEAF_SIZE = 8U;
+constexpr uint32_t INVALID_NODE = ~0U;
+
+struct Bin {
+    Bvh::Aabb bounds;
+    uint32_t count;
+};
+
+constexpr Bvh::Aabb EmptyAabb()
+{
+    constexpr float fmax = std::numeric_limits<float>::max();
+    return {{fmax, fmax, fmax}, {-fmax, -fmax, -fmax}};
+}
+
+inline void Grow(Bvh::Aabb& aabb, const Math::Vec3& min, const Math::Vec3& max)
+{
+    aabb.min = Math::min(aabb.min, min);
+    aabb.max = Math::max(aabb.max, max);
+}
+
+inline float HalfArea(const Bvh::Aabb& aabb)
+{
+    const Math::Vec3 d = aabb.max - aabb.min;
+    return (d.x * d.y) + (d.y * d.z) + (d.z * d.x);
+}
+
+inline uint32_t LargestAxis(const Math::Vec3& extent)
+{
+    if ((extent.x >= extent.y) && (extent.x >= extent.z)) {
+        return 0U;
+    }
+    return (extent.y >= extent.z) ? 1U : 2U;
+}
+}  // namespace
+
+void Bvh::Clear()
+{
+    nodes_.clear();
+    primitives_.clear();
+    firstPrimitive_.clear();
+    lastPrimitive_.clear();
+}
+
+void Bvh::Build(array_view<const Aabb> bounds)
+{
+    Clear();
+    const auto primitiveCount = static_cast<uint32_t>(bounds.size());
+    if (!primitiveCount) {
+        return;
+    }
+    primitives_.resize(primitiveCount);
+    std::iota(primitives_.begin(), primitives_.end(), 0U);
+    centroids_.resize(primitiveCount);
+    for (uint32_t i = 0U; i < primitiveCount; ++i) {
+        centroids_[i] = (bounds[i].min + bounds[i].max) * 0.5f;
+    }
+    const size_t maxNodes = 2U * primitiveCount;
+    nodes_.reserve(maxNodes);
+    firstPrimitive_.reserve(maxNodes);
+    lastPrimitive_.reserve(maxNodes);
+
+    struct Range {
+        uint32_t begin;
+        uint32_t end;
+        // Set for right children, left children are always right after the parent.
+        uint32_t parent;
+        uint32_t depth;
+    };
+    vector<Range> ranges;
+    ranges.push_back({0U, primitiveCount, INVALID_NODE, 0U});
+    Bin bins[BIN_COUNT];
+    float rightAreas[BIN_COUNT];
+    while (!ranges.empty()) {
+        const Range range = ranges.back();
+        ranges.pop_back();
+
+        const auto nodeIndex = static_cast<uint32_t>(nodes_.size());
+        if (range.parent != INVALID_NODE) {
+            nodes_[range.parent].offset = nodeIndex;
+        }
+        Aabb nodeBounds = EmptyAabb();
+        Aabb centroidBounds = EmptyAabb();
+        for (uint32_t i = range.begin; i < range.end; ++i) {
+            const uint32_t primitive = primitives_[i];
+            Grow(nodeBounds, bounds[primitive].min, bounds[primitive].max);
+            Grow(centroidBounds, centroids_[primitive], centroids_[primitive]);
+        }
+        Node& node = nodes_.emplace_back(Node{nodeBounds.min, range.begin, nodeBounds.max, range.end - range.begin});
+        firstPrimitive_.push_back(range.begin);
+        lastPrimitive_.push_back(range.end);
+
+        const uint32_t count = range.end - range.begin;
+        if (count <= MAX_LEAF_SIZE) {
+            continue;
+        }
+        const Math::Vec3 extent = centroidBounds.max - centroidBounds.min;
+        const uint32_t axis = LargestAxis(extent);
+        uint32_t* const first = primitives_.data() + range.begin;
+        uint32_t* const last = primitives_.data() + range.end;
+        uint32_t* mid = nullptr;
+        if ((extent[axis] > 0.0f) && (range.depth < MEDIAN_SPLIT_DEPTH)) {
+            // Binned SAH.
+            const float binScale = static_cast<float>(BIN_COUNT) / extent[axis];
+            const float binMin = centroidBounds.min[axis];
+            auto binIndex = [&](uint32_t primitive) {
+                const auto bin = static_cast<uint32_t>((centroids_[primitive][axis] - binMin) * binScale);
+                return Math::min(bin, BIN_COUNT - 1U);
+            };
+            for (auto& bin : bins) {
+                bin = {EmptyAabb(), 0U};
+            }
+            for (const uint32_t* it = first; it != last; ++it) {
+                auto& bin = bins[binIndex(*it)];
+                Grow(bin.bounds, bounds[*it].min, bounds[*it].max);
+                ++bin.count;
+            }
+            Aabb rightBounds = EmptyAabb();
+            for (uint32_t i = BIN_COUNT - 1U; i > 0U; --i) {
+                Grow(rightBounds, bins[i].bounds.min, bins[i].bounds.max);
+                rightAreas[i] = HalfArea(rightBounds);
+            }
+            Aabb leftBounds = EmptyAabb();
+            uint32_t leftCount = 0U;
+            float bestCost = std::numeric_limits<float>::max();
+            uint32_t bestSplit = 0U;
+            for (uint32_t i = 1U; i < BIN_COUNT; ++i) {
+                Grow(leftBounds, bins[i - 1U].bounds.min, bins[i - 1U].bounds.max);
+                leftCount += bins[i - 1U].count;
+                const uint32_t rightCount = count - leftCount;
+                if (!leftCount || !rightCount) {
+                    continue;
+                }
+                const float cost = (HalfArea(leftBounds) * static_cast<float>(leftCount)) +
+                                   (rightAreas[i] * static_cast<float>(rightCount));
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestSplit = i;
+                }
+            }
+            if ((count <= MAX_SAH_LEAF_SIZE) && (bestCost >= (HalfArea(nodeBounds) * static_cast<float>(count)))) {
+                continue;
+            }
+            if (bestSplit) {
+                mid = std::partition(first, last, [&](uint32_t primitive) { return binIndex(primitive) < bestSplit; });
+            }
+        }
+        if (!mid || (mid == first) || (mid == last)) {
+            // Degenerate split, halve by centroid order instead.
+            mid = first + (count / 2U);
+            std::nth_element(first, mid, last, [&](uint32_t lhs, uint32_t rhs) {
+                return centroids_[lhs][axis] < centroids_[rhs][axis];
+            });
+        }
+
+        // Turn the leaf into an inner node, offset is patched when the right child is created.
+        node.count = 0U;
+        const auto split = static_cast<uint32_t>(mid - primitives_.data());
+        ranges.push_back({split, range.end, nodeIndex, range.depth + 1U});
+        ranges.push_back({range.begin, split, INVALID_NODE, range.depth + 1U});
+    }
+    centroids_.clear();
+}
+CORE3D_END_NAMESPACE()
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_UTIL_BVH_H
+#define CORE_UTIL_BVH_H
+
+#include <cstdint>
+
+#include <3d/namespace.h>
+#include <base/containers/array_view.h>
+#include <base/containers/pair.h>
+#include <base/containers/vector.h>
+#include <base/math/vector.h>
+
+CORE3D_BEGIN_NAMESPACE()
+/** Bounding volume hierarchy of axis aligned boxes built with binned SAH.
+ * Nodes are stored depth first. The left child of an inner node is the next node and the right child is at
+ * Node::offset.
+ */
+class Bvh {
+public:
+    struct Aabb {
+        BASE_NS::Math::Vec3 min;
+        BASE_NS::Math::Vec3 max;
+    };
+
+    struct Node {
+        BASE_NS::Math::Vec3 min;
+        // For leaves index of the first primitive in GetPrimitives(), for inner nodes index of the right child.
+        uint32_t offset;
+        BASE_NS::Math::Vec3 max;
+        // For leaves number of primitives, zero for inner nodes.
+        uint32_t count;
+    };
+
+    /** Result of testing a node against a query volume. */
+    enum class Containment : uint8_t {
+        /** Node and all its primitives are outside. */
+        OUTSIDE,
+        /** Node is partially inside, the children are tested. */
+        INTERSECTS,
+        /** Node and all its primitives are inside. */
+        INSIDE,
+    };
+
+    static constexpr uint32_t MAX_LEAF_SIZE = 4U;
+    // Building switches to median splits after MEDIAN_SPLIT_DEPTH so the depth stays below this.
+    static constexpr uint32_t MAX_DEPTH = 80U;
+
+    /** Rebuilds the hierarchy. Primitive indices used in queries are indices to the given bounds. */
+    void Build(BASE_NS::array_view<const Aabb> bounds);
+    void Clear();
+
+    bool Empty() const
+    {
+        return nodes_.empty();
+    }
+
+    BASE_NS::array_view<const Node> GetNodes() const
+    {
+        return nodes_;
+    }
+
+    BASE_NS::array_view<const uint32_t> GetPrimitives() const
+    {
+        return primitives_;
+    }
+
+    /** Visits the primitives of the nodes which aren't classified as outside.
+     * @param classify Called as classify(const Node&) and returns Containment.
+     * @param visit Called as visit(uint32_t primitive, bool inside). Inside is true when the primitive's node was
+     * classified inside, otherwise the primitive itself still needs to be tested.
+     */
+    template <typename Classify, typename Visit>
+    void Traverse(Classify&& classify, Visit&& visit) const
+    {
+        if (nodes_.empty()) {
+            return;
+        }
+        uint32_t stack[MAX_DEPTH];
+        uint32_t stackSize = 0U;
+        stack[stackSize++] = 0U;
+        while (stackSize) {
+            const uint32_t nodeIndex = stack[--stackSize];
+            const Node& node = nodes_[nodeIndex];
+            const Containment containment = classify(node);
+            if (containment == Containment::OUTSIDE) {
+                continue;
+            }
+            if (containment == Containment::INSIDE) {
+                // Everything in the subtree is a contiguous range of primitives.
+                const auto range = GetPrimitiveRange(nodeIndex);
+                for (uint32_t i = range.first; i < range.second; ++i) {
+                    visit(primitives_[i], true);
+                }
+            } else if (node.count) {
+                for (uint32_t i = node.offset; i < (node.offset + node.count); ++i) {
+                    visit(primitives_[i], false);
+                }
+            } else {
+                stack[stackSize++] = node.offset;
+                stack[stackSize++] = nodeIndex + 1U;
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t MEDIAN_SPLIT_DEPTH = 40U;
+
+    // Range of primitives covered by the subtree of the given node.
+    BASE_NS::pair<uint32_t, uint32_t> GetPrimitiveRange(uint32_t nodeIndex) const
+    {
+        return {firstPrimitive_[nodeIndex], lastPrimitive_[nodeIndex]};
+    }
+
+    BASE_NS::vector<Node> nodes_;
+    BASE_NS::vector<uint32_t> primitives_;
+    // Primitive ranges of each subtree, kept separate as they are only needed for fully inside nodes.
+    BASE_NS::vector<uint32_t> firstPrimitive_;
+    BASE_NS::vector<uint32_t> lastPrimitive_;
+    // Build time helpers.
+    BASE_NS::vector<BASE_NS::Math::Vec3> centroids_;
+};
+CORE3D_END_NAMESPACE()
+
+#endif  // CORE_UTIL_BVH_H
@@ -0,0 +1,552 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/keyframe_sampler.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define KEYFRAME_SAMPLER_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define KEYFRAME_SAMPLER_NEON
+#endif
+
+#include <algorithm>
+
+#include <base/math/mathf.h>
+#include <base/math/quaternion.h>
+#include <base/math/quaternion_util.h>
+
+CORE3D_BEGIN_NAMESPACE()
+using namespace BASE_NS;
+
+namespace {
+// How many keyframes the cursor is moved before using a binary search.
+constexpr size_t CURSOR_STEPS = 4U;
+
+constexpr size_t QUAT_SIZE = 4U;
+
+inline size_t GroupIndex(KeyframeSampler::ValueType type, KeyframeSampler::Mode mode)
+{
+    return static_cast<size_t>(type) * static_cast<size_t>(KeyframeSampler::Mode::COUNT) + static_cast<size_t>(mode);
+}
+
+// Relative value of N component vectors. Operations are in the same order as with the Math vector types so the
+// results match the per track evaluation.
+template <size_t N>
+void EvaluateStep(array_view<const KeyframeSample> samples)
+{
+    for (const auto& sample : samples) {
+        const float* value = (sample.t > 0.5f) ? sample.end : sample.start;
+        for (size_t i = 0U; i < N; ++i) {
+            sample.result[i] = (value[i] - sample.initial[i]) * sample.weight;
+        }
+    }
+}
+
+template <size_t N>
+void EvaluateLinear(array_view<const KeyframeSample> samples)
+{
+    for (const auto& sample : samples) {
+        const float t = Math::clamp01(sample.t);
+        for (size_t i = 0U; i < N; ++i) {
+            const float value = sample.start[i] + (sample.end[i] - sample.start[i]) * t;
+            sample.result[i] = (value - sample.initial[i]) * sample.weight;
+        }
+    }
+}
+
+struct HermiteFactors {
+    float f1;
+    float f2;
+    float f3;
+    float f4;
+};
+
+inline HermiteFactors GetHermiteFactors(const float s)
+{
+    // Same as Math::Hermite.
+    const float s2 = s * s;
+    const float s3 = s2 * s;
+    const float s23 = 2.f * s3;
+    const float s32 = 3.f * s2;
+    return {s23 - s32 + 1.f, -s23 + s32, s3 - 2.f * s2 + s, s3 - s2};
+}
+
+template <size_t N>
+void EvaluateSpline(array_view<const KeyframeSample> samples)
+{
+    for (const auto& sample : samples) {
+        const HermiteFactors f = GetHermiteFactors(sample.t);
+        const float* v1 = sample.start + N;
+        const float* t1 = sample.start + N * 2U;
+        const float* v2 = sample.end + N;
+        const float* t2 = sample.end;
+        for (size_t i = 0U; i < N; ++i) {
+            const float value = v1[i] * f.f1 + v2[i] * f.f2 + t1[i] * f.f3 + t2[i] * f.f4;
+            sample.result[i] = (value - sample.initial[i]) * sample.weight;
+        }
+    }
+}
+
+inline const Math::Quat& AsQuat(const float* value)
+{
+    return *static_cast<const Math::Quat*>(static_cast<const void*>(value));
+}
+
+inline Math::Quat StepQuat(const KeyframeSample& sample)
+{
+    return AsQuat((sample.t > 0.5f) ? sample.end : sample.start);
+}
+
+inline Math::Quat SplineQuat(const KeyframeSample& sample)
+{
+    const HermiteFactors f = GetHermiteFactors(sample.t);
+    const Math::Quat& v1 = AsQuat(sample.start + QUAT_SIZE);
+    const Math::Quat& t1 = AsQuat(sample.start + QUAT_SIZE * 2U);
+    const Math::Quat& v2 = AsQuat(sample.end + QUAT_SIZE);
+    const Math::Quat& t2 = AsQuat(sample.end);
+    return Math::Normalize(Math::Quat(v1.x * f.f1 + v2.x * f.f2 + t1.x * f.f3 + t2.x * f.f4,
+        v1.y * f.f1 + v2.y * f.f2 + t1.y * f.f3 + t2.y * f.f4, v1.z * f.f1 + v2.z * f.f2 + t1.z * f.f3 + t2.z * f.f4,
+        v1.w * f.f1 + v2.w * f.f2 + t1.w * f.f3 + t2.w * f.f4));
+}
+
+#if defined(KEYFRAME_SAMPLER_SSE2) || defined(KEYFRAME_SAMPLER_NEON)
+// Four quaternions evaluated at once with the components in separate registers. The lane functions mirror
+// Math::Slerp, Math::Inverse and Math::Normalize operation by operation, without fused multiply-adds, so that the
+// results match the scalar functions.
+constexpr size_t LANE_COUNT = 4U;
+
+#if defined(KEYFRAME_SAMPLER_SSE2)
+using Lane = __m128;
+using LaneMask = __m128;
+
+inline Lane Splat(float value)
+{
+    return _mm_set1_ps(value);
+}
+inline Lane Load(const float* values)
+{
+    return _mm_loadu_ps(values);
+}
+inline void Store(float* values, Lane lane)
+{
+    _mm_storeu_ps(values, lane);
+}
+inline Lane Add(Lane lhs, Lane rhs)
+{
+    return _mm_add_ps(lhs, rhs);
+}
+inline Lane Sub(Lane lhs, Lane rhs)
+{
+    return _mm_sub_ps(lhs, rhs);
+}
+inline Lane Mul(Lane lhs, Lane rhs)
+{
+    return _mm_mul_ps(lhs, rhs);
+}
+inline Lane Div(Lane lhs, Lane rhs)
+{
+    return _mm_div_ps(lhs, rhs);
+}
+inline Lane Negate(Lane lane)
+{
+    return _mm_xor_ps(lane, _mm_set1_ps(-0.0f));
+}
+inline Lane Sqrt(Lane lane)
+{
+    return _mm_sqrt_ps(lane);
+}
+inline Lane Clamp01(Lane lane)
+{
+    return _mm_min_ps(_mm_max_ps(lane, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+}
+inline LaneMask Less(Lane lhs, Lane rhs)
+{
+    return _mm_cmplt_ps(lhs, rhs);
+}
+inline LaneMask LessEqual(Lane lhs, Lane rhs)
+{
+    return _mm_cmple_ps(lhs, rhs);
+}
+inline LaneMask NotEqual(Lane lhs, Lane rhs)
+{
+    return _mm_cmpneq_ps(lhs, rhs);
+}
+inline Lane Select(LaneMask mask, Lane ifTrue, Lane ifFalse)
+{
+    return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+#else
+using Lane = float32x4_t;
+using LaneMask = uint32x4_t;
+
+inline Lane Splat(float value)
+{
+    return vdupq_n_f32(value);
+}
+inline Lane Load(const float* values)
+{
+    return vld1q_f32(values);
+}
+inline void Store(float* values, Lane lane)
+{
+    vst1q_f32(values, lane);
+}
+inline Lane Add(Lane lhs, Lane rhs)
+{
+    return vaddq_f32(lhs, rhs);
+}
+inline Lane Sub(Lane lhs, Lane rhs)
+{
+    return vsubq_f32(lhs, rhs);
+}
+inline Lane Mul(Lane lhs, Lane rhs)
+{
+    return vmulq_f32(lhs, rhs);
+}
+inline Lane Div(Lane lhs, Lane rhs)
+{
+    return vdivq_f32(lhs, rhs);
+}
+inline Lane Negate(Lane lane)
+{
+    return vnegq_f32(lane);
+}
+inline Lane Sqrt(Lane lane)
+{
+    return vsqrtq_f32(lane);
+}
+inline Lane Clamp01(Lane lane)
+{
+    return vminq_f32(vmaxq_f32(lane, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+}
+inline LaneMask Less(Lane lhs, Lane rhs)
+{
+    return vcltq_f32(lhs, rhs);
+}
+inline LaneMask LessEqual(Lane lhs, Lane rhs)
+{
+    return vcleq_f32(lhs, rhs);
+}
+inline LaneMask NotEqual(Lane lhs, Lane rhs)
+{
+    return vmvnq_u32(vceqq_f32(lhs, rhs));
+}
+inline Lane Select(LaneMask mask, Lane ifTrue, Lane ifFalse)
+{
+    return vbslq_f32(mask, ifTrue, ifFalse);
+}
+#endif
+
+struct QuatLanes {
+    Lane x;
+    Lane y;
+    Lane z;
+    Lane w;
+};
+
+// Transposes up to four quaternions to lanes, missing lanes are identity.
+QuatLanes LoadQuats(const Math::Quat* quats, size_t count)
+{
+    alignas(16) float values[QUAT_SIZE][LANE_COUNT]{};
+    for (size_t lane = 0U; lane < LANE_COUNT; ++lane) {
+        const Math::Quat quat = (lane < count) ? quats[lane] : Math::Quat(0.0f, 0.0f, 0.0f, 1.0f);
+        values[0U][lane] = quat.x;
+        values[1U][lane] = quat.y;
+        values[2U][lane] = quat.z;
+        values[3U][lane] = quat.w;
+    }
+    return {Load(values[0U]), Load(values[1U]), Load(values[2U]), Load(values[3U])};
+}
+
+inline QuatLanes Select(LaneMask mask, const QuatLanes& ifTrue, const QuatLanes& ifFalse)
+{
+    return {Select(mask, ifTrue.x, ifFalse.x), Select(mask, ifTrue.y, ifFalse.y), Select(mask, ifTrue.z, ifFalse.z),
+        Select(mask, ifTrue.w, ifFalse.w)};
+}
+
+inline Lane Dot(const QuatLanes& lhs, const QuatLanes& rhs)
+{
+    return Add(Add(Add(Mul(lhs.x, rhs.x), Mul(lhs.y, rhs.y)), Mul(lhs.z, rhs.z)), Mul(lhs.w, rhs.w));
+}
+
+// a * x + b * y per component.
+inline QuatLanes Combine(Lane a, const QuatLanes& x, Lane b, const QuatLanes& y)
+{
+    return {Add(Mul(a, x.x), Mul(b, y.x)), Add(Mul(a, x.y), Mul(b, y.y)), Add(Mul(a, x.z), Mul(b, y.z)),
+        Add(Mul(a, x.w), Mul(b, y.w))};
+}
+
+QuatLanes Slerp(const QuatLanes& x, const QuatLanes& y, const Lane a)
+{
+    Lane cosTheta = Dot(x, y);
+    const LaneMask flip = Less(cosTheta, Splat(0.0f));
+    const QuatLanes z{Select(flip, Negate(y.x), y.x), Select(flip, Negate(y.y), y.y), Select(flip, Negate(y.z), y.z),
+        Select(flip, Negate(y.w), y.w)};
+    cosTheta = Select(flip, Negate(cosTheta), cosTheta);
+
+    const Lane clamped = Clamp01(a);
+    const QuatLanes linear{Add(x.x, Mul(Sub(z.x, x.x), clamped)), Add(x.y, Mul(Sub(z.y, x.y), clamped)),
+        Add(x.z, Mul(Sub(z.z, x.z), clamped)), Add(x.w, Mul(Sub(z.w, x.w), clamped))};
+
+    // Chebyshev approximation of Math::Slerp.
+    constexpr float mu = 1.85298109240830f;
+    constexpr float u[8] = {1.f / (1 * 3), 1.f / (2 * 5), 1.f / (3 * 7), 1.f / (4 * 9), 1.f / (5 * 11),
+        1.f / (6 * 13), 1.f / (7 * 15), mu / (8 * 17)};
+    constexpr float v[8] = {1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, mu * 8.f / 17};
+
+    const Lane one = Splat(1.0f);
+    const Lane xm1 = Sub(cosTheta, one);
+    const Lane d = Sub(one, a);
+    const Lane sqrA = Mul(a, a);
+    const Lane sqrD = Mul(d, d);
+    Lane productA = one;
+    Lane productD = one;
+    for (int i = 7; i >= 0; --i) {
+        const Lane bA = Mul(Sub(Mul(Splat(u[i]), sqrA), Splat(v[i])), xm1);
+        const Lane bD = Mul(Sub(Mul(Splat(u[i]), sqrD), Splat(v[i])), xm1);
+        productA = Add(one, Mul(bA, productA));
+        productD = Add(one, Mul(bD, productD));
+    }
+    const QuatLanes spherical = Combine(Mul(d, productD), x, Mul(a, productA), z);
+    return Select(Less(Sub(one, Splat(Math::EPSILON)), cosTheta), linear, spherical);
+}
+
+QuatLanes Inverse(const QuatLanes& rotation)
+{
+    const Lane lengthSq = Dot(rotation, rotation);
+    const Lane inverse = Div(Splat(1.0f), lengthSq);
+    const Lane negInverse = Negate(inverse);
+    return Select(NotEqual(lengthSq, Splat(0.0f)),
+        QuatLanes{Mul(rotation.x, negInverse), Mul(rotation.y, negInverse), Mul(rotation.z, negInverse),
+            Mul(rotation.w, inverse)},
+        rotation);
+}
+
+QuatLanes Multiply(const QuatLanes& lhs, const QuatLanes& rhs)
+{
+    return {Sub(Add(Add(Mul(lhs.w, rhs.x), Mul(lhs.x, rhs.w)), Mul(lhs.y, rhs.z)), Mul(lhs.z, rhs.y)),
+        Sub(Add(Add(Mul(lhs.w, rhs.y), Mul(lhs.y, rhs.w)), Mul(lhs.z, rhs.x)), Mul(lhs.x, rhs.z)),
+        Sub(Add(Add(Mul(lhs.w, rhs.z), Mul(lhs.z, rhs.w)), Mul(lhs.x, rhs.y)), Mul(lhs.y, rhs.x)),
+        Sub(Sub(Sub(Mul(lhs.w, rhs.w), Mul(lhs.x, rhs.x)), Mul(lhs.y, rhs.y)), Mul(lhs.z, rhs.z))};
+}
+
+QuatLanes Normalize(const QuatLanes& q)
+{
+    const Lane len = Sqrt(Dot(q, q));
+    const Lane oneOverLen = Div(Splat(1.0f), len);
+    const QuatLanes identity{Splat(0.0f), Splat(0.0f), Splat(0.0f), Splat(1.0f)};
+    return Select(LessEqual(len, Splat(0.0f)), identity,
+        QuatLanes{Mul(q.x, oneOverLen), Mul(q.y, oneOverLen), Mul(q.z, oneOverLen), Mul(q.w, oneOverLen)});
+}
+
+// Writes the relative rotations of up to four samples, see RelativeQuat.
+void StoreRelativeQuats(const KeyframeSample* samples, size_t count, const QuatLanes& values)
+{
+    Math::Quat initial[LANE_COUNT];
+    alignas(16) float weights[LANE_COUNT]{};
+    for (size_t lane = 0U; lane < count; ++lane) {
+        initial[lane] = AsQuat(samples[lane].initial);
+        weights[lane] = samples[lane].weight;
+    }
+    const QuatLanes identity{Splat(0.0f), Splat(0.0f), Splat(0.0f), Splat(1.0f)};
+    const QuatLanes delta =
+        Normalize(Slerp(identity, Multiply(values, Inverse(LoadQuats(initial, count))), Load(weights)));
+
+    alignas(16) float results[QUAT_SIZE][LANE_COUNT];
+    Store(results[0U], delta.x);
+    Store(results[1U], delta.y);
+    Store(results[2U], delta.z);
+    Store(results[3U], delta.w);
+    for (size_t lane = 0U; lane < count; ++lane) {
+        float* dst = samples[lane].result;
+        dst[0U] = results[0U][lane];
+        dst[1U] = results[1U][lane];
+        dst[2U] = results[2U][lane];
+        dst[3U] = results[3U][lane];
+    }
+}
+
+template <typename Sample>
+void EvaluateQuats(array_view<const KeyframeSample> samples, Sample&& sample)
+{
+    for (size_t i = 0U; i < samples.size(); i += LANE_COUNT) {
+        const size_t count = std::min(LANE_COUNT, samples.size() - i);
+        Math::Quat values[LANE_COUNT];
+        for (size_t lane = 0U; lane < count; ++lane) {
+            values[lane] = sample(samples[i + lane]);
+        }
+        StoreRelativeQuats(samples.data() + i, count, LoadQuats(values, count));
+    }
+}
+
+void EvaluateQuatLinear(array_view<const KeyframeSample> samples)
+{
+    for (size_t i = 0U; i < samples.size(); i += LANE_COUNT) {
+        const size_t count = std::min(LANE_COUNT, samples.size() - i);
+        Math::Quat start[LANE_COUNT];
+        Math::Quat end[LANE_COUNT];
+        alignas(16) float t[LANE_COUNT]{};
+        for (size_t lane = 0U; lane < count; ++lane) {
+            const auto& sample = samples[i + lane];
+            start[lane] = AsQuat(sample.start);
+            end[lane] = AsQuat(sample.end);
+            t[lane] = sample.t;
+        }
+        StoreRelativeQuats(
+            samples.data() + i, count, Slerp(LoadQuats(start, count), LoadQuats(end, count), Load(t)));
+    }
+}
+#else
+inline void StoreQuat(float* dst, const Math::Quat& value)
+{
+    dst[0U] = value.x;
+    dst[1U] = value.y;
+    dst[2U] = value.z;
+    dst[3U] = value.w;
+}
+
+// Rotation from the initial rotation to value, scaled by weight.
+inline Math::Quat RelativeQuat(const Math::Quat& value, const KeyframeSample& sample)
+{
+    static constexpr Math::Quat identity(0.0f, 0.0f, 0.0f, 1.0f);
+    const Math::Quat inverseInitialRotation = Math::Inverse(AsQuat(sample.initial));
+    return Math::Normalize(Math::Slerp(identity, value * inverseInitialRotation, sample.weight));
+}
+
+template <typename Sample>
+void EvaluateQuats(array_view<const KeyframeSample> samples, Sample&& sample)
+{
+    for (const auto& s : samples) {
+        StoreQuat(s.result, RelativeQuat(sample(s), s));
+    }
+}
+
+void EvaluateQuatLinear(array_view<const KeyframeSample> samples)
+{
+    for (const auto& sample : samples) {
+        StoreQuat(sample.result, RelativeQuat(Math::Slerp(AsQuat(sample.start), AsQuat(sample.end), sample.t), sample));
+    }
+}
+#endif
+
+template <size_t N>
+void EvaluateGroup(KeyframeSampler::Mode mode, array_view<const KeyframeSample> samples)
+{
+    switch (mode) {
+        case KeyframeSampler::Mode::STEP:
+            EvaluateStep<N>(samples);
+            break;
+        case KeyframeSampler::Mode::LINEAR:
+            EvaluateLinear<N>(samples);
+            break;
+        case KeyframeSampler::Mode::SPLINE:
+            EvaluateSpline<N>(samples);
+            break;
+        default:
+            break;
+    }
+}
+
+void EvaluateQuat(KeyframeSampler::Mode mode, array_view<const KeyframeSample> samples)
+{
+    switch (mode) {
+        case KeyframeSampler::Mode::STEP:
+            EvaluateQuats(samples, StepQuat);
+            break;
+        case KeyframeSampler::Mode::LINEAR:
+            EvaluateQuatLinear(samples);
+            break;
+        case KeyframeSampler::Mode::SPLINE:
+            EvaluateQuats(samples, SplineQuat);
+            break;
+        default:
+            break;
+    }
+}
+}  // namespace
+
+size_t FindKeyframe(array_view<const float> timestamps, float time, size_t cursor)
+{
+    const size_t count = timestamps.size();
+    cursor = std::min(cursor, count);
+    // Move forward while the keyframe at the cursor is not after time, and backward while the previous one is.
+    for (size_t step = 0U; step < CURSOR_STEPS; ++step) {
+        if ((cursor < count) && !(time < timestamps[cursor])) {
+            ++cursor;
+        } else if ((cursor > 0U) && (time < timestamps[cursor - 1U])) {
+            --cursor;
+        } else {
+            return cursor;
+        }
+    }
+    if (((cursor == count) || (time < timestamps[cursor])) && ((cursor == 0U) || !(time < timestamps[cursor - 1U]))) {
+        return cursor;
+    }
+    return static_cast<size_t>(std::upper_bound(timestamps.begin(), timestamps.end(), time) - timestamps.begin());
+}
+
+void KeyframeSampler::Add(ValueType type, Mode mode, const KeyframeSample& sample)
+{
+    groups_[GroupIndex(type, mode)].push_back(sample);
+}
+
+float* KeyframeSampler::Allocate(size_t count)
+{
+    if (count > CHUNK_SIZE) {
+        return nullptr;
+    }
+    if ((chunk_ < chunks_.size()) && ((chunkUsed_ + count) > CHUNK_SIZE)) {
+        ++chunk_;
+        chunkUsed_ = 0U;
+    }
+    if (chunk_ == chunks_.size()) {
+        chunks_.emplace_back(CHUNK_SIZE);
+    }
+    float* values = chunks_[chunk_].data() + chunkUsed_;
+    chunkUsed_ += count;
+    return values;
+}
+
+void KeyframeSampler::Evaluate()
+{
+    for (size_t modeIndex = 0U; modeIndex < static_cast<size_t>(Mode::COUNT); ++modeIndex) {
+        const auto mode = static_cast<Mode>(modeIndex);
+        auto& floats = groups_[GroupIndex(ValueType::FLOAT, mode)];
+        EvaluateGroup<1U>(mode, floats);
+        floats.clear();
+        auto& vec2s = groups_[GroupIndex(ValueType::VEC2, mode)];
+        EvaluateGroup<2U>(mode, vec2s);
+        vec2s.clear();
+        auto& vec3s = groups_[GroupIndex(ValueType::VEC3, mode)];
+        EvaluateGroup<3U>(mode, vec3s);
+        vec3s.clear();
+        auto& vec4s = groups_[GroupIndex(ValueType::VEC4, mode)];
+        EvaluateGroup<4U>(mode, vec4s);
+        vec4s.clear();
+        auto& quats = groups_[GroupIndex(ValueType::QUAT, mode)];
+        EvaluateQuat(mode, quats);
+        quats.clear();
+    }
+    chunk_ = 0U;
+    chunkUsed_ = 0U;
+}
+
+bool KeyframeSampler::Empty() const
+{
+    return std::all_of(std::begin(groups_), std::end(groups_), [](const auto& group) { return group.empty(); });
+}
+CORE3D_END_NAMESPACE()
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_UTIL_KEYFRAME_SAMPLER_H
+#define CORE_UTIL_KEYFRAME_SAMPLER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <3d/namespace.h>
+#include <base/containers/array_view.h>
+#include <base/containers/vector.h>
+
+CORE3D_BEGIN_NAMESPACE()
+/** Index of the first timestamp greater than time, the same as std::upper_bound. The search starts from cursor,
+ * the result of the previous search of the same track, and steps over a few keyframes before falling back to a
+ * binary search. Playback is usually monotonic so the cursor is either still valid or one keyframe off.
+ */
+size_t FindKeyframe(BASE_NS::array_view<const float> timestamps, float time, size_t cursor);
+
+/** Keyframes selected for one track. For linear and step interpolation start and end point to the keyframe
+ * values, for splines to the in-tangent of the keyframe, followed by the spline vertex and the out-tangent.
+ * The result is relative to initial and scaled by weight, as the animation system sums the results of all the tracks
+ * targeting a property.
+ */
+struct KeyframeSample {
+    const float* start;
+    const float* end;
+    const float* initial;
+    float* result;
+    float t;
+    float weight;
+};
+
+/** Collects the keyframe samples of many tracks grouped by value type and interpolation mode so that each group is
+ * evaluated in one loop without per track dispatch. Quaternions with linear interpolation are evaluated four at a
+ * time with SSE2 or NEON.
+ */
+class KeyframeSampler {
+public:
+    enum class ValueType : uint8_t { FLOAT, VEC2, VEC3, VEC4, QUAT, COUNT };
+    enum class Mode : uint8_t { STEP, LINEAR, SPLINE, COUNT };
+
+    void Add(ValueType type, Mode mode, const KeyframeSample& sample);
+
+    /** Storage for count floats which stays valid until Evaluate, e.g. for keyframes decoded from compressed
+     * tracks. */
+    float* Allocate(size_t count);
+
+    /** Evaluates all the added samples and clears the groups and the allocations. */
+    void Evaluate();
+
+    bool Empty() const;
+
+private:
+    static constexpr size_t GROUP_COUNT = static_cast<size_t>(ValueType::COUNT) * static_cast<size_t>(Mode::COUNT);
+    BASE_NS::vector<KeyframeSample> groups_[GROUP_COUNT];
+    // Allocate hands out floats from fixed size chunks so that earlier allocations aren't moved.
+    static constexpr size_t CHUNK_SIZE = 4096U;
+    BASE_NS::vector<BASE_NS::vector<float>> chunks_;
+    size_t chunk_ { 0U };
+    size_t chunkUsed_ { 0U };
+};
+CORE3D_END_NAMESPACE()
+
+#endif  // CORE_UTIL_KEYFRAME_SAMPLER_H
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "light_probe_locator.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include <3d/light_probe_types/light_probe_constants.h>
+#include <base/math/vector_util.h>
+
+#include "util/light_probe_util.h"
+
+CORE3D_BEGIN_NAMESPACE()
+using namespace BASE_NS;
+
+namespace {
+// A walk between objects moving a bit per frame is a few steps, longer walks are left to the bvh.
+constexpr uint32_t MAX_WALK_STEPS = 128U;
+
+bool IsInside(const Math::Vec4& bary)
+{
+    return bary.x >= 0.0f && bary.y >= 0.0f && bary.z >= 0.0f && bary.w >= 0.0f &&
+           std::abs(bary.x + bary.y + bary.z + bary.w - 1.0f) < LightProbeConstants::EPSILON;
+}
+
+bool IsCloser(float distance, uint32_t index, const LightProbeLocator::NearestProbe& other)
+{
+    return (distance < other.distance) || ((distance == other.distance) && (index < other.index));
+}
+
+// Inserts a probe to the sorted list of nearest probes, distances are squared while searching.
+void InsertNearest(array_view<LightProbeLocator::NearestProbe> nearest, uint32_t index, float distance)
+{
+    size_t slot = nearest.size();
+    while (slot && IsCloser(distance, index, nearest[slot - 1U])) {
+        if (slot < nearest.size()) {
+            nearest[slot] = nearest[slot - 1U];
+        }
+        --slot;
+    }
+    if (slot < nearest.size()) {
+        nearest[slot] = {index, distance};
+    }
+}
+}  // namespace
+
+void LightProbeLocator::Build(
+    const LightProbeVolume& lightProbeVolume, array_view<const TetrahedronAdjacency> adjacency)
+{
+    Clear();
+    const auto& tetrahedrons = lightProbeVolume.tetrahedrons;
+    tetrahedronCount_ = tetrahedrons.size();
+    if (adjacency.size() == tetrahedrons.size()) {
+        adjacency_.append(adjacency.cbegin(), adjacency.cend());
+    }
+    if (!tetrahedrons.empty()) {
+        vector<Bvh::Aabb> bounds;
+        bounds.reserve(tetrahedrons.size());
+        for (const auto& tet : tetrahedrons) {
+            Bvh::Aabb aabb{tet.vertices[0], tet.vertices[0]};
+            for (uint32_t i = 1U; i < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++i) {
+                aabb.min = Math::min(aabb.min, tet.vertices[i]);
+                aabb.max = Math::max(aabb.max, tet.vertices[i]);
+            }
+            bounds.push_back(aabb);
+        }
+        bvh_.Build(bounds);
+    }
+
+    const auto& lightProbes = lightProbeVolume.lightProbes;
+    kdNodes_.reserve(lightProbes.size());
+    for (uint32_t i = 0U; i < static_cast<uint32_t>(lightProbes.size()); ++i) {
+        kdNodes_.push_back({lightProbes[i].position, i, {}, 0U, {}});
+    }
+    BuildKdTree(0U, static_cast<uint32_t>(kdNodes_.size()));
+}
+
+void LightProbeLocator::Clear()
+{
+    adjacency_.clear();
+    bvh_.Clear();
+    kdNodes_.clear();
+    tetrahedronCount_ = 0U;
+}
+
+bool LightProbeLocator::IsBuiltFor(const LightProbeVolume& lightProbeVolume) const
+{
+    return (lightProbeVolume.lightProbes.size() == kdNodes_.size()) &&
+           (lightProbeVolume.tetrahedrons.size() == tetrahedronCount_);
+}
+
+uint32_t LightProbeLocator::FindTetrahedron(
+    const LightProbeVolume& lightProbeVolume, const Math::Vec3& position, uint32_t& hint) const
+{
+    const auto& tetrahedrons = lightProbeVolume.tetrahedrons;
+    if (tetrahedrons.empty()) {
+        return INVALID_INDEX;
+    }
+    if (adjacency_.size() == tetrahedrons.size()) {
+        uint32_t& current = hint;
+        if (current >= tetrahedrons.size()) {
+            current = 0U;
+        }
+        for (uint32_t step = 0U; step < MAX_WALK_STEPS; ++step) {
+            const Math::Vec4 bary = LightProbeUtil::CalculateBarycentricCoordinates(position, tetrahedrons[current]);
+            if (IsInside(bary)) {
+                return current;
+            }
+            // Cross the face opposite of the vertex with the most negative weight, i.e. the face the point is
+            // furthest behind.
+            uint32_t exit = 0U;
+            for (uint32_t i = 1U; i < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++i) {
+                if (bary[i] < bary[exit]) {
+                    exit = i;
+                }
+            }
+            const uint32_t next = adjacency_[current].neighbors[exit];
+            if (next == TetrahedronAdjacency::INVALID_NEIGHBOR) {
+                // Either outside of the volume or behind a concave part of the hull.
+                break;
+            }
+            current = next;
+        }
+    }
+    const uint32_t found = FindTetrahedronBvh(lightProbeVolume, position);
+    if (found != INVALID_INDEX) {
+        hint = found;
+    }
+    return found;
+}
+
+uint32_t LightProbeLocator::FindTetrahedronBvh(
+    const LightProbeVolume& lightProbeVolume, const Math::Vec3& position) const
+{
+    // Lowest index wins when the point is on a shared face so the result matches a linear search.
+    uint32_t found = INVALID_INDEX;
+    bvh_.Traverse(
+        [&position](const Bvh::Node& node) {
+            const bool inside = (position.x >= node.min.x) && (position.y >= node.min.y) &&
+                                (position.z >= node.min.z) && (position.x <= node.max.x) &&
+                                (position.y <= node.max.y) && (position.z <= node.max.z);
+            return inside ? Bvh::Containment::INTERSECTS : Bvh::Containment::OUTSIDE;
+        },
+        [&lightProbeVolume, &position, &found](uint32_t primitive, bool) {
+            if ((primitive < found) && (primitive < lightProbeVolume.tetrahedrons.size()) &&
+                IsInside(LightProbeUtil::CalculateBarycentricCoordinates(
+                    position, lightProbeVolume.tetrahedrons[primitive]))) {
+                found = primitive;
+            }
+        });
+    return found;
+}
+
+uint32_t LightProbeLocator::FindNearestProbes(const Math::Vec3& position, array_view<NearestProbe> nearest) const
+{
+    for (auto& slot : nearest) {
+        slot = {INVALID_INDEX, FLT_MAX};
+    }
+    if (nearest.empty()) {
+        return 0U;
+    }
+    SearchKdTree(0U, static_cast<uint32_t>(kdNodes_.size()), position, nearest);
+    uint32_t count = 0U;
+    for (auto& slot : nearest) {
+        if (slot.index == INVALID_INDEX) {
+            break;
+        }
+        slot.distance = Math::sqrt(slot.distance);
+        ++count;
+    }
+    return count;
+}
+
+void LightProbeLocator::BuildKdTree(uint32_t begin, uint32_t end)
+{
+    if (begin >= end) {
+        return;
+    }
+    Math::Vec3 min = kdNodes_[begin].position;
+    Math::Vec3 max = min;
+    for (uint32_t i = begin + 1U; i < end; ++i) {
+        min = Math::min(min, kdNodes_[i].position);
+        max = Math::max(max, kdNodes_[i].position);
+    }
+    // Split along the longest extent of the range.
+    const Math::Vec3 extent = max - min;
+    uint32_t axis = (extent.x >= extent.y) ? 0U : 1U;
+    if (extent.z > extent[axis]) {
+        axis = 2U;
+    }
+    const uint32_t mid = begin + (end - begin) / 2U;
+    std::nth_element(kdNodes_.begin() + begin, kdNodes_.begin() + mid, kdNodes_.begin() + end,
+        [axis](const KdNode& lhs, const KdNode& rhs) { return lhs.position[axis] < rhs.position[axis]; });
+    KdNode& node = kdNodes_[mid];
+    node.min = min;
+    node.max = max;
+    node.axis = axis;
+    BuildKdTree(begin, mid);
+    BuildKdTree(mid + 1U, end);
+}
+
+void LightProbeLocator::SearchKdTree(
+    uint32_t begin, uint32_t end, const Math::Vec3& position, array_view<NearestProbe> nearest) const
+{
+    if (begin >= end) {
+        return;
+    }
+    const uint32_t mid = begin + (end - begin) / 2U;
+    const KdNode& node = kdNodes_[mid];
+    // Skip the range if its bounds are further than the furthest probe found so far.
+    const Math::Vec3 closest = Math::min(Math::max(position, node.min), node.max);
+    if (Math::Distance2(position, closest) > nearest[nearest.size() - 1U].distance) {
+        return;
+    }
+    InsertNearest(nearest, node.probe, Math::Distance2(position, node.position));
+
+    const bool left = position[node.axis] < node.position[node.axis];
+    SearchKdTree(left ? begin : (mid + 1U), left ? mid : end, position, nearest);
+    SearchKdTree(left ? (mid + 1U) : begin, left ? end : mid, position, nearest);
+}
+CORE3D_END_NAMESPACE()
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_UTIL_LIGHT_PROBE_LOCATOR_H
+#define CORE_UTIL_LIGHT_PROBE_LOCATOR_H
+
+#include <cstdint>
+
+#include <3d/light_probe_types/light_probe.h>
+#include <3d/namespace.h>
+#include <base/containers/array_view.h>
+#include <base/containers/vector.h>
+#include <base/math/vector.h>
+
+#include "util/bowyer_watson_delaunay_3d.h"
+#include "util/bvh.h"
+
+CORE3D_BEGIN_NAMESPACE()
+/** Search structures for the point queries of a light probe volume.
+ * The containing tetrahedron is found by walking over the tetrahedron faces from a previous result, a bvh of the
+ * tetrahedrons is used when the walk doesn't reach the point. Nearest probes are searched from a k-d tree.
+ * The locator doesn't keep references to the volume, queries take the volume it was built for.
+ */
+class LightProbeLocator {
+public:
+    static constexpr uint32_t INVALID_INDEX = ~0U;
+
+    struct NearestProbe {
+        uint32_t index;
+        float distance;
+    };
+
+    /** Rebuilds the search structures. Adjacency is optional, without it each query uses the bvh. */
+    void Build(const LightProbeVolume& lightProbeVolume, BASE_NS::array_view<const TetrahedronAdjacency> adjacency);
+    void Clear();
+
+    /** Checks that the locator was built for a volume with the same probes and tetrahedrons. */
+    bool IsBuiltFor(const LightProbeVolume& lightProbeVolume) const;
+
+    /** Finds the tetrahedron containing the position.
+     * @param hint Tetrahedron where the walk starts, updated with where the walk ended. Keep it per object so the
+     * next query of the same object starts nearby.
+     * @return Index of the tetrahedron or INVALID_INDEX when the position is outside of the volume.
+     */
+    uint32_t FindTetrahedron(
+        const LightProbeVolume& lightProbeVolume, const BASE_NS::Math::Vec3& position, uint32_t& hint) const;
+
+    /** Finds the probes closest to the position sorted by distance, ties are sorted by index.
+     * @return Number of probes written to nearest.
+     */
+    uint32_t FindNearestProbes(const BASE_NS::Math::Vec3& position, BASE_NS::array_view<NearestProbe> nearest) const;
+
+private:
+    // Probes in k-d tree order. The node of range [begin, end) is at the middle, splits the range along axis and
+    // has the bounds of the whole range.
+    struct KdNode {
+        BASE_NS::Math::Vec3 position;
+        uint32_t probe;
+        BASE_NS::Math::Vec3 min;
+        uint32_t axis;
+        BASE_NS::Math::Vec3 max;
+    };
+
+    uint32_t FindTetrahedronBvh(const LightProbeVolume& lightProbeVolume, const BASE_NS::Math::Vec3& position) const;
+    void BuildKdTree(uint32_t begin, uint32_t end);
+    void SearchKdTree(uint32_t begin, uint32_t end, const BASE_NS::Math::Vec3& position,
+        BASE_NS::array_view<NearestProbe> nearest) const;
+
+    BASE_NS::vector<TetrahedronAdjacency> adjacency_;
+    Bvh bvh_;
+    BASE_NS::vector<KdNode> kdNodes_;
+    size_t tetrahedronCount_{0U};
+};
+CORE3D_END_NAMESPACE()
+
+#endif  // CORE_UTIL_LIGHT_PROBE_LOCATOR_H
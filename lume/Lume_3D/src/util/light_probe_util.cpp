@@ -26,6 +26,7 @@
 #include <core/namespace.h>
 
 #include "bowyer_watson_delaunay_3d.h"
+#include "light_probe_locator.h"
 
 namespace {
 void InterpolateLightProbeData(const BASE_NS::Math::Vec4& barycentric, const CORE3D_NS::Tetrahedron& tet,
@@ -99,6 +100,17 @@ uint32_t FindNearestProbes(const CORE3D_NS::LightProbeVolume& volume, const BASE
     return count;
 }
 
+uint32_t FindNearestProbes(const CORE3D_NS::LightProbeLocator& locator, const BASE_NS::Math::Vec3& worldCenter,
+    ProbeDistance (&nearest)[IDW_NEAREST_PROBES])
+{
+    CORE3D_NS::LightProbeLocator::NearestProbe found[IDW_NEAREST_PROBES];
+    const uint32_t count = locator.FindNearestProbes(worldCenter, found);
+    for (uint32_t i = 0U; i < IDW_NEAREST_PROBES; ++i) {
+        nearest[i] = {found[i].index, found[i].distance};
+    }
+    return count;
+}
+
 void ComputeIdwWeights(
     const ProbeDistance (&nearest)[IDW_NEAREST_PROBES], uint32_t probeCount, float (&weights)[IDW_NEAREST_PROBES])
 {
@@ -114,7 +126,8 @@ void ComputeIdwWeights(
 }
 
 bool InterpolateFromNearestProbes(const CORE3D_NS::LightProbeVolume& lightProbeVolume,
-    const BASE_NS::Math::Vec3& worldCenter, CORE3D_NS::LightProbeInterpolatedData& lightProbeInterpolatedData)
+    const CORE3D_NS::LightProbeLocator* locator, const BASE_NS::Math::Vec3& worldCenter,
+    CORE3D_NS::LightProbeInterpolatedData& lightProbeInterpolatedData)
 {
     if (lightProbeVolume.lightProbes.empty()) {
         return false;
@@ -122,7 +135,8 @@ bool InterpolateFromNearestProbes(const CORE3D_NS::LightProbeVolume& lightProbeV
     auto& result = lightProbeInterpolatedData;
 
     ProbeDistance nearest[IDW_NEAREST_PROBES] = {};
-    const uint32_t probeCount = FindNearestProbes(lightProbeVolume, worldCenter, nearest);
+    const uint32_t probeCount = locator ? FindNearestProbes(*locator, worldCenter, nearest)
+                                        : FindNearestProbes(lightProbeVolume, worldCenter, nearest);
 
     float weights[IDW_NEAREST_PROBES] = {0.0f, 0.0f, 0.0f};
     ComputeIdwWeights(nearest, probeCount, weights);
@@ -252,14 +266,41 @@ LightProbeInterpolatedDataOpt LightProbeUtil::GetInterpolatedLightProbeData(
     }
     auto tetOpt = FindContainingTetrahedron(worldCenter, lightProbeVolume);
     if (!tetOpt) {
-        auto res = InterpolateFromNearestProbes(lightProbeVolume, worldCenter, lightProbeInterpolatedData);
+        auto res = InterpolateFromNearestProbes(lightProbeVolume, nullptr, worldCenter, lightProbeInterpolatedData);
         return {lightProbeInterpolatedData, res};
     }
     const auto& tet = tetOpt.tetrahedrons;
     const uint32_t probeCount = static_cast<uint32_t>(lightProbeVolume.lightProbes.size());
     if (tet.indices[0] >= probeCount || tet.indices[1] >= probeCount || tet.indices[2] >= probeCount ||
         tet.indices[3] >= probeCount) {
-        auto res = InterpolateFromNearestProbes(lightProbeVolume, worldCenter, lightProbeInterpolatedData);
+        auto res = InterpolateFromNearestProbes(lightProbeVolume, nullptr, worldCenter, lightProbeInterpolatedData);
+        return {lightProbeInterpolatedData, res};
+    }
+    auto barycentric = CalculateBarycentricCoordinates(worldCenter, tet);
+    InterpolateLightProbeData(barycentric, tet, lightProbeVolume, lightProbeInterpolatedData);
+    return {lightProbeInterpolatedData, true};
+}
+
+LightProbeInterpolatedDataOpt LightProbeUtil::GetInterpolatedLightProbeData(const LightProbeVolume& lightProbeVolume,
+    const LightProbeLocator& locator, const BASE_NS::Math::Vec3& worldCenter, uint32_t& tetrahedronHint)
+{
+    if (!locator.IsBuiltFor(lightProbeVolume)) {
+        return GetInterpolatedLightProbeData(lightProbeVolume, worldCenter);
+    }
+    LightProbeInterpolatedData lightProbeInterpolatedData;
+    if (lightProbeVolume.lightProbes.empty()) {
+        return {lightProbeInterpolatedData, false};
+    }
+    const uint32_t tetIndex = locator.FindTetrahedron(lightProbeVolume, worldCenter, tetrahedronHint);
+    if (tetIndex == LightProbeLocator::INVALID_INDEX) {
+        auto res = InterpolateFromNearestProbes(lightProbeVolume, &locator, worldCenter, lightProbeInterpolatedData);
+        return {lightProbeInterpolatedData, res};
+    }
+    const auto& tet = lightProbeVolume.tetrahedrons[tetIndex];
+    const uint32_t probeCount = static_cast<uint32_t>(lightProbeVolume.lightProbes.size());
+    if (tet.indices[0] >= probeCount || tet.indices[1] >= probeCount || tet.indices[2] >= probeCount ||
+        tet.indices[3] >= probeCount) {
+        auto res = InterpolateFromNearestProbes(lightProbeVolume, &locator, worldCenter, lightProbeInterpolatedData);
         return {lightProbeInterpolatedData, res};
     }
     auto barycentric = CalculateBarycentricCoordinates(worldCenter, tet);
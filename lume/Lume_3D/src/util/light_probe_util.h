@@ -27,6 +27,8 @@ class Vec4;
 BASE_END_NAMESPACE()
 
 CORE3D_BEGIN_NAMESPACE()
+class LightProbeLocator;
+
 class LightProbeUtil {
 public:
     static TetrahedronOpt FindContainingTetrahedron(
@@ -35,6 +37,10 @@ public:
         const BASE_NS::Math::Vec3& point, const Tetrahedron& tet);
     static LightProbeInterpolatedDataOpt GetInterpolatedLightProbeData(
         const LightProbeVolume& lightProbeVolume, const BASE_NS::Math::Vec3& worldCenter);
+    // Same as above but uses the search structures of the locator. tetrahedronHint is where the search starts and
+    // where it ended, keep it per object between frames.
+    static LightProbeInterpolatedDataOpt GetInterpolatedLightProbeData(const LightProbeVolume& lightProbeVolume,
+        const LightProbeLocator& locator, const BASE_NS::Math::Vec3& worldCenter, uint32_t& tetrahedronHint);
 
     LightProbeUtil() = default;
     ~LightProbeUtil() = default;
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <numeric>
 #include <optional>
 #include <securec.h>
 
@@ -566,6 +567,19 @@ void FillSubmeshBuffers(array_view<MeshComponent::Submesh> submeshes, const Mesh
     }
 }
 
+bool IsTriangleList(const GraphicsState::InputAssembly& inputAssembly)
+{
+    return (inputAssembly.primitiveTopology == PrimitiveTopology::CORE_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST) ||
+           (inputAssembly.primitiveTopology == PrimitiveTopology::CORE_PRIMITIVE_TOPOLOGY_MAX_ENUM);
+}
+
+// Number of indices a submesh has in MeshComponent::pickingIndices.
+size_t GetPickingIndexCount(uint32_t vertexCount, uint32_t indexCount)
+{
+    const uint32_t count = indexCount ? indexCount : vertexCount;
+    return count - (count % 3U);
+}
+
 MinAndMax CalculateAabb(array_view<const MeshComponent::Submesh> submeshes)
 {
     MinAndMax minMax;
@@ -1143,6 +1157,8 @@ void MeshBuilder::Initialize(const IMeshBuilder::Configuration& config)
     targetDataSize_ = 0;
 
     jointBoundsData_.clear();
+    pickingPositions_.clear();
+    pickingIndices_.clear();
 
     if (vertexPtr_) {
         vertexPtr_ = nullptr;
@@ -1198,6 +1214,10 @@ void MeshBuilder::Allocate()
     jointDataSize_ = bufferSizes.jointBuffer;
     targetDataSize_ = bufferSizes.morphVertexData;
 
+    if (flags_ & ConfigurationFlagBits::PICKING_DATA) {
+        AllocatePickingData();
+    }
+
     if (flags_ & ConfigurationFlagBits::NO_STAGING_BUFFER) {
         // Create host accessible buffers where data can be written directly.
         IMeshBuilder::GpuBufferCreateInfo flags = DEFAULT_BUFFER_CREATE_INFO;
@@ -1334,6 +1354,14 @@ void MeshBuilder::SetVertexData(size_t submeshIndex, const DataBuffer& positions
                 submesh.positionOffset = static_cast<int32_t>(offset);
                 submesh.positionSize = sizeof(Math::Vec3) * submeshDesc.vertexCount;
             }
+            if (!pickingPositions_.empty()) {
+                OutputBuffer dst{BASE_FORMAT_R32G32B32_SFLOAT,
+                    sizeof(Math::Vec3),
+                    {reinterpret_cast<uint8_t*>(pickingPositions_.data() + submesh.pickingVertexOffset),
+                        sizeof(Math::Vec3) * submeshDesc.vertexCount},
+                    {}};
+                Fill(dst, positions, submeshDesc.vertexCount);
+            }
         }
 
         // Process normal.
@@ -1505,6 +1533,20 @@ void MeshBuilder::SetIndexData(size_t submeshIndex, const DataBuffer& indices)
             // Then copy the data to staging buffer.
             std::copy(output.buffer.data(), output.buffer.data() + bufferSize, buffer + bufferOffset);
         }
+
+        if (!pickingIndices_.empty() && indexCount) {
+            const size_t count = GetPickingIndexCount(submesh.info.vertexCount, indexCount);
+            auto* pickingIndices = pickingIndices_.data() + submesh.pickingIndexOffset;
+            OutputBuffer dst{BASE_FORMAT_R32_UINT,
+                sizeof(uint32_t),
+                {reinterpret_cast<uint8_t*>(pickingIndices), sizeof(uint32_t) * count},
+                {}};
+            Fill(dst, indices, count);
+            // Indices are relative to the submesh, make them relative to all the positions.
+            for (size_t i = 0U; i < count; ++i) {
+                pickingIndices[i] += submesh.pickingVertexOffset;
+            }
+        }
     }
 }
 
@@ -1899,6 +1941,10 @@ Entity MeshBuilder::CreateMesh(IEcs& ecs, Entity meshEntity) const
             }
         }
 
+        if (!pickingIndices_.empty()) {
+            AppendPickingData(mesh);
+        }
+
         // Only the new submeshes should have new buffers, so assign them before appending.
         FillSubmeshBuffers(submeshes_, CreateBuffers(ecs));
         mesh.submeshes.append(submeshes_.cbegin(), submeshes_.cend());
@@ -1922,6 +1968,53 @@ void MeshBuilder::EnablePrimitiveRestart(size_t index)
 }
 
 // Private methods
+void MeshBuilder::AllocatePickingData()
+{
+    size_t vertexCount = 0U;
+    size_t indexCount = 0U;
+    for (auto& submesh : submeshInfos_) {
+        if (!IsTriangleList(submesh.info.inputAssembly)) {
+            PLUGIN_LOG_W("MeshBuilder: picking data is only supported for triangle lists");
+            return;
+        }
+        submesh.pickingVertexOffset = static_cast<uint32_t>(vertexCount);
+        submesh.pickingIndexOffset = static_cast<uint32_t>(indexCount);
+        vertexCount += submesh.info.vertexCount;
+        indexCount += GetPickingIndexCount(submesh.info.vertexCount, submesh.info.indexCount);
+    }
+    if ((vertexCount > UINT32_MAX) || !indexCount) {
+        return;
+    }
+    pickingPositions_.resize(vertexCount);
+    pickingIndices_.resize(indexCount);
+    // Submeshes without indices are drawn in vertex order.
+    for (const auto& submesh : submeshInfos_) {
+        if (!submesh.info.indexCount) {
+            auto* begin = pickingIndices_.data() + submesh.pickingIndexOffset;
+            std::iota(begin, begin + GetPickingIndexCount(submesh.info.vertexCount, 0U), submesh.pickingVertexOffset);
+        }
+    }
+}
+
+void MeshBuilder::AppendPickingData(MeshComponent& mesh) const
+{
+    // Appending is only possible when the existing submeshes have their triangles in the picking data.
+    size_t existingIndices = 0U;
+    for (const auto& submesh : mesh.submeshes) {
+        existingIndices += GetPickingIndexCount(submesh.vertexCount, submesh.indexCount);
+    }
+    if (existingIndices != mesh.pickingIndices.size()) {
+        PLUGIN_LOG_W("MeshBuilder: mesh has submeshes without picking data");
+        return;
+    }
+    const auto vertexOffset = static_cast<uint32_t>(mesh.pickingPositions.size());
+    mesh.pickingPositions.append(pickingPositions_.cbegin(), pickingPositions_.cend());
+    mesh.pickingIndices.reserve(mesh.pickingIndices.size() + pickingIndices_.size());
+    for (const auto index : pickingIndices_) {
+        mesh.pickingIndices.push_back(index + vertexOffset);
+    }
+}
+
 MeshBuilder::BufferEntities MeshBuilder::CreateBuffers(IEcs& ecs) const
 {
     BufferEntities entities;
@@ -125,6 +125,9 @@ public:
         uint32_t tangentSize = 0;
         int32_t indexOffset = -1;
         uint32_t indexSize = 0;
+        // Offsets to pickingPositions_ and pickingIndices_.
+        uint32_t pickingVertexOffset = 0;
+        uint32_t pickingIndexOffset = 0;
     };
 
 private:
@@ -158,6 +161,8 @@ private:
         uint32_t& byteSize, uint8_t* dst, const BASE_NS::Math::Vec4& defaultValue) const;
 
     void RemapBufferAccessToBindings(size_t submeshIndex);
+    void AllocatePickingData();
+    void AppendPickingData(MeshComponent& mesh) const;
 
     RENDER_NS::IRenderContext& renderContext_;
     RENDER_NS::VertexInputDeclarationView vertexInputDeclaration_;
@@ -187,6 +192,9 @@ private:
 
     mutable BASE_NS::vector<uint8_t> vertexData_;
     BASE_NS::vector<uint8_t> indexData_;
+    // CPU copies of the triangle lists when configured with PICKING_DATA.
+    BASE_NS::vector<BASE_NS::Math::Vec3> pickingPositions_;
+    BASE_NS::vector<uint32_t> pickingIndices_;
     uint32_t flags_ = 0;
     bool rtEnabled_{false};
 };
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mesh_bvh.h"
+
+#include <limits>
+
+#include <base/math/mathf.h>
+#include <base/math/vector_util.h>
+
+CORE3D_BEGIN_NAMESPACE()
+using namespace BASE_NS;
+
+namespace {
+Math::Vec3 SafeInverse(const Math::Vec3& direction)
+{
+    constexpr float fmax = std::numeric_limits<float>::max();
+    return {(direction.x != 0.0f) ? (1.0f / direction.x) : fmax, (direction.y != 0.0f) ? (1.0f / direction.y) : fmax,
+        (direction.z != 0.0f) ? (1.0f / direction.z) : fmax};
+}
+
+// Slab test returning the entry distance clamped to the ray start.
+inline bool IntersectNode(const Bvh::Node& node, const Math::Vec3& start, const Math::Vec3& invDirection,
+    float maxDistance, float& entry)
+{
+    const float tx1 = (node.min.x - start.x) * invDirection.x;
+    const float tx2 = (node.max.x - start.x) * invDirection.x;
+    float tmin = Math::min(tx1, tx2);
+    float tmax = Math::max(tx1, tx2);
+
+    const float ty1 = (node.min.y - start.y) * invDirection.y;
+    const float ty2 = (node.max.y - start.y) * invDirection.y;
+    tmin = Math::max(tmin, Math::min(ty1, ty2));
+    tmax = Math::min(tmax, Math::max(ty1, ty2));
+
+    const float tz1 = (node.min.z - start.z) * invDirection.z;
+    const float tz2 = (node.max.z - start.z) * invDirection.z;
+    tmin = Math::max(tmin, Math::min(tz1, tz2));
+    tmax = Math::min(tmax, Math::max(tz1, tz2));
+
+    entry = Math::max(tmin, 0.0f);
+    return (tmax >= entry) && (entry < maxDistance);
+}
+
+// Moller-Trumbore, culling back faces.
+inline bool IntersectTriangle(const Math::Vec3* corners, const Math::Vec3& start, const Math::Vec3& direction,
+    float sign, float& distance, Math::Vec2& uv)
+{
+    const Math::Vec3 v0v1 = corners[1] - corners[0];
+    const Math::Vec3 v0v2 = corners[2] - corners[0];
+    const Math::Vec3 pvec = Math::Cross(direction, v0v2);
+    const float det = Math::Dot(v0v1, pvec);
+    if ((det * sign) <= 0.0f) {
+        return false;
+    }
+    const float invDet = 1.0f / det;
+    const Math::Vec3 tvec = start - corners[0];
+    const float u = Math::Dot(tvec, pvec) * invDet;
+    if ((u < 0.0f) || (u > 1.0f)) {
+        return false;
+    }
+    const Math::Vec3 qvec = Math::Cross(tvec, v0v1);
+    const float v = Math::Dot(direction, qvec) * invDet;
+    if ((v < 0.0f) || ((u + v) > 1.0f)) {
+        return false;
+    }
+    distance = Math::Dot(v0v2, qvec) * invDet;
+    uv = Math::Vec2(u, v);
+    return true;
+}
+}  // namespace
+
+void MeshBvh::Build(array_view<const Math::Vec3> positions, array_view<const uint32_t> indices)
+{
+    const size_t triangleCount = indices.size() / 3U;
+    vector<Bvh::Aabb> bounds(triangleCount);
+    vector<Math::Vec3> corners(triangleCount * 3U);
+    for (size_t i = 0U; i < triangleCount; ++i) {
+        const uint32_t* triangle = indices.data() + (i * 3U);
+        Math::Vec3* dst = corners.data() + (i * 3U);
+        if ((triangle[0U] < positions.size()) && (triangle[1U] < positions.size()) &&
+            (triangle[2U] < positions.size())) {
+            dst[0U] = positions[triangle[0U]];
+            dst[1U] = positions[triangle[1U]];
+            dst[2U] = positions[triangle[2U]];
+        }
+        // Otherwise the corners stay at the origin and the degenerate triangle can't be hit.
+        bounds[i] = {Math::min(Math::min(dst[0U], dst[1U]), dst[2U]), Math::max(Math::max(dst[0U], dst[1U]), dst[2U])};
+    }
+    bvh_.Build(bounds);
+
+    // Reorder the corners to the leaf order.
+    const auto primitives = bvh_.GetPrimitives();
+    corners_.resize(corners.size());
+    for (size_t i = 0U; i < primitives.size(); ++i) {
+        const Math::Vec3* src = corners.data() + (static_cast<size_t>(primitives[i]) * 3U);
+        Math::Vec3* dst = corners_.data() + (i * 3U);
+        dst[0U] = src[0U];
+        dst[1U] = src[1U];
+        dst[2U] = src[2U];
+    }
+}
+
+bool MeshBvh::RayCast(
+    const Math::Vec3& start, const Math::Vec3& direction, bool flipWinding, float maxDistance, Hit& hit) const
+{
+    const auto nodes = bvh_.GetNodes();
+    const auto primitives = bvh_.GetPrimitives();
+    const Math::Vec3 invDirection = SafeInverse(direction);
+    const float sign = flipWinding ? -1.0f : 1.0f;
+
+    float closest = maxDistance;
+    uint32_t closestIndex = ~0U;
+    Math::Vec2 closestUv;
+
+    float entry = 0.0f;
+    if (nodes.empty() || !IntersectNode(nodes[0U], start, invDirection, closest, entry)) {
+        return false;
+    }
+
+    // Only the further child is pushed so the depth of the hierarchy limits the stack size.
+    struct StackEntry {
+        uint32_t node;
+        float entry;
+    };
+    StackEntry stack[Bvh::MAX_DEPTH];
+    uint32_t stackSize = 0U;
+    uint32_t nodeIndex = 0U;
+    for (;;) {
+        const Bvh::Node& node = nodes[nodeIndex];
+        if (node.count) {
+            for (uint32_t i = node.offset; i < (node.offset + node.count); ++i) {
+                float distance;
+                Math::Vec2 uv;
+                if (IntersectTriangle(corners_.data() + (static_cast<size_t>(i) * 3U), start, direction, sign,
+                        distance, uv) &&
+                    (distance >= 0.0f) && (distance < closest)) {
+                    closest = distance;
+                    closestIndex = i;
+                    closestUv = uv;
+                }
+            }
+        } else {
+            const uint32_t left = nodeIndex + 1U;
+            const uint32_t right = node.offset;
+            float leftEntry = 0.0f;
+            float rightEntry = 0.0f;
+            const bool hitLeft = IntersectNode(nodes[left], start, invDirection, closest, leftEntry);
+            const bool hitRight = IntersectNode(nodes[right], start, invDirection, closest, rightEntry);
+            if (hitLeft && hitRight) {
+                if (leftEntry <= rightEntry) {
+                    stack[stackSize++] = {right, rightEntry};
+                    nodeIndex = left;
+                } else {
+                    stack[stackSize++] = {left, leftEntry};
+                    nodeIndex = right;
+                }
+                continue;
+            }
+            if (hitLeft || hitRight) {
+                nodeIndex = hitLeft ? left : right;
+                continue;
+            }
+        }
+        // Continue with the closest pending node which may still contain a closer hit.
+        while (stackSize && (stack[stackSize - 1U].entry >= closest)) {
+            --stackSize;
+        }
+        if (!stackSize) {
+            break;
+        }
+        nodeIndex = stack[--stackSize].node;
+    }
+
+    if (closestIndex == ~0U) {
+        return false;
+    }
+    hit.distance = closest;
+    hit.uv = closestUv;
+    hit.triangle = primitives[closestIndex];
+    return true;
+}
+CORE3D_END_NAMESPACE()
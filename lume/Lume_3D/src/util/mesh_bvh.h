@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CORE_UTIL_MESH_BVH_H
+#define CORE_UTIL_MESH_BVH_H
+
+#include <cstdint>
+
+#include <3d/namespace.h>
+#include <base/containers/array_view.h>
+#include <base/containers/vector.h>
+#include <base/math/vector.h>
+
+#include "util/bvh.h"
+
+CORE3D_BEGIN_NAMESPACE()
+/** Bounding volume hierarchy over the triangles of a mesh for ray casts. */
+class MeshBvh {
+public:
+    struct Hit {
+        float distance;
+        /** Barycentric coordinates relative to the second and third corner. */
+        BASE_NS::Math::Vec2 uv;
+        /** Index of the triangle in the index list given to Build. */
+        uint32_t triangle;
+    };
+
+    /** Rebuilds the hierarchy from a triangle list. Triangles with indices out of range are never hit. */
+    void Build(BASE_NS::array_view<const BASE_NS::Math::Vec3> positions, BASE_NS::array_view<const uint32_t> indices);
+
+    bool Empty() const
+    {
+        return bvh_.Empty();
+    }
+
+    uint32_t GetTriangleCount() const
+    {
+        return static_cast<uint32_t>(corners_.size() / 3U);
+    }
+
+    /** Finds the closest front facing triangle hit by the ray start + distance * direction, where 0 <= distance <
+     * maxDistance. Children are visited front to back and nodes further than the closest hit so far are skipped.
+     * @param flipWinding Treat clockwise triangles as front facing, e.g. when the mesh is mirrored.
+     */
+    bool RayCast(const BASE_NS::Math::Vec3& start, const BASE_NS::Math::Vec3& direction, bool flipWinding,
+        float maxDistance, Hit& hit) const;
+
+private:
+    Bvh bvh_;
+    // Triangle corners in the order of Bvh::GetPrimitives() so that leaves read consecutive memory.
+    BASE_NS::vector<BASE_NS::Math::Vec3> corners_;
+};
+CORE3D_END_NAMESPACE()
+
+#endif  // CORE_UTIL_MESH_BVH_H
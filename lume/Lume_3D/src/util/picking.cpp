@@ -29,6 +29,7 @@
 #include <3d/ecs/components/world_matrix_component.h>
 #include <3d/ecs/systems/intf_node_system.h>
 #include <base/containers/fixed_string.h>
+#include <base/containers/unordered_map.h>
 #include <base/math/mathf.h>
 #include <base/math/matrix_util.h>
 #include <base/math/vector_util.h>
@@ -40,7 +41,9 @@
 #include <core/plugin/intf_plugin_register.h>
 #include <core/property/intf_property_handle.h>
 
+#include "util/bvh.h"
 #include "util/log.h"
+#include "util/mesh_bvh.h"
 #include "util/scene_util.h"
 
 CORE3D_BEGIN_NAMESPACE()
@@ -49,6 +52,16 @@ using namespace CORE_NS;
 using namespace RENDER_NS;
 
 namespace {
+// Caches of more ECSs than this replace the least recently used one.
+constexpr size_t MAX_CACHED_ECS_COUNT = 4U;
+
+// Number of indices a submesh has in MeshComponent::pickingIndices.
+size_t GetPickingIndexCount(const MeshComponent::Submesh& submesh)
+{
+    const uint32_t count = submesh.indexCount ? submesh.indexCount : submesh.vertexCount;
+    return count - (count % 3U);
+}
+
 MinAndMax GetWorldAABB(const Math::Mat4X4& world, const Math::Vec3& aabbMin, const Math::Vec3& aabbMax)
 {
     // Based on https://gist.github.com/cmf028/81e8d3907035640ee0e3fdd69ada543f
@@ -327,6 +340,46 @@ Math::Mat4X4 GetWorldMatrix(
 }
 }  // namespace
 
+struct Picking::SceneBvh {
+    struct Instance {
+        Math::Mat4X4 world;
+        Entity entity;
+        Entity mesh;
+        uint64_t layerMask;
+        // Skinned meshes are tested against the joint bounds which are already in world space.
+        bool skinned;
+    };
+    Bvh bvh;
+    // World space bounds and render meshes, indexed by the primitives of the hierarchy.
+    vector<Bvh::Aabb> bounds;
+    vector<Instance> instances;
+};
+
+struct Picking::MeshData {
+    MeshBvh bvh;
+    // Index of the first triangle of each submesh in the picking data.
+    vector<uint32_t> submeshFirstTriangles;
+};
+
+struct Picking::EcsCache {
+    struct MeshEntry {
+        uint32_t generation;
+        shared_ptr<const MeshData> data;
+    };
+    // The address is only compared, a destroyed ECS is detected from another id at the same address.
+    const IEcs* ecs{nullptr};
+    uint64_t ecsId{0};
+    uint64_t lastUse{0};
+    // Generation counters of the render mesh, world matrix, joint matrices, mesh and layer managers.
+    uint32_t generations[5U]{};
+    shared_ptr<const SceneBvh> scene;
+    unordered_map<Entity, MeshEntry> meshes;
+};
+
+Picking::Picking() = default;
+
+Picking::~Picking() = default;
+
 Math::Vec3 Picking::ScreenToWorld(IEcs const& ecs, Entity cameraEntity, Math::Vec3 screenCoordinate) const
 {
     if (!EntityUtil::IsValid(cameraEntity)) {
@@ -393,125 +446,16 @@ Math::Vec3 Picking::WorldToScreen(IEcs const& ecs, Entity cameraEntity, Math::Ve
 
 vector<RayCastResult> Picking::RayCast(const IEcs& ecs, const Math::Vec3& start, const Math::Vec3& direction) const
 {
-    vector<RayCastResult> result;
-
-    auto nodeSystem = GetSystem<INodeSystem>(ecs);
-    auto const renderMeshComponentManager = GetManager<IRenderMeshComponentManager>(ecs);
-    auto const worldMatrixComponentManager = GetManager<IWorldMatrixComponentManager>(ecs);
-    auto const jointMatricesComponentManager = GetManager<IJointMatricesComponentManager>(ecs);
-    auto const meshComponentManagerPtr = GetManager<IMeshComponentManager>(ecs);
-    if (!nodeSystem || !renderMeshComponentManager || !worldMatrixComponentManager || !jointMatricesComponentManager ||
-        !meshComponentManagerPtr) {
-        return result;
-    }
-    auto const& meshComponentManager = *meshComponentManagerPtr;
-    float distance = 0;
-
-    auto const invDir = DirectionVectorInverse(direction);
-    for (IComponentManager::ComponentId i = 0; i < renderMeshComponentManager->GetComponentCount(); i++) {
-        const Entity id = renderMeshComponentManager->GetEntity(i);
-        auto node = nodeSystem->GetNode(id);
-        if (!node) {
-            continue;
-        }
-        if (const auto jointMatrices = jointMatricesComponentManager->Read(id); jointMatrices) {
-            // Use the skinned aabb's.
-            const auto& jointMatricesComponent = *jointMatrices;
-            if (IntersectAabb(jointMatricesComponent.jointsAabbMin,
-                    jointMatricesComponent.jointsAabbMax,
-                    start,
-                    invDir,
-                    distance)) {
-                const float centerDistance = Math::Magnitude(
-                    (jointMatricesComponent.jointsAabbMax + jointMatricesComponent.jointsAabbMin) * 0.5f - start);
-                const Math::Vec3 hitPosition = start + direction * distance;
-                result.push_back(RayCastResult{node, centerDistance, distance, hitPosition});
-            }
-        } else if (const auto worldMatrixId = worldMatrixComponentManager->GetComponentId(id);
-                   worldMatrixId != IComponentManager::INVALID_COMPONENT_ID) {
-            auto const renderMeshComponent = renderMeshComponentManager->Get(i);
-            if (const auto meshHandle = meshComponentManager.Read(renderMeshComponent.mesh); meshHandle) {
-                auto const worldMatrixComponent = worldMatrixComponentManager->Get(worldMatrixId);
-                const auto raycastResult = HitTestNode(*node, *meshHandle, worldMatrixComponent.matrix, start, invDir);
-                if (raycastResult.node) {
-                    result.push_back(raycastResult);
-                }
-            } else {
-                PLUGIN_LOG_W(
-                    "no mesh resource for entity %" PRIx64 ", resource %" PRIx64, id.id, renderMeshComponent.mesh.id);
-            }
-        }
-    }
-
-    std::sort(
-        result.begin(), result.end(), [](const auto& lhs, const auto& rhs) { return (lhs.distance < rhs.distance); });
-
-    return result;
+    return RayCastBounds(ecs, start, direction, false, 0U);
 }
 
 vector<RayCastResult> Picking::RayCast(
     const IEcs& ecs, const Math::Vec3& start, const Math::Vec3& direction, uint64_t layerMask) const
 {
-    vector<RayCastResult> result;
-
-    auto nodeSystem = GetSystem<INodeSystem>(ecs);
-    auto const renderMeshComponentManager = GetManager<IRenderMeshComponentManager>(ecs);
-    auto const layerComponentManager = GetManager<ILayerComponentManager>(ecs);
-    auto const worldMatrixComponentManager = GetManager<IWorldMatrixComponentManager>(ecs);
-    auto const jointMatricesComponentManager = GetManager<IJointMatricesComponentManager>(ecs);
-    auto const meshComponentManagerPtr = GetManager<IMeshComponentManager>(ecs);
-    if (!nodeSystem || !renderMeshComponentManager || !layerComponentManager || !worldMatrixComponentManager ||
-        !jointMatricesComponentManager || !meshComponentManagerPtr) {
-        return result;
-    }
-    auto const& meshComponentManager = *meshComponentManagerPtr;
-
-    auto const invDir = DirectionVectorInverse(direction);
-    float distance = 0;
-    for (IComponentManager::ComponentId i = 0; i < renderMeshComponentManager->GetComponentCount(); i++) {
-        const Entity id = renderMeshComponentManager->GetEntity(i);
-        if (auto node = nodeSystem->GetNode(id); node) {
-            if (layerComponentManager->Get(id).layerMask & layerMask) {
-                if (const auto jointMatrices = jointMatricesComponentManager->Read(id); jointMatrices) {
-                    // Use the skinned aabb's.
-                    const auto& jointMatricesComponent = *jointMatrices;
-                    if (IntersectAabb(jointMatricesComponent.jointsAabbMin,
-                            jointMatricesComponent.jointsAabbMax,
-                            start,
-                            invDir,
-                            distance)) {
-                        const float centerDistance = Math::Magnitude(
-                            (jointMatricesComponent.jointsAabbMax + jointMatricesComponent.jointsAabbMin) * 0.5f -
-                            start);
-                        const Math::Vec3 hitPosition = start + direction * distance;
-                        result.push_back(RayCastResult{node, centerDistance, distance, hitPosition});
-                    }
-                } else {
-                    if (const auto worldMatrixId = worldMatrixComponentManager->GetComponentId(id);
-                        worldMatrixId != IComponentManager::INVALID_COMPONENT_ID) {
-                        auto const renderMeshComponent = renderMeshComponentManager->Get(i);
-                        if (const auto meshHandle = meshComponentManager.Read(renderMeshComponent.mesh); meshHandle) {
-                            auto const worldMatrixComponent = worldMatrixComponentManager->Get(worldMatrixId);
-                            const auto raycastResult =
-                                HitTestNode(*node, *meshHandle, worldMatrixComponent.matrix, start, invDir);
-                            if (raycastResult.node) {
-                                result.push_back(raycastResult);
-                            }
-                        } else {
-                            PLUGIN_LOG_W("no mesh resource for entity %" PRIx64 ", resource %" PRIx64,
-                                id.id,
-                                renderMeshComponent.mesh.id);
-                        }
-                    }
-                }
-            }
-        }
+    if (!GetManager<ILayerComponentManager>(ecs)) {
+        return {};
     }
-
-    std::sort(
-        result.begin(), result.end(), [](const auto& lhs, const auto& rhs) { return (lhs.distance < rhs.distance); });
-
-    return result;
+    return RayCastBounds(ecs, start, direction, true, layerMask);
 }
 
 BASE_NS::vector<RayTriangleCastResult> Core3D::Picking::RayCast(const BASE_NS::Math::Vec3& start,
@@ -601,6 +545,95 @@ BASE_NS::vector<RayTriangleCastResult> Core3D::Picking::RayCastFromCamera(CORE_N
     return BASE_NS::vector<RayTriangleCastResult>();
 }
 
+vector<RayMeshCastResult> Picking::RayCastMeshes(
+    const IEcs& ecs, const Math::Vec3& start, const Math::Vec3& direction, uint64_t layerMask) const
+{
+    vector<RayMeshCastResult> result;
+
+    auto* const nodeSystem = GetSystem<INodeSystem>(ecs);
+    auto* const meshManager = GetManager<IMeshComponentManager>(ecs);
+    if (!nodeSystem || !meshManager) {
+        return result;
+    }
+    const auto scene = GetSceneBvh(ecs);
+    if (!scene) {
+        return result;
+    }
+
+    const auto invDir = DirectionVectorInverse(direction);
+    scene->bvh.Traverse(
+        [&start, &invDir](const Bvh::Node& node) {
+            float distance = 0.0f;
+            return IntersectAabb(node.min, node.max, start, invDir, distance) ? Bvh::Containment::INTERSECTS
+                                                                              : Bvh::Containment::OUTSIDE;
+        },
+        [&](const uint32_t index, bool) {
+            const auto& instance = scene->instances[index];
+            // Picking data is in bind pose, so skinned meshes can't be tested.
+            if (instance.skinned || !(instance.layerMask & layerMask)) {
+                return;
+            }
+            ISceneNode* node = nodeSystem->GetNode(instance.entity);
+            const auto meshId = meshManager->GetComponentId(instance.mesh);
+            if (!node || (meshId == IComponentManager::INVALID_COMPONENT_ID)) {
+                return;
+            }
+            shared_ptr<const MeshData> meshData;
+            if (const auto meshHandle = meshManager->Read(meshId); meshHandle && !meshHandle->pickingIndices.empty()) {
+                meshData = GetMeshData(ecs, instance.mesh, *meshHandle, meshManager->GetComponentGeneration(meshId));
+            }
+            if (!meshData) {
+                return;
+            }
+            // Test in mesh space, the distance along the ray stays the same.
+            float determinant = 0.0f;
+            const Math::Mat4X4 toMesh = Math::Inverse(instance.world, determinant);
+            const Math::Vec3 meshStart = Math::MultiplyPoint3X4(toMesh, start);
+            const Math::Vec3 meshDirection = Math::MultiplyVector(toMesh, direction);
+            // Mirroring transforms reverse the winding.
+            MeshBvh::Hit hit;
+            if (meshData->bvh.RayCast(
+                    meshStart, meshDirection, determinant < 0.0f, std::numeric_limits<float>::max(), hit)) {
+                const auto& firstTriangles = meshData->submeshFirstTriangles;
+                const auto submeshIndex = static_cast<uint32_t>(
+                    std::upper_bound(firstTriangles.cbegin(), firstTriangles.cend(), hit.triangle) -
+                    firstTriangles.cbegin() - 1);
+                result.push_back(RayMeshCastResult{node,
+                    hit.distance,
+                    start + direction * hit.distance,
+                    hit.uv,
+                    submeshIndex,
+                    hit.triangle - firstTriangles[submeshIndex]});
+            }
+        });
+
+    std::sort(
+        result.begin(), result.end(), [](const auto& lhs, const auto& rhs) { return (lhs.distance < rhs.distance); });
+
+    return result;
+}
+
+vector<RayMeshCastResult> Picking::RayCastMeshesFromCamera(
+    IEcs const& ecs, Entity camera, const Math::Vec2& screenPos, uint64_t layerMask) const
+{
+    const auto* worldMatrixManager = GetManager<IWorldMatrixComponentManager>(ecs);
+    const auto* cameraManager = GetManager<ICameraComponentManager>(ecs);
+    if (!worldMatrixManager || !cameraManager) {
+        return vector<RayMeshCastResult>();
+    }
+
+    const auto wmcId = worldMatrixManager->GetComponentId(camera);
+    const auto ccId = cameraManager->GetComponentId(camera);
+    if (wmcId != IComponentManager::INVALID_COMPONENT_ID && ccId != IComponentManager::INVALID_COMPONENT_ID) {
+        const auto cameraComponent = cameraManager->Read(ccId);
+        const auto worldMatrixComponent = worldMatrixManager->Get(wmcId);
+        const Ray ray = RayFromCamera(*cameraComponent, worldMatrixComponent, screenPos);
+        return RayCastMeshes(ecs, ray.origin, ray.direction, layerMask);
+    }
+
+    return vector<RayMeshCastResult>();
+}
+
 MinAndMax Picking::GetWorldAABB(const Math::Mat4X4& world, const Math::Vec3& aabbMin, const Math::Vec3& aabbMax) const
 {
     return CORE3D_NS::GetWorldAABB(world, aabbMin, aabbMax);
@@ -666,4 +699,180 @@ void Picking::Ref()
 
 void Picking::Unref()
 {}
+
+vector<RayCastResult> Picking::RayCastBounds(
+    const IEcs& ecs, const Math::Vec3& start, const Math::Vec3& direction, bool useLayerMask, uint64_t layerMask) const
+{
+    vector<RayCastResult> result;
+
+    auto* const nodeSystem = GetSystem<INodeSystem>(ecs);
+    auto* const meshManager = GetManager<IMeshComponentManager>(ecs);
+    if (!nodeSystem || !meshManager) {
+        return result;
+    }
+    const auto scene = GetSceneBvh(ecs);
+    if (!scene) {
+        return result;
+    }
+
+    const auto invDir = DirectionVectorInverse(direction);
+    scene->bvh.Traverse(
+        [&start, &invDir](const Bvh::Node& node) {
+            float distance = 0.0f;
+            return IntersectAabb(node.min, node.max, start, invDir, distance) ? Bvh::Containment::INTERSECTS
+                                                                              : Bvh::Containment::OUTSIDE;
+        },
+        [&](const uint32_t index, bool) {
+            const auto& instance = scene->instances[index];
+            if (useLayerMask && !(instance.layerMask & layerMask)) {
+                return;
+            }
+            ISceneNode* node = nodeSystem->GetNode(instance.entity);
+            if (!node) {
+                return;
+            }
+            if (instance.skinned) {
+                // Use the skinned aabb's.
+                const auto& bounds = scene->bounds[index];
+                float distance = 0.0f;
+                if (IntersectAabb(bounds.min, bounds.max, start, invDir, distance)) {
+                    const float centerDistance = Math::Magnitude((bounds.max + bounds.min) * 0.5f - start);
+                    const Math::Vec3 hitPosition = start + direction * distance;
+                    result.push_back(RayCastResult{node, centerDistance, distance, hitPosition});
+                }
+            } else if (const auto meshHandle = meshManager->Read(instance.mesh); meshHandle) {
+                const auto raycastResult = HitTestNode(*node, *meshHandle, instance.world, start, invDir);
+                if (raycastResult.node) {
+                    result.push_back(raycastResult);
+                }
+            }
+        });
+
+    std::sort(
+        result.begin(), result.end(), [](const auto& lhs, const auto& rhs) { return (lhs.distance < rhs.distance); });
+
+    return result;
+}
+
+shared_ptr<const Picking::SceneBvh> Picking::GetSceneBvh(const IEcs& ecs) const
+{
+    auto* const renderMeshManager = GetManager<IRenderMeshComponentManager>(ecs);
+    auto* const worldMatrixManager = GetManager<IWorldMatrixComponentManager>(ecs);
+    auto* const jointMatricesManager = GetManager<IJointMatricesComponentManager>(ecs);
+    auto* const meshManager = GetManager<IMeshComponentManager>(ecs);
+    auto* const layerManager = GetManager<ILayerComponentManager>(ecs);
+    if (!renderMeshManager || !worldMatrixManager || !jointMatricesManager || !meshManager) {
+        return {};
+    }
+    const uint32_t generations[] = {renderMeshManager->GetGenerationCounter(),
+        worldMatrixManager->GetGenerationCounter(), jointMatricesManager->GetGenerationCounter(),
+        meshManager->GetGenerationCounter(), layerManager ? layerManager->GetGenerationCounter() : 0U};
+    static_assert(sizeof(generations) == sizeof(EcsCache::generations));
+
+    std::lock_guard lock(cacheMutex_);
+    EcsCache& cache = GetEcsCache(ecs);
+    if (cache.scene && std::equal(std::begin(generations), std::end(generations), std::begin(cache.generations))) {
+        return cache.scene;
+    }
+
+    auto scene = make_shared<SceneBvh>();
+    const auto componentCount = renderMeshManager->GetComponentCount();
+    scene->instances.reserve(componentCount);
+    scene->bounds.reserve(componentCount);
+    for (IComponentManager::ComponentId i = 0; i < componentCount; i++) {
+        const Entity id = renderMeshManager->GetEntity(i);
+        const uint64_t instanceLayerMask =
+            layerManager ? layerManager->Get(id).layerMask : LayerConstants::DEFAULT_LAYER_MASK;
+        if (const auto jointMatrices = jointMatricesManager->Read(id); jointMatrices) {
+            scene->instances.push_back({Math::IDENTITY_4X4, id, {}, instanceLayerMask, true});
+            scene->bounds.push_back({jointMatrices->jointsAabbMin, jointMatrices->jointsAabbMax});
+        } else if (const auto worldMatrixId = worldMatrixManager->GetComponentId(id);
+                   worldMatrixId != IComponentManager::INVALID_COMPONENT_ID) {
+            const Entity mesh = renderMeshManager->Read(i)->mesh;
+            if (const auto meshHandle = meshManager->Read(mesh); meshHandle) {
+                const Math::Mat4X4 world = worldMatrixManager->Get(worldMatrixId).matrix;
+                const MinAndMax meshMinMax = CORE3D_NS::GetWorldAABB(world, meshHandle->aabbMin, meshHandle->aabbMax);
+                scene->instances.push_back({world, id, mesh, instanceLayerMask, false});
+                scene->bounds.push_back({meshMinMax.minAABB, meshMinMax.maxAABB});
+            } else {
+                PLUGIN_LOG_W("no mesh resource for entity %" PRIx64 ", resource %" PRIx64, id.id, mesh.id);
+            }
+        }
+    }
+    scene->bvh.Build(scene->bounds);
+
+    // Keep the triangle hierarchies of the meshes which are still rendered.
+    unordered_map<Entity, EcsCache::MeshEntry> meshes;
+    for (const auto& instance : scene->instances) {
+        if (const auto pos = cache.meshes.find(instance.mesh); pos != cache.meshes.end()) {
+            meshes.insert({instance.mesh, pos->second});
+        }
+    }
+    cache.meshes = BASE_NS::move(meshes);
+    std::copy(std::begin(generations), std::end(generations), std::begin(cache.generations));
+    cache.scene = scene;
+    return scene;
+}
+
+shared_ptr<const Picking::MeshData> Picking::GetMeshData(
+    const IEcs& ecs, Entity meshEntity, const MeshComponent& mesh, uint32_t generation) const
+{
+    std::lock_guard lock(cacheMutex_);
+    EcsCache& cache = GetEcsCache(ecs);
+    if (const auto pos = cache.meshes.find(meshEntity);
+        (pos != cache.meshes.end()) && (pos->second.generation == generation)) {
+        return pos->second.data;
+    }
+
+    vector<uint32_t> submeshFirstTriangles;
+    submeshFirstTriangles.reserve(mesh.submeshes.size());
+    size_t indexCount = 0U;
+    for (const auto& submesh : mesh.submeshes) {
+        submeshFirstTriangles.push_back(static_cast<uint32_t>(indexCount / 3U));
+        indexCount += GetPickingIndexCount(submesh);
+    }
+    shared_ptr<MeshData> data;
+    if (indexCount == mesh.pickingIndices.size()) {
+        data = make_shared<MeshData>();
+        data->bvh.Build(mesh.pickingPositions, mesh.pickingIndices);
+        data->submeshFirstTriangles = BASE_NS::move(submeshFirstTriangles);
+    } else {
+        PLUGIN_LOG_W("picking data doesn't match the submeshes of mesh %" PRIx64, meshEntity.id);
+    }
+    // Invalid data is cached as well to warn only once per change.
+    cache.meshes[meshEntity] = EcsCache::MeshEntry{generation, data};
+    return data;
+}
+
+Picking::EcsCache& Picking::GetEcsCache(const IEcs& ecs) const
+{
+    ++cacheUseCounter_;
+    size_t index = 0U;
+    while ((index < caches_.size()) && (caches_[index]->ecs != &ecs)) {
+        ++index;
+    }
+    if (index == caches_.size()) {
+        if (caches_.size() < MAX_CACHED_ECS_COUNT) {
+            caches_.emplace_back();
+        } else {
+            index = 0U;
+            for (size_t i = 1U; i < caches_.size(); ++i) {
+                if (caches_[i]->lastUse < caches_[index]->lastUse) {
+                    index = i;
+                }
+            }
+            caches_[index].reset();
+        }
+    } else if (caches_[index]->ecsId != ecs.GetId()) {
+        // The cached ECS was destroyed and another one was created at the same address.
+        caches_[index].reset();
+    }
+    if (!caches_[index]) {
+        caches_[index] = make_unique<EcsCache>();
+        caches_[index]->ecs = &ecs;
+        caches_[index]->ecsId = ecs.GetId();
+    }
+    caches_[index]->lastUse = cacheUseCounter_;
+    return *caches_[index];
+}
 CORE3D_END_NAMESPACE()
@@ -15,8 +15,14 @@
 #ifndef CORE_UTIL_PICKING_H
 #define CORE_UTIL_PICKING_H
 
+#include <cstdint>
+#include <mutex>
+
 #include <3d/util/intf_picking.h>
+#include <base/containers/shared_ptr.h>
 #include <base/containers/string_view.h>
+#include <base/containers/unique_ptr.h>
+#include <base/containers/vector.h>
 #include <core/namespace.h>
 
 CORE_BEGIN_NAMESPACE()
@@ -35,8 +41,8 @@ struct MeshComponent;
 
 class Picking : public IPicking {
 public:
-    Picking() = default;
-    ~Picking() override = default;
+    Picking();
+    ~Picking() override;
     BASE_NS::Math::Vec3 ScreenToWorld(
         CORE_NS::IEcs const& ecs, CORE_NS::Entity cameraEntity, BASE_NS::Math::Vec3 screenCoordinate) const override;
 
@@ -57,6 +63,11 @@ public:
     BASE_NS::vector<RayTriangleCastResult> RayCastFromCamera(CORE_NS::IEcs const& ecs, CORE_NS::Entity camera,
         const BASE_NS::Math::Vec2& screenPos, BASE_NS::array_view<const BASE_NS::Math::Vec3> triangles) const override;
 
+    BASE_NS::vector<RayMeshCastResult> RayCastMeshes(CORE_NS::IEcs const& ecs, const BASE_NS::Math::Vec3& start,
+        const BASE_NS::Math::Vec3& direction, uint64_t layerMask) const override;
+    BASE_NS::vector<RayMeshCastResult> RayCastMeshesFromCamera(CORE_NS::IEcs const& ecs, CORE_NS::Entity camera,
+        const BASE_NS::Math::Vec2& screenPos, uint64_t layerMask) const override;
+
     MinAndMax GetWorldAABB(const BASE_NS::Math::Mat4X4& world, const BASE_NS::Math::Vec3& aabbMin,
         const BASE_NS::Math::Vec3& aabbMax) const override;
 
@@ -88,6 +99,27 @@ protected:
         }
         return invDir;
     }
+
+private:
+    struct SceneBvh;
+    struct MeshData;
+    struct EcsCache;
+
+    // Ray casts against the render meshes, layerMask is ignored when useLayerMask is false.
+    BASE_NS::vector<RayCastResult> RayCastBounds(CORE_NS::IEcs const& ecs, const BASE_NS::Math::Vec3& start,
+        const BASE_NS::Math::Vec3& direction, bool useLayerMask, uint64_t layerMask) const;
+
+    // Hierarchy over the world bounds of the render meshes, rebuilt when the relevant components have changed.
+    BASE_NS::shared_ptr<const SceneBvh> GetSceneBvh(CORE_NS::IEcs const& ecs) const;
+    // Triangle hierarchy of a mesh, rebuilt when the mesh component has changed. Null if the mesh has no picking data.
+    BASE_NS::shared_ptr<const MeshData> GetMeshData(
+        CORE_NS::IEcs const& ecs, CORE_NS::Entity meshEntity, const MeshComponent& mesh, uint32_t generation) const;
+    EcsCache& GetEcsCache(CORE_NS::IEcs const& ecs) const;
+
+    // Picking is shared by everyone using the render context, caches of a few ECSs are kept.
+    mutable std::mutex cacheMutex_;
+    mutable BASE_NS::vector<BASE_NS::unique_ptr<EcsCache>> caches_;
+    mutable uint64_t cacheUseCounter_{0};
 };
 
 inline constexpr BASE_NS::string_view GetName(const IPicking*)
@@ -65,6 +65,7 @@
 #include <render/intf_render_context.h>
 
 #include "uri_lookup.h"
+#include "util/animation_compression.h"
 #include "util/component_util_functions.h"
 #include "util/log.h"
 
@@ -535,6 +536,13 @@ vector<Entity> UpdateTracks(IEcs& ecs, array_view<EntityReference> targetTracks,
                             dstOutput->type = srcOutput->type;
                             auto& dst = dstOutput->data;
                             const auto& src = srcOutput->data;
+                            if (srcOutput->encoding == AnimationOutputComponent::Encoding::QUANTIZED) {
+                                // quantized positions are corrected by scaling the quantization range.
+                                dst = src;
+                                dstOutput->encoding = srcOutput->encoding;
+                                AnimationCompression::Scale(dst, scale);
+                                return dstTrackEntity;
+                            }
                             dst.resize(src.size());
                             const auto count = dst.size() / sizeof(Math::Vec3);
                             const auto srcPositions =
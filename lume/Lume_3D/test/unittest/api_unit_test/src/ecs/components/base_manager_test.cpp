@@ -51,6 +51,7 @@
 #include <3d/ecs/components/water_ripple_component.h>
 #include <3d/ecs/components/weather_component.h>
 #include <3d/ecs/components/world_matrix_component.h>
+#include <base/containers/vector.h>
 #include <base/math/vector_util.h>
 #include <core/ecs/intf_entity_manager.h>
 #include <core/intf_engine.h>
@@ -158,6 +159,41 @@ void BaseManagerIPropertyApiTest(BASE_NS::string componentName)
         ASSERT_EQ(nullptr, propertyApi.MetaData(propertyCount));
     }
 }
+
+template <typename ComponentType, typename ManagerType>
+void BaseManagerComponentsTest()
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto ecs = testContext->ecs;
+    auto& entityManager = ecs->GetEntityManager();
+
+    auto baseManager = GetManager<ManagerType>(*ecs);
+    vector<Entity> entities;
+    for (uint32_t i = 0; i < 10u; ++i) {
+        entities.push_back(entityManager.Create());
+        baseManager->Create(entities.back());
+    }
+    baseManager->Destroy(entities[3u]);
+    baseManager->Destroy(entities[5u]);
+    baseManager->Gc();
+
+    // The view covers all the components in ComponentId order and shares the storage with the handles.
+    auto components = baseManager->GetComponents();
+    ASSERT_EQ(baseManager->GetComponentCount(), components.size());
+    for (IComponentManager::ComponentId id = 0; id < components.size(); ++id) {
+        auto handle = baseManager->Read(id);
+        ASSERT_TRUE(handle);
+        EXPECT_EQ(&components[id], &*handle);
+        EXPECT_EQ(id, baseManager->GetComponentId(baseManager->GetEntity(id)));
+    }
+    EXPECT_FALSE(baseManager->HasComponent(entities[3u]));
+    EXPECT_FALSE(baseManager->HasComponent(entities[5u]));
+    for (const auto& entity : entities) {
+        baseManager->Destroy(entity);
+    }
+    baseManager->Gc();
+    EXPECT_TRUE(baseManager->GetComponents().empty());
+}
 }  // namespace
 
 /**
@@ -371,6 +407,15 @@ UNIT_TEST(API_EcsJointMatricesComponent, IPropertyApiTest, testing::ext::TestSiz
 {
     BaseManagerIPropertyApiTest<JointMatricesComponent, IJointMatricesComponentManager>("JointMatricesComponent");
 }
+/**
+ * @tc.name: ComponentsTest
+ * @tc.desc: Tests for the contiguous component view.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsJointMatricesComponent, ComponentsTest, testing::ext::TestSize.Level1)
+{
+    BaseManagerComponentsTest<JointMatricesComponent, IJointMatricesComponentManager>();
+}
 
 /**
  * @tc.name: CreateTest
@@ -428,6 +473,15 @@ UNIT_TEST(API_EcsLocalMatrixComponent, IPropertyApiTest, testing::ext::TestSize.
 {
     BaseManagerIPropertyApiTest<LocalMatrixComponent, ILocalMatrixComponentManager>("LocalMatrixComponent");
 }
+/**
+ * @tc.name: ComponentsTest
+ * @tc.desc: Tests for the contiguous component view.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsLocalMatrixComponent, ComponentsTest, testing::ext::TestSize.Level1)
+{
+    BaseManagerComponentsTest<LocalMatrixComponent, ILocalMatrixComponentManager>();
+}
 
 /**
  * @tc.name: CreateTest
@@ -852,4 +906,13 @@ UNIT_TEST(API_EcsWorldMatrixComponent, CreateTest, testing::ext::TestSize.Level1
 UNIT_TEST(API_EcsWorldMatrixComponent, IPropertyApiTest, testing::ext::TestSize.Level1)
 {
     BaseManagerIPropertyApiTest<WorldMatrixComponent, IWorldMatrixComponentManager>("WorldMatrixComponent");
+}
+/**
+ * @tc.name: ComponentsTest
+ * @tc.desc: Tests for the contiguous component view.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsWorldMatrixComponent, ComponentsTest, testing::ext::TestSize.Level1)
+{
+    BaseManagerComponentsTest<WorldMatrixComponent, IWorldMatrixComponentManager>();
 }
\ No newline at end of file
@@ -642,6 +642,71 @@ UNIT_TEST(API_EcsNodeSystem, EffectivelyEnabledTest, testing::ext::TestSize.Leve
     }
 }
 
+/**
+ * @tc.name: WideHierarchyWorldMatrixTest
+ * @tc.desc: Tests world matrix propagation in a hierarchy large enough to be updated in multiple tasks.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_EcsNodeSystem, WideHierarchyWorldMatrixTest, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto ecs = testContext->ecs;
+
+    auto wcm = GetManager<IWorldMatrixComponentManager>(*ecs);
+    ASSERT_NE(nullptr, wcm);
+    auto nodeSystem = GetSystem<INodeSystem>(*ecs);
+    ASSERT_NE(nullptr, nodeSystem);
+
+    constexpr uint32_t childCount = 2000U;
+    auto root = nodeSystem->CreateNode();
+    root->SetPosition(BASE_NS::Math::Vec3(0.f, 1.f, 0.f));
+    BASE_NS::vector<ISceneNode*> children;
+    BASE_NS::vector<ISceneNode*> grandChildren;
+    for (uint32_t i = 0U; i < childCount; ++i) {
+        auto child = nodeSystem->CreateNode();
+        child->SetPosition(BASE_NS::Math::Vec3(static_cast<float>(i), 0.f, 0.f));
+        child->SetParent(*root);
+        children.push_back(child);
+        auto grandChild = nodeSystem->CreateNode();
+        grandChild->SetPosition(BASE_NS::Math::Vec3(0.f, 0.f, 1.f));
+        grandChild->SetParent(*child);
+        grandChildren.push_back(grandChild);
+    }
+
+    ecs->ProcessEvents();
+    ecs->Update(1u, 1u);
+    ecs->ProcessEvents();
+    for (uint32_t i = 0U; i < childCount; ++i) {
+        EXPECT_EQ(wcm->Get(grandChildren[i]->GetEntity()).matrix.w,
+            BASE_NS::Math::Vec4(static_cast<float>(i), 1.f, 1.f, 1.f));
+    }
+
+    // Move the root and some of the children during the same frame.
+    root->SetPosition(BASE_NS::Math::Vec3(0.f, 2.f, 0.f));
+    for (uint32_t i = 0U; i < childCount; i += 10U) {
+        children[i]->SetPosition(BASE_NS::Math::Vec3(static_cast<float>(i), 0.f, 2.f));
+    }
+    ecs->ProcessEvents();
+    ecs->Update(2u, 1u);
+    ecs->ProcessEvents();
+    for (uint32_t i = 0U; i < childCount; ++i) {
+        const float z = (i % 10U) ? 1.f : 3.f;
+        EXPECT_EQ(
+            wcm->Get(grandChildren[i]->GetEntity()).matrix.w, BASE_NS::Math::Vec4(static_cast<float>(i), 2.f, z, 1.f));
+    }
+
+    // Disabled subtrees are not updated.
+    root->SetEnabled(false);
+    root->SetPosition(BASE_NS::Math::Vec3(0.f, 3.f, 0.f));
+    ecs->ProcessEvents();
+    ecs->Update(3u, 1u);
+    ecs->ProcessEvents();
+    EXPECT_EQ(wcm->Get(grandChildren[1U]->GetEntity()).matrix.w, BASE_NS::Math::Vec4(1.f, 2.f, 1.f, 1.f));
+    EXPECT_FALSE(grandChildren[1U]->GetEffectivelyEnabled());
+
+    nodeSystem->DestroyNode(*root);
+}
+
 /**
  * @tc.name: AddChild
  * @tc.desc: Tests for Add Child. [AUTO-GENERATED]
@@ -25,6 +25,8 @@
 #include <3d/ecs/components/world_matrix_component.h>
 #include <3d/ecs/systems/intf_node_system.h>
 #include <3d/implementation_uids.h>
+#include <3d/render/default_material_constants.h>
+#include <3d/util/intf_mesh_builder.h>
 #include <3d/util/intf_mesh_util.h>
 #include <3d/util/intf_picking.h>
 #include <3d/util/intf_scene_util.h>
@@ -35,12 +37,15 @@
 #include <base/math/vector_util.h>
 #include <core/ecs/intf_entity_manager.h>
 #include <core/intf_engine.h>
+#include <core/plugin/intf_class_factory.h>
 #include <core/plugin/intf_class_register.h>
 #include <core/plugin/intf_plugin.h>
 #include <core/property/intf_property_api.h>
 #include <core/property/intf_property_handle.h>
 #include <core/property/property_types.h>
 #include <render/datastore/intf_render_data_store_manager.h>
+#include <render/device/intf_device.h>
+#include <render/device/intf_shader_manager.h>
 #include <render/implementation_uids.h>
 
 #include "test_framework.h"
@@ -457,6 +462,125 @@ UNIT_TEST(API_UtilPicking, RayTriangleCastTest, testing::ext::TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: RayMeshCastTest
+ * @tc.desc: Tests for Ray Mesh Cast Test. Casts against the picking data of a mesh with an indexed and a non-indexed
+ * submesh.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(API_UtilPicking, RayMeshCastTest, testing::ext::TestSize.Level1)
+{
+    UTest::TestContext* testContext = UTest::GetTestContext();
+    auto renderContext = testContext->renderContext;
+    auto ecs = testContext->ecs;
+
+    auto picking = GetInstance<IPicking>(*renderContext->GetInterface<IClassRegister>(), UID_PICKING);
+    ASSERT_NE(nullptr, picking);
+    auto nodeSystem = GetSystem<INodeSystem>(*ecs);
+    ASSERT_NE(nullptr, nodeSystem);
+    auto renderMeshManager = GetManager<IRenderMeshComponentManager>(*ecs);
+    ASSERT_NE(nullptr, renderMeshManager);
+    auto meshManager = GetManager<IMeshComponentManager>(*ecs);
+    ASSERT_NE(nullptr, meshManager);
+
+    // Two quads facing +z, the first one at z = 0 with indices and the second one at z = -1 without.
+    const Math::Vec3 quad[] = {{-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {-1.0f, 1.0f, 0.0f}};
+    const uint16_t quadIndices[] = {0U, 1U, 2U, 0U, 2U, 3U};
+    vector<Math::Vec3> positions0(quad, quad + countof(quad));
+    vector<Math::Vec3> positions1;
+    for (const auto index : quadIndices) {
+        positions1.push_back(quad[index] + Math::Vec3(0.0f, 0.0f, -1.0f));
+    }
+
+    auto meshBuilder = CreateInstance<IMeshBuilder>(*renderContext, UID_MESH_BUILDER);
+    ASSERT_TRUE(meshBuilder);
+    IShaderManager& shaderManager = renderContext->GetDevice().GetShaderManager();
+    const VertexInputDeclarationView vertexInputDeclaration =
+        shaderManager.GetVertexInputDeclarationView(shaderManager.GetVertexInputDeclarationHandle(
+            DefaultMaterialShaderConstants::VERTEX_INPUT_DECLARATION_FORWARD));
+    meshBuilder->Initialize({vertexInputDeclaration, 2U, IMeshBuilder::ConfigurationFlagBits::PICKING_DATA});
+    IMeshBuilder::Submesh submesh;
+    submesh.vertexCount = static_cast<uint32_t>(positions0.size());
+    submesh.indexCount = static_cast<uint32_t>(countof(quadIndices));
+    submesh.indexType = CORE_INDEX_TYPE_UINT16;
+    meshBuilder->AddSubmesh(submesh);
+    submesh.vertexCount = static_cast<uint32_t>(positions1.size());
+    submesh.indexCount = 0U;
+    meshBuilder->AddSubmesh(submesh);
+    meshBuilder->Allocate();
+    const IMeshBuilder::DataBuffer positionData0{BASE_FORMAT_R32G32B32_SFLOAT, sizeof(Math::Vec3),
+        {reinterpret_cast<const uint8_t*>(positions0.data()), positions0.size() * sizeof(Math::Vec3)}};
+    const IMeshBuilder::DataBuffer positionData1{BASE_FORMAT_R32G32B32_SFLOAT, sizeof(Math::Vec3),
+        {reinterpret_cast<const uint8_t*>(positions1.data()), positions1.size() * sizeof(Math::Vec3)}};
+    meshBuilder->SetVertexData(0U, positionData0, {}, {}, {}, {}, {});
+    meshBuilder->CalculateAABB(0U, positionData0);
+    meshBuilder->SetIndexData(0U,
+        {BASE_FORMAT_R16_UINT, sizeof(uint16_t), {reinterpret_cast<const uint8_t*>(quadIndices), sizeof(quadIndices)}});
+    meshBuilder->SetVertexData(1U, positionData1, {}, {}, {}, {}, {});
+    meshBuilder->CalculateAABB(1U, positionData1);
+    meshBuilder->CreateGpuResources();
+    const Entity mesh = meshBuilder->CreateMesh(*ecs);
+    if (auto meshHandle = meshManager->Read(mesh); meshHandle) {
+        EXPECT_EQ(10U, meshHandle->pickingPositions.size());
+        EXPECT_EQ(12U, meshHandle->pickingIndices.size());
+    }
+
+    // Far from the other tests' nodes.
+    const Math::Vec3 position{100.0f, 0.0f, 0.0f};
+    auto node = nodeSystem->CreateNode();
+    renderMeshManager->Create(node->GetEntity());
+    renderMeshManager->Write(node->GetEntity())->mesh = mesh;
+    SetWorldMatrixFromPosition(node->GetEntity(), *ecs, position);
+
+    const auto layerMask = LayerConstants::DEFAULT_LAYER_MASK;
+    {
+        // The first quad is closer.
+        const auto result = picking->RayCastMeshes(*ecs, position + Math::Vec3(0.5f, 0.25f, 5.0f),
+            Math::Vec3(0.0f, 0.0f, -1.0f), layerMask);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ(node, result[0].node);
+        EXPECT_EQ(0U, result[0].submeshIndex);
+        EXPECT_EQ(0U, result[0].triangleIndex);
+        EXPECT_NEAR(5.0f, result[0].distance, 0.0001f);
+        EXPECT_NEAR(100.5f, result[0].worldPosition.x, 0.0001f);
+        EXPECT_NEAR(0.25f, result[0].worldPosition.y, 0.0001f);
+        EXPECT_NEAR(0.0f, result[0].worldPosition.z, 0.0001f);
+        EXPECT_NEAR(0.125f, result[0].hitUv.x, 0.0001f);
+        EXPECT_NEAR(0.625f, result[0].hitUv.y, 0.0001f);
+    }
+    {
+        // Starting between the quads only the second one is ahead.
+        const auto result = picking->RayCastMeshes(*ecs, position + Math::Vec3(-0.5f, 0.25f, -0.5f),
+            Math::Vec3(0.0f, 0.0f, -1.0f), layerMask);
+        ASSERT_EQ(1, result.size());
+        EXPECT_EQ(1U, result[0].submeshIndex);
+        EXPECT_EQ(1U, result[0].triangleIndex);
+        EXPECT_NEAR(0.5f, result[0].distance, 0.0001f);
+    }
+    {
+        // Back faces and other layers aren't hit.
+        EXPECT_EQ(0, picking->RayCastMeshes(*ecs, position + Math::Vec3(0.5f, 0.25f, -5.0f),
+            Math::Vec3(0.0f, 0.0f, 1.0f), layerMask).size());
+        EXPECT_EQ(0, picking->RayCastMeshes(*ecs, position + Math::Vec3(0.5f, 0.25f, 5.0f),
+            Math::Vec3(0.0f, 0.0f, -1.0f), ~layerMask).size());
+    }
+    {
+        // Moving the node rebuilds the scene hierarchy.
+        SetWorldMatrixFromPosition(node->GetEntity(), *ecs, position + Math::Vec3(0.0f, 10.0f, 0.0f));
+        EXPECT_EQ(0, picking->RayCastMeshes(*ecs, position + Math::Vec3(0.5f, 0.25f, 5.0f),
+            Math::Vec3(0.0f, 0.0f, -1.0f), layerMask).size());
+        // Without picking data only the bounds can be hit.
+        if (auto meshHandle = meshManager->Write(mesh); meshHandle) {
+            meshHandle->pickingIndices.clear();
+        }
+        EXPECT_EQ(0, picking->RayCastMeshes(*ecs, position + Math::Vec3(0.5f, 10.25f, 5.0f),
+            Math::Vec3(0.0f, 0.0f, -1.0f), layerMask).size());
+        EXPECT_EQ(1, picking->RayCast(*ecs, position + Math::Vec3(0.5f, 10.25f, 5.0f),
+            Math::Vec3(0.0f, 0.0f, -1.0f)).size());
+    }
+    nodeSystem->DestroyNode(*node);
+}
+
 /**
  * @tc.name: WorldAndScreenCoordinatesTest
  * @tc.desc: Tests for World And Screen Coordinates Test. [AUTO-GENERATED]
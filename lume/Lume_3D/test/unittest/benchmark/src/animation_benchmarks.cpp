@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include <base/containers/vector.h>
+#include <base/math/quaternion_util.h>
+#include <base/math/vector_util.h>
+
+#include "util/keyframe_sampler.h"
+
+namespace benchmarks {
+namespace {
+using BASE_NS::vector;
+using CORE3D_NS::FindKeyframe;
+using CORE3D_NS::KeyframeSample;
+using CORE3D_NS::KeyframeSampler;
+namespace Math = BASE_NS::Math;
+
+constexpr uint32_t JOINT_COUNT = 60U;
+constexpr uint32_t KEYFRAME_COUNT = 60U;
+constexpr float FRAME_TIME = 1.0f / 30.0f;
+constexpr float DELTA_TIME = 1.0f / 60.0f;
+
+// Translation, rotation and scale track of each joint of each character, 30 fps keyframes for two seconds.
+struct Crowd {
+    vector<float> timestamps;
+    vector<Math::Vec3> translations;
+    vector<Math::Quat> rotations;
+    vector<Math::Vec3> scales;
+    // Per track initial values and results, track i of joint j is at j * 3 + i.
+    vector<Math::Vec4> initial;
+    vector<Math::Vec4> results;
+    vector<size_t> cursors;
+    // Characters start at different times.
+    vector<float> startTimes;
+    uint32_t joints;
+};
+
+Crowd CreateCrowd(uint32_t characters)
+{
+    std::mt19937 generator(1U);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    Crowd crowd;
+    crowd.joints = characters * JOINT_COUNT;
+    for (uint32_t i = 0U; i < KEYFRAME_COUNT; ++i) {
+        crowd.timestamps.push_back(static_cast<float>(i) * FRAME_TIME);
+    }
+    const size_t keyframes = static_cast<size_t>(crowd.joints) * KEYFRAME_COUNT;
+    crowd.translations.reserve(keyframes);
+    crowd.rotations.reserve(keyframes);
+    crowd.scales.reserve(keyframes);
+    for (size_t i = 0U; i < keyframes; ++i) {
+        crowd.translations.push_back({value(generator), value(generator), value(generator)});
+        crowd.rotations.push_back(
+            Math::Normalize(Math::Quat(value(generator), value(generator), value(generator), value(generator))));
+        crowd.scales.push_back(Math::Vec3(1.0f, 1.0f, 1.0f) + Math::Vec3(value(generator)) * 0.1f);
+    }
+    crowd.initial.resize(crowd.joints * 3U, Math::Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    crowd.results.resize(crowd.joints * 3U);
+    crowd.cursors.resize(crowd.joints * 3U, 0U);
+    std::uniform_real_distribution<float> start(0.0f, FRAME_TIME * static_cast<float>(KEYFRAME_COUNT - 1U));
+    for (uint32_t i = 0U; i < characters; ++i) {
+        crowd.startTimes.push_back(start(generator));
+    }
+    return crowd;
+}
+
+struct Frame {
+    size_t current;
+    size_t next;
+    float t;
+};
+
+Frame GetFrame(const vector<float>& timestamps, float time, size_t upperBound)
+{
+    const size_t next = std::min(upperBound, timestamps.size() - 1U);
+    const size_t current = upperBound ? (upperBound - 1U) : 0U;
+    const float t = (current != next) ? std::clamp(
+        (time - timestamps[current]) / (timestamps[next] - timestamps[current]), 0.0f, 1.0f) : 0.0f;
+    return {current, next, t};
+}
+
+float GetTime(const Crowd& crowd, uint32_t joint, float time)
+{
+    const float duration = FRAME_TIME * static_cast<float>(KEYFRAME_COUNT - 1U);
+    return std::fmod(crowd.startTimes[joint / JOINT_COUNT] + time, duration);
+}
+
+size_t UpperBound(const vector<float>& timestamps, float time)
+{
+    return static_cast<size_t>(std::upper_bound(timestamps.begin(), timestamps.end(), time) - timestamps.begin());
+}
+
+void CharacterCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(1000)->Arg(4000)->ArgName("characters")->Unit(benchmark::kMicrosecond);
+}
+}  // namespace
+
+// Keyframe search of all the tracks with a binary search per track.
+void FindKeyframesBinarySearch(benchmark::State& state)
+{
+    Crowd crowd = CreateCrowd(static_cast<uint32_t>(state.range(0)));
+    float time = 0.0f;
+    for (auto _ : state) {
+        for (uint32_t joint = 0U; joint < crowd.joints; ++joint) {
+            const float jointTime = GetTime(crowd, joint, time);
+            for (uint32_t track = 0U; track < 3U; ++track) {
+                crowd.cursors[joint * 3U + track] = UpperBound(crowd.timestamps, jointTime);
+            }
+        }
+        benchmark::DoNotOptimize(crowd.cursors.data());
+        time += DELTA_TIME;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * crowd.joints * 3);
+}
+
+// Keyframe search of all the tracks continuing from the previous frame's cursor.
+void FindKeyframesCursor(benchmark::State& state)
+{
+    Crowd crowd = CreateCrowd(static_cast<uint32_t>(state.range(0)));
+    float time = 0.0f;
+    for (auto _ : state) {
+        for (uint32_t joint = 0U; joint < crowd.joints; ++joint) {
+            const float jointTime = GetTime(crowd, joint, time);
+            for (uint32_t track = 0U; track < 3U; ++track) {
+                auto& cursor = crowd.cursors[joint * 3U + track];
+                cursor = FindKeyframe(crowd.timestamps, jointTime, cursor);
+            }
+        }
+        benchmark::DoNotOptimize(crowd.cursors.data());
+        time += DELTA_TIME;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * crowd.joints * 3);
+}
+
+// Keyframe search and interpolation of each track in turn, as before batching.
+void SampleTracksPerTrack(benchmark::State& state)
+{
+    Crowd crowd = CreateCrowd(static_cast<uint32_t>(state.range(0)));
+    float time = 0.0f;
+    for (auto _ : state) {
+        for (uint32_t joint = 0U; joint < crowd.joints; ++joint) {
+            const float jointTime = GetTime(crowd, joint, time);
+            const size_t keyframes = static_cast<size_t>(joint) * KEYFRAME_COUNT;
+            const size_t track = joint * 3U;
+            {
+                const Frame frame = GetFrame(crowd.timestamps, jointTime, UpperBound(crowd.timestamps, jointTime));
+                const Math::Vec3 value = Math::Lerp(crowd.translations[keyframes + frame.current],
+                    crowd.translations[keyframes + frame.next], frame.t);
+                crowd.results[track] = Math::Vec4(value - Math::Vec3(crowd.initial[track]), 0.0f);
+            }
+            {
+                const Frame frame = GetFrame(crowd.timestamps, jointTime, UpperBound(crowd.timestamps, jointTime));
+                const Math::Quat value = Math::Slerp(
+                    crowd.rotations[keyframes + frame.current], crowd.rotations[keyframes + frame.next], frame.t);
+                const auto& initial = crowd.initial[track + 1U];
+                const Math::Quat delta = Math::Normalize(Math::Slerp(Math::Quat(0.0f, 0.0f, 0.0f, 1.0f),
+                    value * Math::Inverse(Math::Quat(initial.x, initial.y, initial.z, initial.w)), 1.0f));
+                crowd.results[track + 1U] = Math::Vec4(delta.x, delta.y, delta.z, delta.w);
+            }
+            {
+                const Frame frame = GetFrame(crowd.timestamps, jointTime, UpperBound(crowd.timestamps, jointTime));
+                const Math::Vec3 value =
+                    Math::Lerp(crowd.scales[keyframes + frame.current], crowd.scales[keyframes + frame.next], frame.t);
+                crowd.results[track + 2U] = Math::Vec4(value - Math::Vec3(crowd.initial[track + 2U]), 0.0f);
+            }
+        }
+        benchmark::DoNotOptimize(crowd.results.data());
+        time += DELTA_TIME;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * crowd.joints * 3);
+}
+
+// Keyframe search with cursors and interpolation of the tracks grouped by type with KeyframeSampler.
+void SampleTracksBatched(benchmark::State& state)
+{
+    Crowd crowd = CreateCrowd(static_cast<uint32_t>(state.range(0)));
+    KeyframeSampler sampler;
+    float time = 0.0f;
+    for (auto _ : state) {
+        for (uint32_t joint = 0U; joint < crowd.joints; ++joint) {
+            const float jointTime = GetTime(crowd, joint, time);
+            const size_t keyframes = static_cast<size_t>(joint) * KEYFRAME_COUNT;
+            const size_t track = joint * 3U;
+            for (size_t i = 0U; i < 3U; ++i) {
+                auto& cursor = crowd.cursors[track + i];
+                cursor = FindKeyframe(crowd.timestamps, jointTime, cursor);
+                const Frame frame = GetFrame(crowd.timestamps, jointTime, cursor);
+                const float* values = (i == 0U)   ? &crowd.translations[keyframes].x
+                                      : (i == 1U) ? &crowd.rotations[keyframes].x
+                                                  : &crowd.scales[keyframes].x;
+                const size_t components = (i == 1U) ? 4U : 3U;
+                sampler.Add((i == 1U) ? KeyframeSampler::ValueType::QUAT : KeyframeSampler::ValueType::VEC3,
+                    KeyframeSampler::Mode::LINEAR,
+                    KeyframeSample{values + frame.current * components, values + frame.next * components,
+                        &crowd.initial[track + i].x, &crowd.results[track + i].x, frame.t, 1.0f});
+            }
+        }
+        sampler.Evaluate();
+        benchmark::DoNotOptimize(crowd.results.data());
+        time += DELTA_TIME;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * crowd.joints * 3);
+}
+
+BENCHMARK(FindKeyframesBinarySearch)->Apply(CharacterCounts);
+BENCHMARK(FindKeyframesCursor)->Apply(CharacterCounts);
+BENCHMARK(SampleTracksPerTrack)->Apply(CharacterCounts);
+BENCHMARK(SampleTracksBatched)->Apply(CharacterCounts);
+
+}  // namespace benchmarks
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+
+#include <base/containers/vector.h>
+#include <base/math/quaternion_util.h>
+#include <base/math/vector_util.h>
+#include <core/property/property_types.h>
+
+#include "util/animation_compression.h"
+#include "util/keyframe_sampler.h"
+
+namespace benchmarks {
+namespace {
+using BASE_NS::array_view;
+using BASE_NS::vector;
+using CORE3D_NS::AnimationCompression;
+using CORE3D_NS::AnimationTrackComponent;
+using CORE3D_NS::FindKeyframe;
+using CORE3D_NS::KeyframeSample;
+using CORE3D_NS::KeyframeSampler;
+namespace Math = BASE_NS::Math;
+
+constexpr uint32_t KEYFRAME_COUNT = 300U;
+constexpr float FRAME_TIME = 1.0f / 30.0f;
+constexpr float DELTA_TIME = 1.0f / 60.0f;
+constexpr float DURATION = FRAME_TIME * static_cast<float>(KEYFRAME_COUNT - 1U);
+
+// A translation and a rotation track per joint, ten seconds of smooth motion sampled at 30 fps like captured or
+// baked animations.
+struct Tracks {
+    vector<float> timestamps;
+    vector<vector<uint8_t>> translations;
+    vector<vector<uint8_t>> rotations;
+    vector<Math::Vec4> initial;
+    vector<Math::Vec4> results;
+    vector<size_t> cursors;
+    size_t rawBytes { 0U };
+    size_t compressedBytes { 0U };
+};
+
+template<typename T>
+vector<uint8_t> ToBytes(const vector<T>& values)
+{
+    const auto* data = reinterpret_cast<const uint8_t*>(values.data());
+    return vector<uint8_t>(data, data + values.size_in_bytes());
+}
+
+Tracks CreateTracks(uint32_t joints, bool compressed)
+{
+    std::mt19937 generator(1U);
+    std::uniform_real_distribution<float> frequency(0.2f, 2.0f);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    Tracks tracks;
+    for (uint32_t i = 0U; i < KEYFRAME_COUNT; ++i) {
+        tracks.timestamps.push_back(static_cast<float>(i) * FRAME_TIME);
+    }
+    for (uint32_t joint = 0U; joint < joints; ++joint) {
+        const float f = frequency(generator);
+        const Math::Vec3 amplitude(value(generator), value(generator), value(generator));
+        const Math::Vec3 axis = Math::Normalize(Math::Vec3(value(generator), value(generator), 1.0f));
+        vector<Math::Vec3> translations;
+        vector<Math::Quat> rotations;
+        for (const float time : tracks.timestamps) {
+            translations.push_back(amplitude * std::sin(time * f));
+            rotations.push_back(Math::AngleAxis(std::sin(time * f) * 1.5f, axis));
+        }
+        auto translationData = ToBytes(translations);
+        auto rotationData = ToBytes(rotations);
+        tracks.rawBytes += translationData.size() + rotationData.size();
+        if (compressed) {
+            translationData = AnimationCompression::Compress(CORE_NS::PropertyType::VEC3_T,
+                AnimationTrackComponent::Interpolation::LINEAR, tracks.timestamps, translationData);
+            rotationData = AnimationCompression::Compress(CORE_NS::PropertyType::QUAT_T,
+                AnimationTrackComponent::Interpolation::LINEAR, tracks.timestamps, rotationData);
+        }
+        tracks.compressedBytes += translationData.size() + rotationData.size();
+        tracks.translations.push_back(std::move(translationData));
+        tracks.rotations.push_back(std::move(rotationData));
+    }
+    tracks.initial.resize(joints * 2U, Math::Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    tracks.results.resize(joints * 2U);
+    tracks.cursors.resize(joints * 2U, 0U);
+    return tracks;
+}
+
+struct Frame {
+    size_t current;
+    size_t next;
+    float t;
+};
+
+Frame GetFrame(array_view<const float> timestamps, float time, size_t& cursor)
+{
+    cursor = FindKeyframe(timestamps, time, cursor);
+    const size_t next = std::min(cursor, timestamps.size() - 1U);
+    const size_t current = cursor ? (cursor - 1U) : 0U;
+    const float t = (current != next) ? std::clamp(
+        (time - timestamps[current]) / (timestamps[next] - timestamps[current]), 0.0f, 1.0f) : 0.0f;
+    return {current, next, t};
+}
+
+float GetTime(uint32_t joint, float time)
+{
+    return std::fmod(static_cast<float>(joint % 64U) * 0.1f + time, DURATION);
+}
+
+void SetCounters(benchmark::State& state, const Tracks& tracks)
+{
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(tracks.cursors.size()));
+    state.counters["raw_bytes"] = static_cast<double>(tracks.rawBytes);
+    state.counters["bytes"] = static_cast<double>(tracks.compressedBytes);
+    state.counters["ratio"] = static_cast<double>(tracks.rawBytes) / static_cast<double>(tracks.compressedBytes);
+}
+
+void JointCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(1000)->Arg(10000)->ArgName("joints")->Unit(benchmark::kMicrosecond);
+}
+}  // namespace
+
+// Keyframe reduction and quantization of all the tracks, as done when importing.
+void CompressTracks(benchmark::State& state)
+{
+    const Tracks tracks = CreateTracks(static_cast<uint32_t>(state.range(0)), false);
+    size_t bytes = 0U;
+    for (auto _ : state) {
+        bytes = 0U;
+        for (size_t i = 0U; i < tracks.translations.size(); ++i) {
+            bytes += AnimationCompression::Compress(CORE_NS::PropertyType::VEC3_T,
+                AnimationTrackComponent::Interpolation::LINEAR, tracks.timestamps, tracks.translations[i])
+                         .size();
+            bytes += AnimationCompression::Compress(CORE_NS::PropertyType::QUAT_T,
+                AnimationTrackComponent::Interpolation::LINEAR, tracks.timestamps, tracks.rotations[i])
+                         .size();
+        }
+        benchmark::DoNotOptimize(bytes);
+    }
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(tracks.cursors.size()) * KEYFRAME_COUNT);
+    state.counters["raw_bytes"] = static_cast<double>(tracks.rawBytes);
+    state.counters["bytes"] = static_cast<double>(bytes);
+}
+
+// Sampling raw float keyframes.
+void SampleRawTracks(benchmark::State& state)
+{
+    Tracks tracks = CreateTracks(static_cast<uint32_t>(state.range(0)), false);
+    KeyframeSampler sampler;
+    float time = 0.0f;
+    for (auto _ : state) {
+        for (uint32_t joint = 0U; joint < tracks.translations.size(); ++joint) {
+            const float jointTime = GetTime(joint, time);
+            const size_t track = joint * 2U;
+            {
+                const Frame frame = GetFrame(tracks.timestamps, jointTime, tracks.cursors[track]);
+                const auto* values = reinterpret_cast<const float*>(tracks.translations[joint].data());
+                sampler.Add(KeyframeSampler::ValueType::VEC3, KeyframeSampler::Mode::LINEAR,
+                    KeyframeSample { values + frame.current * 3U, values + frame.next * 3U,
+                        tracks.initial[track].data, tracks.results[track].data, frame.t, 1.0f });
+            }
+            {
+                const Frame frame = GetFrame(tracks.timestamps, jointTime, tracks.cursors[track + 1U]);
+                const auto* values = reinterpret_cast<const float*>(tracks.rotations[joint].data());
+                sampler.Add(KeyframeSampler::ValueType::QUAT, KeyframeSampler::Mode::LINEAR,
+                    KeyframeSample { values + frame.current * 4U, values + frame.next * 4U,
+                        tracks.initial[track + 1U].data, tracks.results[track + 1U].data, frame.t, 1.0f });
+            }
+        }
+        sampler.Evaluate();
+        benchmark::DoNotOptimize(tracks.results.data());
+        time += DELTA_TIME;
+    }
+    SetCounters(state, tracks);
+}
+
+// Sampling quantized keyframes, decoding the two keyframes of each track before interpolation like the animation
+// system.
+void SampleQuantizedTracks(benchmark::State& state)
+{
+    Tracks tracks = CreateTracks(static_cast<uint32_t>(state.range(0)), true);
+    KeyframeSampler sampler;
+    float time = 0.0f;
+    auto add = [&sampler, &tracks](KeyframeSampler::ValueType type, size_t components,
+                   const vector<uint8_t>& data, float time, size_t track) {
+        AnimationCompression::Track quantized;
+        if (!AnimationCompression::GetTrack(data, quantized)) {
+            return;
+        }
+        const Frame frame = GetFrame(quantized.timestamps, time, tracks.cursors[track]);
+        float* values = sampler.Allocate(components * 2U);
+        AnimationCompression::DecodeKeyframe(quantized, frame.current, values);
+        AnimationCompression::DecodeKeyframe(quantized, frame.next, values + components);
+        sampler.Add(type, KeyframeSampler::Mode::LINEAR,
+            KeyframeSample { values, values + components, tracks.initial[track].data, tracks.results[track].data,
+                frame.t, 1.0f });
+    };
+    for (auto _ : state) {
+        for (uint32_t joint = 0U; joint < tracks.translations.size(); ++joint) {
+            const float jointTime = GetTime(joint, time);
+            const size_t track = joint * 2U;
+            add(KeyframeSampler::ValueType::VEC3, 3U, tracks.translations[joint], jointTime, track);
+            add(KeyframeSampler::ValueType::QUAT, 4U, tracks.rotations[joint], jointTime, track + 1U);
+        }
+        sampler.Evaluate();
+        benchmark::DoNotOptimize(tracks.results.data());
+        time += DELTA_TIME;
+    }
+    SetCounters(state, tracks);
+}
+
+BENCHMARK(CompressTracks)->Arg(1000)->ArgName("joints")->Unit(benchmark::kMillisecond);
+BENCHMARK(SampleRawTracks)->Apply(JointCounts);
+BENCHMARK(SampleQuantizedTracks)->Apply(JointCounts);
+}  // namespace benchmarks
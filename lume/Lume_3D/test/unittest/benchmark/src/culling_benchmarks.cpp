@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include <base/containers/vector.h>
+#include <base/math/matrix_util.h>
+#include <base/math/vector_util.h>
+#include <core/implementation_uids.h>
+#include <core/plugin/intf_class_register.h>
+#include <core/util/intf_frustum_util.h>
+
+#include "util/bvh.h"
+
+namespace benchmarks {
+namespace {
+using BASE_NS::vector;
+using CORE3D_NS::Bvh;
+using CORE_NS::Frustum;
+using CORE_NS::IFrustumUtil;
+namespace Math = BASE_NS::Math;
+
+// Half size of the cube the submeshes are scattered in, the camera sees roughly a tenth of it.
+constexpr float SCENE_EXTENT = 500.0f;
+
+struct Sphere {
+    Math::Vec3 center;
+    float radius;
+};
+
+struct Scene {
+    vector<Sphere> spheres;
+    vector<Bvh::Aabb> bounds;
+    Frustum frustum;
+};
+
+Scene CreateScene(IFrustumUtil& frustumUtil, uint32_t count)
+{
+    Scene scene;
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<float> position(-SCENE_EXTENT, SCENE_EXTENT);
+    std::uniform_real_distribution<float> radius(0.5f, 4.0f);
+    scene.spheres.resize(count);
+    scene.bounds.resize(count);
+    for (uint32_t i = 0U; i < count; ++i) {
+        const Math::Vec3 center(position(generator), position(generator), position(generator));
+        const float r = radius(generator);
+        scene.spheres[i] = {center, r};
+        scene.bounds[i] = {center - Math::Vec3(r, r, r), center + Math::Vec3(r, r, r)};
+    }
+    const Math::Mat4X4 view = Math::LookAtRh({0.0f, 0.0f, SCENE_EXTENT}, {}, {0.0f, 1.0f, 0.0f});
+    const Math::Mat4X4 proj = Math::PerspectiveRhZo(Math::DEG2RAD * 60.0f, 16.0f / 9.0f, 0.1f, SCENE_EXTENT);
+    scene.frustum = frustumUtil.CreateFrustum(proj * view);
+    return scene;
+}
+
+IFrustumUtil& GetFrustumUtil()
+{
+    return *CORE_NS::GetInstance<IFrustumUtil>(CORE_NS::UID_FRUSTUM_UTIL);
+}
+
+// Same classification as render slot culling uses.
+Bvh::Containment Classify(const Frustum& frustum, const Bvh::Node& node)
+{
+    bool inside = true;
+    for (const auto& plane : frustum.planes) {
+        const Math::Vec3 far((plane.x >= 0.0f) ? node.max.x : node.min.x, (plane.y >= 0.0f) ? node.max.y : node.min.y,
+            (plane.z >= 0.0f) ? node.max.z : node.min.z);
+        const Math::Vec3 near((plane.x >= 0.0f) ? node.min.x : node.max.x, (plane.y >= 0.0f) ? node.min.y : node.max.y,
+            (plane.z >= 0.0f) ? node.min.z : node.max.z);
+        if ((Math::Dot(Math::Vec3(plane), far) + plane.w) < 0.0f) {
+            return Bvh::Containment::OUTSIDE;
+        }
+        if ((Math::Dot(Math::Vec3(plane), near) + plane.w) <= 0.0f) {
+            inside = false;
+        }
+    }
+    return inside ? Bvh::Containment::INSIDE : Bvh::Containment::INTERSECTS;
+}
+
+void SceneSizes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(10000)->Arg(100000)->ArgName("submeshes")->Unit(benchmark::kMicrosecond);
+}
+}  // namespace
+
+// Testing every submesh against the frustum one call at a time.
+void CullLinear(benchmark::State& state)
+{
+    auto& frustumUtil = GetFrustumUtil();
+    const Scene scene = CreateScene(frustumUtil, static_cast<uint32_t>(state.range(0)));
+    vector<uint32_t> visible;
+    visible.reserve(scene.spheres.size());
+    for (auto _ : state) {
+        visible.clear();
+        for (uint32_t i = 0U; i < static_cast<uint32_t>(scene.spheres.size()); ++i) {
+            if (frustumUtil.SphereFrustumCollision(scene.frustum, scene.spheres[i].center, scene.spheres[i].radius)) {
+                visible.push_back(i);
+            }
+        }
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.counters["visible"] = static_cast<double>(visible.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Testing every submesh with the batch SIMD test, including gathering the spheres to structure of arrays layout.
+void CullBatch(benchmark::State& state)
+{
+    auto& frustumUtil = GetFrustumUtil();
+    const Scene scene = CreateScene(frustumUtil, static_cast<uint32_t>(state.range(0)));
+    const size_t count = scene.spheres.size();
+    vector<float> spheres(count * 4U);
+    vector<uint64_t> visible((count + 63U) / 64U);
+    for (auto _ : state) {
+        for (size_t i = 0U; i < count; ++i) {
+            spheres[i] = scene.spheres[i].center.x;
+            spheres[count + i] = scene.spheres[i].center.y;
+            spheres[(count * 2U) + i] = scene.spheres[i].center.z;
+            spheres[(count * 3U) + i] = scene.spheres[i].radius;
+        }
+        const float* data = spheres.data();
+        frustumUtil.SpheresFrustumCollision({&scene.frustum, 1U},
+            {{data, count}, {data + count, count}, {data + (count * 2U), count}, {data + (count * 3U), count}},
+            visible);
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Culling against a prebuilt hierarchy, submeshes in partially visible leaves are tested individually.
+void CullBvh(benchmark::State& state)
+{
+    auto& frustumUtil = GetFrustumUtil();
+    const Scene scene = CreateScene(frustumUtil, static_cast<uint32_t>(state.range(0)));
+    Bvh bvh;
+    bvh.Build(scene.bounds);
+    vector<uint32_t> visible;
+    visible.reserve(scene.spheres.size());
+    for (auto _ : state) {
+        visible.clear();
+        bvh.Traverse([&scene](const Bvh::Node& node) { return Classify(scene.frustum, node); },
+            [&](const uint32_t index, const bool inside) {
+                if (inside || frustumUtil.SphereFrustumCollision(
+                                  scene.frustum, scene.spheres[index].center, scene.spheres[index].radius)) {
+                    visible.push_back(index);
+                }
+            });
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.counters["visible"] = static_cast<double>(visible.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Per frame cost of rebuilding the hierarchy in RenderDataStoreDefaultMaterial::PreRender.
+void BuildBvh(benchmark::State& state)
+{
+    const Scene scene = CreateScene(GetFrustumUtil(), static_cast<uint32_t>(state.range(0)));
+    Bvh bvh;
+    for (auto _ : state) {
+        bvh.Build(scene.bounds);
+        benchmark::DoNotOptimize(bvh.GetNodes().data());
+    }
+    state.counters["nodes"] = static_cast<double>(bvh.GetNodes().size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(CullLinear)->Apply(SceneSizes);
+BENCHMARK(CullBatch)->Apply(SceneSizes);
+BENCHMARK(CullBvh)->Apply(SceneSizes);
+BENCHMARK(BuildBvh)->Apply(SceneSizes);
+
+}  // namespace benchmarks
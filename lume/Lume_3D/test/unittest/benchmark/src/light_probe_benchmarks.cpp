@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include <3d/light_probe_types/light_probe.h>
+#include <base/containers/vector.h>
+#include <base/math/vector.h>
+#include <base/math/vector_util.h>
+
+#include "util/bowyer_watson_delaunay_3d.h"
+#include "util/light_probe_locator.h"
+#include "util/light_probe_util.h"
+
+namespace benchmarks {
+namespace {
+using BASE_NS::vector;
+using CORE3D_NS::LightProbeGroupComponent;
+using CORE3D_NS::LightProbeLocator;
+using CORE3D_NS::LightProbeUtil;
+namespace Math = BASE_NS::Math;
+
+constexpr uint32_t PROBE_COUNT = 10000U;
+// Half size of the cube the probes are scattered in.
+constexpr float VOLUME_EXTENT = 50.0f;
+// Half size of the cube the objects move in and distance an object moves per frame.
+constexpr float OBJECT_EXTENT = VOLUME_EXTENT * 0.9f;
+constexpr float OBJECT_SPEED = 0.1f;
+
+struct ProbeVolume {
+    vector<LightProbeGroupComponent::LightProbe> probes;
+    vector<CORE3D_NS::Tetrahedron> tetrahedrons;
+    vector<CORE3D_NS::TetrahedronAdjacency> adjacency;
+    CORE3D_NS::LightProbeVolume volume;
+    LightProbeLocator locator;
+};
+
+vector<LightProbeGroupComponent::LightProbe> CreateProbes(uint32_t count)
+{
+    vector<LightProbeGroupComponent::LightProbe> probes(count);
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<float> position(-VOLUME_EXTENT, VOLUME_EXTENT);
+    std::uniform_real_distribution<float> coefficient(0.0f, 1.0f);
+    for (auto& probe : probes) {
+        probe.position = {position(generator), position(generator), position(generator)};
+        for (auto& sh : probe.shCoefficients) {
+            sh = {coefficient(generator), coefficient(generator), coefficient(generator)};
+        }
+        probe.bentNormal = {0.0f, 1.0f, 0.0f};
+        probe.ao = coefficient(generator);
+    }
+    return probes;
+}
+
+// Triangulating the probes takes a while, the volume is shared by all the lookup benchmarks.
+const ProbeVolume& GetProbeVolume()
+{
+    static const ProbeVolume probeVolume = [] {
+        ProbeVolume result;
+        result.probes = CreateProbes(PROBE_COUNT);
+        CORE3D_NS::BowyerWatsonDelaunay3D::LightProbeVolume delaunayVolume{
+            result.probes, result.tetrahedrons, &result.adjacency};
+        CORE3D_NS::BowyerWatsonDelaunay3D().BuildTetrahedralMesh(delaunayVolume);
+        result.volume = {result.probes, result.tetrahedrons};
+        result.locator.Build(result.volume, result.adjacency);
+        return result;
+    }();
+    return probeVolume;
+}
+
+struct Object {
+    Math::Vec3 position;
+    Math::Vec3 velocity;
+    uint32_t tetrahedronHint;
+};
+
+struct Objects {
+    vector<Object> objects;
+    Math::Vec3 center;
+};
+
+// Objects wandering inside the volume, or above it when outside is set so that the nearest probes are used.
+Objects CreateObjects(uint32_t count, bool outside)
+{
+    Objects result;
+    result.objects.resize(count);
+    result.center = {0.0f, outside ? (VOLUME_EXTENT + OBJECT_EXTENT * 1.5f) : 0.0f, 0.0f};
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<float> position(-OBJECT_EXTENT, OBJECT_EXTENT);
+    std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+    for (auto& object : result.objects) {
+        object.position = result.center + Math::Vec3(position(generator), position(generator), position(generator));
+        const Math::Vec3 heading(direction(generator), direction(generator), direction(generator));
+        object.velocity = Math::Normalize(heading) * OBJECT_SPEED;
+        object.tetrahedronHint = 0U;
+    }
+    return result;
+}
+
+void MoveObjects(Objects& objects)
+{
+    for (auto& object : objects.objects) {
+        object.position += object.velocity;
+        for (uint32_t axis = 0U; axis < 3U; ++axis) {
+            if (Math::abs(object.position[axis] - objects.center[axis]) > OBJECT_EXTENT) {
+                object.velocity[axis] = -object.velocity[axis];
+            }
+        }
+    }
+}
+
+void ObjectCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(1000)->Arg(10000)->ArgName("objects")->Unit(benchmark::kMillisecond);
+}
+
+void ProbeCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(1000)->Arg(10000)->Arg(50000)->ArgName("probes")->Unit(benchmark::kMillisecond);
+}
+
+// Linear search is too slow to run with all the objects.
+void LinearObjectCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(1000)->ArgName("objects")->Unit(benchmark::kMillisecond);
+}
+}  // namespace
+
+// Tetrahedralization of the probes with the adjacency needed by the locator.
+void LightProbeTetrahedralize(benchmark::State& state)
+{
+    const auto probes = CreateProbes(static_cast<uint32_t>(state.range(0)));
+    vector<CORE3D_NS::Tetrahedron> tetrahedrons;
+    vector<CORE3D_NS::TetrahedronAdjacency> adjacency;
+    for (auto _ : state) {
+        CORE3D_NS::BowyerWatsonDelaunay3D::LightProbeVolume delaunayVolume{probes, tetrahedrons, &adjacency};
+        CORE3D_NS::BowyerWatsonDelaunay3D().BuildTetrahedralMesh(delaunayVolume);
+        benchmark::DoNotOptimize(tetrahedrons.data());
+    }
+    state.counters["tetrahedrons"] = static_cast<double>(tetrahedrons.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Testing every tetrahedron for every object, as done before the locator.
+void LightProbeLookupLinear(benchmark::State& state)
+{
+    const auto& probeVolume = GetProbeVolume();
+    auto objects = CreateObjects(static_cast<uint32_t>(state.range(0)), false);
+    for (auto _ : state) {
+        MoveObjects(objects);
+        for (const auto& object : objects.objects) {
+            auto result = LightProbeUtil::GetInterpolatedLightProbeData(probeVolume.volume, object.position);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.counters["tetrahedrons"] = static_cast<double>(probeVolume.tetrahedrons.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Walking from the tetrahedron of the previous frame.
+void LightProbeLookupWalk(benchmark::State& state)
+{
+    const auto& probeVolume = GetProbeVolume();
+    auto objects = CreateObjects(static_cast<uint32_t>(state.range(0)), false);
+    for (auto _ : state) {
+        MoveObjects(objects);
+        for (auto& object : objects.objects) {
+            auto result = LightProbeUtil::GetInterpolatedLightProbeData(
+                probeVolume.volume, probeVolume.locator, object.position, object.tetrahedronHint);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.counters["tetrahedrons"] = static_cast<double>(probeVolume.tetrahedrons.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Objects outside of the volume, the tetrahedrons and probes are searched linearly.
+void LightProbeNearestLinear(benchmark::State& state)
+{
+    const auto& probeVolume = GetProbeVolume();
+    auto objects = CreateObjects(static_cast<uint32_t>(state.range(0)), true);
+    for (auto _ : state) {
+        MoveObjects(objects);
+        for (const auto& object : objects.objects) {
+            auto result = LightProbeUtil::GetInterpolatedLightProbeData(probeVolume.volume, object.position);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// Objects outside of the volume, the bvh rejects the tetrahedrons and the k-d tree finds the nearest probes.
+void LightProbeNearestKdTree(benchmark::State& state)
+{
+    const auto& probeVolume = GetProbeVolume();
+    auto objects = CreateObjects(static_cast<uint32_t>(state.range(0)), true);
+    for (auto _ : state) {
+        MoveObjects(objects);
+        for (auto& object : objects.objects) {
+            auto result = LightProbeUtil::GetInterpolatedLightProbeData(
+                probeVolume.volume, probeVolume.locator, object.position, object.tetrahedronHint);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(LightProbeTetrahedralize)->Apply(ProbeCounts);
+BENCHMARK(LightProbeLookupLinear)->Apply(LinearObjectCounts);
+BENCHMARK(LightProbeLookupWalk)->Apply(ObjectCounts);
+BENCHMARK(LightProbeNearestLinear)->Apply(LinearObjectCounts);
+BENCHMARK(LightProbeNearestKdTree)->Apply(ObjectCounts);
+
+}  // namespace benchmarks
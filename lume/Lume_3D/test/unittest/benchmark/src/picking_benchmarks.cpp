@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include <base/containers/vector.h>
+#include <base/math/matrix_util.h>
+#include <base/math/quaternion_util.h>
+#include <base/math/vector_util.h>
+
+#include "util/bvh.h"
+#include "util/mesh_bvh.h"
+#include "util/picking.h"
+
+namespace benchmarks {
+namespace {
+using BASE_NS::vector;
+using CORE3D_NS::Bvh;
+using CORE3D_NS::MeshBvh;
+namespace Math = BASE_NS::Math;
+
+constexpr uint32_t RAY_COUNT = 1024U;
+
+// Height field of size x size quads in the XZ plane facing +y.
+struct Grid {
+    vector<Math::Vec3> positions;
+    vector<uint32_t> indices;
+};
+
+Grid CreateGrid(uint32_t size, float extent, std::mt19937& generator)
+{
+    std::uniform_real_distribution<float> height(0.0f, extent / static_cast<float>(size));
+    Grid grid;
+    const uint32_t columns = size + 1U;
+    grid.positions.reserve(static_cast<size_t>(columns) * columns);
+    for (uint32_t z = 0U; z < columns; ++z) {
+        for (uint32_t x = 0U; x < columns; ++x) {
+            grid.positions.push_back({(static_cast<float>(x) / static_cast<float>(size) - 0.5f) * extent,
+                height(generator), (static_cast<float>(z) / static_cast<float>(size) - 0.5f) * extent});
+        }
+    }
+    grid.indices.reserve(static_cast<size_t>(size) * size * 6U);
+    for (uint32_t z = 0U; z < size; ++z) {
+        for (uint32_t x = 0U; x < size; ++x) {
+            const uint32_t i = z * columns + x;
+            grid.indices.push_back(i);
+            grid.indices.push_back(i + columns);
+            grid.indices.push_back(i + 1U);
+            grid.indices.push_back(i + 1U);
+            grid.indices.push_back(i + columns);
+            grid.indices.push_back(i + columns + 1U);
+        }
+    }
+    return grid;
+}
+
+struct Ray {
+    Math::Vec3 start;
+    Math::Vec3 direction;
+};
+
+// Rays from above the area towards random points on it.
+vector<Ray> CreateRays(float extent, std::mt19937& generator)
+{
+    std::uniform_real_distribution<float> position(-0.5f * extent, 0.5f * extent);
+    vector<Ray> rays(RAY_COUNT);
+    for (auto& ray : rays) {
+        ray.start = {position(generator), extent, position(generator)};
+        const Math::Vec3 target(position(generator), 0.0f, position(generator));
+        ray.direction = Math::Normalize(target - ray.start);
+    }
+    return rays;
+}
+
+// Grid size giving at least the requested number of triangles.
+uint32_t GridSize(int64_t triangles)
+{
+    uint32_t size = 1U;
+    while ((static_cast<int64_t>(size) * size * 2) < triangles) {
+        ++size;
+    }
+    return size;
+}
+
+void TriangleCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(1 << 20)->Arg(1 << 22)->ArgName("triangles")->Unit(benchmark::kMicrosecond);
+}
+}  // namespace
+
+// IPicking::RayCast with a triangle list, testing every triangle.
+void RayCastTriangleList(benchmark::State& state)
+{
+    std::mt19937 generator(1U);
+    constexpr float extent = 100.0f;
+    const Grid grid = CreateGrid(GridSize(state.range(0)), extent, generator);
+    vector<Math::Vec3> triangles;
+    triangles.reserve(grid.indices.size());
+    for (const auto index : grid.indices) {
+        triangles.push_back(grid.positions[index]);
+    }
+    const vector<Ray> rays = CreateRays(extent, generator);
+    const CORE3D_NS::Picking picking;
+    size_t ray = 0U;
+    for (auto _ : state) {
+        const auto& r = rays[ray++ % rays.size()];
+        auto result = picking.RayCast(r.start, r.direction, triangles);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Closest hit against the triangle hierarchy of a single mesh.
+void RayCastMeshBvh(benchmark::State& state)
+{
+    std::mt19937 generator(1U);
+    constexpr float extent = 100.0f;
+    const Grid grid = CreateGrid(GridSize(state.range(0)), extent, generator);
+    const vector<Ray> rays = CreateRays(extent, generator);
+    MeshBvh bvh;
+    bvh.Build(grid.positions, grid.indices);
+    size_t ray = 0U;
+    uint32_t hits = 0U;
+    for (auto _ : state) {
+        const auto& r = rays[ray++ % rays.size()];
+        MeshBvh::Hit hit;
+        hits += bvh.RayCast(r.start, r.direction, false, std::numeric_limits<float>::max(), hit) ? 1U : 0U;
+        benchmark::DoNotOptimize(hit);
+    }
+    state.counters["hitRatio"] = static_cast<double>(hits) / static_cast<double>(state.iterations());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Same work as Picking::RayCastMeshes: a hierarchy over the world bounds of 1024 rotated instances sharing a mesh,
+// and the hit instances tested in mesh space.
+void RayCastSceneBvh(benchmark::State& state)
+{
+    constexpr uint32_t instanceRows = 32U;
+    constexpr uint32_t instanceCount = instanceRows * instanceRows;
+    constexpr float instanceExtent = 10.0f;
+    constexpr float extent = instanceExtent * static_cast<float>(instanceRows);
+    std::mt19937 generator(1U);
+    const Grid grid = CreateGrid(GridSize(state.range(0) / instanceCount), instanceExtent, generator);
+    MeshBvh meshBvh;
+    meshBvh.Build(grid.positions, grid.indices);
+    Math::Vec3 meshMin(std::numeric_limits<float>::max());
+    Math::Vec3 meshMax(-std::numeric_limits<float>::max());
+    for (const auto& position : grid.positions) {
+        meshMin = Math::min(meshMin, position);
+        meshMax = Math::max(meshMax, position);
+    }
+
+    std::uniform_real_distribution<float> angle(0.0f, Math::PI * 2.0f);
+    vector<Math::Mat4X4> toMesh(instanceCount);
+    vector<Bvh::Aabb> bounds(instanceCount);
+    for (uint32_t i = 0U; i < instanceCount; ++i) {
+        const Math::Vec3 position((static_cast<float>(i % instanceRows) + 0.5f) * instanceExtent - 0.5f * extent,
+            0.0f, (static_cast<float>(i / instanceRows) + 0.5f) * instanceExtent - 0.5f * extent);
+        const Math::Mat4X4 world = Math::Trs(
+            position, Math::AngleAxis(angle(generator), Math::Vec3(0.0f, 1.0f, 0.0f)), Math::Vec3(1.0f, 1.0f, 1.0f));
+        toMesh[i] = Math::Inverse(world);
+        bounds[i] = {Math::Vec3(std::numeric_limits<float>::max()), Math::Vec3(-std::numeric_limits<float>::max())};
+        for (uint32_t corner = 0U; corner < 8U; ++corner) {
+            const Math::Vec3 point((corner & 1U) ? meshMax.x : meshMin.x, (corner & 2U) ? meshMax.y : meshMin.y,
+                (corner & 4U) ? meshMax.z : meshMin.z);
+            const Math::Vec3 worldPoint = Math::MultiplyPoint3X4(world, point);
+            bounds[i].min = Math::min(bounds[i].min, worldPoint);
+            bounds[i].max = Math::max(bounds[i].max, worldPoint);
+        }
+    }
+    Bvh sceneBvh;
+    sceneBvh.Build(bounds);
+    const vector<Ray> rays = CreateRays(extent, generator);
+
+    size_t ray = 0U;
+    uint32_t hits = 0U;
+    for (auto _ : state) {
+        const auto& r = rays[ray++ % rays.size()];
+        const Math::Vec3 invDirection(1.0f / r.direction.x, 1.0f / r.direction.y, 1.0f / r.direction.z);
+        sceneBvh.Traverse(
+            [&r, &invDirection](const Bvh::Node& node) {
+                const Math::Vec3 t1 = (node.min - r.start) * invDirection;
+                const Math::Vec3 t2 = (node.max - r.start) * invDirection;
+                const Math::Vec3 tmin = Math::min(t1, t2);
+                const Math::Vec3 tmax = Math::max(t1, t2);
+                const float entry = Math::max(Math::max(tmin.x, tmin.y), tmin.z);
+                const float exit = Math::min(Math::min(tmax.x, tmax.y), tmax.z);
+                return ((exit >= entry) && (exit > 0.0f)) ? Bvh::Containment::INTERSECTS : Bvh::Containment::OUTSIDE;
+            },
+            [&](const uint32_t index, bool) {
+                MeshBvh::Hit hit;
+                if (meshBvh.RayCast(Math::MultiplyPoint3X4(toMesh[index], r.start),
+                        Math::MultiplyVector(toMesh[index], r.direction), false, std::numeric_limits<float>::max(),
+                        hit)) {
+                    ++hits;
+                }
+            });
+    }
+    state.counters["instances"] = static_cast<double>(instanceCount);
+    state.counters["hitRatio"] = static_cast<double>(hits) / static_cast<double>(state.iterations());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(RayCastTriangleList)->Apply(TriangleCounts);
+BENCHMARK(RayCastMeshBvh)->Apply(TriangleCounts);
+BENCHMARK(RayCastSceneBvh)->Apply(TriangleCounts);
+
+}  // namespace benchmarks
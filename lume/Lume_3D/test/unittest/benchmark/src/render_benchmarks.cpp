@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include <3d/ecs/components/camera_component.h>
+#include <3d/ecs/components/light_component.h>
+#include <3d/ecs/components/render_handle_component.h>
+#include <3d/ecs/components/render_mesh_component.h>
+#include <3d/ecs/components/transform_component.h>
+#include <3d/implementation_uids.h>
+#include <3d/intf_graphics_context.h>
+#include <3d/util/intf_mesh_util.h>
+#include <3d/util/intf_scene_util.h>
+#include <base/containers/fixed_string.h>
+#include <base/containers/string.h>
+#include <base/containers/vector.h>
+#include <base/math/quaternion_util.h>
+#include <core/ecs/intf_ecs.h>
+#include <core/ecs/intf_system_graph_loader.h>
+#include <core/implementation_uids.h>
+#include <core/intf_engine.h>
+#include <core/plugin/intf_class_factory.h>
+#include <core/plugin/intf_plugin_register.h>
+#include <core/threading/intf_thread_pool.h>
+#include <render/device/intf_gpu_resource_manager.h>
+#include <render/implementation_uids.h>
+#include <render/intf_render_context.h>
+#include <render/nodecontext/intf_render_node_graph_manager.h>
+#include <render/intf_renderer.h>
+
+#include "utils.h"
+
+namespace benchmarks {
+namespace {
+using BASE_NS::vector;
+using CORE3D_NS::CameraComponent;
+using CORE3D_NS::IGraphicsContext;
+using CORE3D_NS::LightComponent;
+using CORE_NS::Entity;
+using CORE_NS::EntityReference;
+using CORE_NS::IEcs;
+using CORE_NS::IThreadPool;
+using RENDER_NS::IRenderContext;
+using RENDER_NS::IRenderNodeGraphManager;
+namespace Math = BASE_NS::Math;
+
+constexpr uint32_t TARGET_SIZE = 256U;
+constexpr float SCENE_EXTENT = 50.0f;
+constexpr BASE_NS::string_view PING_PONG_IMAGES[] = {"BenchmarkPingPong0", "BenchmarkPingPong1"};
+
+// Render context on the headless device, the frame is recorded and walked by the backend but nothing is executed.
+struct HeadlessRenderer {
+    IRenderContext::Ptr renderContext;
+    IGraphicsContext::Ptr graphicsContext;
+    IEcs::Ptr ecs;
+};
+
+// The ECS uses the engine's default thread pool unless a pool is given.
+bool CreateRenderer(CORE_NS::IEngine& engine, HeadlessRenderer& renderer, IThreadPool* threadPool = nullptr)
+{
+    constexpr BASE_NS::Uid plugins[] = {RENDER_NS::UID_RENDER_PLUGIN, CORE3D_NS::UID_3D_PLUGIN};
+    if (!CORE_NS::GetPluginRegister().LoadPlugins(plugins)) {
+        return false;
+    }
+    renderer.renderContext = static_cast<IRenderContext::Ptr>(
+        engine.GetInterface<CORE_NS::IClassFactory>()->CreateInstance(RENDER_NS::UID_RENDER_CONTEXT));
+    if (!renderer.renderContext) {
+        return false;
+    }
+    RENDER_NS::DeviceCreateInfo deviceCreateInfo;
+    deviceCreateInfo.backendType = RENDER_NS::DeviceBackendType::HEADLESS;
+    const RENDER_NS::RenderCreateInfo info{
+        {
+            "3d_benchmark",  // name
+            1,               // versionMajor
+            0,               // versionMinor
+            0,               // versionPatch
+        },
+        deviceCreateInfo,
+    };
+    if (renderer.renderContext->Init(info) != RENDER_NS::RenderResultCode::RENDER_SUCCESS) {
+        return false;
+    }
+    renderer.graphicsContext = CORE_NS::CreateInstance<IGraphicsContext>(
+        *renderer.renderContext->GetInterface<CORE_NS::IClassFactory>(), CORE3D_NS::UID_GRAPHICS_CONTEXT);
+    if (!renderer.graphicsContext) {
+        return false;
+    }
+    renderer.graphicsContext->Init({});
+
+    renderer.ecs = threadPool ? engine.CreateEcs(*threadPool) : engine.CreateEcs();
+    auto factory = CORE_NS::GetInstance<CORE_NS::ISystemGraphLoaderFactory>(CORE_NS::UID_SYSTEM_GRAPH_LOADER);
+    auto systemGraphLoader = factory->Create(engine.GetFileManager());
+    if (!systemGraphLoader->Load("rofs3D://systemGraph.json", *renderer.ecs).success) {
+        return false;
+    }
+    renderer.ecs->Initialize();
+    return true;
+}
+
+void DestroyRenderer(HeadlessRenderer& renderer)
+{
+    renderer.ecs->Uninitialize();
+    renderer.ecs.reset();
+    renderer.graphicsContext.reset();
+    renderer.renderContext.reset();
+}
+
+EntityReference CreateColorTarget(IRenderContext& renderContext, IEcs& ecs)
+{
+    RENDER_NS::GpuImageDesc desc;
+    desc.width = TARGET_SIZE;
+    desc.height = TARGET_SIZE;
+    desc.depth = 1U;
+    desc.format = BASE_NS::BASE_FORMAT_R8G8B8A8_SRGB;
+    desc.engineCreationFlags = RENDER_NS::CORE_ENGINE_IMAGE_CREATION_DYNAMIC_BARRIERS;
+    desc.imageTiling = RENDER_NS::CORE_IMAGE_TILING_OPTIMAL;
+    desc.imageType = RENDER_NS::CORE_IMAGE_TYPE_2D;
+    desc.imageViewType = RENDER_NS::CORE_IMAGE_VIEW_TYPE_2D;
+    desc.layerCount = 1U;
+    desc.memoryPropertyFlags = RENDER_NS::CORE_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    desc.mipCount = 1U;
+    desc.sampleCountFlags = RENDER_NS::CORE_SAMPLE_COUNT_1_BIT;
+    desc.usageFlags = RENDER_NS::CORE_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | RENDER_NS::CORE_IMAGE_USAGE_SAMPLED_BIT;
+
+    EntityReference entity = ecs.GetEntityManager().CreateReferenceCounted();
+    auto rhManager = CORE_NS::GetManager<CORE3D_NS::IRenderHandleComponentManager>(ecs);
+    rhManager->Create(entity);
+    if (auto scopedHandle = rhManager->Write(entity); scopedHandle) {
+        scopedHandle->reference = renderContext.GetDevice().GetGpuResourceManager().Create(desc);
+    }
+    return entity;
+}
+
+// Camera rendering to an offscreen target, a directional light and count cubes scattered around the camera target.
+void CreateScene(HeadlessRenderer& renderer, uint32_t count)
+{
+    IEcs& ecs = *renderer.ecs;
+    const auto& sceneUtil = renderer.graphicsContext->GetSceneUtil();
+    const Entity camera =
+        sceneUtil.CreateCamera(ecs, Math::Vec3(0.0f, 0.0f, SCENE_EXTENT * 2.0f), {}, 0.1f, SCENE_EXTENT * 4.0f, 60.0f);
+    sceneUtil.UpdateCameraViewport(ecs, camera, {TARGET_SIZE, TARGET_SIZE});
+    if (auto cameraHandle = CORE_NS::GetManager<CORE3D_NS::ICameraComponentManager>(ecs)->Write(camera);
+        cameraHandle) {
+        cameraHandle->sceneFlags |= CameraComponent::SceneFlagBits::MAIN_CAMERA_BIT;
+        cameraHandle->pipelineFlags |= CameraComponent::PipelineFlagBits::CLEAR_COLOR_BIT;
+        cameraHandle->customColorTargets.push_back(CreateColorTarget(*renderer.renderContext, ecs));
+    }
+
+    LightComponent light;
+    light.type = LightComponent::Type::DIRECTIONAL;
+    light.shadowEnabled = true;
+    sceneUtil.CreateLight(ecs, light, {}, Math::AngleAxis(-0.25f * Math::PI, Math::Vec3(1.0f, 0.0f, 0.0f)));
+
+    auto& meshUtil = renderer.graphicsContext->GetMeshUtil();
+    const Entity cube = meshUtil.GenerateCubeMesh(ecs, "cube", {}, 1.0f, 1.0f, 1.0f);
+    auto transformManager = CORE_NS::GetManager<CORE3D_NS::ITransformComponentManager>(ecs);
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<float> position(-SCENE_EXTENT, SCENE_EXTENT);
+    for (uint32_t i = 0U; i < count; ++i) {
+        const Entity node = meshUtil.GenerateEntity(ecs, "node", cube);
+        if (auto transform = transformManager->Write(node); transform) {
+            transform->position = {position(generator), position(generator), position(generator)};
+        }
+    }
+}
+
+// CPU cost of a full frame: ECS systems, render node graph setup and execution, and the backend walk.
+void BM_RenderFrameHeadless(benchmark::State& state)
+{
+    CORE_NS::IEngine* engine = GetEngine();
+    HeadlessRenderer renderer;
+    if (!engine || !CreateRenderer(*engine, renderer)) {
+        state.SkipWithError("headless render context not available");
+        return;
+    }
+    CreateScene(renderer, static_cast<uint32_t>(state.range(0)));
+
+    IEcs* ecsInputs[] = {renderer.ecs.get()};
+    auto& rendererInstance = renderer.renderContext->GetRenderer();
+    for (auto _ : state) {
+        engine->TickFrame(ecsInputs);
+        benchmark::DoNotOptimize(
+            rendererInstance.RenderFrame(renderer.graphicsContext->GetRenderNodeGraphs(*renderer.ecs)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    DestroyRenderer(renderer);
+}
+BENCHMARK(BM_RenderFrameHeadless)->RangeMultiplier(4)->Range(16, 4096)->Unit(benchmark::kMillisecond);
+
+// Large static scene where only the given percentage of the render meshes move each frame. With the retained render
+// mesh data only the moved render meshes are patched instead of re-adding the whole scene.
+void BM_RenderFrameAnimatedInstances(benchmark::State& state)
+{
+    constexpr uint32_t instanceCount = 100000U;
+    CORE_NS::IEngine* engine = GetEngine();
+    HeadlessRenderer renderer;
+    if (!engine || !CreateRenderer(*engine, renderer)) {
+        state.SkipWithError("headless render context not available");
+        return;
+    }
+    CreateScene(renderer, instanceCount);
+
+    auto renderMeshManager = CORE_NS::GetManager<CORE3D_NS::IRenderMeshComponentManager>(*renderer.ecs);
+    auto transformManager = CORE_NS::GetManager<CORE3D_NS::ITransformComponentManager>(*renderer.ecs);
+    vector<Entity> renderMeshes;
+    renderMeshes.reserve(renderMeshManager->GetComponentCount());
+    for (CORE_NS::IComponentManager::ComponentId id = 0U; id < renderMeshManager->GetComponentCount(); ++id) {
+        renderMeshes.push_back(renderMeshManager->GetEntity(id));
+    }
+    const size_t animatedCount = renderMeshes.size() * static_cast<size_t>(state.range(0)) / 100U;
+
+    IEcs* ecsInputs[] = {renderer.ecs.get()};
+    auto& rendererInstance = renderer.renderContext->GetRenderer();
+    // settle the initial frame
+    engine->TickFrame(ecsInputs);
+    rendererInstance.RenderFrame(renderer.graphicsContext->GetRenderNodeGraphs(*renderer.ecs));
+
+    size_t next = 0U;
+    float offset = 0.01f;
+    for (auto _ : state) {
+        for (size_t i = 0U; i < animatedCount; ++i) {
+            if (auto transform = transformManager->Write(renderMeshes[next]); transform) {
+                transform->position.y += offset;
+            }
+            next = (next + 1U) % renderMeshes.size();
+        }
+        offset = -offset;
+        engine->TickFrame(ecsInputs);
+        benchmark::DoNotOptimize(
+            rendererInstance.RenderFrame(renderer.graphicsContext->GetRenderNodeGraphs(*renderer.ecs)));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(animatedCount));
+
+    DestroyRenderer(renderer);
+}
+BENCHMARK(BM_RenderFrameAnimatedInstances)->Arg(1)->Arg(100)->Unit(benchmark::kMillisecond);
+
+// Full gather of a large scene with range(0) threads in the ECS thread pool. Touching a render mesh component makes
+// the render system re-add every render mesh, which is split into per thread buffers and merged by the data store.
+void BM_RenderFrameGatherThreads(benchmark::State& state)
+{
+    constexpr uint32_t instanceCount = 100000U;
+    CORE_NS::IEngine* engine = GetEngine();
+    auto* factory = CORE_NS::GetInstance<CORE_NS::ITaskQueueFactory>(CORE_NS::UID_TASK_QUEUE_FACTORY);
+    HeadlessRenderer renderer;
+    if (!engine || !factory) {
+        state.SkipWithError("engine not available");
+        return;
+    }
+    const IThreadPool::Ptr threadPool = factory->CreateThreadPool(static_cast<uint32_t>(state.range(0)));
+    if (!CreateRenderer(*engine, renderer, threadPool.get())) {
+        state.SkipWithError("headless render context not available");
+        return;
+    }
+    CreateScene(renderer, instanceCount);
+
+    auto renderMeshManager = CORE_NS::GetManager<CORE3D_NS::IRenderMeshComponentManager>(*renderer.ecs);
+    const Entity renderMesh = renderMeshManager->GetEntity(0U);
+
+    IEcs* ecsInputs[] = {renderer.ecs.get()};
+    auto& rendererInstance = renderer.renderContext->GetRenderer();
+    // settle the initial frame
+    engine->TickFrame(ecsInputs);
+    rendererInstance.RenderFrame(renderer.graphicsContext->GetRenderNodeGraphs(*renderer.ecs));
+
+    for (auto _ : state) {
+        // writing bumps the component generation which prevents patching the retained render meshes
+        renderMeshManager->Write(renderMesh);
+        engine->TickFrame(ecsInputs);
+        benchmark::DoNotOptimize(
+            rendererInstance.RenderFrame(renderer.graphicsContext->GetRenderNodeGraphs(*renderer.ecs)));
+    }
+    state.SetItemsProcessed(state.iterations() * instanceCount);
+
+    DestroyRenderer(renderer);
+}
+BENCHMARK(BM_RenderFrameGatherThreads)
+    ->RangeMultiplier(2)
+    ->Range(1, 8)
+    ->ArgName("threads")
+    ->Unit(benchmark::kMillisecond);
+
+// Render node graph with count fullscreen copy nodes ping-ponging between two images. Every node samples the output
+// of the previous node, so the render graph needs to track both images and create barriers for each node.
+BASE_NS::string CreatePingPongGraphJson(uint32_t count)
+{
+    BASE_NS::string json = R"({"compatibility_info":{"version":"22.00","type":"rendernodegraph"},"nodes":[)";
+    for (uint32_t i = 0U; i < count; ++i) {
+        if (i > 0U) {
+            json += ",";
+        }
+        json += R"({"typeName":"RenderNodeFullscreenGeneric","nodeName":"BenchmarkCopy)";
+        json += BASE_NS::to_string(i);
+        json += R"(","queue":{"type":"graphics","index":0},)";
+        json += R"("shader":"rendershaders://shader/fullscreen_copy.shader",)";
+        json += R"("renderPass":{"attachments":[{"loadOp":"dont_care","storeOp":"store","name":")";
+        json += PING_PONG_IMAGES[(i + 1U) % 2U];
+        json += R"("}],"subpassIndex":0,"subpassCount":1,"subpass":{"colorAttachmentIndices":[0]}},)";
+        json += R"("resources":{"images":[{"set":0,"binding":1,"name":")";
+        json += PING_PONG_IMAGES[i % 2U];
+        json += R"("}],"samplers":[{"set":0,"binding":0,"name":"CORE_DEFAULT_SAMPLER_LINEAR_CLAMP"}]}})";
+    }
+    json += "]}";
+    return json;
+}
+
+// CPU cost of a frame of a render node graph with range(0) nodes. Render node execution and the backend walk are
+// linear in node count, the render graph barrier and state processing grows with nodes and tracked resources.
+void BM_RenderGraphHeadless(benchmark::State& state)
+{
+    CORE_NS::IEngine* engine = GetEngine();
+    HeadlessRenderer renderer;
+    if (!engine || !CreateRenderer(*engine, renderer)) {
+        state.SkipWithError("headless render context not available");
+        return;
+    }
+
+    RENDER_NS::GpuImageDesc desc;
+    desc.width = TARGET_SIZE;
+    desc.height = TARGET_SIZE;
+    desc.depth = 1U;
+    desc.format = BASE_NS::BASE_FORMAT_R8G8B8A8_UNORM;
+    desc.engineCreationFlags = RENDER_NS::CORE_ENGINE_IMAGE_CREATION_DYNAMIC_BARRIERS;
+    desc.imageTiling = RENDER_NS::CORE_IMAGE_TILING_OPTIMAL;
+    desc.imageType = RENDER_NS::CORE_IMAGE_TYPE_2D;
+    desc.imageViewType = RENDER_NS::CORE_IMAGE_VIEW_TYPE_2D;
+    desc.layerCount = 1U;
+    desc.memoryPropertyFlags = RENDER_NS::CORE_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    desc.mipCount = 1U;
+    desc.sampleCountFlags = RENDER_NS::CORE_SAMPLE_COUNT_1_BIT;
+    desc.usageFlags = RENDER_NS::CORE_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | RENDER_NS::CORE_IMAGE_USAGE_SAMPLED_BIT;
+    auto& gpuResourceMgr = renderer.renderContext->GetDevice().GetGpuResourceManager();
+    // named images referenced by the render nodes, kept alive until the end of the benchmark
+    [[maybe_unused]] const RENDER_NS::RenderHandleReference images[] = {
+        gpuResourceMgr.Create(PING_PONG_IMAGES[0U], desc),
+        gpuResourceMgr.Create(PING_PONG_IMAGES[1U], desc),
+    };
+
+    auto& renderNodeGraphMgr = renderer.renderContext->GetRenderNodeGraphManager();
+    const auto result =
+        renderNodeGraphMgr.GetRenderNodeGraphLoader().LoadString(CreatePingPongGraphJson(uint32_t(state.range(0))));
+    if (!result.success) {
+        state.SkipWithError(result.error.c_str());
+        DestroyRenderer(renderer);
+        return;
+    }
+    const RENDER_NS::RenderHandleReference renderNodeGraphs[] = {
+        renderNodeGraphMgr.Create(IRenderNodeGraphManager::RenderNodeGraphUsageType::RENDER_NODE_GRAPH_STATIC,
+            result.desc, "BenchmarkPingPong"),
+    };
+
+    auto& rendererInstance = renderer.renderContext->GetRenderer();
+    // first frame initializes the render nodes and creates the pipelines
+    rendererInstance.RenderFrame(renderNodeGraphs);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rendererInstance.RenderFrame(renderNodeGraphs));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    DestroyRenderer(renderer);
+}
+BENCHMARK(BM_RenderGraphHeadless)->RangeMultiplier(4)->Range(4, 1024)->Unit(benchmark::kMillisecond);
+}  // namespace
+}  // namespace benchmarks
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CORE3D_BENCHMARK_UTILS_HEADER
+#define CORE3D_BENCHMARK_UTILS_HEADER
+
+#include <core/intf_engine.h>
+#include <core/namespace.h>
+
+namespace benchmarks {
+
+// Engine created by the benchmark runner, valid while benchmarks are running.
+CORE_NS::IEngine* GetEngine();
+void SetEngine(CORE_NS::IEngine* engine);
+
+}  // namespace benchmarks
+
+#endif
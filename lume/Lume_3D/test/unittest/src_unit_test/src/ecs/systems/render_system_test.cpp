@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <3d/ecs/components/joint_matrices_component.h>
+#include <3d/ecs/components/layer_component.h>
+#include <3d/ecs/components/material_component.h>
+#include <3d/ecs/components/skin_component.h>
+#include <3d/ecs/systems/intf_node_system.h>
+#include <3d/ecs/systems/intf_render_preprocessor_system.h>
+#include <3d/ecs/systems/intf_skinning_system.h>
+#include <3d/util/intf_mesh_util.h>
+#include <base/containers/string.h>
+#include <base/containers/vector.h>
+#include <base/math/matrix_util.h>
+#include <core/ecs/intf_entity_manager.h>
+#include <core/intf_engine.h>
+#include <core/property/intf_property_handle.h>
+#include <core/property/scoped_handle.h>
+#include <render/datastore/intf_render_data_store_manager.h>
+
+#include "ecs/components/previous_joint_matrices_component.h"
+#include "render/datastore/render_data_store_default_material.h"
+#include "test_framework.h"
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace BASE_NS;
+using namespace CORE_NS;
+using namespace RENDER_NS;
+using namespace CORE3D_NS;
+
+namespace {
+// enough render meshes that the generation counters of the managers are well ahead of single components
+constexpr uint32_t NODE_COUNT = 64U;
+constexpr size_t JOINT_COUNT = 2U;
+constexpr uint64_t FRAME_TIME = 16U;
+
+class RenderSystemTestScene {
+public:
+    RenderSystemTestScene()
+    {
+        UTest::TestContext* testContext = UTest::GetTestContext();
+        ecs_ = UTest::CreateAndInitializeDefaultEcs(*testContext->engine);
+        IEcs& ecs = *ecs_;
+        // the joint matrices are written by the test
+        if (auto skinningSystem = GetSystem<ISkinningSystem>(ecs); skinningSystem) {
+            skinningSystem->SetActive(false);
+        }
+        if (auto preprocessorSystem = GetSystem<IRenderPreprocessorSystem>(ecs); preprocessorSystem) {
+            const auto properties =
+                ScopedHandle<const IRenderPreprocessorSystem::Properties>(preprocessorSystem->GetProperties());
+            dataStore_ = testContext->renderContext->GetRenderDataStoreManager().GetRenderDataStore(
+                properties->dataStoreMaterial);
+        }
+        if (!dataStore_ || (dataStore_->GetTypeName() != RenderDataStoreDefaultMaterial::TYPE_NAME)) {
+            return;
+        }
+        dsMaterial_ = static_cast<RenderDataStoreDefaultMaterial*>(dataStore_.get());
+
+        const Entity material = ecs.GetEntityManager().Create();
+        GetManager<IMaterialComponentManager>(ecs)->Create(material);
+        auto& meshUtil = testContext->graphicsContext->GetMeshUtil();
+        const Entity mesh = meshUtil.GenerateCubeMesh(ecs, "cube", material, 1.0f, 1.0f, 1.0f);
+        auto nodeSystem = GetSystem<INodeSystem>(ecs);
+        auto layerManager = GetManager<ILayerComponentManager>(ecs);
+        for (uint32_t idx = 0U; idx < NODE_COUNT; ++idx) {
+            const Entity entity = meshUtil.GenerateEntity(ecs, "cube" + to_string(idx), mesh);
+            nodeSystem->GetNode(entity)->SetPosition(Math::Vec3(2.0f * static_cast<float>(idx), 0.0f, 0.0f));
+            layerManager->Create(entity);
+            nodes_.push_back(entity);
+        }
+
+        const Entity skinned = nodes_.back();
+        auto skinManager = GetManager<ISkinComponentManager>(ecs);
+        skinManager->Create(skinned);
+        if (auto handle = skinManager->Write(skinned); handle) {
+            handle->skinRoot = ecs.GetEntityManager().Create();
+        }
+        GetManager<IJointMatricesComponentManager>(ecs)->Create(skinned);
+        SetJointMatrices(0.0f);
+        auto prevJointManager = GetManager<IPreviousJointMatricesComponentManager>(ecs);
+        prevJointManager->Create(skinned);
+        if (auto handle = prevJointManager->Write(skinned); handle) {
+            handle->count = JOINT_COUNT;
+        }
+    }
+
+    bool IsValid() const
+    {
+        return dsMaterial_ != nullptr;
+    }
+
+    IEcs& GetEcs()
+    {
+        return *ecs_;
+    }
+
+    const vector<Entity>& GetNodes() const
+    {
+        return nodes_;
+    }
+
+    void SetJointMatrices(const float offset)
+    {
+        if (auto handle = GetManager<IJointMatricesComponentManager>(*ecs_)->Write(nodes_.back()); handle) {
+            handle->count = JOINT_COUNT;
+            for (size_t idx = 0U; idx < JOINT_COUNT; ++idx) {
+                handle->jointMatrices[idx] =
+                    Math::Translate(Math::IDENTITY_4X4, Math::Vec3(offset, static_cast<float>(idx), 0.0f));
+            }
+            handle->jointsAabbMin = Math::Vec3(offset - 1.0f, -1.0f, -1.0f);
+            handle->jointsAabbMax = Math::Vec3(offset + 1.0f, static_cast<float>(JOINT_COUNT), 1.0f);
+        }
+    }
+
+    // updates the ECS and calls the check with the frame data the render system added
+    template<typename Check>
+    void RunFrame(Check&& check)
+    {
+        ++frame_;
+        ecs_->ProcessEvents();
+        ecs_->Update(frame_ * FRAME_TIME, FRAME_TIME);
+        dsMaterial_->PreRender();
+        check(*dsMaterial_);
+        dsMaterial_->PostRender();
+    }
+
+    void RunFrame()
+    {
+        RunFrame([](const RenderDataStoreDefaultMaterial&) {});
+    }
+
+    // the render mesh data was patched instead of added again
+    bool HasRetainedFrameMeshData() const
+    {
+        return dsMaterial_->HasRetainedFrameMeshData();
+    }
+
+private:
+    IEcs::Ptr ecs_;
+    refcnt_ptr<IRenderDataStore> dataStore_;
+    RenderDataStoreDefaultMaterial* dsMaterial_{nullptr};
+    vector<Entity> nodes_;
+    uint64_t frame_{0U};
+};
+
+const RenderMeshData* FindMeshData(const RenderDataStoreDefaultMaterial& dsMaterial, const Entity entity)
+{
+    for (const auto& meshData : dsMaterial.GetMeshData()) {
+        if (meshData.id == entity.id) {
+            return &meshData;
+        }
+    }
+    return nullptr;
+}
+}  // namespace
+
+/**
+ * @tc.name: RetainedTransformChange
+ * @tc.desc: Tests that a node moved after the first frames updates the retained render mesh data.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_EcsRenderSystem, RetainedTransformChange, testing::ext::TestSize.Level1)
+{
+    RenderSystemTestScene scene;
+    ASSERT_TRUE(scene.IsValid());
+    scene.RunFrame();
+    scene.RunFrame();
+    // retained render mesh data is used by default
+    EXPECT_TRUE(scene.HasRetainedFrameMeshData());
+
+    const Entity node = scene.GetNodes()[NODE_COUNT / 2U];
+    for (uint32_t idx = 1U; idx < 4U; ++idx) {
+        const Math::Vec3 position(0.0f, static_cast<float>(idx), -1.0f);
+        GetSystem<INodeSystem>(scene.GetEcs())->GetNode(node)->SetPosition(position);
+        scene.RunFrame([&](const RenderDataStoreDefaultMaterial& dsMaterial) {
+            const RenderMeshData* meshData = FindMeshData(dsMaterial, node);
+            ASSERT_NE(nullptr, meshData);
+            EXPECT_TRUE(Math::Translate(Math::IDENTITY_4X4, position) == meshData->world);
+        });
+        EXPECT_TRUE(scene.HasRetainedFrameMeshData());
+    }
+}
+
+/**
+ * @tc.name: RetainedLayerChange
+ * @tc.desc: Tests that a layer changed after the first frames updates the retained render mesh data.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_EcsRenderSystem, RetainedLayerChange, testing::ext::TestSize.Level1)
+{
+    RenderSystemTestScene scene;
+    ASSERT_TRUE(scene.IsValid());
+    scene.RunFrame();
+    scene.RunFrame();
+    // retained render mesh data is used by default
+    EXPECT_TRUE(scene.HasRetainedFrameMeshData());
+
+    const Entity node = scene.GetNodes()[NODE_COUNT / 2U];
+    const uint64_t layerMasks[] = {LayerFlagBits::CORE_LAYER_FLAG_BIT_01, LayerConstants::DEFAULT_LAYER_MASK};
+    for (const uint64_t layerMask : layerMasks) {
+        if (auto handle = GetManager<ILayerComponentManager>(scene.GetEcs())->Write(node); handle) {
+            handle->layerMask = layerMask;
+        }
+        scene.RunFrame([&](const RenderDataStoreDefaultMaterial& dsMaterial) {
+            const RenderMeshData* meshData = FindMeshData(dsMaterial, node);
+            ASSERT_NE(nullptr, meshData);
+            EXPECT_EQ(layerMask, meshData->layerMask);
+        });
+        EXPECT_TRUE(scene.HasRetainedFrameMeshData());
+    }
+}
+
+/**
+ * @tc.name: RetainedJointChange
+ * @tc.desc: Tests that joint matrices changed after the first frames update the retained skin data.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_EcsRenderSystem, RetainedJointChange, testing::ext::TestSize.Level1)
+{
+    RenderSystemTestScene scene;
+    ASSERT_TRUE(scene.IsValid());
+    scene.RunFrame();
+    scene.RunFrame();
+    // retained render mesh data is used by default
+    EXPECT_TRUE(scene.HasRetainedFrameMeshData());
+
+    for (uint32_t idx = 1U; idx < 4U; ++idx) {
+        const float offset = static_cast<float>(idx);
+        scene.SetJointMatrices(offset);
+        scene.RunFrame([offset](const RenderDataStoreDefaultMaterial& dsMaterial) {
+            const auto joints = dsMaterial.GetMeshJointMatrices();
+            ASSERT_EQ(1U, joints.size());
+            ASSERT_LE(JOINT_COUNT, joints[0U].count);
+            for (size_t jointIdx = 0U; jointIdx < JOINT_COUNT; ++jointIdx) {
+                EXPECT_TRUE(Math::Translate(Math::IDENTITY_4X4,
+                                Math::Vec3(offset, static_cast<float>(jointIdx), 0.0f)) == joints[0U].data[jointIdx]);
+            }
+        });
+        EXPECT_TRUE(scene.HasRetainedFrameMeshData());
+    }
+}
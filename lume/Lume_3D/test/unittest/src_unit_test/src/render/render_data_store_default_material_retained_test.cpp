@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <3d/ecs/components/joint_matrices_component.h>
+#include <3d/ecs/components/layer_component.h>
+#include <3d/ecs/components/material_component.h>
+#include <3d/ecs/components/skin_component.h>
+#include <3d/ecs/systems/intf_node_system.h>
+#include <3d/ecs/systems/intf_render_preprocessor_system.h>
+#include <3d/ecs/systems/intf_skinning_system.h>
+#include <3d/util/intf_mesh_util.h>
+#include <base/containers/string.h>
+#include <base/containers/vector.h>
+#include <base/math/matrix_util.h>
+#include <core/ecs/intf_entity_manager.h>
+#include <core/intf_engine.h>
+#include <core/property/intf_property_handle.h>
+#include <core/property/scoped_handle.h>
+#include <render/datastore/intf_render_data_store_manager.h>
+
+#include "ecs/components/previous_joint_matrices_component.h"
+#include "render/datastore/render_data_store_default_material.h"
+#include "test_framework.h"
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace BASE_NS;
+using namespace CORE_NS;
+using namespace RENDER_NS;
+using namespace CORE3D_NS;
+
+namespace {
+constexpr uint32_t NODE_COUNT = 4U;
+constexpr size_t JOINT_COUNT = 2U;
+constexpr uint64_t FRAME_TIME = 16U;
+
+struct RetainedTestScene {
+    IEcs::Ptr ecs;
+    refcnt_ptr<IRenderDataStore> dataStore;
+    RenderDataStoreDefaultMaterial* dsMaterial{nullptr};
+    Entity material;
+    Entity mesh;
+    vector<Entity> nodes;
+    Entity skinned;
+};
+
+void SetJointMatrices(IEcs& ecs, const Entity entity, const float offset)
+{
+    if (auto handle = GetManager<IJointMatricesComponentManager>(ecs)->Write(entity); handle) {
+        handle->count = JOINT_COUNT;
+        for (size_t idx = 0U; idx < JOINT_COUNT; ++idx) {
+            handle->jointMatrices[idx] =
+                Math::Translate(Math::IDENTITY_4X4, Math::Vec3(offset, static_cast<float>(idx), 0.0f));
+        }
+        handle->jointsAabbMin = Math::Vec3(offset - 1.0f, -1.0f, -1.0f);
+        handle->jointsAabbMax = Math::Vec3(offset + 1.0f, static_cast<float>(JOINT_COUNT), 1.0f);
+    }
+}
+
+void CreateScene(IEngine& engine, IGraphicsContext& graphicsContext, IRenderContext& renderContext,
+    const bool retained, RetainedTestScene& scene)
+{
+    scene.ecs = UTest::CreateAndInitializeDefaultEcs(engine);
+    IEcs& ecs = *scene.ecs;
+    // the joint matrices are written by the test
+    if (auto skinningSystem = GetSystem<ISkinningSystem>(ecs); skinningSystem) {
+        skinningSystem->SetActive(false);
+    }
+    auto preprocessorSystem = GetSystem<IRenderPreprocessorSystem>(ecs);
+    ASSERT_TRUE(preprocessorSystem);
+    {
+        const auto properties =
+            ScopedHandle<const IRenderPreprocessorSystem::Properties>(preprocessorSystem->GetProperties());
+        scene.dataStore = renderContext.GetRenderDataStoreManager().GetRenderDataStore(properties->dataStoreMaterial);
+    }
+    ASSERT_TRUE(scene.dataStore);
+    ASSERT_EQ(RenderDataStoreDefaultMaterial::TYPE_NAME, scene.dataStore->GetTypeName());
+    scene.dsMaterial = static_cast<RenderDataStoreDefaultMaterial*>(scene.dataStore.get());
+    scene.dsMaterial->SetRetainedFrameMeshDataEnabled(retained);
+
+    auto materialManager = GetManager<IMaterialComponentManager>(ecs);
+    scene.material = ecs.GetEntityManager().Create();
+    materialManager->Create(scene.material);
+
+    auto& meshUtil = graphicsContext.GetMeshUtil();
+    scene.mesh = meshUtil.GenerateCubeMesh(ecs, "cube", scene.material, 1.0f, 1.0f, 1.0f);
+    auto nodeSystem = GetSystem<INodeSystem>(ecs);
+    for (uint32_t idx = 0U; idx < NODE_COUNT; ++idx) {
+        const Entity entity = meshUtil.GenerateEntity(ecs, "cube" + to_string(idx), scene.mesh);
+        nodeSystem->GetNode(entity)->SetPosition(Math::Vec3(2.0f * static_cast<float>(idx), 0.0f, 0.0f));
+        scene.nodes.push_back(entity);
+    }
+    GetManager<ILayerComponentManager>(ecs)->Create(scene.nodes[0U]);
+
+    scene.skinned = scene.nodes.back();
+    auto skinManager = GetManager<ISkinComponentManager>(ecs);
+    skinManager->Create(scene.skinned);
+    if (auto handle = skinManager->Write(scene.skinned); handle) {
+        handle->skinRoot = ecs.GetEntityManager().Create();
+    }
+    GetManager<IJointMatricesComponentManager>(ecs)->Create(scene.skinned);
+    SetJointMatrices(ecs, scene.skinned, 0.0f);
+    auto prevJointManager = GetManager<IPreviousJointMatricesComponentManager>(ecs);
+    prevJointManager->Create(scene.skinned);
+    if (auto handle = prevJointManager->Write(scene.skinned); handle) {
+        handle->count = JOINT_COUNT;
+    }
+}
+
+void ExpectSameFrameData(const RenderDataStoreDefaultMaterial& retained, const RenderDataStoreDefaultMaterial& full)
+{
+    const auto meshes = retained.GetMeshData();
+    const auto fullMeshes = full.GetMeshData();
+    ASSERT_EQ(fullMeshes.size(), meshes.size());
+    for (size_t idx = 0U; idx < meshes.size(); ++idx) {
+        EXPECT_EQ(fullMeshes[idx].id, meshes[idx].id);
+        EXPECT_EQ(fullMeshes[idx].meshId, meshes[idx].meshId);
+        EXPECT_EQ(fullMeshes[idx].layerMask, meshes[idx].layerMask);
+        EXPECT_EQ(fullMeshes[idx].sceneId, meshes[idx].sceneId);
+        EXPECT_TRUE(fullMeshes[idx].world == meshes[idx].world);
+        EXPECT_TRUE(fullMeshes[idx].prevWorld == meshes[idx].prevWorld);
+    }
+
+    const auto submeshes = retained.GetSubmeshes();
+    const auto fullSubmeshes = full.GetSubmeshes();
+    ASSERT_EQ(fullSubmeshes.size(), submeshes.size());
+    for (size_t idx = 0U; idx < submeshes.size(); ++idx) {
+        const auto& submesh = submeshes[idx];
+        const auto& fullSubmesh = fullSubmeshes[idx];
+        EXPECT_EQ(fullSubmesh.submeshFlags, submesh.submeshFlags);
+        EXPECT_EQ(fullSubmesh.indices.id, submesh.indices.id);
+        EXPECT_EQ(fullSubmesh.indices.meshIndex, submesh.indices.meshIndex);
+        EXPECT_EQ(fullSubmesh.indices.skinJointIndex, submesh.indices.skinJointIndex);
+        EXPECT_EQ(fullSubmesh.indices.materialIndex, submesh.indices.materialIndex);
+        EXPECT_EQ(fullSubmesh.indices.materialFrameOffset, submesh.indices.materialFrameOffset);
+        EXPECT_EQ(fullSubmesh.layers.layerMask, submesh.layers.layerMask);
+        EXPECT_EQ(fullSubmesh.drawCommand.instanceCount, submesh.drawCommand.instanceCount);
+        EXPECT_TRUE(fullSubmesh.bounds.worldCenter == submesh.bounds.worldCenter);
+        EXPECT_EQ(fullSubmesh.bounds.worldRadius, submesh.bounds.worldRadius);
+    }
+
+    const auto joints = retained.GetMeshJointMatrices();
+    const auto fullJoints = full.GetMeshJointMatrices();
+    ASSERT_EQ(fullJoints.size(), joints.size());
+    for (size_t idx = 0U; idx < joints.size(); ++idx) {
+        ASSERT_EQ(fullJoints[idx].count, joints[idx].count);
+        for (uint32_t jointIdx = 0U; jointIdx < joints[idx].count; ++jointIdx) {
+            EXPECT_TRUE(fullJoints[idx].data[jointIdx] == joints[idx].data[jointIdx]);
+        }
+    }
+
+    const auto frameIndices = retained.GetMaterialFrameIndices();
+    const auto fullFrameIndices = full.GetMaterialFrameIndices();
+    ASSERT_EQ(fullFrameIndices.size(), frameIndices.size());
+    for (size_t idx = 0U; idx < frameIndices.size(); ++idx) {
+        EXPECT_EQ(fullFrameIndices[idx], frameIndices[idx]);
+    }
+    const auto uniforms = retained.GetMaterialUniforms();
+    const auto fullUniforms = full.GetMaterialUniforms();
+    ASSERT_EQ(fullUniforms.size(), uniforms.size());
+    for (size_t idx = 0U; idx < uniforms.size(); ++idx) {
+        EXPECT_TRUE(fullUniforms[idx].factors.factors[0U] == uniforms[idx].factors.factors[0U]);
+    }
+
+    const auto info = retained.GetRenderFrameObjectInfo();
+    const auto fullInfo = full.GetRenderFrameObjectInfo();
+    EXPECT_EQ(fullInfo.renderMaterialFlags, info.renderMaterialFlags);
+    EXPECT_TRUE(fullInfo.shadowCasterBoundingSphere.center == info.shadowCasterBoundingSphere.center);
+    EXPECT_EQ(fullInfo.shadowCasterBoundingSphere.radius, info.shadowCasterBoundingSphere.radius);
+
+    const auto counts = retained.GetObjectCounts();
+    const auto fullCounts = full.GetObjectCounts();
+    EXPECT_EQ(fullCounts.meshCount, counts.meshCount);
+    EXPECT_EQ(fullCounts.submeshCount, counts.submeshCount);
+    EXPECT_EQ(fullCounts.skinCount, counts.skinCount);
+    EXPECT_EQ(fullCounts.materialCount, counts.materialCount);
+}
+
+// runs the same scene with retained frame data and with a full rebuild every frame
+class RetainedTestScenes {
+public:
+    RetainedTestScenes()
+    {
+        UTest::TestContext* testContext = UTest::GetTestContext();
+        CreateScene(*testContext->engine, *testContext->graphicsContext, *testContext->renderContext, true, retained_);
+        CreateScene(*testContext->engine, *testContext->graphicsContext, *testContext->renderContext, false, full_);
+    }
+
+    bool IsValid() const
+    {
+        return retained_.dsMaterial && full_.dsMaterial;
+    }
+
+    // modifies both scenes, updates the ECS, and lets the data store add frame data before rendering
+    template<typename Modify, typename AddFrameData>
+    void RunFrame(Modify&& modify, AddFrameData&& addFrameData)
+    {
+        ++frame_;
+        for (RetainedTestScene* scene : {&retained_, &full_}) {
+            modify(*scene);
+            scene->ecs->ProcessEvents();
+            scene->ecs->Update(frame_ * FRAME_TIME, FRAME_TIME);
+            addFrameData(*scene);
+            scene->dsMaterial->PreRender();
+        }
+        ExpectSameFrameData(*retained_.dsMaterial, *full_.dsMaterial);
+        for (RetainedTestScene* scene : {&retained_, &full_}) {
+            scene->dsMaterial->PostRender();
+        }
+    }
+
+    template<typename Modify>
+    void RunFrame(Modify&& modify)
+    {
+        RunFrame(modify, [](RetainedTestScene&) {});
+    }
+
+    void RunFrame()
+    {
+        RunFrame([](RetainedTestScene&) {});
+    }
+
+    // the frame data of the previous frame is kept for patching
+    bool HasRetainedFrameMeshData() const
+    {
+        return retained_.dsMaterial->HasRetainedFrameMeshData();
+    }
+
+private:
+    RetainedTestScene retained_;
+    RetainedTestScene full_;
+    uint64_t frame_{0U};
+};
+}  // namespace
+
+/**
+ * @tc.name: TransformChange
+ * @tc.desc: Tests that patched world matrices match a full rebuild of the frame data.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_RenderDataStoreDefaultMaterialRetained, TransformChange, testing::ext::TestSize.Level1)
+{
+    RetainedTestScenes scenes;
+    ASSERT_TRUE(scenes.IsValid());
+    scenes.RunFrame();
+    scenes.RunFrame();
+    EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+
+    for (uint32_t idx = 0U; idx < 3U; ++idx) {
+        scenes.RunFrame([idx](RetainedTestScene& scene) {
+            auto nodeSystem = GetSystem<INodeSystem>(*scene.ecs);
+            nodeSystem->GetNode(scene.nodes[1U])->SetPosition(Math::Vec3(1.0f, static_cast<float>(idx), 0.0f));
+            nodeSystem->GetNode(scene.skinned)->SetScale(Math::Vec3(1.0f + static_cast<float>(idx)));
+        });
+        EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+    }
+    // no changes
+    scenes.RunFrame();
+    // inverse winding
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        GetSystem<INodeSystem>(*scene.ecs)->GetNode(scene.nodes[0U])->SetScale(Math::Vec3(-1.0f, 1.0f, 1.0f));
+    });
+    scenes.RunFrame();
+}
+
+/**
+ * @tc.name: LayerChange
+ * @tc.desc: Tests that patched layer masks match a full rebuild of the frame data.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_RenderDataStoreDefaultMaterialRetained, LayerChange, testing::ext::TestSize.Level1)
+{
+    RetainedTestScenes scenes;
+    ASSERT_TRUE(scenes.IsValid());
+    scenes.RunFrame();
+    scenes.RunFrame();
+    EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        if (auto handle = GetManager<ILayerComponentManager>(*scene.ecs)->Write(scene.nodes[0U]); handle) {
+            handle->layerMask = LayerFlagBits::CORE_LAYER_FLAG_BIT_01;
+        }
+    });
+    EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+    // layer and transform change of the same render mesh
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        if (auto handle = GetManager<ILayerComponentManager>(*scene.ecs)->Write(scene.nodes[0U]); handle) {
+            handle->layerMask = LayerConstants::DEFAULT_LAYER_MASK;
+        }
+        GetSystem<INodeSystem>(*scene.ecs)->GetNode(scene.nodes[0U])->SetPosition(Math::Vec3(0.0f, 1.0f, 0.0f));
+    });
+    scenes.RunFrame();
+}
+
+/**
+ * @tc.name: MaterialChange
+ * @tc.desc: Tests that retained frame data with material changes matches a full rebuild of the frame data.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_RenderDataStoreDefaultMaterialRetained, MaterialChange, testing::ext::TestSize.Level1)
+{
+    RetainedTestScenes scenes;
+    ASSERT_TRUE(scenes.IsValid());
+    scenes.RunFrame();
+    scenes.RunFrame();
+    EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+
+    // uniforms are read with the material index
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        if (auto handle = GetManager<IMaterialComponentManager>(*scene.ecs)->Write(scene.material); handle) {
+            handle->textures[MaterialComponent::TextureIndex::BASE_COLOR].factor = Math::Vec4(1.0f, 0.0f, 0.0f, 1.0f);
+        }
+    });
+    EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+    // shadow casting changes the material flags of the frame
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        if (auto handle = GetManager<IMaterialComponentManager>(*scene.ecs)->Write(scene.material); handle) {
+            handle->materialLightingFlags &= ~MaterialComponent::LightingFlagBits::SHADOW_CASTER_BIT;
+        }
+    });
+    scenes.RunFrame();
+}
+
+/**
+ * @tc.name: SkinChange
+ * @tc.desc: Tests that patched skin joint matrices match a full rebuild of the frame data.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_RenderDataStoreDefaultMaterialRetained, SkinChange, testing::ext::TestSize.Level1)
+{
+    RetainedTestScenes scenes;
+    ASSERT_TRUE(scenes.IsValid());
+    scenes.RunFrame();
+    scenes.RunFrame();
+    EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+
+    for (uint32_t idx = 1U; idx < 3U; ++idx) {
+        scenes.RunFrame([idx](RetainedTestScene& scene) {
+            SetJointMatrices(*scene.ecs, scene.skinned, static_cast<float>(idx));
+            if (auto handle =
+                    GetManager<IPreviousJointMatricesComponentManager>(*scene.ecs)->Write(scene.skinned);
+                handle) {
+                handle->jointMatrices[0U] = Math::Translate(Math::IDENTITY_4X4, Math::Vec3(static_cast<float>(idx)));
+            }
+        });
+        EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+    }
+    // joint count change
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        if (auto handle = GetManager<IJointMatricesComponentManager>(*scene.ecs)->Write(scene.skinned); handle) {
+            handle->count = 1U;
+        }
+    });
+    scenes.RunFrame();
+}
+
+/**
+ * @tc.name: EntityAddAndRemove
+ * @tc.desc: Tests that retained frame data with added and removed render meshes matches a full rebuild.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_RenderDataStoreDefaultMaterialRetained, EntityAddAndRemove, testing::ext::TestSize.Level1)
+{
+    RetainedTestScenes scenes;
+    ASSERT_TRUE(scenes.IsValid());
+    scenes.RunFrame();
+    scenes.RunFrame();
+    EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        auto& meshUtil = UTest::GetTestContext()->graphicsContext->GetMeshUtil();
+        const Entity entity = meshUtil.GenerateEntity(*scene.ecs, "added", scene.mesh);
+        GetSystem<INodeSystem>(*scene.ecs)->GetNode(entity)->SetPosition(Math::Vec3(0.0f, 0.0f, 2.0f));
+        scene.nodes.push_back(entity);
+    });
+    scenes.RunFrame();
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        scene.ecs->GetEntityManager().Destroy(scene.nodes[1U]);
+        scene.nodes.erase(scene.nodes.begin() + 1);
+    });
+    scenes.RunFrame();
+    // transform change after the renderable set changed
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        GetSystem<INodeSystem>(*scene.ecs)->GetNode(scene.nodes.back())->SetPosition(Math::Vec3(0.0f, 2.0f, 2.0f));
+    });
+}
+
+/**
+ * @tc.name: ExternalFrameData
+ * @tc.desc: Tests that retained frame data with render meshes added outside the render system matches a full rebuild.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_RenderDataStoreDefaultMaterialRetained, ExternalFrameData, testing::ext::TestSize.Level1)
+{
+    RetainedTestScenes scenes;
+    ASSERT_TRUE(scenes.IsValid());
+    scenes.RunFrame();
+    scenes.RunFrame();
+    EXPECT_TRUE(scenes.HasRetainedFrameMeshData());
+
+    const auto addExternal = [](RetainedTestScene& scene) {
+        RenderMeshData rmd;
+        rmd.world = Math::Translate(Math::IDENTITY_4X4, Math::Vec3(0.0f, -2.0f, 0.0f));
+        rmd.normalWorld = rmd.world;
+        rmd.prevWorld = rmd.world;
+        rmd.id = scene.mesh.id + 0xFFFFU;
+        rmd.meshId = scene.mesh.id;
+        scene.dsMaterial->AddFrameRenderMeshData(rmd);
+    };
+    scenes.RunFrame([](RetainedTestScene&) {}, addExternal);
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        GetSystem<INodeSystem>(*scene.ecs)->GetNode(scene.nodes[1U])->SetPosition(Math::Vec3(1.0f, 1.0f, 0.0f));
+    });
+    scenes.RunFrame([](RetainedTestScene& scene) {
+        GetSystem<INodeSystem>(*scene.ecs)->GetNode(scene.nodes[1U])->SetPosition(Math::Vec3(1.0f, 2.0f, 0.0f));
+    });
+    // external data on top of patched data
+    scenes.RunFrame(
+        [](RetainedTestScene& scene) {
+            GetSystem<INodeSystem>(*scene.ecs)->GetNode(scene.nodes[1U])->SetPosition(Math::Vec3(1.0f, 3.0f, 0.0f));
+        },
+        addExternal);
+    scenes.RunFrame();
+}
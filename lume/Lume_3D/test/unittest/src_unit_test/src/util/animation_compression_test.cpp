@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <util/animation_compression.h>
+
+#include <base/containers/vector.h>
+#include <base/math/quaternion_util.h>
+#include <base/math/vector.h>
+#include <core/property/property_types.h>
+
+#include "test_framework.h"
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace BASE_NS;
+using namespace CORE_NS;
+using namespace CORE3D_NS;
+
+namespace {
+constexpr size_t KEYFRAME_COUNT = 300U;
+constexpr float FRAME_TIME = 1.0f / 30.0f;
+
+vector<float> CreateTimestamps()
+{
+    vector<float> timestamps;
+    for (size_t i = 0U; i < KEYFRAME_COUNT; ++i) {
+        timestamps.push_back(static_cast<float>(i) * FRAME_TIME);
+    }
+    return timestamps;
+}
+
+template<typename T>
+array_view<const uint8_t> AsBytes(const vector<T>& values)
+{
+    return array_view(reinterpret_cast<const uint8_t*>(values.data()), values.size_in_bytes());
+}
+
+template<typename T>
+array_view<const T> AsValues(const vector<uint8_t>& data)
+{
+    return array_view(reinterpret_cast<const T*>(data.data()), data.size() / sizeof(T));
+}
+}  // namespace
+
+/**
+ * @tc.name: CompressLinearPositions
+ * @tc.desc: Tests that a smooth vec3 track is reduced and decompresses within the tolerance and quantization error.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_UtilAnimationCompression, CompressLinearPositions, testing::ext::TestSize.Level1)
+{
+    const auto timestamps = CreateTimestamps();
+    vector<Math::Vec3> positions;
+    for (const float time : timestamps) {
+        positions.push_back(Math::Vec3(std::sin(time * 0.5f), 2.0f * time, std::cos(time * 0.25f)));
+    }
+    const auto compressed = AnimationCompression::Compress(
+        PropertyType::VEC3_T, AnimationTrackComponent::Interpolation::LINEAR, timestamps, AsBytes(positions));
+    ASSERT_FALSE(compressed.empty());
+    EXPECT_LT(compressed.size(), positions.size_in_bytes());
+
+    AnimationCompression::Track track;
+    ASSERT_TRUE(AnimationCompression::GetTrack(compressed, track));
+    EXPECT_LT(track.timestamps.size(), timestamps.size());
+    EXPECT_EQ(track.timestamps[0U], timestamps[0U]);
+    EXPECT_EQ(track.timestamps[track.timestamps.size() - 1U], timestamps.back());
+
+    const auto decompressed =
+        AnimationCompression::Decompress(compressed, AnimationTrackComponent::Interpolation::LINEAR, timestamps);
+    const auto values = AsValues<Math::Vec3>(decompressed);
+    ASSERT_EQ(values.size(), positions.size());
+    // tolerance and half a quantization step of the largest range.
+    const float maxError = AnimationCompression::DEFAULT_TOLERANCE + 2.0f * 10.0f / 65535.0f;
+    for (size_t i = 0U; i < values.size(); ++i) {
+        EXPECT_NEAR(positions[i].x, values[i].x, maxError);
+        EXPECT_NEAR(positions[i].y, values[i].y, maxError);
+        EXPECT_NEAR(positions[i].z, values[i].z, maxError);
+    }
+}
+
+/**
+ * @tc.name: CompressRotations
+ * @tc.desc: Tests that rotations are decoded as unit quaternions close to the originals.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_UtilAnimationCompression, CompressRotations, testing::ext::TestSize.Level1)
+{
+    const auto timestamps = CreateTimestamps();
+    vector<Math::Quat> rotations;
+    for (const float time : timestamps) {
+        rotations.push_back(Math::AngleAxis(time * 2.0f, Math::Normalize(Math::Vec3(1.0f, 2.0f, 0.5f))));
+    }
+    for (const auto mode : { AnimationTrackComponent::Interpolation::STEP,
+             AnimationTrackComponent::Interpolation::LINEAR }) {
+        const auto compressed =
+            AnimationCompression::Compress(PropertyType::QUAT_T, mode, timestamps, AsBytes(rotations));
+        ASSERT_FALSE(compressed.empty());
+        EXPECT_LT(compressed.size(), rotations.size_in_bytes());
+
+        const auto decompressed = AnimationCompression::Decompress(compressed, mode, timestamps);
+        const auto values = AsValues<Math::Quat>(decompressed);
+        ASSERT_EQ(values.size(), rotations.size());
+        for (size_t i = 0U; i < values.size(); ++i) {
+            EXPECT_NEAR(Math::Dot(values[i], values[i]), 1.0f, 0.0001f);
+            // q and -q are the same rotation.
+            EXPECT_NEAR(std::abs(Math::Dot(rotations[i], values[i])), 1.0f, 0.0001f);
+        }
+    }
+}
+
+/**
+ * @tc.name: CompressStep
+ * @tc.desc: Tests that step tracks keep the keyframes where the value changes.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_UtilAnimationCompression, CompressStep, testing::ext::TestSize.Level1)
+{
+    const auto timestamps = CreateTimestamps();
+    vector<float> values;
+    for (size_t i = 0U; i < KEYFRAME_COUNT; ++i) {
+        values.push_back(static_cast<float>(i / 100U));
+    }
+    const auto compressed = AnimationCompression::Compress(
+        PropertyType::FLOAT_T, AnimationTrackComponent::Interpolation::STEP, timestamps, AsBytes(values));
+    AnimationCompression::Track track;
+    ASSERT_TRUE(AnimationCompression::GetTrack(compressed, track));
+    EXPECT_LT(track.timestamps.size(), 10U);
+
+    const auto decompressed =
+        AnimationCompression::Decompress(compressed, AnimationTrackComponent::Interpolation::STEP, timestamps);
+    const auto decoded = AsValues<float>(decompressed);
+    ASSERT_EQ(decoded.size(), values.size());
+    for (size_t i = 0U; i < values.size(); ++i) {
+        EXPECT_NEAR(values[i], decoded[i], 0.0001f);
+    }
+}
+
+/**
+ * @tc.name: UnsupportedAndInvalidData
+ * @tc.desc: Tests that splines, unsupported types and mismatching data aren't compressed, and that invalid data is
+ * rejected.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_UtilAnimationCompression, UnsupportedAndInvalidData, testing::ext::TestSize.Level1)
+{
+    const auto timestamps = CreateTimestamps();
+    vector<Math::Vec3> positions(KEYFRAME_COUNT * 3U);
+    EXPECT_TRUE(AnimationCompression::Compress(
+        PropertyType::VEC3_T, AnimationTrackComponent::Interpolation::SPLINE, timestamps, AsBytes(positions))
+                    .empty());
+    EXPECT_TRUE(AnimationCompression::Compress(
+        PropertyType::BOOL_T, AnimationTrackComponent::Interpolation::STEP, timestamps, AsBytes(positions))
+                    .empty());
+    EXPECT_TRUE(AnimationCompression::Compress(
+        PropertyType::VEC3_T, AnimationTrackComponent::Interpolation::LINEAR, timestamps, AsBytes(positions))
+                    .empty());
+
+    AnimationCompression::Track track;
+    EXPECT_FALSE(AnimationCompression::GetTrack({}, track));
+    positions.resize(KEYFRAME_COUNT);
+    auto compressed = AnimationCompression::Compress(
+        PropertyType::VEC3_T, AnimationTrackComponent::Interpolation::LINEAR, timestamps, AsBytes(positions));
+    ASSERT_TRUE(AnimationCompression::GetTrack(compressed, track));
+    compressed.pop_back();
+    EXPECT_FALSE(AnimationCompression::GetTrack(compressed, track));
+}
+
+/**
+ * @tc.name: Scale
+ * @tc.desc: Tests that scaling quantized data scales the decoded values.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_UtilAnimationCompression, Scale, testing::ext::TestSize.Level1)
+{
+    const auto timestamps = CreateTimestamps();
+    vector<Math::Vec3> positions;
+    for (const float time : timestamps) {
+        positions.push_back(Math::Vec3(time, -time, 1.0f));
+    }
+    auto compressed = AnimationCompression::Compress(
+        PropertyType::VEC3_T, AnimationTrackComponent::Interpolation::LINEAR, timestamps, AsBytes(positions));
+    ASSERT_TRUE(AnimationCompression::Scale(compressed, 2.0f));
+
+    AnimationCompression::Track track;
+    ASSERT_TRUE(AnimationCompression::GetTrack(compressed, track));
+    float values[3U];
+    AnimationCompression::DecodeKeyframe(track, track.timestamps.size() - 1U, values);
+    EXPECT_NEAR(values[0U], 2.0f * positions.back().x, 0.001f);
+    EXPECT_NEAR(values[1U], 2.0f * positions.back().y, 0.001f);
+    EXPECT_NEAR(values[2U], 2.0f, 0.001f);
+}
@@ -13,7 +13,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <util/bowyer_watson_delaunay_3d.h>
 
 #include <3d/ecs/components/light_probe_group_component.h>
@@ -406,4 +408,66 @@ UNIT_TEST(SRC_BowyerWatsonDelaunay3D, TetrahedronVertexMatch, testing::ext::Test
     delaunay.BuildTetrahedralMesh(volume);
 
     EXPECT_TRUE(ValidateVertexMatch(tetrahedrons, probes));
-}
\ No newline at end of file
+}
+UNIT_TEST(SRC_BowyerWatsonDelaunay3D, BuildTetrahedralMesh_Adjacency, testing::ext::TestSize.Level1)
+{
+    vector<LightProbeGroupComponent::LightProbe> probes = CreateManyProbes(100);
+    vector<Tetrahedron> tetrahedrons;
+    vector<TetrahedronAdjacency> adjacency;
+
+    BowyerWatsonDelaunay3D delaunay;
+    BowyerWatsonDelaunay3D::LightProbeVolume volume{probes, tetrahedrons, &adjacency};
+    delaunay.BuildTetrahedralMesh(volume);
+
+    ASSERT_EQ(adjacency.size(), tetrahedrons.size());
+    uint32_t hullFaces = 0U;
+    for (uint32_t tetIndex = 0U; tetIndex < tetrahedrons.size(); ++tetIndex) {
+        const Tetrahedron& tet = tetrahedrons[tetIndex];
+        for (uint32_t face = 0U; face < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++face) {
+            const uint32_t neighbor = adjacency[tetIndex].neighbors[face];
+            if (neighbor == TetrahedronAdjacency::INVALID_NEIGHBOR) {
+                ++hullFaces;
+                continue;
+            }
+            ASSERT_LT(neighbor, tetrahedrons.size());
+            // The neighbor links back and has the three vertices of the face but not the opposite one.
+            const auto& back = adjacency[neighbor].neighbors;
+            EXPECT_NE(std::find(std::begin(back), std::end(back), tetIndex), std::end(back));
+            const auto& other = tetrahedrons[neighbor].indices;
+            for (uint32_t i = 0U; i < LightProbeConstants::TETRAHEDRON_LIGHT_PROBE_COUNT; ++i) {
+                const bool shared = std::find(std::begin(other), std::end(other), tet.indices[i]) != std::end(other);
+                EXPECT_EQ(shared, i != face);
+            }
+        }
+    }
+    EXPECT_GT(hullFaces, 0U);
+}
+
+UNIT_TEST(SRC_BowyerWatsonDelaunay3D, BuildTetrahedralMesh_Grid, testing::ext::TestSize.Level1)
+{
+    // Grid cells have all their corners on one sphere, the tetrahedrons must still fill the grid without overlap.
+    constexpr uint32_t gridSize = 6U;
+    vector<LightProbeGroupComponent::LightProbe> probes;
+    for (uint32_t i = 0; i < gridSize * gridSize * gridSize; ++i) {
+        LightProbeGroupComponent::LightProbe probe;
+        probe.position = Math::Vec3(
+            (float)(i % gridSize), (float)((i / gridSize) % gridSize), (float)(i / (gridSize * gridSize)));
+        probes.push_back(probe);
+    }
+    vector<Tetrahedron> tetrahedrons;
+
+    BowyerWatsonDelaunay3D delaunay;
+    BowyerWatsonDelaunay3D::LightProbeVolume volume{probes, tetrahedrons};
+    delaunay.BuildTetrahedralMesh(volume);
+
+    EXPECT_TRUE(ValidateIndices(tetrahedrons, probes.size()));
+    EXPECT_TRUE(ValidateAllPointsCovered(tetrahedrons, probes.size()));
+    float totalVolume = 0.0f;
+    for (const auto& tet : tetrahedrons) {
+        EXPECT_TRUE(ValidateNonDegenerate(tet));
+        totalVolume += CalculateTetrahedronVolume(tet);
+    }
+    const float gridVolume = (float)((gridSize - 1U) * (gridSize - 1U) * (gridSize - 1U));
+    EXPECT_NEAR(totalVolume, gridVolume, gridVolume * 1e-4f);
+    EXPECT_TRUE(ValidateEmptyCircumsphere(tetrahedrons, probes));
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <random>
+#include <util/keyframe_sampler.h>
+
+#include <base/containers/vector.h>
+#include <base/math/quaternion_util.h>
+#include <base/math/spline.h>
+#include <base/math/vector_util.h>
+
+#include "test_framework.h"
+#if defined(UNIT_TESTS_USE_HCPPTEST)
+#include "test_runner_ohos_system.h"
+#else
+#include "test_runner.h"
+#endif
+
+using namespace BASE_NS;
+using namespace CORE3D_NS;
+
+namespace {
+constexpr float TOLERANCE = 0.0001f;
+
+Math::Quat RandomRotation(std::mt19937& generator)
+{
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    return Math::Normalize(Math::Quat(value(generator), value(generator), value(generator), value(generator)));
+}
+
+// Same as the per track interpolation of the animation system.
+Math::Quat RelativeRotation(const Math::Quat& value, const Math::Quat& initial, float weight)
+{
+    return Math::Normalize(Math::Slerp(Math::Quat(0.0f, 0.0f, 0.0f, 1.0f), value * Math::Inverse(initial), weight));
+}
+
+void ExpectNear(const Math::Quat& expected, const Math::Quat& actual)
+{
+    EXPECT_NEAR(expected.x, actual.x, TOLERANCE);
+    EXPECT_NEAR(expected.y, actual.y, TOLERANCE);
+    EXPECT_NEAR(expected.z, actual.z, TOLERANCE);
+    EXPECT_NEAR(expected.w, actual.w, TOLERANCE);
+}
+}  // namespace
+
+/**
+ * @tc.name: FindKeyframeMatchesUpperBound
+ * @tc.desc: Tests that the keyframe search from a cursor gives the same result as a binary search when moving
+ * forward, backward, jumping, and with repeated timestamps.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_UtilKeyframeSampler, FindKeyframeMatchesUpperBound, testing::ext::TestSize.Level1)
+{
+    const vector<float> timestamps{0.0f, 0.5f, 1.0f, 1.0f, 1.5f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+    auto upperBound = [&timestamps](float time) {
+        return static_cast<size_t>(
+            std::upper_bound(timestamps.begin(), timestamps.end(), time) - timestamps.begin());
+    };
+    const float times[]{-1.0f, 0.0f, 0.1f, 0.5f, 0.9f, 1.0f, 1.2f, 2.5f, 7.9f, 8.0f, 9.0f, 0.2f, 5.5f, 1.0f, -0.5f};
+    size_t cursor = 0U;
+    for (const float time : times) {
+        cursor = FindKeyframe(timestamps, time, cursor);
+        EXPECT_EQ(upperBound(time), cursor);
+    }
+    // Playback in both directions with small steps.
+    for (float time = -0.25f; time < 8.5f; time += 0.1f) {
+        cursor = FindKeyframe(timestamps, time, cursor);
+        EXPECT_EQ(upperBound(time), cursor);
+    }
+    for (float time = 8.5f; time > -0.25f; time -= 0.1f) {
+        cursor = FindKeyframe(timestamps, time, cursor);
+        EXPECT_EQ(upperBound(time), cursor);
+    }
+    // Cursor out of range, e.g. from a track which had more keyframes.
+    EXPECT_EQ(upperBound(2.5f), FindKeyframe(timestamps, 2.5f, 100U));
+    EXPECT_EQ(0U, FindKeyframe({}, 1.0f, 3U));
+}
+
+/**
+ * @tc.name: EvaluateVectorTracks
+ * @tc.desc: Tests step, linear and spline interpolation of vector tracks relative to the initial value and scaled
+ * by the weight.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_UtilKeyframeSampler, EvaluateVectorTracks, testing::ext::TestSize.Level1)
+{
+    // Keyframe values, for splines in-tangent, spline vertex and out-tangent.
+    const Math::Vec3 values[]{{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+        {5.0f, 6.0f, 7.0f}, {0.0f, 0.0f, 1.0f}};
+    const Math::Vec3 initial{1.0f, 1.0f, 1.0f};
+    Math::Vec3 step;
+    Math::Vec3 linear;
+    Math::Vec3 spline;
+    const float floatValues[]{2.0f, 4.0f};
+    const float floatInitial = 1.0f;
+    float floatResult = 0.0f;
+
+    KeyframeSampler sampler;
+    sampler.Add(KeyframeSampler::ValueType::VEC3, KeyframeSampler::Mode::STEP,
+        {&values[1U].x, &values[4U].x, &initial.x, &step.x, 0.75f, 0.5f});
+    sampler.Add(KeyframeSampler::ValueType::VEC3, KeyframeSampler::Mode::LINEAR,
+        {&values[1U].x, &values[4U].x, &initial.x, &linear.x, 0.25f, 1.0f});
+    sampler.Add(KeyframeSampler::ValueType::VEC3, KeyframeSampler::Mode::SPLINE,
+        {&values[0U].x, &values[3U].x, &initial.x, &spline.x, 0.5f, 1.0f});
+    sampler.Add(KeyframeSampler::ValueType::FLOAT, KeyframeSampler::Mode::LINEAR,
+        {&floatValues[0U], &floatValues[1U], &floatInitial, &floatResult, 2.0f, 1.0f});
+    EXPECT_FALSE(sampler.Empty());
+    sampler.Evaluate();
+    EXPECT_TRUE(sampler.Empty());
+
+    EXPECT_EQ(Math::Vec3(2.0f, 2.5f, 3.0f), step);
+    EXPECT_EQ(Math::Vec3(1.0f, 2.0f, 3.0f), linear);
+    const Math::Vec3 expectedSpline = Math::Hermite(values[1U], values[2U], values[4U], values[3U], 0.5f) - initial;
+    EXPECT_NEAR(expectedSpline.x, spline.x, TOLERANCE);
+    EXPECT_NEAR(expectedSpline.y, spline.y, TOLERANCE);
+    EXPECT_NEAR(expectedSpline.z, spline.z, TOLERANCE);
+    // t is clamped for linear interpolation.
+    EXPECT_EQ(3.0f, floatResult);
+}
+
+/**
+ * @tc.name: EvaluateRotationTracks
+ * @tc.desc: Tests that rotations evaluated in batches, including a partial batch, match the per track slerp, step
+ * and spline interpolation.
+ * @tc.type: FUNC
+ */
+UNIT_TEST(SRC_UtilKeyframeSampler, EvaluateRotationTracks, testing::ext::TestSize.Level1)
+{
+    constexpr size_t trackCount = 11U;
+    std::mt19937 generator(1U);
+    std::uniform_real_distribution<float> factor(0.0f, 1.0f);
+    // Three values per keyframe for splines, two keyframes per track.
+    vector<Math::Quat> keyframes(trackCount * 6U);
+    for (auto& keyframe : keyframes) {
+        keyframe = RandomRotation(generator);
+    }
+    vector<Math::Quat> initial(trackCount);
+    vector<float> t(trackCount);
+    vector<float> weights(trackCount);
+    for (size_t i = 0U; i < trackCount; ++i) {
+        initial[i] = RandomRotation(generator);
+        t[i] = factor(generator);
+        weights[i] = (i % 2U) ? 1.0f : factor(generator);
+    }
+    // Opposite hemispheres and nearly equal rotations take different paths in slerp.
+    keyframes[3U] = Math::Quat(-keyframes[0U].x, -keyframes[0U].y, -keyframes[0U].z, -keyframes[0U].w);
+    keyframes[9U] = keyframes[6U];
+
+    const KeyframeSampler::Mode modes[]{
+        KeyframeSampler::Mode::STEP, KeyframeSampler::Mode::LINEAR, KeyframeSampler::Mode::SPLINE};
+    for (const auto mode : modes) {
+        vector<Math::Quat> results(trackCount);
+        KeyframeSampler sampler;
+        for (size_t i = 0U; i < trackCount; ++i) {
+            sampler.Add(KeyframeSampler::ValueType::QUAT, mode,
+                {&keyframes[i * 6U].x, &keyframes[i * 6U + 3U].x, &initial[i].x, &results[i].x, t[i], weights[i]});
+        }
+        sampler.Evaluate();
+
+        for (size_t i = 0U; i < trackCount; ++i) {
+            const Math::Quat* start = &keyframes[i * 6U];
+            const Math::Quat* end = &keyframes[i * 6U + 3U];
+            Math::Quat value;
+            if (mode == KeyframeSampler::Mode::STEP) {
+                value = (t[i] > 0.5f) ? *end : *start;
+            } else if (mode == KeyframeSampler::Mode::LINEAR) {
+                value = Math::Slerp(*start, *end, t[i]);
+            } else {
+                const auto toVec4 = [](const Math::Quat& q) { return Math::Vec4(q.x, q.y, q.z, q.w); };
+                const Math::Vec4 spline =
+                    Math::Hermite(toVec4(start[1U]), toVec4(start[2U]), toVec4(end[1U]), toVec4(end[0U]), t[i]);
+                value = Math::Normalize(Math::Quat(spline.x, spline.y, spline.z, spline.w));
+            }
+            ExpectNear(RelativeRotation(value, initial[i], weights[i]), results[i]);
+        }
+    }
+}
@@ -16,6 +16,7 @@
 #include <cmath>
 #include <limits>
 #include <util/bowyer_watson_delaunay_3d.h>
+#include <util/light_probe_locator.h>
 #include <util/light_probe_util.h>
 
 #include <3d/light_probe_types/light_probe.h>
@@ -728,4 +729,105 @@ UNIT_TEST(SRC_LightProbeUtil, GetInterpolatedLightProbeData_ManyProbesLinearRepr
         const float expectedAo = q.x * 0.1f + q.y * 0.1f + q.z * 0.1f;
         EXPECT_NEAR(result.lightProbeInterpolatedData.bentNormalAo.w, expectedAo, 0.01f);
     }
-}
\ No newline at end of file
+}
+// Walking the adjacency and the k-d tree must give the same results as the linear searches, inside and outside of
+// the volume and wherever the walk starts.
+UNIT_TEST(SRC_LightProbeUtil, GetInterpolatedLightProbeData_LocatorMatchesLinear, testing::ext::TestSize.Level1)
+{
+    vector<LightProbeGroupComponent::LightProbe> probes;
+    for (uint32_t z = 0; z < 4; ++z) {
+        for (uint32_t y = 0; y < 4; ++y) {
+            for (uint32_t x = 0; x < 4; ++x) {
+                LightProbeGroupComponent::LightProbe p;
+                // Jitter to avoid ambiguous triangulation of the grid.
+                const float jitter = (float)((x * 7U + y * 13U + z * 5U) % 11U) * 0.02f;
+                p.position = Math::Vec3((float)x + jitter, (float)y - jitter, (float)z + jitter * 0.5f);
+                for (uint32_t i = 0; i < LightProbeConstants::LIGHT_PROBE_SH_COEFFICIENT_COUNT; ++i) {
+                    p.shCoefficients[i] = Math::Vec3((float)x, (float)y, (float)z);
+                }
+                p.bentNormal = Math::Vec3(0.0f, 1.0f, 0.0f);
+                p.ao = (float)(x + y + z) * 0.1f;
+                probes.push_back(p);
+            }
+        }
+    }
+
+    vector<Tetrahedron> tets;
+    vector<TetrahedronAdjacency> adjacency;
+    BowyerWatsonDelaunay3D delaunay;
+    BowyerWatsonDelaunay3D::LightProbeVolume buildVolume{probes, tets, &adjacency};
+    delaunay.BuildTetrahedralMesh(buildVolume);
+    ASSERT_GT(tets.size(), 0u);
+
+    LightProbeVolume volume;
+    volume.lightProbes = probes;
+    volume.tetrahedrons = tets;
+    LightProbeLocator locator;
+    locator.Build(volume, adjacency);
+    EXPECT_TRUE(locator.IsBuiltFor(volume));
+
+    const Math::Vec3 queries[] = {
+        {1.5f, 1.5f, 1.5f},
+        {0.3f, 2.6f, 0.8f},
+        {2.7f, 0.4f, 2.2f},
+        {1.1f, 1.2f, 2.9f},
+        {-2.0f, 1.0f, 1.0f},
+        {5.0f, 6.0f, -3.0f},
+    };
+    for (uint32_t start = 0; start < tets.size(); start += 7U) {
+        uint32_t hint = start;
+        for (const auto& q : queries) {
+            const LightProbeInterpolatedDataOpt expected = LightProbeUtil::GetInterpolatedLightProbeData(volume, q);
+            const LightProbeInterpolatedDataOpt result =
+                LightProbeUtil::GetInterpolatedLightProbeData(volume, locator, q, hint);
+            ASSERT_EQ(result.valid, expected.valid);
+            EXPECT_LT(hint, tets.size());
+            for (uint32_t i = 0; i < LightProbeConstants::LIGHT_PROBE_SH_COEFFICIENT_COUNT; ++i) {
+                const auto& sh = result.lightProbeInterpolatedData.shCoefficients[i];
+                const auto& expectedSh = expected.lightProbeInterpolatedData.shCoefficients[i];
+                EXPECT_NEAR(sh.x, expectedSh.x, 0.001f);
+                EXPECT_NEAR(sh.y, expectedSh.y, 0.001f);
+                EXPECT_NEAR(sh.z, expectedSh.z, 0.001f);
+            }
+            EXPECT_NEAR(
+                result.lightProbeInterpolatedData.bentNormalAo.w, expected.lightProbeInterpolatedData.bentNormalAo.w,
+                0.001f);
+        }
+    }
+}
+
+// Without tetrahedrons the k-d tree finds the same probes as the linear search.
+UNIT_TEST(SRC_LightProbeUtil, LightProbeLocator_FindNearestProbes, testing::ext::TestSize.Level1)
+{
+    vector<LightProbeGroupComponent::LightProbe> probes;
+    for (uint32_t i = 0; i < 200; ++i) {
+        LightProbeGroupComponent::LightProbe p;
+        p.position = Math::Vec3((float)((i * 37U) % 101U), (float)((i * 53U) % 97U), (float)((i * 29U) % 89U));
+        probes.push_back(p);
+    }
+    LightProbeVolume volume;
+    volume.lightProbes = probes;
+    LightProbeLocator locator;
+    locator.Build(volume, {});
+
+    const Math::Vec3 queries[] = {{50.0f, 50.0f, 50.0f}, {-10.0f, 0.0f, 200.0f}, {3.0f, 90.0f, 17.0f}};
+    for (const auto& q : queries) {
+        LightProbeLocator::NearestProbe nearest[3];
+        ASSERT_EQ(locator.FindNearestProbes(q, nearest), 3u);
+        float previous = 0.0f;
+        for (const auto& found : nearest) {
+            ASSERT_LT(found.index, probes.size());
+            EXPECT_NEAR(found.distance, Math::distance(q, probes[found.index].position), 0.001f);
+            EXPECT_GE(found.distance, previous);
+            previous = found.distance;
+        }
+        // Nothing closer than the third one was missed.
+        uint32_t closer = 0;
+        for (const auto& p : probes) {
+            if (Math::distance(q, p.position) < nearest[2].distance) {
+                ++closer;
+            }
+        }
+        EXPECT_LE(closer, 2u);
+    }
+}